@@ -0,0 +1,155 @@
+// Measures method channel marshalling and status event throughput against
+// the real plugin. The status event benchmarks need a plugin built with
+// include_flutter_zoom_meeting_sdk_benchmark_hooks, so run on Linux with
+//
+//   flutter build linux --profile
+//   cmake -Dinclude_flutter_zoom_meeting_sdk_benchmark_hooks=ON \
+//       build/linux/x64/profile
+//   flutter drive --profile --driver=test_driver/integration_test.dart \
+//       --target=integration_test/channel_benchmark_test.dart -d linux
+//
+// Results are written to build/integration_response_data.json.
+
+import 'dart:async';
+import 'dart:convert';
+import 'dart:developer';
+
+import 'package:flutter/services.dart';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_method_channel.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_options_codec.dart';
+import 'package:integration_test/integration_test.dart';
+
+const MethodChannel _channel =
+    MethodChannel('plugins.flutter_zoom_meeting_sdk/zoom_channel');
+
+final ZoomMeetingOptions _joinOptions = ZoomMeetingOptions(
+  userId: 'bot',
+  meetingId: '84512345678',
+  meetingPassword: 's3cr3t',
+  disableDialIn: 'true',
+  disableDrive: 'true',
+  disableInvite: 'true',
+  disableShare: 'false',
+  noDisconnectAudio: 'false',
+  noAudio: 'false',
+  meetingViewOptions: ZoomMeetingOptions.noTextPassword,
+);
+
+/// Returns the [fraction] percentile of [samples], which must be sorted.
+int _percentile(List<int> samples, double fraction) {
+  final index = ((samples.length - 1) * fraction).round();
+  return samples[index];
+}
+
+Map<String, Object> _summary(List<int> samplesUs) {
+  samplesUs.sort();
+  return {
+    'samples': samplesUs.length,
+    'p50Us': _percentile(samplesUs, 0.5),
+    'p99Us': _percentile(samplesUs, 0.99),
+    'maxUs': samplesUs.last,
+  };
+}
+
+/// Builds and encodes the "join" call [iterations] times, then decodes it
+/// as often, with the options packed or as a string map.
+Map<String, Object> _benchmarkJoinCodec(int iterations,
+    {required bool packed}) {
+  const codec = StandardMethodCodec();
+  Object arguments() => packed
+      ? PackedMeetingOptions.encode(_joinOptions, withHostFields: false)
+      : MethodChannelZoom.joinArguments(_joinOptions);
+  final encoded = codec.encodeMethodCall(MethodCall('join', arguments()));
+
+  final encode = Stopwatch()..start();
+  for (var i = 0; i < iterations; i++) {
+    codec.encodeMethodCall(MethodCall('join', arguments()));
+  }
+  encode.stop();
+
+  final decode = Stopwatch()..start();
+  for (var i = 0; i < iterations; i++) {
+    codec.decodeMethodCall(encoded);
+  }
+  decode.stop();
+
+  return {
+    'bytes': encoded.lengthInBytes,
+    'encodeNsPerCall': encode.elapsedMicroseconds * 1000 ~/ iterations,
+    'decodeNsPerCall': decode.elapsedMicroseconds * 1000 ~/ iterations,
+  };
+}
+
+/// Times [iterations] "meeting_status" calls from Dart to the plugin and
+/// back.
+Future<Map<String, Object>> _benchmarkRoundTrip(
+    FlutterZoomMeetingSdk zoom, int iterations) async {
+  final samples = <int>[];
+  for (var i = 0; i < iterations; i++) {
+    final start = Timeline.now;
+    await zoom.meetingStatus('');
+    samples.add(Timeline.now - start);
+  }
+  return _summary(samples);
+}
+
+/// Has the plugin emit [count] status events [intervalUs] apart and
+/// measures delivery to a zoom_status_events listener. Event timestamps and
+/// Timeline.now share the monotonic clock.
+Future<Map<String, Object>> _benchmarkStatusEvents(
+    FlutterZoomMeetingSdk zoom, int count, int intervalUs) async {
+  final before = await zoom.eventQueueStats();
+  final latencies = <int>[];
+  int? firstUs;
+  int? lastUs;
+  final subscription = zoom.onMeetingStatusEvent.listen((event) {
+    final now = Timeline.now;
+    firstUs ??= event.timestampUs;
+    lastUs = now;
+    latencies.add(now - event.timestampUs);
+  });
+  // Let the binary channel handler register before the burst.
+  await Future<void>.delayed(const Duration(milliseconds: 100));
+
+  await _channel.invokeMethod<int>('emit_benchmark_events', <String, String>{
+    'count': '$count',
+    'intervalUs': '$intervalUs',
+  });
+  // Events still queued for the main loop arrive after the response.
+  await Future<void>.delayed(const Duration(milliseconds: 500));
+  await subscription.cancel();
+  final after = await zoom.eventQueueStats();
+
+  final received = latencies.length;
+  final elapsedUs = (lastUs ?? 0) - (firstUs ?? 0);
+  return {
+    'emitted': count,
+    'intervalUs': intervalUs,
+    'received': received,
+    'dropped': after['dropped']! - before['dropped']!,
+    'eventsPerSecond': elapsedUs > 0 ? received * 1000000 ~/ elapsedUs : 0,
+    'latency': received > 0 ? _summary(latencies) : <String, Object>{},
+  };
+}
+
+void main() {
+  final binding = IntegrationTestWidgetsFlutterBinding.ensureInitialized();
+
+  testWidgets('channel benchmark', (WidgetTester tester) async {
+    final zoom = FlutterZoomMeetingSdk();
+    final results = <String, Object>{
+      'joinCodec': _benchmarkJoinCodec(20000, packed: false),
+      'joinCodecPacked': _benchmarkJoinCodec(20000, packed: true),
+      'methodRoundTrip': await _benchmarkRoundTrip(zoom, 2000),
+      // As fast as the plugin can emit: throughput and queue drops.
+      'statusEventBurst': await _benchmarkStatusEvents(zoom, 20000, 0),
+      // Paced at 5000 events/s: delivery latency.
+      'statusEventPaced': await _benchmarkStatusEvents(zoom, 2000, 200),
+    };
+    binding.reportData = results;
+    // ignore: avoid_print
+    print(jsonEncode(results));
+  });
+}
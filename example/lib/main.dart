@@ -4,7 +4,14 @@ import 'dart:async';
 import 'package:flutter/services.dart';
 import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk.dart';
 
-void main() {
+import 'meeting_wall.dart';
+
+void main(List<String> args) {
+  // The Linux runner opens a window per --meeting=<id> on one engine.
+  if (args.any((arg) => arg.startsWith('--meeting='))) {
+    runWidget(const MeetingWall());
+    return;
+  }
   runApp(const MyApp());
 }
 
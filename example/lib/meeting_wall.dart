@@ -0,0 +1,105 @@
+import 'dart:async';
+
+import 'package:flutter/material.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk.dart';
+
+/// One window per meeting given with `--meeting=<id>`, all drawn by the same
+/// engine. The Linux runner opens a view for each meeting and binds it to
+/// the meeting's ID; every view here looks its meeting up by view ID.
+class MeetingWall extends StatefulWidget {
+  const MeetingWall({super.key});
+
+  @override
+  State<MeetingWall> createState() => _MeetingWallState();
+}
+
+class _MeetingWallState extends State<MeetingWall> with WidgetsBindingObserver {
+  @override
+  void initState() {
+    super.initState();
+    WidgetsBinding.instance.addObserver(this);
+  }
+
+  @override
+  void dispose() {
+    WidgetsBinding.instance.removeObserver(this);
+    super.dispose();
+  }
+
+  // Views are added and removed as the runner opens and closes windows.
+  @override
+  void didChangeMetrics() {
+    setState(() {});
+  }
+
+  @override
+  Widget build(BuildContext context) {
+    return ViewCollection(
+      views: [
+        for (final view in WidgetsBinding.instance.platformDispatcher.views)
+          View(view: view, child: const MeetingMonitor()),
+      ],
+    );
+  }
+}
+
+/// Shows the status of the meeting bound to the view it is in.
+class MeetingMonitor extends StatefulWidget {
+  const MeetingMonitor({super.key});
+
+  @override
+  State<MeetingMonitor> createState() => _MeetingMonitorState();
+}
+
+class _MeetingMonitorState extends State<MeetingMonitor> {
+  final _zoomPlugin = FlutterZoomMeetingSdk();
+  String? _meetingId;
+  String _status = 'MEETING_STATUS_IDLE';
+  StreamSubscription<dynamic>? _statusSubscription;
+
+  @override
+  void didChangeDependencies() {
+    super.didChangeDependencies();
+    _bind(View.of(context).viewId);
+  }
+
+  Future<void> _bind(int viewId) async {
+    final bindings = await _zoomPlugin.viewBindings();
+    final meetingId = bindings[viewId];
+    if (!mounted || meetingId == null || meetingId == _meetingId) return;
+    _meetingId = meetingId;
+    await _statusSubscription?.cancel();
+    _statusSubscription =
+        _zoomPlugin.onMeetingStateChangedFor(meetingId).listen((event) {
+      if (!mounted) return;
+      setState(() {
+        _status = (event as List)[0] as String;
+      });
+    });
+    final status = await _zoomPlugin.meetingStatus(meetingId);
+    if (!mounted || status.isEmpty) return;
+    setState(() {
+      _status = status[0] as String;
+    });
+  }
+
+  @override
+  void dispose() {
+    _statusSubscription?.cancel();
+    super.dispose();
+  }
+
+  @override
+  Widget build(BuildContext context) {
+    return MaterialApp(
+      theme: ThemeData(
+        colorScheme: ColorScheme.fromSeed(seedColor: Colors.blue),
+        useMaterial3: true,
+      ),
+      home: Scaffold(
+        appBar: AppBar(title: Text('Meeting ${_meetingId ?? '-'}')),
+        body: Center(child: Text(_status)),
+      ),
+    );
+  }
+}
@@ -6,6 +6,10 @@
 
 #include "generated_plugin_registrant.h"
 
+#include <flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_plugin.h>
 
 void fl_register_plugins(FlPluginRegistry* registry) {
+  g_autoptr(FlPluginRegistrar) flutter_zoom_meeting_sdk_registrar =
+      fl_plugin_registry_get_registrar_for_plugin(registry, "FlutterZoomMeetingSdkPlugin");
+  flutter_zoom_meeting_sdk_plugin_register_with_registrar(flutter_zoom_meeting_sdk_registrar);
 }
@@ -3,6 +3,7 @@
 #
 
 list(APPEND FLUTTER_PLUGIN_LIST
+  flutter_zoom_meeting_sdk
 )
 
 list(APPEND FLUTTER_FFI_PLUGIN_LIST
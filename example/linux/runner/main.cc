@@ -1,6 +1,9 @@
+#include <flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_plugin.h>
+
 #include "my_application.h"
 
 int main(int argc, char** argv) {
+  flutter_zoom_meeting_sdk_plugin_mark_startup("main");
   g_autoptr(MyApplication) app = my_application_new();
   return g_application_run(G_APPLICATION(app), argc, argv);
 }
@@ -1,29 +1,68 @@
 #include "my_application.h"
 
+#include <cstring>
+
 #include <flutter_linux/flutter_linux.h>
 #ifdef GDK_WINDOWING_X11
 #include <gdk/gdkx.h>
 #endif
 
+#include <flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_plugin.h>
+
 #include "flutter/generated_plugin_registrant.h"
 
+// Opens a window for the given meeting ID. Repeat it to watch several
+// meetings: every window is a view on the same engine. The flag is passed
+// on to Dart as well.
+static constexpr char kMeetingFlagPrefix[] = "--meeting=";
+
 struct _MyApplication {
   GtkApplication parent_instance;
   char** dart_entrypoint_arguments;
+  // Meeting IDs given with kMeetingFlagPrefix, NULL-terminated.
+  char** meeting_ids;
 };
 
 G_DEFINE_TYPE(MyApplication, my_application, GTK_TYPE_APPLICATION)
 
+// Passes the plugin settings given in the environment on before the plugins
+// are registered.
+static void configure_plugin() {
+  // Kiosk deployments can start SDK initialization while Dart boots by
+  // providing the init parameters in the environment.
+  const gchar* warm_up_domain = g_getenv("ZOOM_WARM_UP_DOMAIN");
+  if (warm_up_domain != nullptr) {
+    flutter_zoom_meeting_sdk_plugin_set_warm_up_init(
+        warm_up_domain, g_getenv("ZOOM_WARM_UP_JWT_TOKEN"),
+        g_getenv("ZOOM_WARM_UP_APP_KEY"), g_getenv("ZOOM_WARM_UP_APP_SECRET"));
+  }
+
+  // Load and soak runs replace the meeting backend with a scenario replay.
+  const gchar* simulator_scenario = g_getenv("ZOOM_SIMULATOR_SCENARIO");
+  if (simulator_scenario != nullptr) {
+    flutter_zoom_meeting_sdk_plugin_set_simulator_scenario(simulator_scenario);
+  }
+}
+
 // Called when first Flutter frame received.
 static void first_frame_cb(MyApplication* self, FlView* view) {
+  flutter_zoom_meeting_sdk_plugin_mark_startup("first_frame");
   gtk_widget_show(gtk_widget_get_toplevel(GTK_WIDGET(view)));
 }
 
-// Implements GApplication::activate.
-static void my_application_activate(GApplication* application) {
-  MyApplication* self = MY_APPLICATION(application);
+// Forgets the meeting of a view whose window closed.
+static void view_destroy_cb(FlView* view, gpointer user_data) {
+  flutter_zoom_meeting_sdk_plugin_bind_view(fl_view_get_id(view), nullptr);
+}
+
+// Puts |view| in a new window titled |title| and binds it to |meeting_id|,
+// if any. The window is shown when the view renders its first frame.
+static void add_view_window(MyApplication* self,
+                            FlView* view,
+                            const gchar* title,
+                            const gchar* meeting_id) {
   GtkWindow* window =
-      GTK_WINDOW(gtk_application_window_new(GTK_APPLICATION(application)));
+      GTK_WINDOW(gtk_application_window_new(GTK_APPLICATION(self)));
 
   // Use a header bar when running in GNOME as this is the common style used
   // by applications and is the setup most users will be using (e.g. Ubuntu
@@ -45,20 +84,15 @@ static void my_application_activate(GApplication* application) {
   if (use_header_bar) {
     GtkHeaderBar* header_bar = GTK_HEADER_BAR(gtk_header_bar_new());
     gtk_widget_show(GTK_WIDGET(header_bar));
-    gtk_header_bar_set_title(header_bar, "flutter_zoom_meeting_sdk_example");
+    gtk_header_bar_set_title(header_bar, title);
     gtk_header_bar_set_show_close_button(header_bar, TRUE);
     gtk_window_set_titlebar(window, GTK_WIDGET(header_bar));
   } else {
-    gtk_window_set_title(window, "flutter_zoom_meeting_sdk_example");
+    gtk_window_set_title(window, title);
   }
 
   gtk_window_set_default_size(window, 1280, 720);
 
-  g_autoptr(FlDartProject) project = fl_dart_project_new();
-  fl_dart_project_set_dart_entrypoint_arguments(
-      project, self->dart_entrypoint_arguments);
-
-  FlView* view = fl_view_new(project);
   GdkRGBA background_color;
   // Background defaults to black, override it here if necessary, e.g. #00000000
   // for transparent.
@@ -73,7 +107,43 @@ static void my_application_activate(GApplication* application) {
                            self);
   gtk_widget_realize(GTK_WIDGET(view));
 
+  if (meeting_id != nullptr) {
+    flutter_zoom_meeting_sdk_plugin_bind_view(fl_view_get_id(view),
+                                              meeting_id);
+    g_signal_connect(view, "destroy", G_CALLBACK(view_destroy_cb), nullptr);
+  }
+}
+
+// Implements GApplication::activate.
+static void my_application_activate(GApplication* application) {
+  flutter_zoom_meeting_sdk_plugin_mark_startup("activate");
+  MyApplication* self = MY_APPLICATION(application);
+
+  g_autoptr(FlDartProject) project = fl_dart_project_new();
+  fl_dart_project_set_dart_entrypoint_arguments(
+      project, self->dart_entrypoint_arguments);
+
+  // The first window owns the engine; each further meeting gets a view on
+  // it rather than an engine of its own.
+  const gchar* first_meeting = self->meeting_ids[0];
+  FlView* view = fl_view_new(project);
+  add_view_window(self, view,
+                  first_meeting != nullptr ? first_meeting
+                                           : "flutter_zoom_meeting_sdk_example",
+                  first_meeting);
+
+  configure_plugin();
+
+  flutter_zoom_meeting_sdk_plugin_mark_startup("register_plugins");
   fl_register_plugins(FL_PLUGIN_REGISTRY(view));
+  flutter_zoom_meeting_sdk_plugin_mark_startup("plugins_registered");
+
+  FlEngine* engine = fl_view_get_engine(view);
+  for (char** meeting_id = self->meeting_ids + (first_meeting != nullptr);
+       *meeting_id != nullptr; ++meeting_id) {
+    add_view_window(self, fl_view_new_for_engine(engine), *meeting_id,
+                    *meeting_id);
+  }
 
   gtk_widget_grab_focus(GTK_WIDGET(view));
 }
@@ -84,7 +154,22 @@ static gboolean my_application_local_command_line(GApplication* application,
                                                   int* exit_status) {
   MyApplication* self = MY_APPLICATION(application);
   // Strip out the first argument as it is the binary name.
-  self->dart_entrypoint_arguments = g_strdupv(*arguments + 1);
+  GPtrArray* dart_arguments = g_ptr_array_new();
+  GPtrArray* meeting_ids = g_ptr_array_new();
+  for (gchar** argument = *arguments + 1; *argument != nullptr; ++argument) {
+    if (g_str_has_prefix(*argument, kMeetingFlagPrefix) &&
+        (*argument)[strlen(kMeetingFlagPrefix)] != '\0') {
+      g_ptr_array_add(meeting_ids,
+                      g_strdup(*argument + strlen(kMeetingFlagPrefix)));
+    }
+    g_ptr_array_add(dart_arguments, g_strdup(*argument));
+  }
+  g_ptr_array_add(dart_arguments, nullptr);
+  self->dart_entrypoint_arguments =
+      reinterpret_cast<char**>(g_ptr_array_free(dart_arguments, FALSE));
+  g_ptr_array_add(meeting_ids, nullptr);
+  self->meeting_ids =
+      reinterpret_cast<char**>(g_ptr_array_free(meeting_ids, FALSE));
 
   g_autoptr(GError) error = nullptr;
   if (!g_application_register(application, nullptr, &error)) {
@@ -121,6 +206,7 @@ static void my_application_shutdown(GApplication* application) {
 static void my_application_dispose(GObject* object) {
   MyApplication* self = MY_APPLICATION(object);
   g_clear_pointer(&self->dart_entrypoint_arguments, g_strfreev);
+  g_clear_pointer(&self->meeting_ids, g_strfreev);
   G_OBJECT_CLASS(my_application_parent_class)->dispose(object);
 }
 
@@ -2,24 +2,280 @@ import 'dart:async';
 
 import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_platform_interface.dart';
 export 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_platform_interface.dart'
-    show ZoomOptions, ZoomMeetingOptions;
+    show
+        ZoomOptions,
+        ZoomMeetingOptions,
+        MeetingStatus,
+        MeetingStatusEvent,
+        GalleryLayout,
+        GalleryTile,
+        ZoomAudioStream,
+        ActiveSpeakerChange,
+        TokenExpiring,
+        FramePoolStats,
+        FramePoolClassStats,
+        MemoryStats,
+        MemoryCategoryStats,
+        MemoryPressure,
+        MemoryPressureChange,
+        VideoStats,
+        VideoFrameStats,
+        RosterDeltaType,
+        RosterDelta,
+        RosterSnapshot,
+        RosterParticipant,
+        ParticipantRoster;
 
 class FlutterZoomMeetingSdk {
+  /// On Linux, [ZoomOptions.jwtToken] may be left out once a valid token
+  /// for the app key has been cached by an earlier call or [setAuthToken].
+  /// A token that has already expired fails with
+  /// `ZOOM_ERROR_AUTHRET_TOKENWRONG` without reaching the SDK.
   Future<List> init(ZoomOptions options) async =>
       ZoomPlatform.instance.initZoom(options);
 
+  /// Caches a freshly issued SDK token for its app key, ready for the next
+  /// [init]. Returns false if it is not a JWT with `iat` and `exp` claims or
+  /// has already expired. Only supported by the Linux plugin.
+  Future<bool> setAuthToken(String jwtToken) =>
+      ZoomPlatform.instance.setAuthToken(jwtToken);
+
+  /// Cached SDK tokens due to be replaced, a few minutes before they
+  /// expire. Tokens minted together come due at slightly different times,
+  /// so a fleet does not fetch new ones all at once. Only supported by the
+  /// Linux plugin.
+  Stream<TokenExpiring> get onTokenExpiring =>
+      ZoomPlatform.instance.onTokenExpiring();
+
   Future<bool> startMeeting(ZoomMeetingOptions options) async =>
       ZoomPlatform.instance.startMeeting(options);
 
   Future<bool> joinMeeting(ZoomMeetingOptions options) async =>
       ZoomPlatform.instance.joinMeeting(options);
 
+  /// Leaves [meetingId] while staying in any other meeting. Only supported
+  /// by the Linux plugin.
+  Future<bool> leaveMeeting(String meetingId) =>
+      ZoomPlatform.instance.leaveMeeting(meetingId);
+
+  /// The ID of every meeting being attended, mapped to its session ID as
+  /// reported in [MeetingStatusEvent.sessionId]. Only supported by the Linux
+  /// plugin.
+  Future<Map<String, int>> meetingSessions() =>
+      ZoomPlatform.instance.meetingSessions();
+
+  /// Batches of participant roster changes from every meeting, in order.
+  /// Only supported by the Linux plugin; see [watchParticipants].
+  Stream<List<RosterDelta>> get onParticipantDeltas =>
+      ZoomPlatform.instance.onParticipantDeltas();
+
+  /// The roster changes after [sinceSequence], or the whole roster if
+  /// some of them are no longer kept. Only supported by the Linux plugin.
+  Future<RosterSnapshot> participantSnapshot({int sinceSequence = 0}) =>
+      ZoomPlatform.instance.participantSnapshot(sinceSequence);
+
+  /// A [ParticipantRoster] of every meeting, emitted again after each batch
+  /// of changes. Missed changes are caught up with [participantSnapshot],
+  /// so the work per batch follows the number of changes, not of
+  /// participants. Only supported by the Linux plugin.
+  Stream<ParticipantRoster> watchParticipants() async* {
+    final roster = ParticipantRoster();
+    final batches = StreamIterator(onParticipantDeltas);
+    try {
+      roster.applySnapshot(await participantSnapshot());
+      yield roster;
+      while (await batches.moveNext()) {
+        if (!roster.apply(batches.current)) {
+          roster.applySnapshot(
+              await participantSnapshot(sinceSequence: roster.sequence));
+          roster.apply(batches.current);
+        }
+        yield roster;
+      }
+    } finally {
+      await batches.cancel();
+    }
+  }
+
+  /// The meeting each Flutter view shows, keyed by view ID, as bound by the
+  /// runner or [bindView]. A runner watching several meetings opens a view
+  /// per meeting on one engine; each view finds its meeting with
+  /// `View.of(context).viewId`. Only supported by the Linux plugin.
+  Future<Map<int, String>> viewBindings() =>
+      ZoomPlatform.instance.viewBindings();
+
+  /// Binds the view [viewId] to [meetingId], or unbinds it if [meetingId]
+  /// is null. Only supported by the Linux plugin.
+  Future<bool> bindView(int viewId, String? meetingId) =>
+      ZoomPlatform.instance.bindView(viewId, meetingId);
+
+  /// On Linux, [meetingId]'s status, or `MEETING_STATUS_IDLE` if it is not
+  /// being attended. An empty [meetingId] asks for the latest status, which
+  /// Linux answers with `MEETING_STATUS_UNKNOWN` while several meetings are
+  /// open. Other platforms report their only meeting.
   Future<List> meetingStatus(String meetingId) =>
       ZoomPlatform.instance.meetingStatus(meetingId);
 
+  /// The latest status change, read from the plugin's cached state without
+  /// asking the SDK. Only supported by the Linux plugin.
+  Future<MeetingStatusEvent?> meetingState() =>
+      ZoomPlatform.instance.meetingState();
+
+  /// Waits until the status moves past [sinceSequence], or for [timeout]
+  /// (at most a minute), and returns the latest status either way. Pass the
+  /// returned event's sequence back in to poll for the next change without
+  /// missing any. Only supported by the Linux plugin.
+  Future<MeetingStatusEvent?> waitForStatusChange(int sinceSequence,
+          {Duration timeout = const Duration(seconds: 30)}) =>
+      ZoomPlatform.instance
+          .waitForStatusChange(sinceSequence, timeout: timeout);
+
   Stream<dynamic> get onMeetingStateChanged =>
       ZoomPlatform.instance.onMeetingStatus();
 
+  /// Status changes of [meetingId] alone. The Linux plugin appends the
+  /// meeting ID to each status event; events without one are dropped.
+  Stream<dynamic> onMeetingStateChangedFor(String meetingId) =>
+      ZoomPlatform.instance.onMeetingStatus().where((event) =>
+          event is List && event.length > 2 && event[2] == meetingId);
+
+  /// Typed status changes decoded from the compact binary channel. Only
+  /// supported by the Linux plugin.
+  Stream<MeetingStatusEvent> get onMeetingStatusEvent =>
+      ZoomPlatform.instance.onMeetingStatusEvent();
+
+  /// Renders [participantId]'s video into a Flutter texture and returns its
+  /// ID for use with a `Texture` widget, or -1 if the video is unavailable,
+  /// as it always is on an engine without a view. Only supported by the
+  /// Linux plugin.
+  Future<int> subscribeVideo(String participantId) =>
+      ZoomPlatform.instance.subscribeVideo(participantId);
+
+  /// Stops [participantId]'s video and releases its texture.
+  Future<bool> unsubscribeVideo(String participantId) =>
+      ZoomPlatform.instance.unsubscribeVideo(participantId);
+
+  /// Reports how large [participantId]'s texture is drawn, in physical
+  /// pixels, so frames are scaled down to that size before upload instead
+  /// of converting and uploading full-resolution video for a small tile.
+  /// Call it again whenever the widget is resized; 0 x 0 restores full
+  /// resolution. Returns false if the video is not subscribed. Only
+  /// supported by the Linux plugin.
+  Future<bool> setVideoDisplaySize(
+          String participantId, int width, int height) =>
+      ZoomPlatform.instance.setVideoDisplaySize(participantId, width, height);
+
+  /// Composites every participant in [layout] into one texture and returns
+  /// its ID, or -1 if the layout is invalid. The same texture is reused for
+  /// later layouts. Participants with their own texture from
+  /// [subscribeVideo] cannot be in the gallery. Only supported by the Linux
+  /// plugin.
+  Future<int> setGalleryLayout(GalleryLayout layout) =>
+      ZoomPlatform.instance.setGalleryLayout(layout);
+
+  /// Stops all gallery video and releases the gallery texture.
+  Future<bool> clearGallery() => ZoomPlatform.instance.clearGallery();
+
+  /// Opens 16 kHz mono PCM for [participantId], or for the meeting mix by
+  /// default. Returns null if audio is unavailable. Only supported by the
+  /// Linux plugin.
+  Future<ZoomAudioStream?> openAudioStream(
+          [String participantId = ZoomAudioStream.mixed]) =>
+      ZoomAudioStream.open(
+        participantId,
+        subscribe: () => ZoomPlatform.instance.subscribeAudio(participantId),
+        unsubscribe: () =>
+            ZoomPlatform.instance.unsubscribeAudio(participantId),
+        notifications: ZoomPlatform.instance.onAudioDataAvailable(),
+      );
+
+  /// Starts or stops detecting who is speaking in each participant's raw
+  /// audio, natively and without sending the audio to Dart. Returns false
+  /// if audio is unavailable. Only supported by the Linux plugin.
+  Future<bool> setSpeakerDetection(bool enabled) =>
+      ZoomPlatform.instance.setSpeakerDetection(enabled);
+
+  /// Who is speaking, sent only when it changes while speaker detection is
+  /// on. The active speaker changes when they stop or another speaker is
+  /// clearly louder for a moment, so it suits speaker-follow layouts.
+  Stream<ActiveSpeakerChange> get onActiveSpeakerChanged =>
+      ZoomPlatform.instance.onActiveSpeakerChanged();
+
+  /// Starts recording the raw audio of every participant, and the meeting
+  /// mix, into segment files in [directory] on a native writer thread. The
+  /// recording never holds up media delivery: records that cannot be
+  /// queued are dropped and counted in [recordingStats]. Only supported by
+  /// the Linux plugin.
+  Future<bool> startRecording(String directory) =>
+      ZoomPlatform.instance.startRecording(directory);
+
+  /// Adds [participantId]'s video to the recording. Fails while the
+  /// participant has a texture from [subscribeVideo] or is in the gallery.
+  Future<bool> recordVideo(String participantId) =>
+      ZoomPlatform.instance.recordVideo(participantId);
+
+  /// Stops recording once everything queued is written and the last
+  /// segment finished. Returns false if nothing was recording or writing
+  /// failed.
+  Future<bool> stopRecording() => ZoomPlatform.instance.stopRecording();
+
+  /// Records written and dropped, bytes written, segments finished and
+  /// whether writing failed (1) for the recording in progress.
+  Future<Map<String, int>> recordingStats() =>
+      ZoomPlatform.instance.recordingStats();
+
+  /// Memory held by the native pool that received video frames are
+  /// allocated from, in total and for each buffer size. Only supported by
+  /// the Linux plugin.
+  Future<FramePoolStats> framePoolStats() =>
+      ZoomPlatform.instance.framePoolStats();
+
+  /// Memory the native plugin holds for video frames, textures, audio
+  /// rings, the roster, event queues and recording, now and at its peak,
+  /// and the resident set of the process. Only supported by the Linux
+  /// plugin.
+  Future<MemoryStats> getMemoryStats() =>
+      ZoomPlatform.instance.getMemoryStats();
+
+  /// Sets soft budgets for the memory the plugin tracks and for the
+  /// resident set of the whole process; a missing or zero budget is not
+  /// enforced. Going over either sheds video resolution, live gallery tiles
+  /// and roster history until memory is back under 90% of the budget, see
+  /// [MemoryPressure]. Only supported by the Linux plugin.
+  Future<bool> setMemoryBudget({int? pluginBytes, int? rssBytes}) =>
+      ZoomPlatform.instance
+          .setMemoryBudget(pluginBytes: pluginBytes, rssBytes: rssBytes);
+
+  /// Changes of [MemoryPressure] while a budget is set. Only supported by
+  /// the Linux plugin.
+  Stream<MemoryPressureChange> get onMemoryPressure =>
+      ZoomPlatform.instance.onMemoryPressure();
+
+  /// Frames produced, displayed and dropped, and how old displayed frames
+  /// were, for each participant texture and the gallery. Only supported by
+  /// the Linux plugin.
+  Future<VideoStats> videoStats() => ZoomPlatform.instance.videoStats();
+
+  /// Counters for the native status event queue: depth, coalesced events
+  /// and drain latency. Only supported by the Linux plugin.
+  Future<Map<String, int>> eventQueueStats() =>
+      ZoomPlatform.instance.eventQueueStats();
+
+  /// Startup milestones reached so far, such as `first_frame` and
+  /// `sdk_init_complete`, in microseconds since the process started. Only
+  /// supported by the Linux plugin.
+  Future<Map<String, int>> startupTimeline() =>
+      ZoomPlatform.instance.startupTimeline();
+
+  /// Starts recording trace spans in Dart, in the method channel and in the
+  /// native plugin, discarding any previous trace. Only supported by the
+  /// Linux plugin.
+  Future<bool> startTrace() => ZoomPlatform.instance.startTrace();
+
+  /// Stops tracing and writes everything recorded since [startTrace] to
+  /// [path] as Chrome trace JSON, for chrome://tracing or Perfetto.
+  Future<bool> dumpTrace(String path) => ZoomPlatform.instance.dumpTrace(path);
+
   Future<String?> getPlatformVersion() {
     return ZoomPlatform.instance.getPlatformVersion();
   }
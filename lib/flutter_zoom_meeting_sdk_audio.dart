@@ -0,0 +1,207 @@
+import 'dart:async';
+import 'dart:ffi';
+import 'dart:typed_data';
+
+/// Reads 16-bit mono PCM from a native ring buffer shared by address.
+///
+/// The layout matches `PcmRingHeader` in `linux/pcm_ring_buffer.h`. The
+/// native side never waits for the reader: if it falls more than a ring's
+/// worth behind, the oldest samples are lost and [read] skips them.
+class PcmRingReader {
+  static const int magic = 0x4d43505a;
+  static const int version = 2;
+
+  static const int _versionOffset = 4;
+  static const int _sampleRateOffset = 8;
+  static const int _capacityOffset = 16;
+  static const int _dataOffsetOffset = 24;
+  static const int _writePositionOffset = 64;
+  static const int _claimPositionOffset = 72;
+  static const int _readPositionOffset = 128;
+  static const int _droppedSamplesOffset = 192;
+
+  final int _address;
+  final int sampleRate;
+  final int capacity;
+  final Int16List _data;
+  int _readPosition;
+
+  PcmRingReader._(this._address, this.sampleRate, this.capacity, this._data,
+      this._readPosition);
+
+  /// Attaches to the ring at [address]. Reading starts with the oldest
+  /// sample the ring still holds that has not been read yet.
+  factory PcmRingReader(int address) {
+    if (Pointer<Uint32>.fromAddress(address).value != magic) {
+      throw ArgumentError.value(address, 'address', 'not a PCM ring');
+    }
+    if (Pointer<Uint32>.fromAddress(address + _versionOffset).value !=
+        version) {
+      throw ArgumentError.value(
+          address, 'address', 'unsupported PCM ring version');
+    }
+    final capacity =
+        Pointer<Uint32>.fromAddress(address + _capacityOffset).value;
+    final dataOffset =
+        Pointer<Uint32>.fromAddress(address + _dataOffsetOffset).value;
+    return PcmRingReader._(
+      address,
+      Pointer<Uint32>.fromAddress(address + _sampleRateOffset).value,
+      capacity,
+      Pointer<Int16>.fromAddress(address + dataOffset).asTypedList(capacity),
+      Pointer<Uint64>.fromAddress(address + _readPositionOffset).value,
+    );
+  }
+
+  /// Samples written so far, counted from when the ring was created.
+  int get writePosition =>
+      Pointer<Uint64>.fromAddress(_address + _writePositionOffset).value;
+
+  /// Where the write in progress, if any, will end. Samples before
+  /// [claimPosition] - [capacity] may already be overwritten.
+  int get claimPosition =>
+      Pointer<Uint64>.fromAddress(_address + _claimPositionOffset).value;
+
+  /// Samples overwritten before they were read.
+  int get droppedSamples =>
+      Pointer<Uint64>.fromAddress(_address + _droppedSamplesOffset).value;
+
+  /// Returns every sample written since the last call.
+  Int16List read() {
+    final end = writePosition;
+    var start = _readPosition;
+    if (end - start > capacity) {
+      start = end - capacity;
+    }
+    var samples = Int16List(end - start);
+    final first = start % capacity;
+    final firstCount =
+        samples.length < capacity - first ? samples.length : capacity - first;
+    samples.setRange(0, firstCount, _data, first);
+    samples.setRange(firstCount, samples.length, _data);
+
+    // The producer may have lapped the start of the copy while it ran, or
+    // be part way through a write that does. It claims the slots before
+    // touching them, so the claim covers both.
+    final overwrittenBefore = claimPosition - capacity;
+    if (overwrittenBefore > start) {
+      final lost = overwrittenBefore - start < samples.length
+          ? overwrittenBefore - start
+          : samples.length;
+      samples = Int16List.sublistView(samples, lost);
+    }
+
+    _readPosition = end;
+    Pointer<Uint64>.fromAddress(_address + _readPositionOffset).value = end;
+    return samples;
+  }
+}
+
+/// 16 kHz mono PCM for the meeting mix or one participant, resampled
+/// natively and shared with Dart without copying it through a channel.
+class ZoomAudioStream {
+  /// Participant ID of the meeting mix.
+  static const String mixed = '0';
+
+  static final Map<String, ZoomAudioStream> _open = {};
+
+  final String participantId;
+  final PcmRingReader _reader;
+  final Future<bool> Function() _unsubscribe;
+  late final StreamController<Int16List> _controller;
+  StreamSubscription<String>? _notifications;
+  bool _closed = false;
+
+  ZoomAudioStream._(this.participantId, this._reader,
+      Stream<String> notifications, this._unsubscribe) {
+    _controller = StreamController<Int16List>.broadcast(
+      onListen: () {
+        _notifications = notifications.listen((_) => _drain());
+        _drain();
+      },
+      onCancel: () {
+        _notifications?.cancel();
+        _notifications = null;
+      },
+    );
+  }
+
+  /// Returns the open stream for [participantId], or creates one from
+  /// [subscribe], which returns the native ring's address or -1.
+  /// [notifications] carries the IDs of streams with new samples.
+  static Future<ZoomAudioStream?> open(
+    String participantId, {
+    required Future<int> Function() subscribe,
+    required Future<bool> Function() unsubscribe,
+    required Stream<String> notifications,
+  }) async {
+    final existing = _open[participantId];
+    if (existing != null) {
+      return existing;
+    }
+    final address = await subscribe();
+    if (address <= 0) {
+      return null;
+    }
+    // Another open() may have finished while this one waited.
+    return _open[participantId] ??= ZoomAudioStream._(
+      participantId,
+      PcmRingReader(address),
+      notifications.where((id) => id == participantId),
+      unsubscribe,
+    );
+  }
+
+  int get sampleRate => _reader.sampleRate;
+
+  /// Samples the native side overwrote before they were read.
+  int get droppedSamples => _closed ? 0 : _reader.droppedSamples;
+
+  /// Chunks of new samples, delivered as the native side reports them.
+  Stream<Int16List> get samples => _controller.stream;
+
+  /// Returns every sample received since the last read, for polling instead
+  /// of listening to [samples].
+  Int16List read() => _closed ? Int16List(0) : _reader.read();
+
+  void _drain() {
+    final chunk = read();
+    if (chunk.isNotEmpty) {
+      _controller.add(chunk);
+    }
+  }
+
+  /// Stops the stream and frees the native ring.
+  Future<void> close() async {
+    if (_closed) {
+      return;
+    }
+    // The ring must not be read once the native side has freed it.
+    _closed = true;
+    _open.remove(participantId);
+    await _notifications?.cancel();
+    await _controller.close();
+    await _unsubscribe();
+  }
+}
+
+/// Who is speaking, as detected natively from each participant's audio.
+class ActiveSpeakerChange {
+  /// The participant to follow, or null while nobody is speaking.
+  final String? activeSpeaker;
+
+  /// Everybody speaking, including [activeSpeaker].
+  final List<String> speaking;
+
+  const ActiveSpeakerChange({this.activeSpeaker, this.speaking = const []});
+
+  /// Decodes the `[name, activeSpeaker, speaking]` event sent by the Linux
+  /// plugin.
+  factory ActiveSpeakerChange.fromEvent(List event) => ActiveSpeakerChange(
+        activeSpeaker: event[1] as String?,
+        speaking: (event[2] as List).cast<String>(),
+      );
+
+  @override
+  String toString() => 'ActiveSpeakerChange($activeSpeaker, $speaking)';
+}
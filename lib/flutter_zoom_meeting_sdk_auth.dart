@@ -0,0 +1,30 @@
+/// A cached SDK token that is due to be replaced.
+///
+/// The Linux plugin reports each token it holds once, a few minutes before
+/// it expires, so that a new one can be fetched and handed over with
+/// `setAuthToken` while the old one still works.
+class TokenExpiring {
+  /// The app key the token was issued for, from its `appKey` or `sdkKey`
+  /// claim.
+  final String appKey;
+
+  /// When the token stops being accepted.
+  final DateTime expiresAt;
+
+  const TokenExpiring({required this.appKey, required this.expiresAt});
+
+  /// Decodes the `[name, appKey, expiresAt]` event sent by the Linux
+  /// plugin, where `expiresAt` is in seconds since the epoch.
+  factory TokenExpiring.fromEvent(List event) => TokenExpiring(
+        appKey: event[1] as String,
+        expiresAt: DateTime.fromMillisecondsSinceEpoch(
+            (event[2] as int) * 1000,
+            isUtc: true),
+      );
+
+  /// How long the token has left.
+  Duration get remaining => expiresAt.difference(DateTime.now());
+
+  @override
+  String toString() => 'TokenExpiring($appKey, $expiresAt)';
+}
@@ -0,0 +1,83 @@
+import 'dart:async';
+import 'dart:ffi';
+import 'dart:isolate';
+
+/// Binds the C ABI of `libzoom_core.so`, the Linux plugin's native core,
+/// declared in `linux/include/flutter_zoom_meeting_sdk/zoom_core.h`.
+///
+/// Calls go straight to native code on the calling thread, and native
+/// threads post back to a [ReceivePort] without waiting for the platform
+/// thread, so nothing here is encoded for a channel or scheduled on the
+/// main loop.
+class ZoomCore {
+  /// The `ZOOM_CORE_ABI_VERSION` these bindings were written for.
+  static const int abiVersion = 2;
+
+  static const String libraryName = 'libzoom_core.so';
+
+  final int _handle;
+  final bool Function(int, int) _setAudioPort;
+  final void Function(int, int) _acknowledgeAudio;
+
+  ReceivePort? _audioPort;
+  late final StreamController<String> _audioNotifications =
+      StreamController<String>.broadcast(
+    onListen: _listenForAudio,
+    onCancel: _stopListeningForAudio,
+  );
+
+  ZoomCore._(this._handle, DynamicLibrary library)
+      : _setAudioPort = library.lookupFunction<
+            Bool Function(Uint64, Int64),
+            bool Function(int, int)>('zoom_core_set_audio_port'),
+        _acknowledgeAudio = library.lookupFunction<
+            Void Function(Uint64, Uint32),
+            void Function(int, int)>('zoom_core_acknowledge_audio');
+
+  /// Binds the plugin instance named by [handle], as the plugin returns it
+  /// for "core_handle". Returns null if the library is not loaded in this
+  /// process or has another ABI version. Once the plugin is disposed the
+  /// handle is stale and calls through it do nothing.
+  static ZoomCore? open(int handle) {
+    final DynamicLibrary library;
+    try {
+      library = DynamicLibrary.open(libraryName);
+    } on ArgumentError {
+      return null;
+    }
+    final version = library.lookupFunction<Int32 Function(),
+        int Function()>('zoom_core_abi_version')();
+    if (version != abiVersion) {
+      return null;
+    }
+    library.lookupFunction<Void Function(Pointer<Void>),
+            void Function(Pointer<Void>)>('zoom_core_init_dart_api')(
+        NativeApi.postCObject.cast());
+    return ZoomCore._(handle, library);
+  }
+
+  /// IDs of audio streams with new samples, posted by the audio thread.
+  Stream<String> get audioNotifications => _audioNotifications.stream;
+
+  void _listenForAudio() {
+    final port = ReceivePort();
+    if (!_setAudioPort(_handle, port.sendPort.nativePort)) {
+      port.close();
+      return;
+    }
+    _audioPort = port;
+    port.listen((message) {
+      final participantId = message as int;
+      // Re-arm before the listeners read, so samples that arrive while they
+      // do are announced again.
+      _acknowledgeAudio(_handle, participantId);
+      _audioNotifications.add('$participantId');
+    });
+  }
+
+  void _stopListeningForAudio() {
+    _setAudioPort(_handle, 0);
+    _audioPort?.close();
+    _audioPort = null;
+  }
+}
@@ -0,0 +1,76 @@
+import 'dart:typed_data';
+
+/// Meeting states, in the order of the native status codes.
+enum MeetingStatus {
+  idle,
+  connecting,
+  waitingForHost,
+  inMeeting,
+  disconnecting,
+  reconnecting,
+  failed,
+  inWaitingRoom,
+  webinarPromote,
+  webinarDepromote,
+  unknown,
+}
+
+/// A meeting status change received on the binary status channel.
+class MeetingStatusEvent {
+  /// Size in bytes of an encoded event.
+  static const int recordSize = 32;
+
+  final MeetingStatus status;
+  final int errorCode;
+  final int internalErrorCode;
+
+  /// Session of the meeting this change belongs to, or 0 if it belongs to
+  /// none. Session IDs are never reused: a meeting joined again after its
+  /// session ended gets a new one.
+  final int sessionId;
+
+  /// Microseconds on the native monotonic clock.
+  final int timestampUs;
+
+  /// Increases by one for every status change reported by the SDK.
+  final int sequence;
+
+  const MeetingStatusEvent({
+    required this.status,
+    required this.errorCode,
+    required this.internalErrorCode,
+    this.sessionId = 0,
+    required this.timestampUs,
+    required this.sequence,
+  });
+
+  /// Decodes the little-endian record written by the native plugin
+  /// (see linux/status_event_codec.h).
+  factory MeetingStatusEvent.decode(ByteData data, [int offset = 0]) {
+    if (data.lengthInBytes - offset < recordSize) {
+      throw ArgumentError('Status event record is too short');
+    }
+    final code = data.getInt32(offset, Endian.little);
+    return MeetingStatusEvent(
+      status: code >= 0 && code < MeetingStatus.values.length
+          ? MeetingStatus.values[code]
+          : MeetingStatus.unknown,
+      errorCode: data.getInt32(offset + 4, Endian.little),
+      internalErrorCode: data.getInt32(offset + 8, Endian.little),
+      sessionId: data.getUint32(offset + 12, Endian.little),
+      timestampUs: data.getInt64(offset + 16, Endian.little),
+      sequence: data.getUint64(offset + 24, Endian.little),
+    );
+  }
+
+  /// Decodes every record in a batch sent by the native plugin.
+  static List<MeetingStatusEvent> decodeAll(ByteData data) {
+    final count = data.lengthInBytes ~/ recordSize;
+    return List<MeetingStatusEvent>.generate(
+        count, (int i) => MeetingStatusEvent.decode(data, i * recordSize));
+  }
+
+  @override
+  String toString() =>
+      'MeetingStatusEvent(#$sequence ${status.name}, error: $errorCode/$internalErrorCode)';
+}
@@ -0,0 +1,69 @@
+/// Bytes held by one size class of the native frame pool.
+class FramePoolClassStats {
+  /// Size of every buffer in the class.
+  final int bufferSize;
+  final int inUseBytes;
+  final int freeBytes;
+
+  /// Highest [inUseBytes] so far.
+  final int peakBytes;
+
+  const FramePoolClassStats({
+    required this.bufferSize,
+    required this.inUseBytes,
+    required this.freeBytes,
+    required this.peakBytes,
+  });
+
+  factory FramePoolClassStats.fromMap(Map<Object?, Object?> map) =>
+      FramePoolClassStats(
+        bufferSize: map['bufferSize'] as int? ?? 0,
+        inUseBytes: map['inUseBytes'] as int? ?? 0,
+        freeBytes: map['freeBytes'] as int? ?? 0,
+        peakBytes: map['peakBytes'] as int? ?? 0,
+      );
+
+  @override
+  String toString() => 'FramePoolClassStats($bufferSize, in use $inUseBytes, '
+      'free $freeBytes, peak $peakBytes)';
+}
+
+/// Bytes held by the native pool that video frame planes are allocated
+/// from.
+///
+/// Frames are allocated from [maxBytes] at most, in use and free buffers
+/// together; frames that would go over it are dropped and counted in
+/// [failedAllocations].
+class FramePoolStats {
+  final int maxBytes;
+  final int inUseBytes;
+  final int freeBytes;
+
+  /// Highest in use and free total so far.
+  final int peakBytes;
+  final int failedAllocations;
+
+  /// The size classes that have held a buffer, smallest first.
+  final List<FramePoolClassStats> classes;
+
+  const FramePoolStats({
+    required this.maxBytes,
+    required this.inUseBytes,
+    required this.freeBytes,
+    required this.peakBytes,
+    required this.failedAllocations,
+    required this.classes,
+  });
+
+  factory FramePoolStats.fromMap(Map<Object?, Object?> map) => FramePoolStats(
+        maxBytes: map['maxBytes'] as int? ?? 0,
+        inUseBytes: map['inUseBytes'] as int? ?? 0,
+        freeBytes: map['freeBytes'] as int? ?? 0,
+        peakBytes: map['peakBytes'] as int? ?? 0,
+        failedAllocations: map['failedAllocations'] as int? ?? 0,
+        classes: [
+          for (final entry in map['classes'] as List<Object?>? ?? const [])
+            FramePoolClassStats.fromMap(entry as Map<Object?, Object?>),
+        ],
+      );
+}
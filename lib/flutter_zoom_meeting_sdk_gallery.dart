@@ -0,0 +1,85 @@
+import 'dart:typed_data';
+
+/// Where one participant's video is drawn in the gallery atlas, in pixels.
+class GalleryTile {
+  final String participantId;
+  final int x;
+  final int y;
+  final int width;
+  final int height;
+
+  const GalleryTile({
+    required this.participantId,
+    required this.x,
+    required this.y,
+    required this.width,
+    required this.height,
+  });
+
+  @override
+  String toString() =>
+      'GalleryTile($participantId, $x, $y, ${width}x$height)';
+}
+
+/// Positions of every gallery participant inside one atlas texture.
+///
+/// Show the atlas with a `Texture` widget sized [width] x [height] and put
+/// each participant's overlay at its tile.
+class GalleryLayout {
+  final int width;
+  final int height;
+  final List<GalleryTile> tiles;
+
+  const GalleryLayout({
+    required this.width,
+    required this.height,
+    required this.tiles,
+  });
+
+  /// Lays [participantIds] out in the most square grid that fits, in
+  /// reading order, with [spacing] pixels between tiles.
+  factory GalleryLayout.grid(
+    List<String> participantIds, {
+    required int width,
+    required int height,
+    int spacing = 0,
+  }) {
+    final count = participantIds.length;
+    var columns = 1;
+    while (columns * columns < count) {
+      columns++;
+    }
+    final rows = count == 0 ? 1 : (count + columns - 1) ~/ columns;
+    final tileWidth = (width - spacing * (columns - 1)) ~/ columns;
+    final tileHeight = (height - spacing * (rows - 1)) ~/ rows;
+    return GalleryLayout(
+      width: width,
+      height: height,
+      tiles: [
+        for (var i = 0; i < count; i++)
+          GalleryTile(
+            participantId: participantIds[i],
+            x: (i % columns) * (tileWidth + spacing),
+            y: (i ~/ columns) * (tileHeight + spacing),
+            width: tileWidth,
+            height: tileHeight,
+          ),
+      ],
+    );
+  }
+
+  /// The tiles as sent to the native compositor: participant ID, x, y,
+  /// width and height per tile.
+  Int64List encodeTiles() {
+    final encoded = Int64List(tiles.length * 5);
+    for (var i = 0; i < tiles.length; i++) {
+      final tile = tiles[i];
+      encoded[i * 5] = int.parse(tile.participantId);
+      encoded[i * 5 + 1] = tile.x;
+      encoded[i * 5 + 2] = tile.y;
+      encoded[i * 5 + 3] = tile.width;
+      encoded[i * 5 + 4] = tile.height;
+    }
+    return encoded;
+  }
+}
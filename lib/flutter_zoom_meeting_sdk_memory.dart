@@ -0,0 +1,104 @@
+/// How much the Linux plugin sheds to stay within its memory budget.
+enum MemoryPressure {
+  /// Within budget, or no budget set.
+  normal,
+
+  /// Over budget: participant video at half resolution, at most nine live
+  /// gallery tiles and a shorter roster history.
+  reduced,
+
+  /// Half again over budget: quarter resolution, four live gallery tiles.
+  minimal;
+
+  /// Decodes the level name sent by the Linux plugin.
+  static MemoryPressure fromName(Object? name) => MemoryPressure.values
+      .firstWhere((level) => level.name == name, orElse: () => normal);
+}
+
+/// Bytes one native subsystem holds, see [MemoryStats.categories].
+class MemoryCategoryStats {
+  final int currentBytes;
+
+  /// Highest [currentBytes] so far.
+  final int peakBytes;
+
+  const MemoryCategoryStats({
+    required this.currentBytes,
+    required this.peakBytes,
+  });
+
+  factory MemoryCategoryStats.fromMap(Map<Object?, Object?> map) =>
+      MemoryCategoryStats(
+        currentBytes: map['currentBytes'] as int? ?? 0,
+        peakBytes: map['peakBytes'] as int? ?? 0,
+      );
+
+  @override
+  String toString() => 'MemoryCategoryStats($currentBytes, peak $peakBytes)';
+}
+
+/// Memory the Linux plugin holds, by subsystem, next to the resident set of
+/// the whole process, which also counts the engine and the Zoom SDK.
+///
+/// Counts are batched per native thread, so each category may lag by up to
+/// 64 KiB per thread.
+class MemoryStats {
+  /// Keyed by `videoFrames`, `videoTextures`, `audioRings`, `roster`,
+  /// `eventQueues` and `recording`.
+  final Map<String, MemoryCategoryStats> categories;
+
+  /// Every category together.
+  final int trackedBytes;
+
+  /// Highest [trackedBytes] so far.
+  final int peakBytes;
+  final int rssBytes;
+  final MemoryPressure pressure;
+
+  const MemoryStats({
+    required this.categories,
+    required this.trackedBytes,
+    required this.peakBytes,
+    required this.rssBytes,
+    required this.pressure,
+  });
+
+  factory MemoryStats.fromMap(Map<Object?, Object?> map) => MemoryStats(
+        categories: {
+          for (final entry
+              in (map['categories'] as Map<Object?, Object?>? ?? const {})
+                  .entries)
+            entry.key as String: MemoryCategoryStats.fromMap(
+                entry.value as Map<Object?, Object?>),
+        },
+        trackedBytes: map['trackedBytes'] as int? ?? 0,
+        peakBytes: map['peakBytes'] as int? ?? 0,
+        rssBytes: map['rssBytes'] as int? ?? 0,
+        pressure: MemoryPressure.fromName(map['pressure']),
+      );
+}
+
+/// A change of [MemoryPressure], with the measurements that caused it.
+class MemoryPressureChange {
+  final MemoryPressure pressure;
+  final int trackedBytes;
+  final int rssBytes;
+
+  const MemoryPressureChange({
+    required this.pressure,
+    required this.trackedBytes,
+    required this.rssBytes,
+  });
+
+  /// Decodes the `[name, level, trackedBytes, rssBytes]` event sent by the
+  /// Linux plugin.
+  factory MemoryPressureChange.fromEvent(List event) => MemoryPressureChange(
+        pressure: MemoryPressure.fromName(event[1]),
+        trackedBytes: event[2] as int,
+        rssBytes: event[3] as int,
+      );
+
+  @override
+  String toString() =>
+      'MemoryPressureChange(${pressure.name}, $trackedBytes, $rssBytes)';
+}
@@ -1,14 +1,101 @@
+import 'dart:async';
+import 'dart:io' show Platform, pid;
+
 import 'package:flutter/services.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_audio.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_auth.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_core.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_events.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_frame_pool.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_gallery.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_memory.dart';
 import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_options.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_options_codec.dart';
 import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_platform_interface.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_roster.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_video_stats.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_trace.dart';
 
 class MethodChannelZoom extends ZoomPlatform {
+  MethodChannelZoom({bool? packMeetingOptions})
+      : packMeetingOptions = packMeetingOptions ?? Platform.isLinux;
+
+  /// Whether join and start send [PackedMeetingOptions] instead of a string
+  /// map. Only the Linux plugin reads packed options.
+  final bool packMeetingOptions;
+
   final MethodChannel channel =
       const MethodChannel('plugins.flutter_zoom_meeting_sdk/zoom_channel');
 
   final EventChannel eventChannel =
       const EventChannel('plugins.flutter_zoom_meeting_sdk/zoom_event_stream');
 
+  final BasicMessageChannel<ByteData> statusEventChannel =
+      const BasicMessageChannel<ByteData>(
+          'plugins.flutter_zoom_meeting_sdk/zoom_status_events', BinaryCodec());
+
+  StreamController<MeetingStatusEvent>? _statusEventController;
+
+  /// Name of the zoom_event_stream events that announce new audio samples.
+  static const String audioDataEventName = 'AUDIO_DATA_AVAILABLE';
+
+  // Each receiveBroadcastStream() call replaces the previous one's native
+  // handler, so every consumer shares this one.
+  late final Stream<dynamic> _events = eventChannel.receiveBroadcastStream();
+
+  /// Name of the zoom_event_stream events that carry roster deltas.
+  static const String participantDeltasEventName = 'PARTICIPANT_DELTAS';
+
+  /// The native core bound through dart:ffi, or null where the plugin has
+  /// none, see [ZoomCore].
+  late final Future<ZoomCore?> zoomCore = _openZoomCore();
+
+  StreamSubscription<String>? _audioSubscription;
+  late final StreamController<String> _audioNotifications =
+      StreamController<String>.broadcast(
+    onListen: _listenForAudio,
+    onCancel: () {
+      _audioSubscription?.cancel();
+      _audioSubscription = null;
+    },
+  );
+
+  static bool _isAudioNotification(dynamic event) =>
+      event is List && event.isNotEmpty && event[0] == audioDataEventName;
+
+  /// Name of the zoom_event_stream events that report detected speakers.
+  static const String activeSpeakerEventName = 'ACTIVE_SPEAKER_CHANGED';
+
+  static bool _isParticipantDeltas(dynamic event) =>
+      event is List &&
+      event.isNotEmpty &&
+      event[0] == participantDeltasEventName;
+
+  static bool _isActiveSpeakerChange(dynamic event) =>
+      event is List && event.isNotEmpty && event[0] == activeSpeakerEventName;
+
+  /// Name of the zoom_event_stream events that ask for a fresh SDK token.
+  static const String tokenExpiringEventName = 'TOKEN_EXPIRING';
+
+  static bool _isTokenExpiring(dynamic event) =>
+      event is List && event.isNotEmpty && event[0] == tokenExpiringEventName;
+
+  /// Name of the zoom_event_stream events that report memory pressure.
+  static const String memoryPressureEventName = 'MEMORY_PRESSURE';
+
+  static bool _isMemoryPressure(dynamic event) =>
+      event is List && event.isNotEmpty && event[0] == memoryPressureEventName;
+
+  /// Dart-side spans around every method call, merged into [dumpTrace].
+  final ZoomTraceRecorder trace = ZoomTraceRecorder();
+
+  Future<T?> _invoke<T>(String method, [dynamic arguments]) => trace.span(
+      'dart', method, () => channel.invokeMethod<T>(method, arguments));
+
+  Future<Map<K, V>?> _invokeMap<K, V>(String method, [dynamic arguments]) =>
+      trace.span('dart', method,
+          () => channel.invokeMapMethod<K, V>(method, arguments));
+
   @override
   Future<List> initZoom(ZoomOptions options) async {
     var optionMap = <String, String>{};
@@ -22,15 +109,39 @@ class MethodChannelZoom extends ZoomPlatform {
       optionMap['jwtToken'] = options.jwtToken!;
     }
     optionMap['domain'] = options.domain;
-    return channel
-        .invokeMethod<List>('init', optionMap)
+    return _invoke<List>('init', optionMap)
         .then<List>((List? value) => value ?? []);
   }
 
+  @override
+  Future<bool> setAuthToken(String jwtToken) async {
+    var optionMap = <String, String>{};
+    optionMap['jwtToken'] = jwtToken;
+
+    return _invoke<bool>('set_auth_token', optionMap)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Stream<TokenExpiring> onTokenExpiring() {
+    return _events
+        .where(_isTokenExpiring)
+        .map((event) => TokenExpiring.fromEvent(event as List));
+  }
+
   @override
   Future<bool> startMeeting(ZoomMeetingOptions options) async {
     assert(options.zoomAccessToken != null);
     assert(options.displayName != null);
+    final Object arguments = packMeetingOptions
+        ? PackedMeetingOptions.encode(options)
+        : startArguments(options);
+    return _invoke<bool>('start', arguments)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  /// The string map sent with "start" when options are not packed.
+  static Map<String, String> startArguments(ZoomMeetingOptions options) {
     var optionMap = <String, String>{};
     optionMap['userId'] = options.userId;
     optionMap['displayName'] = options.displayName!;
@@ -46,14 +157,20 @@ class MethodChannelZoom extends ZoomPlatform {
     if (options.meetingViewOptions != null) {
       optionMap['meetingViewOptions'] = options.meetingViewOptions!.toString();
     }
-
-    return channel
-        .invokeMethod<bool>('start', optionMap)
-        .then<bool>((bool? value) => value ?? false);
+    return optionMap;
   }
 
   @override
   Future<bool> joinMeeting(ZoomMeetingOptions options) async {
+    final Object arguments = packMeetingOptions
+        ? PackedMeetingOptions.encode(options, withHostFields: false)
+        : joinArguments(options);
+    return _invoke<bool>('join', arguments)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  /// The string map sent with "join" when options are not packed.
+  static Map<String, String> joinArguments(ZoomMeetingOptions options) {
     var optionMap = <String, String>{};
     optionMap['userId'] = options.userId;
     optionMap['meetingId'] = options.meetingId;
@@ -67,9 +184,63 @@ class MethodChannelZoom extends ZoomPlatform {
     if (options.meetingViewOptions != null) {
       optionMap['meetingViewOptions'] = options.meetingViewOptions!.toString();
     }
+    return optionMap;
+  }
 
-    return channel
-        .invokeMethod<bool>('join', optionMap)
+  @override
+  Future<bool> leaveMeeting(String meetingId) async {
+    var optionMap = <String, String>{};
+    optionMap['meetingId'] = meetingId;
+
+    return _invoke<bool>('leave_meeting', optionMap)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Future<Map<String, int>> meetingSessions() async {
+    return _invokeMap<String, int>('meeting_sessions')
+        .then<Map<String, int>>((Map<String, int>? value) => value ?? {});
+  }
+
+  @override
+  Stream<List<RosterDelta>> onParticipantDeltas() {
+    return _events.where(_isParticipantDeltas).map((event) =>
+        RosterDelta.decodeAll(
+            ByteData.sublistView((event as List)[1] as Uint8List)));
+  }
+
+  @override
+  Future<RosterSnapshot> participantSnapshot(int sinceSequence) async {
+    var optionMap = <String, String>{};
+    optionMap['sinceSequence'] = sinceSequence.toString();
+
+    final value =
+        await _invokeMap<String, Object?>('participant_snapshot', optionMap);
+    final deltas = value?['deltas'] as Uint8List?;
+    return RosterSnapshot(
+      sequence: value?['sequence'] as int? ?? 0,
+      full: value?['full'] as bool? ?? false,
+      deltas: deltas == null
+          ? const []
+          : RosterDelta.decodeAll(ByteData.sublistView(deltas)),
+    );
+  }
+
+  @override
+  Future<Map<int, String>> viewBindings() async {
+    return _invokeMap<int, String>('view_bindings')
+        .then<Map<int, String>>((Map<int, String>? value) => value ?? {});
+  }
+
+  @override
+  Future<bool> bindView(int viewId, String? meetingId) async {
+    var optionMap = <String, String>{};
+    optionMap['viewId'] = '$viewId';
+    if (meetingId != null) {
+      optionMap['meetingId'] = meetingId;
+    }
+
+    return _invoke<bool>('bind_view', optionMap)
         .then<bool>((bool? value) => value ?? false);
   }
 
@@ -78,19 +249,281 @@ class MethodChannelZoom extends ZoomPlatform {
     var optionMap = <String, String>{};
     optionMap['meetingId'] = meetingId;
 
-    return channel
-        .invokeMethod<List>('meeting_status', optionMap)
+    return _invoke<List>('meeting_status', optionMap)
         .then<List>((List? value) => value ?? []);
   }
 
+  @override
+  Future<MeetingStatusEvent?> meetingState() async {
+    final value = await _invoke<Uint8List>('meeting_state');
+    return value == null
+        ? null
+        : MeetingStatusEvent.decode(ByteData.sublistView(value));
+  }
+
+  @override
+  Future<MeetingStatusEvent?> waitForStatusChange(int sinceSequence,
+      {Duration timeout = const Duration(seconds: 30)}) async {
+    var optionMap = <String, String>{};
+    optionMap['sinceSequence'] = '$sinceSequence';
+    optionMap['timeoutMs'] = '${timeout.inMilliseconds}';
+
+    final value =
+        await _invoke<Uint8List>('wait_for_status_change', optionMap);
+    return value == null
+        ? null
+        : MeetingStatusEvent.decode(ByteData.sublistView(value));
+  }
+
   @override
   Stream<dynamic> onMeetingStatus() {
-    return eventChannel.receiveBroadcastStream();
+    return _events.where((event) =>
+        !_isAudioNotification(event) &&
+        !_isParticipantDeltas(event) &&
+        !_isActiveSpeakerChange(event) &&
+        !_isTokenExpiring(event) &&
+        !_isMemoryPressure(event));
+  }
+
+  @override
+  Stream<MeetingStatusEvent> onMeetingStatusEvent() {
+    _statusEventController ??= StreamController<MeetingStatusEvent>.broadcast(
+      onListen: () {
+        statusEventChannel.setMessageHandler((ByteData? message) async {
+          if (message != null) {
+            MeetingStatusEvent.decodeAll(message)
+                .forEach(_statusEventController!.add);
+          }
+          return null;
+        });
+        _invoke<void>(
+            'binary_status_events', <String, String>{'enabled': 'true'});
+      },
+      onCancel: () {
+        _invoke<void>(
+            'binary_status_events', <String, String>{'enabled': 'false'});
+        statusEventChannel.setMessageHandler(null);
+      },
+    );
+    return _statusEventController!.stream;
+  }
+
+  @override
+  Future<int> subscribeVideo(String participantId) async {
+    var optionMap = <String, String>{};
+    optionMap['participantId'] = participantId;
+
+    return _invoke<int>('subscribe_video', optionMap)
+        .then<int>((int? value) => value ?? -1);
+  }
+
+  @override
+  Future<bool> unsubscribeVideo(String participantId) async {
+    var optionMap = <String, String>{};
+    optionMap['participantId'] = participantId;
+
+    return _invoke<bool>('unsubscribe_video', optionMap)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Future<bool> setVideoDisplaySize(
+      String participantId, int width, int height) async {
+    var optionMap = <String, String>{};
+    optionMap['participantId'] = participantId;
+    optionMap['width'] = width.toString();
+    optionMap['height'] = height.toString();
+
+    return _invoke<bool>('set_video_display_size', optionMap)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Future<int> setGalleryLayout(GalleryLayout layout) async {
+    var optionMap = <String, Object>{};
+    optionMap['width'] = layout.width.toString();
+    optionMap['height'] = layout.height.toString();
+    optionMap['tiles'] = layout.encodeTiles();
+
+    return _invoke<int>('set_gallery_layout', optionMap)
+        .then<int>((int? value) => value ?? -1);
+  }
+
+  @override
+  Future<bool> clearGallery() async {
+    return _invoke<bool>('clear_gallery')
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Future<int> subscribeAudio(String participantId) async {
+    var optionMap = <String, String>{};
+    optionMap['participantId'] = participantId;
+
+    return _invoke<int>('subscribe_audio', optionMap)
+        .then<int>((int? value) => value ?? -1);
+  }
+
+  @override
+  Future<bool> unsubscribeAudio(String participantId) async {
+    var optionMap = <String, String>{};
+    optionMap['participantId'] = participantId;
+
+    return _invoke<bool>('unsubscribe_audio', optionMap)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Stream<String> onAudioDataAvailable() => _audioNotifications.stream;
+
+  Future<ZoomCore?> _openZoomCore() async {
+    if (!Platform.isLinux) {
+      return null;
+    }
+    try {
+      final handle = await _invoke<int>('core_handle');
+      return handle == null ? null : ZoomCore.open(handle);
+    } on MissingPluginException {
+      return null;
+    }
+  }
+
+  // Audio notifications come from the audio thread through the native
+  // core's port where there is one, and from zoom_event_stream otherwise.
+  Future<void> _listenForAudio() async {
+    final core = await zoomCore;
+    if (!_audioNotifications.hasListener || _audioSubscription != null) {
+      return;
+    }
+    final source = core?.audioNotifications ??
+        _events
+            .where(_isAudioNotification)
+            .map((event) => (event as List)[1] as String);
+    _audioSubscription = source.listen(_audioNotifications.add);
+  }
+
+  @override
+  Future<bool> setSpeakerDetection(bool enabled) async {
+    var optionMap = <String, String>{};
+    optionMap['enabled'] = enabled.toString();
+
+    return _invoke<bool>('set_speaker_detection', optionMap)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Stream<ActiveSpeakerChange> onActiveSpeakerChanged() {
+    return _events
+        .where(_isActiveSpeakerChange)
+        .map((event) => ActiveSpeakerChange.fromEvent(event as List));
+  }
+
+  @override
+  Future<bool> startRecording(String directory) async {
+    var optionMap = <String, String>{};
+    optionMap['directory'] = directory;
+
+    return _invoke<bool>('start_recording', optionMap)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Future<bool> recordVideo(String participantId) async {
+    var optionMap = <String, String>{};
+    optionMap['participantId'] = participantId;
+
+    return _invoke<bool>('record_video', optionMap)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Future<bool> stopRecording() async {
+    return _invoke<bool>('stop_recording')
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Future<Map<String, int>> recordingStats() async {
+    return _invokeMap<String, int>('recording_stats')
+        .then<Map<String, int>>((Map<String, int>? value) => value ?? {});
+  }
+
+  @override
+  Future<FramePoolStats> framePoolStats() async {
+    return _invokeMap<Object?, Object?>('frame_pool_stats')
+        .then<FramePoolStats>((Map<Object?, Object?>? value) =>
+            FramePoolStats.fromMap(value ?? const {}));
+  }
+
+  @override
+  Future<MemoryStats> getMemoryStats() async {
+    return _invokeMap<Object?, Object?>('memory_stats').then<MemoryStats>(
+        (Map<Object?, Object?>? value) =>
+            MemoryStats.fromMap(value ?? const {}));
+  }
+
+  @override
+  Future<bool> setMemoryBudget({int? pluginBytes, int? rssBytes}) async {
+    var optionMap = <String, String>{};
+    if (pluginBytes != null) {
+      optionMap['pluginBytes'] = '$pluginBytes';
+    }
+    if (rssBytes != null) {
+      optionMap['rssBytes'] = '$rssBytes';
+    }
+
+    return _invoke<bool>('set_memory_budget', optionMap)
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Stream<MemoryPressureChange> onMemoryPressure() {
+    return _events
+        .where(_isMemoryPressure)
+        .map((event) => MemoryPressureChange.fromEvent(event as List));
+  }
+
+  @override
+  Future<VideoStats> videoStats() async {
+    return _invokeMap<Object?, Object?>('video_stats').then<VideoStats>(
+        (Map<Object?, Object?>? value) =>
+            VideoStats.fromMap(value ?? const {}));
+  }
+
+  @override
+  Future<Map<String, int>> eventQueueStats() async {
+    return _invokeMap<String, int>('event_queue_stats')
+        .then<Map<String, int>>((Map<String, int>? value) => value ?? {});
+  }
+
+  @override
+  Future<Map<String, int>> startupTimeline() async {
+    return _invokeMap<String, int>('startup_timeline')
+        .then<Map<String, int>>((Map<String, int>? value) => value ?? {});
+  }
+
+  @override
+  Future<bool> startTrace() async {
+    trace.start();
+    return _invoke<bool>('start_trace')
+        .then<bool>((bool? value) => value ?? false);
+  }
+
+  @override
+  Future<bool> dumpTrace(String path) async {
+    trace.stop();
+    var optionMap = <String, String>{};
+    optionMap['path'] = path;
+    optionMap['dartEvents'] = trace.encodeEvents(pid);
+
+    return channel
+        .invokeMethod<bool>('dump_trace', optionMap)
+        .then<bool>((bool? value) => value ?? false);
   }
 
   @override
   Future<String?> getPlatformVersion() {
-    return channel.invokeMethod<String>('getPlatformVersion');
+    return _invoke<String>('getPlatformVersion');
   }
 }
 
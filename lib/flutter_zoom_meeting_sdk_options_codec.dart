@@ -0,0 +1,70 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_options.dart';
+
+/// Packs [ZoomMeetingOptions] into the binary record the Linux plugin reads
+/// with "join" and "start" (see linux/meeting_options_codec.h).
+///
+/// Boolean options share one flags word and strings are length-prefixed
+/// UTF-8, so the plugin decodes the whole record in one pass.
+class PackedMeetingOptions {
+  static const int formatVersion = 1;
+
+  static const int disableDialIn = 1 << 0;
+  static const int disableDrive = 1 << 1;
+  static const int disableInvite = 1 << 2;
+  static const int disableShare = 1 << 3;
+  static const int noDisconnectAudio = 1 << 4;
+  static const int noAudio = 1 << 5;
+
+  /// Size of the version, flags and meeting view options header.
+  static const int headerSize = 12;
+
+  PackedMeetingOptions._();
+
+  /// Flags for [options]. The string options are true when they equal
+  /// "true" ignoring case, as the native string map parser reads them.
+  static int flags(ZoomMeetingOptions options) {
+    bool isTrue(String value) => value.toLowerCase() == 'true';
+    var flags = 0;
+    if (isTrue(options.disableDialIn)) flags |= disableDialIn;
+    if (isTrue(options.disableDrive)) flags |= disableDrive;
+    if (isTrue(options.disableInvite)) flags |= disableInvite;
+    if (isTrue(options.disableShare)) flags |= disableShare;
+    if (isTrue(options.noDisconnectAudio)) flags |= noDisconnectAudio;
+    if (isTrue(options.noAudio)) flags |= noAudio;
+    return flags;
+  }
+
+  /// Returns the packed record for [options]. Without [withHostFields] the
+  /// display name and access token, which only "start" uses, are left
+  /// empty.
+  static Uint8List encode(ZoomMeetingOptions options,
+      {bool withHostFields = true}) {
+    final strings = <List<int>>[
+      utf8.encode(options.userId),
+      utf8.encode(withHostFields ? options.displayName ?? '' : ''),
+      utf8.encode(options.meetingId),
+      utf8.encode(options.meetingPassword),
+      utf8.encode(withHostFields ? options.zoomAccessToken ?? '' : ''),
+    ];
+    var size = headerSize;
+    for (final string in strings) {
+      size += 4 + string.length;
+    }
+
+    final bytes = Uint8List(size);
+    final data = ByteData.sublistView(bytes);
+    data.setUint32(0, formatVersion, Endian.little);
+    data.setUint32(4, flags(options), Endian.little);
+    data.setInt32(8, options.meetingViewOptions ?? 0, Endian.little);
+    var offset = headerSize;
+    for (final string in strings) {
+      data.setUint32(offset, string.length, Endian.little);
+      bytes.setAll(offset + 4, string);
+      offset += 4 + string.length;
+    }
+    return bytes;
+  }
+}
@@ -2,8 +2,24 @@ import 'dart:async';
 import 'package:plugin_platform_interface/plugin_platform_interface.dart';
 import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_options.dart';
 
+import 'flutter_zoom_meeting_sdk_audio.dart';
+import 'flutter_zoom_meeting_sdk_auth.dart';
+import 'flutter_zoom_meeting_sdk_events.dart';
+import 'flutter_zoom_meeting_sdk_frame_pool.dart';
+import 'flutter_zoom_meeting_sdk_gallery.dart';
+import 'flutter_zoom_meeting_sdk_memory.dart';
 import 'flutter_zoom_meeting_sdk_method_channel.dart';
+import 'flutter_zoom_meeting_sdk_roster.dart';
+import 'flutter_zoom_meeting_sdk_video_stats.dart';
+export 'flutter_zoom_meeting_sdk_audio.dart';
+export 'flutter_zoom_meeting_sdk_auth.dart';
+export 'flutter_zoom_meeting_sdk_events.dart';
+export 'flutter_zoom_meeting_sdk_frame_pool.dart';
+export 'flutter_zoom_meeting_sdk_gallery.dart';
+export 'flutter_zoom_meeting_sdk_memory.dart';
 export 'flutter_zoom_meeting_sdk_options.dart';
+export 'flutter_zoom_meeting_sdk_roster.dart';
+export 'flutter_zoom_meeting_sdk_video_stats.dart';
 
 abstract class ZoomPlatform extends PlatformInterface {
   ZoomPlatform() : super(token: _token);
@@ -19,6 +35,14 @@ abstract class ZoomPlatform extends PlatformInterface {
     throw UnimplementedError('initZoom() has not been implemented.');
   }
 
+  Future<bool> setAuthToken(String jwtToken) async {
+    throw UnimplementedError('setAuthToken() has not been implemented.');
+  }
+
+  Stream<TokenExpiring> onTokenExpiring() {
+    throw UnimplementedError('onTokenExpiring() has not been implemented.');
+  }
+
   Future<bool> startMeeting(ZoomMeetingOptions options) async {
     throw UnimplementedError('startMeeting() has not been implemented.');
   }
@@ -27,14 +51,152 @@ abstract class ZoomPlatform extends PlatformInterface {
     throw UnimplementedError('joinMeeting() has not been implemented.');
   }
 
+  Future<bool> leaveMeeting(String meetingId) async {
+    throw UnimplementedError('leaveMeeting() has not been implemented.');
+  }
+
+  Future<Map<String, int>> meetingSessions() async {
+    throw UnimplementedError('meetingSessions() has not been implemented.');
+  }
+
+  Future<Map<int, String>> viewBindings() async {
+    throw UnimplementedError('viewBindings() has not been implemented.');
+  }
+
+  Future<bool> bindView(int viewId, String? meetingId) async {
+    throw UnimplementedError('bindView() has not been implemented.');
+  }
+
   Future<List> meetingStatus(String meetingId) async {
     throw UnimplementedError('meetingStatus() has not been implemented.');
   }
 
+  Future<MeetingStatusEvent?> meetingState() async {
+    throw UnimplementedError('meetingState() has not been implemented.');
+  }
+
+  Future<MeetingStatusEvent?> waitForStatusChange(int sinceSequence,
+      {Duration timeout = const Duration(seconds: 30)}) async {
+    throw UnimplementedError(
+        'waitForStatusChange() has not been implemented.');
+  }
+
   Stream<dynamic> onMeetingStatus() {
     throw UnimplementedError('onMeetingStatus() has not been implemented.');
   }
 
+  Stream<MeetingStatusEvent> onMeetingStatusEvent() {
+    throw UnimplementedError(
+        'onMeetingStatusEvent() has not been implemented.');
+  }
+
+  Stream<List<RosterDelta>> onParticipantDeltas() {
+    throw UnimplementedError(
+        'onParticipantDeltas() has not been implemented.');
+  }
+
+  Future<RosterSnapshot> participantSnapshot(int sinceSequence) async {
+    throw UnimplementedError(
+        'participantSnapshot() has not been implemented.');
+  }
+
+  Future<int> subscribeVideo(String participantId) async {
+    throw UnimplementedError('subscribeVideo() has not been implemented.');
+  }
+
+  Future<bool> unsubscribeVideo(String participantId) async {
+    throw UnimplementedError('unsubscribeVideo() has not been implemented.');
+  }
+
+  Future<bool> setVideoDisplaySize(
+      String participantId, int width, int height) async {
+    throw UnimplementedError(
+        'setVideoDisplaySize() has not been implemented.');
+  }
+
+  Future<int> setGalleryLayout(GalleryLayout layout) async {
+    throw UnimplementedError('setGalleryLayout() has not been implemented.');
+  }
+
+  Future<bool> clearGallery() async {
+    throw UnimplementedError('clearGallery() has not been implemented.');
+  }
+
+  Future<int> subscribeAudio(String participantId) async {
+    throw UnimplementedError('subscribeAudio() has not been implemented.');
+  }
+
+  Future<bool> unsubscribeAudio(String participantId) async {
+    throw UnimplementedError('unsubscribeAudio() has not been implemented.');
+  }
+
+  Stream<String> onAudioDataAvailable() {
+    throw UnimplementedError(
+        'onAudioDataAvailable() has not been implemented.');
+  }
+
+  Future<bool> setSpeakerDetection(bool enabled) async {
+    throw UnimplementedError(
+        'setSpeakerDetection() has not been implemented.');
+  }
+
+  Stream<ActiveSpeakerChange> onActiveSpeakerChanged() {
+    throw UnimplementedError(
+        'onActiveSpeakerChanged() has not been implemented.');
+  }
+
+  Future<bool> startRecording(String directory) async {
+    throw UnimplementedError('startRecording() has not been implemented.');
+  }
+
+  Future<bool> recordVideo(String participantId) async {
+    throw UnimplementedError('recordVideo() has not been implemented.');
+  }
+
+  Future<bool> stopRecording() async {
+    throw UnimplementedError('stopRecording() has not been implemented.');
+  }
+
+  Future<Map<String, int>> recordingStats() async {
+    throw UnimplementedError('recordingStats() has not been implemented.');
+  }
+
+  Future<FramePoolStats> framePoolStats() async {
+    throw UnimplementedError('framePoolStats() has not been implemented.');
+  }
+
+  Future<MemoryStats> getMemoryStats() async {
+    throw UnimplementedError('getMemoryStats() has not been implemented.');
+  }
+
+  Future<bool> setMemoryBudget({int? pluginBytes, int? rssBytes}) async {
+    throw UnimplementedError('setMemoryBudget() has not been implemented.');
+  }
+
+  Stream<MemoryPressureChange> onMemoryPressure() {
+    throw UnimplementedError('onMemoryPressure() has not been implemented.');
+  }
+
+  Future<VideoStats> videoStats() async {
+    throw UnimplementedError('videoStats() has not been implemented.');
+  }
+
+  Future<Map<String, int>> eventQueueStats() async {
+    throw UnimplementedError('eventQueueStats() has not been implemented.');
+  }
+
+  Future<Map<String, int>> startupTimeline() async {
+    throw UnimplementedError('startupTimeline() has not been implemented.');
+  }
+
+  Future<bool> startTrace() async {
+    throw UnimplementedError('startTrace() has not been implemented.');
+  }
+
+  Future<bool> dumpTrace(String path) async {
+    throw UnimplementedError('dumpTrace() has not been implemented.');
+  }
+
   Future<String?> getPlatformVersion() {
     throw UnimplementedError('platformVersion() has not been implemented.');
   }
@@ -0,0 +1,231 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+/// Kinds of roster change, in the order of the native type codes.
+enum RosterDeltaType {
+  joined,
+  left,
+  changed,
+
+  /// The meeting of [RosterDelta.sessionId] ended, and every participant
+  /// in it is gone.
+  sessionEnded,
+}
+
+/// One change to the participant roster, as sent by the native plugin.
+class RosterDelta {
+  /// Size in bytes of an encoded delta before its name.
+  static const int headerSize = 28;
+
+  /// Bits of [changes].
+  static const int nameChanged = 1 << 0;
+  static const int audioChanged = 1 << 1;
+  static const int videoChanged = 1 << 2;
+  static const int handChanged = 1 << 3;
+
+  /// Increases by one for every change to the roster.
+  final int sequence;
+  final RosterDeltaType type;
+
+  /// Session of the participant's meeting, as in
+  /// `MeetingStatusEvent.sessionId`.
+  final int sessionId;
+
+  /// The participant's roster slot. It is fixed while the participant is
+  /// present and only reused after it leaves.
+  final int slot;
+  final int participantId;
+
+  /// What a [RosterDeltaType.changed] delta changed, as a combination of
+  /// [nameChanged], [audioChanged], [videoChanged] and [handChanged].
+  final int changes;
+
+  /// The participant's state after the change.
+  final bool audioMuted;
+  final bool videoOn;
+  final bool handRaised;
+
+  /// Set when joining, and when [changes] includes [nameChanged].
+  final String? displayName;
+
+  const RosterDelta({
+    required this.sequence,
+    required this.type,
+    required this.sessionId,
+    required this.slot,
+    required this.participantId,
+    this.changes = 0,
+    this.audioMuted = false,
+    this.videoOn = false,
+    this.handRaised = false,
+    this.displayName,
+  });
+
+  /// Decodes every delta in a batch written by the native plugin (see
+  /// linux/roster_delta_codec.h).
+  static List<RosterDelta> decodeAll(ByteData data) {
+    final deltas = <RosterDelta>[];
+    var offset = 0;
+    while (offset < data.lengthInBytes) {
+      if (data.lengthInBytes - offset < headerSize) {
+        throw ArgumentError('Roster delta record is too short');
+      }
+      final nameLength = data.getUint32(offset + 24, Endian.little);
+      final paddedLength = (nameLength + 3) & ~3;
+      if (data.lengthInBytes - offset - headerSize < paddedLength) {
+        throw ArgumentError('Roster delta name is cut off');
+      }
+      final typeCode = data.getUint8(offset + 20);
+      final state = data.getUint8(offset + 22);
+      final type = typeCode < RosterDeltaType.values.length
+          ? RosterDeltaType.values[typeCode]
+          : throw ArgumentError('Unknown roster delta type $typeCode');
+      final hasName = type == RosterDeltaType.joined ||
+          (data.getUint8(offset + 21) & nameChanged) != 0;
+      deltas.add(RosterDelta(
+        sequence: data.getUint64(offset, Endian.little),
+        type: type,
+        sessionId: data.getUint32(offset + 8, Endian.little),
+        slot: data.getUint32(offset + 12, Endian.little),
+        participantId: data.getUint32(offset + 16, Endian.little),
+        changes: data.getUint8(offset + 21),
+        audioMuted: (state & 1) != 0,
+        videoOn: (state & 2) != 0,
+        handRaised: (state & 4) != 0,
+        displayName: hasName
+            ? utf8.decode(data.buffer.asUint8List(
+                data.offsetInBytes + offset + headerSize, nameLength))
+            : null,
+      ));
+      offset += headerSize + paddedLength;
+    }
+    return deltas;
+  }
+
+  @override
+  String toString() => 'RosterDelta(#$sequence ${type.name} $participantId '
+      'in session $sessionId, slot $slot)';
+}
+
+/// The answer to `participantSnapshot`: either the deltas since the
+/// requested sequence, or, when [full], the whole roster as joins.
+class RosterSnapshot {
+  /// Sequence of the latest delta included.
+  final int sequence;
+  final bool full;
+  final List<RosterDelta> deltas;
+
+  const RosterSnapshot({
+    required this.sequence,
+    required this.full,
+    required this.deltas,
+  });
+}
+
+/// A present participant, as kept by [ParticipantRoster].
+class RosterParticipant {
+  final int slot;
+  final int sessionId;
+  final int participantId;
+  String displayName;
+  bool audioMuted;
+  bool videoOn;
+  bool handRaised;
+
+  RosterParticipant({
+    required this.slot,
+    required this.sessionId,
+    required this.participantId,
+    required this.displayName,
+    this.audioMuted = false,
+    this.videoOn = false,
+    this.handRaised = false,
+  });
+
+  @override
+  String toString() => 'RosterParticipant($participantId, $displayName)';
+}
+
+/// A Dart copy of the native roster, kept up to date from deltas so that
+/// each update costs the size of the change, not of the meeting.
+///
+/// Feed it every batch from `onParticipantDeltas`. When [apply] reports a
+/// gap, deltas were missed; ask for `participantSnapshot(roster.sequence)`
+/// and pass the result to [applySnapshot].
+class ParticipantRoster {
+  final Map<int, RosterParticipant> _bySlot = {};
+
+  /// Sequence of the latest delta applied.
+  int get sequence => _sequence;
+  int _sequence = 0;
+
+  /// Every present participant, by roster slot.
+  Map<int, RosterParticipant> get participants => _bySlot;
+
+  /// Participants of the meeting with session [sessionId].
+  Iterable<RosterParticipant> participantsOf(int sessionId) =>
+      _bySlot.values.where((p) => p.sessionId == sessionId);
+
+  /// Applies a batch of deltas in order. Deltas already applied are
+  /// skipped. Returns false, and stops, at the first delta that does not
+  /// follow [sequence].
+  bool apply(Iterable<RosterDelta> deltas) {
+    for (final delta in deltas) {
+      if (delta.sequence <= _sequence) {
+        continue;
+      }
+      if (delta.sequence != _sequence + 1) {
+        return false;
+      }
+      _applyOne(delta);
+      _sequence = delta.sequence;
+    }
+    return true;
+  }
+
+  /// Brings the roster up to date with a `participantSnapshot` result.
+  void applySnapshot(RosterSnapshot snapshot) {
+    if (snapshot.full) {
+      _bySlot.clear();
+      snapshot.deltas.forEach(_applyOne);
+      _sequence = snapshot.sequence;
+    } else {
+      apply(snapshot.deltas);
+    }
+  }
+
+  void _applyOne(RosterDelta delta) {
+    switch (delta.type) {
+      case RosterDeltaType.joined:
+        _bySlot[delta.slot] = RosterParticipant(
+          slot: delta.slot,
+          sessionId: delta.sessionId,
+          participantId: delta.participantId,
+          displayName: delta.displayName ?? '',
+          audioMuted: delta.audioMuted,
+          videoOn: delta.videoOn,
+          handRaised: delta.handRaised,
+        );
+        break;
+      case RosterDeltaType.left:
+        _bySlot.remove(delta.slot);
+        break;
+      case RosterDeltaType.changed:
+        final participant = _bySlot[delta.slot];
+        if (participant == null) {
+          break;
+        }
+        if (delta.displayName != null) {
+          participant.displayName = delta.displayName!;
+        }
+        participant
+          ..audioMuted = delta.audioMuted
+          ..videoOn = delta.videoOn
+          ..handRaised = delta.handRaised;
+        break;
+      case RosterDeltaType.sessionEnded:
+        _bySlot.removeWhere((_, p) => p.sessionId == delta.sessionId);
+        break;
+    }
+  }
+}
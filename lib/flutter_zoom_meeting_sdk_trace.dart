@@ -0,0 +1,89 @@
+import 'dart:convert';
+import 'dart:developer';
+
+/// Records Dart-side spans for a Chrome trace.
+///
+/// Timestamps come from [Timeline.now], the same monotonic clock the native
+/// tracer uses, so Dart spans line up with native ones in one trace.
+class ZoomTraceRecorder {
+  /// Chrome trace thread ID under which Dart spans are shown.
+  static const int dartThreadId = 0;
+
+  /// Spans kept per session; later spans are counted in [dropped].
+  static const int maxSpans = 4096;
+
+  final List<_Span> _spans = [];
+  bool _enabled = false;
+  int _dropped = 0;
+
+  bool get enabled => _enabled;
+
+  /// Spans discarded this session because [maxSpans] was reached.
+  int get dropped => _dropped;
+
+  /// Discards previous spans and starts recording.
+  void start() {
+    _spans.clear();
+    _dropped = 0;
+    _enabled = true;
+  }
+
+  void stop() {
+    _enabled = false;
+  }
+
+  /// Runs [body] and records how long its future took as [name] in
+  /// [category]. When recording is off this only calls [body].
+  Future<T> span<T>(String category, String name, Future<T> Function() body) {
+    if (!_enabled) {
+      return body();
+    }
+    final start = Timeline.now;
+    return body().whenComplete(() => _add(category, name, start));
+  }
+
+  void _add(String category, String name, int start) {
+    if (_spans.length == maxSpans) {
+      _dropped++;
+      return;
+    }
+    _spans.add(_Span(category, name, start, Timeline.now - start));
+  }
+
+  /// Serializes the recorded spans as Chrome trace events for process [pid],
+  /// separated by commas and without the surrounding array.
+  String encodeEvents(int pid) {
+    if (_spans.isEmpty) {
+      return '';
+    }
+    final events = <String>[
+      jsonEncode({
+        'ph': 'M',
+        'pid': pid,
+        'tid': dartThreadId,
+        'name': 'thread_name',
+        'args': {'name': 'dart'},
+      }),
+      for (final span in _spans)
+        jsonEncode({
+          'ph': 'X',
+          'cat': span.category,
+          'name': span.name,
+          'pid': pid,
+          'tid': dartThreadId,
+          'ts': span.start,
+          'dur': span.duration,
+        }),
+    ];
+    return events.join(',\n');
+  }
+}
+
+class _Span {
+  final String category;
+  final String name;
+  final int start;
+  final int duration;
+
+  _Span(this.category, this.name, this.start, this.duration);
+}
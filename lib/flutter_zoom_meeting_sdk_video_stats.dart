@@ -0,0 +1,68 @@
+/// Frame counts for one native video mailbox.
+///
+/// A texture keeps only the newest frame it has not drawn yet, so a frame
+/// replaced before the raster thread got to it is [dropped] rather than
+/// queued. A rising [dropRatio] means rendering cannot keep up with the
+/// video, and is worth alerting on.
+class VideoFrameStats {
+  final int produced;
+  final int displayed;
+  final int dropped;
+
+  /// Age of displayed frames when they were converted for upload, from
+  /// their capture time, in microseconds.
+  final int lastAgeUs;
+  final int meanAgeUs;
+  final int maxAgeUs;
+
+  const VideoFrameStats({
+    required this.produced,
+    required this.displayed,
+    required this.dropped,
+    required this.lastAgeUs,
+    required this.meanAgeUs,
+    required this.maxAgeUs,
+  });
+
+  factory VideoFrameStats.fromMap(Map<Object?, Object?> map) =>
+      VideoFrameStats(
+        produced: map['produced'] as int? ?? 0,
+        displayed: map['displayed'] as int? ?? 0,
+        dropped: map['dropped'] as int? ?? 0,
+        lastAgeUs: map['lastAgeUs'] as int? ?? 0,
+        meanAgeUs: map['meanAgeUs'] as int? ?? 0,
+        maxAgeUs: map['maxAgeUs'] as int? ?? 0,
+      );
+
+  /// Share of produced frames that were dropped, 0 before any frame.
+  double get dropRatio => produced == 0 ? 0 : dropped / produced;
+
+  @override
+  String toString() => 'VideoFrameStats(produced $produced, displayed '
+      '$displayed, dropped $dropped, mean age ${meanAgeUs}us)';
+}
+
+/// Frame counts for every participant texture and for the gallery.
+class VideoStats {
+  /// Keyed by participant ID.
+  final Map<String, VideoFrameStats> participants;
+
+  /// Every gallery tile together, or null without a gallery.
+  final VideoFrameStats? gallery;
+
+  const VideoStats({required this.participants, this.gallery});
+
+  factory VideoStats.fromMap(Map<Object?, Object?> map) {
+    final participants =
+        map['participants'] as Map<Object?, Object?>? ?? const {};
+    final gallery = map['gallery'] as Map<Object?, Object?>?;
+    return VideoStats(
+      participants: {
+        for (final entry in participants.entries)
+          '${entry.key}':
+              VideoFrameStats.fromMap(entry.value as Map<Object?, Object?>),
+      },
+      gallery: gallery == null ? null : VideoFrameStats.fromMap(gallery),
+    );
+  }
+}
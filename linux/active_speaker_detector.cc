@@ -0,0 +1,346 @@
+#include "active_speaker_detector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "trace.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Where a new or resumed stream's noise floor starts, low enough that
+// speech right away is voiced.
+constexpr double kInitialNoiseFloorDb = -70;
+// Level reported for digital silence.
+constexpr double kSilenceDb = -100;
+constexpr double kFullScaleSquared = 32768.0 * 32768.0;
+
+constexpr double kVoiceBandLowHz = 300;
+constexpr double kVoiceBandHighHz = 3400;
+constexpr double kButterworthQ = 0.70710678118654752;
+
+// Weight of each new voiced frame in a speaker's smoothed level.
+constexpr double kSpeechLevelSmoothing = 0.2;
+
+// Streams silent this long are forgotten, since their participant has most
+// likely left.
+constexpr int64_t kForgetStreamUs = 30 * 1000 * 1000;
+
+// Sum of the squares of |count| samples. Each 16-bit square is at most
+// 2^30, so the SSE2 path's pairwise sums fit in 32 bits as unsigned.
+uint64_t SumOfSquares(const int16_t* samples, size_t count) {
+  uint64_t sum = 0;
+  size_t i = 0;
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  __m128i total = zero;
+  for (; i + 8 <= count; i += 8) {
+    __m128i values =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+    __m128i pairs = _mm_madd_epi16(values, values);
+    total = _mm_add_epi64(total, _mm_unpacklo_epi32(pairs, zero));
+    total = _mm_add_epi64(total, _mm_unpackhi_epi32(pairs, zero));
+  }
+  uint64_t lanes[2];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), total);
+  sum = lanes[0] + lanes[1];
+#endif
+  for (; i < count; ++i) {
+    sum += static_cast<uint64_t>(static_cast<int32_t>(samples[i]) *
+                                 samples[i]);
+  }
+  return sum;
+}
+
+// Computes a second-order Butterworth high- or low-pass at |cutoff_hz|,
+// normalized so that a0 is 1 (RBJ cookbook).
+void SetButterworth(double cutoff_hz,
+                    int sample_rate,
+                    bool high_pass,
+                    float* b0,
+                    float* b1,
+                    float* b2,
+                    float* a1,
+                    float* a2) {
+  double w0 = 2 * kPi * cutoff_hz / sample_rate;
+  double cos_w0 = std::cos(w0);
+  double alpha = std::sin(w0) / (2 * kButterworthQ);
+  double a0 = 1 + alpha;
+  double b_outer = high_pass ? (1 + cos_w0) / 2 : (1 - cos_w0) / 2;
+  double b_middle = high_pass ? -(1 + cos_w0) : 1 - cos_w0;
+  *b0 = static_cast<float>(b_outer / a0);
+  *b1 = static_cast<float>(b_middle / a0);
+  *b2 = static_cast<float>(b_outer / a0);
+  *a1 = static_cast<float>(-2 * cos_w0 / a0);
+  *a2 = static_cast<float>((1 - alpha) / a0);
+}
+
+}  // namespace
+
+ActiveSpeakerDetector::ActiveSpeakerDetector(const Config& config,
+                                             ChangeCallback on_change,
+                                             Clock clock)
+    : config_(config), on_change_(std::move(on_change)), clock_(clock) {}
+
+ActiveSpeakerDetector::SpeakerState ActiveSpeakerDetector::GetState() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return reported_;
+}
+
+void ActiveSpeakerDetector::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  streams_.clear();
+  active_speaker_ = kNoActiveSpeaker;
+  changed_ = true;
+  ReportIfChanged();
+}
+
+void ActiveSpeakerDetector::OnAudioData(uint32_t participant_id,
+                                        const int16_t* samples,
+                                        size_t frames,
+                                        int sample_rate,
+                                        int channels) {
+  if (sample_rate <= 0 || channels <= 0) {
+    return;
+  }
+  ZOOM_TRACE_SCOPE("audio", "detect_speakers");
+  std::lock_guard<std::mutex> lock(mutex_);
+  int64_t now_us = clock_();
+  if (participant_id != kMixedAudioParticipantId) {
+    Stream& stream = streams_[participant_id];
+    if (stream.sample_rate != sample_rate || stream.channels != channels) {
+      Configure(&stream, sample_rate, channels);
+    } else if (now_us - stream.last_audio_us >=
+               int64_t{config_.release_ms} * 1000) {
+      // Backends stop sending a participant's audio while they are quiet,
+      // so a stream that resumes starts afresh.
+      stream.frame.clear();
+      stream.filter_primed = false;
+      stream.noise_floor_db = kInitialNoiseFloorDb;
+    }
+    stream.last_audio_us = now_us;
+
+    size_t remaining = frames * channels;
+    while (remaining > 0) {
+      size_t count =
+          std::min(remaining, stream.frame_samples - stream.frame.size());
+      stream.frame.insert(stream.frame.end(), samples, samples + count);
+      samples += count;
+      remaining -= count;
+      if (stream.frame.size() == stream.frame_samples) {
+        ScoreFrame(participant_id, &stream);
+        stream.frame.clear();
+      }
+    }
+  }
+  if (now_us >= next_expiry_us_) {
+    ExpireStreams(now_us);
+    next_expiry_us_ = now_us + int64_t{config_.frame_ms} * 1000;
+  }
+  ReportIfChanged();
+}
+
+void ActiveSpeakerDetector::Configure(Stream* stream,
+                                      int sample_rate,
+                                      int channels) {
+  if (stream->speaking) {
+    StopSpeaking(stream);
+  }
+  stream->sample_rate = sample_rate;
+  stream->channels = channels;
+  size_t frame_frames = std::max<size_t>(
+      1, static_cast<size_t>(sample_rate) * config_.frame_ms / 1000);
+  stream->frame_samples = frame_frames * channels;
+  stream->frame.clear();
+  stream->frame.reserve(stream->frame_samples);
+
+  // Keep the upper edge below Nyquist for narrowband streams.
+  double high_hz = std::min(kVoiceBandHighHz, 0.45 * sample_rate);
+  Biquad& hp = stream->high_pass;
+  Biquad& lp = stream->low_pass;
+  SetButterworth(kVoiceBandLowHz, sample_rate, true, &hp.b0, &hp.b1, &hp.b2,
+                 &hp.a1, &hp.a2);
+  SetButterworth(high_hz, sample_rate, false, &lp.b0, &lp.b1, &lp.b2, &lp.a1,
+                 &lp.a2);
+  stream->filter_primed = false;
+
+  stream->noise_floor_db = kInitialNoiseFloorDb;
+  stream->voiced_ms = 0;
+  stream->unvoiced_ms = 0;
+}
+
+void ActiveSpeakerDetector::ScoreFrame(uint32_t participant_id,
+                                       Stream* stream) {
+  double mean_square =
+      static_cast<double>(
+          SumOfSquares(stream->frame.data(), stream->frame.size())) /
+      stream->frame.size();
+  double level_db = mean_square > 0
+                        ? 10 * std::log10(mean_square / kFullScaleSquared)
+                        : kSilenceDb;
+
+  // The band filter only runs on frames loud enough to be speech.
+  bool voiced = false;
+  if (level_db >= config_.min_speech_db &&
+      level_db >= stream->noise_floor_db + config_.speech_margin_db) {
+    voiced = VoiceRatio(stream) >= config_.min_voice_ratio;
+  } else {
+    stream->filter_primed = false;
+  }
+
+  if (level_db < stream->noise_floor_db) {
+    stream->noise_floor_db = level_db;
+  } else {
+    stream->noise_floor_db =
+        std::min(level_db, stream->noise_floor_db +
+                               config_.noise_floor_rise_db_per_s *
+                                   config_.frame_ms / 1000);
+  }
+
+  if (voiced) {
+    if (stream->speaking || stream->voiced_ms > 0) {
+      stream->speech_level_db +=
+          kSpeechLevelSmoothing * (level_db - stream->speech_level_db);
+    } else {
+      stream->speech_level_db = level_db;
+    }
+    stream->voiced_ms += config_.frame_ms;
+    stream->unvoiced_ms = 0;
+    if (!stream->speaking && stream->voiced_ms >= config_.attack_ms) {
+      stream->speaking = true;
+      changed_ = true;
+    }
+  } else {
+    stream->unvoiced_ms += config_.frame_ms;
+    stream->voiced_ms = 0;
+    if (stream->speaking && stream->unvoiced_ms >= config_.release_ms) {
+      StopSpeaking(stream);
+    }
+  }
+  UpdateActiveSpeaker(participant_id, stream);
+}
+
+double ActiveSpeakerDetector::VoiceRatio(Stream* stream) {
+  if (!stream->filter_primed) {
+    stream->high_pass.ClearState();
+    stream->low_pass.ClearState();
+    stream->filter_primed = true;
+  }
+  const int channels = stream->channels;
+  const float scale = 1.0f / channels;
+  const int16_t* samples = stream->frame.data();
+  const size_t frames = stream->frame.size() / channels;
+  double band = 0;
+  double total = 0;
+  for (size_t frame = 0; frame < frames; ++frame) {
+    float sum = 0;
+    for (int channel = 0; channel < channels; ++channel) {
+      sum += samples[frame * channels + channel];
+    }
+    float mono = sum * scale;
+    float filtered =
+        stream->low_pass.Process(stream->high_pass.Process(mono));
+    band += filtered * filtered;
+    total += mono * mono;
+  }
+  return total > 0 ? band / total : 0;
+}
+
+void ActiveSpeakerDetector::StopSpeaking(Stream* stream) {
+  stream->speaking = false;
+  stream->voiced_ms = 0;
+  stream->louder_ms = 0;
+  changed_ = true;
+}
+
+void ActiveSpeakerDetector::ExpireStreams(int64_t now_us) {
+  const int64_t release_us = int64_t{config_.release_ms} * 1000;
+  for (auto it = streams_.begin(); it != streams_.end();) {
+    Stream& stream = it->second;
+    int64_t silent_us = now_us - stream.last_audio_us;
+    if (stream.speaking && silent_us >= release_us) {
+      StopSpeaking(&stream);
+    }
+    if (!stream.speaking && silent_us >= kForgetStreamUs) {
+      it = streams_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  UpdateActiveSpeaker(kNoActiveSpeaker, nullptr);
+}
+
+void ActiveSpeakerDetector::UpdateActiveSpeaker(uint32_t participant_id,
+                                                Stream* stream) {
+  auto active = streams_.find(active_speaker_);
+  if (active == streams_.end() || !active->second.speaking) {
+    uint32_t loudest = LoudestSpeaker();
+    if (loudest != active_speaker_) {
+      active_speaker_ = loudest;
+      changed_ = true;
+    }
+    return;
+  }
+  if (stream == nullptr || participant_id == active_speaker_ ||
+      !stream->speaking) {
+    return;
+  }
+  if (stream->speech_level_db >=
+      active->second.speech_level_db + config_.switch_margin_db) {
+    stream->louder_ms += config_.frame_ms;
+  } else {
+    stream->louder_ms = 0;
+  }
+  if (stream->louder_ms >= config_.switch_hold_ms) {
+    stream->louder_ms = 0;
+    active_speaker_ = participant_id;
+    changed_ = true;
+  }
+}
+
+uint32_t ActiveSpeakerDetector::LoudestSpeaker() const {
+  uint32_t loudest = kNoActiveSpeaker;
+  double loudest_db = 0;
+  for (const auto& entry : streams_) {
+    if (entry.second.speaking && (loudest == kNoActiveSpeaker ||
+                                  entry.second.speech_level_db > loudest_db)) {
+      loudest = entry.first;
+      loudest_db = entry.second.speech_level_db;
+    }
+  }
+  return loudest;
+}
+
+ActiveSpeakerDetector::SpeakerState ActiveSpeakerDetector::BuildState() const {
+  SpeakerState state;
+  state.active_speaker = active_speaker_;
+  for (const auto& entry : streams_) {
+    if (entry.second.speaking) {
+      state.speaking.push_back(entry.first);
+    }
+  }
+  return state;
+}
+
+void ActiveSpeakerDetector::ReportIfChanged() {
+  if (!changed_) {
+    return;
+  }
+  changed_ = false;
+  SpeakerState state = BuildState();
+  if (state == reported_) {
+    return;
+  }
+  reported_ = std::move(state);
+  on_change_(reported_);
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,163 @@
+#ifndef FLUTTER_PLUGIN_ACTIVE_SPEAKER_DETECTOR_H_
+#define FLUTTER_PLUGIN_ACTIVE_SPEAKER_DETECTOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "meeting_backend.h"
+#include "monotonic_clock.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Reported as the active speaker while nobody is speaking. Participant IDs
+// are never 0, which is the meeting mix.
+constexpr uint32_t kNoActiveSpeaker = 0;
+
+// Finds who is speaking in each participant's raw audio and picks an active
+// speaker, reporting only changes.
+//
+// Each stream is scored in short frames at its native rate. A frame's level
+// comes from a SIMD sum of squares; only frames loud enough to matter are
+// band-filtered to measure how much of their energy lies in the voice band,
+// which rejects hiss and hum. A frame is voiced when it is both well above
+// the stream's tracked noise floor and mostly in the voice band. Speaking
+// starts after |attack_ms| of voiced frames and stops after |release_ms|
+// without, or once the stream's audio stops arriving for as long. The
+// active speaker only changes when they stop speaking or another speaker
+// stays clearly louder for |switch_hold_ms|.
+//
+// The meeting mix is never scored but keeps timeouts running.
+class ActiveSpeakerDetector : public MeetingBackend::AudioSink {
+ public:
+  struct Config {
+    int frame_ms = 20;
+    // A voiced frame is this far above the noise floor and above
+    // |min_speech_db|, in dB relative to full scale.
+    double speech_margin_db = 9;
+    double min_speech_db = -55;
+    // Share of a voiced frame's energy in the 300-3400 Hz band.
+    double min_voice_ratio = 0.4;
+    // The noise floor falls to any quieter frame at once and rises this
+    // slowly towards louder ones.
+    double noise_floor_rise_db_per_s = 0.5;
+    int attack_ms = 60;
+    int release_ms = 600;
+    // How much louder, for how long, another speaker must be to take over.
+    double switch_margin_db = 3;
+    int switch_hold_ms = 400;
+  };
+
+  struct SpeakerState {
+    uint32_t active_speaker = kNoActiveSpeaker;
+    // Everybody speaking, in ascending ID order.
+    std::vector<uint32_t> speaking;
+
+    bool operator==(const SpeakerState& other) const {
+      return active_speaker == other.active_speaker &&
+             speaking == other.speaking;
+    }
+  };
+
+  // Called with the new state whenever it changes, on the audio thread or
+  // from Reset(), with the detector locked: it must not call back in.
+  using ChangeCallback = std::function<void(const SpeakerState& state)>;
+
+  // Returns the time in microseconds.
+  using Clock = int64_t (*)();
+
+  ActiveSpeakerDetector(const Config& config,
+                        ChangeCallback on_change,
+                        Clock clock = MonotonicNowUs);
+
+  ActiveSpeakerDetector(const ActiveSpeakerDetector&) = delete;
+  ActiveSpeakerDetector& operator=(const ActiveSpeakerDetector&) = delete;
+
+  SpeakerState GetState() const;
+
+  // Forgets every stream, as when raw audio stops, reporting that nobody
+  // is speaking if somebody was.
+  void Reset();
+
+  // MeetingBackend::AudioSink:
+  void OnAudioData(uint32_t participant_id,
+                   const int16_t* samples,
+                   size_t frames,
+                   int sample_rate,
+                   int channels) override;
+
+ private:
+  // Direct form I biquad section.
+  struct Biquad {
+    float b0 = 1, b1 = 0, b2 = 0, a1 = 0, a2 = 0;
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+
+    float Process(float x) {
+      float y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+      x2 = x1;
+      x1 = x;
+      y2 = y1;
+      y1 = y;
+      return y;
+    }
+    void ClearState() { x1 = x2 = y1 = y2 = 0; }
+  };
+
+  struct Stream {
+    int sample_rate = 0;
+    int channels = 0;
+    // Interleaved samples of the frame being collected, and its full size.
+    std::vector<int16_t> frame;
+    size_t frame_samples = 0;
+    // Voice band filter, and whether its state continues the last frame.
+    Biquad high_pass;
+    Biquad low_pass;
+    bool filter_primed = false;
+
+    double noise_floor_db = 0;
+    // Smoothed level of voiced frames.
+    double speech_level_db = 0;
+    int voiced_ms = 0;
+    int unvoiced_ms = 0;
+    // How long this speaker has been clearly louder than the active one.
+    int louder_ms = 0;
+    bool speaking = false;
+    int64_t last_audio_us = 0;
+  };
+
+  void Configure(Stream* stream, int sample_rate, int channels);
+  // Scores a complete frame and updates |participant_id|'s speaking state
+  // and the active speaker.
+  void ScoreFrame(uint32_t participant_id, Stream* stream);
+  // Returns the share of |stream|'s frame energy in the voice band.
+  double VoiceRatio(Stream* stream);
+  void StopSpeaking(Stream* stream);
+  // Stops speakers whose audio stopped arriving and forgets long silent
+  // streams.
+  void ExpireStreams(int64_t now_us);
+  // Picks a new active speaker if theirs stopped, or lets |stream| take
+  // over once it has been louder for long enough. |stream| is null after
+  // expiry.
+  void UpdateActiveSpeaker(uint32_t participant_id, Stream* stream);
+  uint32_t LoudestSpeaker() const;
+  SpeakerState BuildState() const;
+  void ReportIfChanged();
+
+  const Config config_;
+  const ChangeCallback on_change_;
+  const Clock clock_;
+
+  mutable std::mutex mutex_;
+  std::map<uint32_t, Stream> streams_;
+  uint32_t active_speaker_ = kNoActiveSpeaker;
+  int64_t next_expiry_us_ = 0;
+  bool changed_ = false;
+  SpeakerState reported_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_ACTIVE_SPEAKER_DETECTOR_H_
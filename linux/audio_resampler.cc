@@ -0,0 +1,109 @@
+#include "audio_resampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+// Taps per polyphase branch for a 1:1 bandwidth ratio; scaled up with the
+// decimation factor so the transition band stays proportionally narrow.
+constexpr int kBaseTapsPerPhase = 16;
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Fraction of the target Nyquist frequency kept in the passband.
+constexpr double kPassbandFraction = 0.9;
+
+int16_t ToInt16(float value) {
+  float rounded = std::nearbyint(value);
+  return static_cast<int16_t>(std::clamp(rounded, -32768.0f, 32767.0f));
+}
+
+}  // namespace
+
+StreamingResampler::StreamingResampler(int input_rate,
+                                       int input_channels,
+                                       int output_rate)
+    : input_rate_(input_rate > 0 ? input_rate : output_rate),
+      input_channels_(input_channels > 0 ? input_channels : 1),
+      output_rate_(output_rate) {
+  int divisor = std::gcd(input_rate_, output_rate_);
+  up_ = output_rate_ / divisor;
+  down_ = input_rate_ / divisor;
+  taps_per_phase_ = kBaseTapsPerPhase * std::max(1, (down_ + up_ - 1) / up_);
+
+  // Prototype low-pass at the upsampled rate, cut off at the lower Nyquist
+  // frequency, with a Blackman window. The gain of |up_| makes up for the
+  // zeros that upsampling inserts.
+  const int length = up_ * taps_per_phase_;
+  const double cutoff = kPassbandFraction * 0.5 / std::max(up_, down_);
+  const double center = (length - 1) / 2.0;
+  std::vector<double> prototype(length);
+  double sum = 0;
+  for (int k = 0; k < length; ++k) {
+    double t = k - center;
+    double sinc = t == 0 ? 2 * cutoff
+                         : std::sin(2 * kPi * cutoff * t) / (kPi * t);
+    double window = 0.42 - 0.5 * std::cos(2 * kPi * k / (length - 1)) +
+                    0.08 * std::cos(4 * kPi * k / (length - 1));
+    prototype[k] = sinc * window;
+    sum += prototype[k];
+  }
+
+  // Output sample y at upsampled position t = i * up_ + p is
+  //   sum_j x[i - j] * prototype[p + j * up_].
+  filter_.resize(length);
+  for (int p = 0; p < up_; ++p) {
+    for (int j = 0; j < taps_per_phase_; ++j) {
+      filter_[p * taps_per_phase_ + j] =
+          static_cast<float>(prototype[p + j * up_] * up_ / sum);
+    }
+  }
+
+  history_.assign(taps_per_phase_ - 1, 0.0f);
+  position_ = static_cast<uint64_t>(taps_per_phase_ - 1) * up_;
+}
+
+void StreamingResampler::Process(const int16_t* input,
+                                 size_t frames,
+                                 std::vector<int16_t>* output) {
+  const size_t start = history_.size();
+  history_.resize(start + frames);
+  const float scale = 1.0f / input_channels_;
+  for (size_t frame = 0; frame < frames; ++frame) {
+    const int16_t* samples = input + frame * input_channels_;
+    int mixed = 0;
+    for (int channel = 0; channel < input_channels_; ++channel) {
+      mixed += samples[channel];
+    }
+    history_[start + frame] = mixed * scale;
+  }
+
+  const uint64_t available = history_.size();
+  for (;;) {
+    uint64_t index = position_ / up_;
+    if (index >= available) {
+      break;
+    }
+    const float* taps =
+        filter_.data() + (position_ % up_) * taps_per_phase_;
+    const float* newest = history_.data() + index;
+    float acc = 0;
+    for (int j = 0; j < taps_per_phase_; ++j) {
+      acc += newest[-j] * taps[j];
+    }
+    output->push_back(ToInt16(acc));
+    position_ += down_;
+  }
+
+  // Keep the samples the next output reaches back to.
+  uint64_t keep_from = position_ / up_ - (taps_per_phase_ - 1);
+  keep_from = std::min<uint64_t>(keep_from, history_.size());
+  history_.erase(history_.begin(), history_.begin() + keep_from);
+  position_ -= keep_from * up_;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
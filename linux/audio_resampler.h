@@ -0,0 +1,63 @@
+#ifndef FLUTTER_PLUGIN_AUDIO_RESAMPLER_H_
+#define FLUTTER_PLUGIN_AUDIO_RESAMPLER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+
+// Sample rate delivered to Dart for every audio stream.
+constexpr int kAudioOutputSampleRate = 16000;
+
+// Streaming polyphase resampler from interleaved 16-bit PCM at any rate and
+// channel count to mono at |output_rate|.
+//
+// The input is downmixed, then filtered by a windowed-sinc low-pass at the
+// lower of the two Nyquist rates so downsampling does not alias. Filter state
+// carries across Process() calls, so splitting the input into chunks of any
+// size gives the same output as converting it in one piece.
+class StreamingResampler {
+ public:
+  StreamingResampler(int input_rate,
+                     int input_channels,
+                     int output_rate = kAudioOutputSampleRate);
+
+  StreamingResampler(const StreamingResampler&) = delete;
+  StreamingResampler& operator=(const StreamingResampler&) = delete;
+
+  int input_rate() const { return input_rate_; }
+  int input_channels() const { return input_channels_; }
+  int output_rate() const { return output_rate_; }
+
+  // Converts |frames| interleaved input frames and appends the resulting
+  // samples to |output|.
+  void Process(const int16_t* input,
+               size_t frames,
+               std::vector<int16_t>* output);
+
+ private:
+  const int input_rate_;
+  const int input_channels_;
+  const int output_rate_;
+
+  // The conversion is upsampling by |up_|, filtering, then keeping every
+  // |down_|th sample; only the kept samples are ever computed.
+  int up_;
+  int down_;
+  int taps_per_phase_;
+  // Filter coefficients, grouped by phase: phase p uses
+  // filter_[p * taps_per_phase_ ... (p + 1) * taps_per_phase_).
+  std::vector<float> filter_;
+
+  // Downmixed input not yet consumed, preceded by the taps_per_phase_ - 1
+  // samples the next output still needs.
+  std::vector<float> history_;
+  // Position of the next output sample in the upsampled domain, relative to
+  // history_[0].
+  uint64_t position_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_AUDIO_RESAMPLER_H_
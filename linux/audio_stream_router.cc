@@ -0,0 +1,174 @@
+#include "audio_stream_router.h"
+
+#include <utility>
+
+#include "trace.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+AudioStreamRouter::AudioStreamRouter(MeetingBackend* backend,
+                                     const Config& config,
+                                     NotifyCallback notify)
+    : backend_(backend), config_(config), notify_(std::move(notify)) {}
+
+AudioStreamRouter::~AudioStreamRouter() {
+  if (audio_running_) {
+    backend_->StopRawAudio();
+  }
+}
+
+const PcmRingBuffer* AudioStreamRouter::Subscribe(uint32_t participant_id) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = streams_.find(participant_id);
+    if (it != streams_.end()) {
+      return it->second.ring.get();
+    }
+  }
+
+  std::unique_ptr<PcmRingBuffer> ring = PcmRingBuffer::Create(
+      participant_id, kAudioOutputSampleRate, config_.ring_capacity);
+  if (ring == nullptr) {
+    return nullptr;
+  }
+  const PcmRingBuffer* result = ring.get();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams_[participant_id].ring = std::move(ring);
+  }
+
+  if (!EnsureAudioRunning()) {
+    Unsubscribe(participant_id);
+    return nullptr;
+  }
+  return result;
+}
+
+bool AudioStreamRouter::Unsubscribe(uint32_t participant_id) {
+  Stream stream;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = streams_.find(participant_id);
+    if (it == streams_.end()) {
+      return false;
+    }
+    stream = std::move(it->second);
+    streams_.erase(it);
+  }
+  StopAudioIfUnused();
+  return true;
+}
+
+bool AudioStreamRouter::SetRecorder(MeetingBackend::AudioSink* recorder) {
+  return SetTap(&recorder_, recorder);
+}
+
+bool AudioStreamRouter::SetDetector(MeetingBackend::AudioSink* detector) {
+  return SetTap(&detector_, detector);
+}
+
+bool AudioStreamRouter::SetTap(MeetingBackend::AudioSink** slot,
+                               MeetingBackend::AudioSink* tap) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    *slot = tap;
+  }
+  if (tap == nullptr) {
+    StopAudioIfUnused();
+    return true;
+  }
+  if (!EnsureAudioRunning()) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    *slot = nullptr;
+    return false;
+  }
+  return true;
+}
+
+bool AudioStreamRouter::EnsureAudioRunning() {
+  if (!audio_running_) {
+    audio_running_ = backend_->StartRawAudio(this);
+  }
+  return audio_running_;
+}
+
+void AudioStreamRouter::StopAudioIfUnused() {
+  bool unused;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    unused =
+        streams_.empty() && recorder_ == nullptr && detector_ == nullptr;
+  }
+  // StopRawAudio() waits for an in-flight OnAudioData(), which takes
+  // |mutex_|, so it must be called without holding it.
+  if (unused && audio_running_) {
+    backend_->StopRawAudio();
+    audio_running_ = false;
+  }
+}
+
+void AudioStreamRouter::AcknowledgeNotification(uint32_t participant_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = streams_.find(participant_id);
+  if (it != streams_.end()) {
+    it->second.notify_pending = false;
+  }
+}
+
+void AudioStreamRouter::SetNotifyPort(int64_t port) {
+  notify_port_.store(port, std::memory_order_relaxed);
+}
+
+size_t AudioStreamRouter::stream_count() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return streams_.size();
+}
+
+void AudioStreamRouter::OnAudioData(uint32_t participant_id,
+                                    const int16_t* samples,
+                                    size_t frames,
+                                    int sample_rate,
+                                    int channels) {
+  ZOOM_TRACE_SCOPE("audio", "route_audio");
+  bool notify = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (recorder_ != nullptr) {
+      recorder_->OnAudioData(participant_id, samples, frames, sample_rate,
+                             channels);
+    }
+    if (detector_ != nullptr) {
+      detector_->OnAudioData(participant_id, samples, frames, sample_rate,
+                             channels);
+    }
+    auto it = streams_.find(participant_id);
+    if (it == streams_.end()) {
+      return;
+    }
+    Stream& stream = it->second;
+    if (stream.resampler == nullptr ||
+        stream.resampler->input_rate() != sample_rate ||
+        stream.resampler->input_channels() != channels) {
+      stream.resampler =
+          std::make_unique<StreamingResampler>(sample_rate, channels);
+    }
+
+    scratch_.clear();
+    stream.resampler->Process(samples, frames, &scratch_);
+    stream.ring->Write(scratch_.data(), scratch_.size());
+
+    uint64_t position = stream.ring->write_position();
+    if (!stream.notify_pending &&
+        position - stream.notified_position >= config_.notify_interval) {
+      stream.notify_pending = true;
+      stream.notified_position = position;
+      notify = true;
+    }
+  }
+  if (notify && !PostIntToDart(notify_port_.load(std::memory_order_relaxed),
+                                participant_id)) {
+    notify_(participant_id);
+  }
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,122 @@
+#ifndef FLUTTER_PLUGIN_AUDIO_STREAM_ROUTER_H_
+#define FLUTTER_PLUGIN_AUDIO_STREAM_ROUTER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "audio_resampler.h"
+#include "dart_port.h"
+#include "meeting_backend.h"
+#include "pcm_ring_buffer.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Routes the backend's raw audio into one PcmRingBuffer per subscribed
+// stream (the mix or a single participant), resampled to 16 kHz mono.
+//
+// Raw audio runs only while at least one stream is subscribed or a recorder
+// or detector is attached. Dart learns about new samples through |notify|,
+// or straight from the audio thread through a Dart port once one is set.
+// Either is coalesced: after it fires for a stream it does not fire again
+// until AcknowledgeNotification().
+class AudioStreamRouter : public MeetingBackend::AudioSink {
+ public:
+  struct Config {
+    // Four seconds at 16 kHz.
+    size_t ring_capacity = 65536;
+    // Samples written since the last notification before another is sent.
+    size_t notify_interval = 800;
+  };
+
+  // Called on the audio thread with the participant ID of a stream that has
+  // new samples.
+  using NotifyCallback = std::function<void(uint32_t participant_id)>;
+
+  AudioStreamRouter(MeetingBackend* backend,
+                    const Config& config,
+                    NotifyCallback notify);
+
+  // Stops raw audio if it is running.
+  ~AudioStreamRouter() override;
+
+  AudioStreamRouter(const AudioStreamRouter&) = delete;
+  AudioStreamRouter& operator=(const AudioStreamRouter&) = delete;
+
+  // Main thread only. Returns the ring for |participant_id|, creating it and
+  // starting raw audio as needed, or nullptr if audio is unavailable.
+  const PcmRingBuffer* Subscribe(uint32_t participant_id);
+
+  // Main thread only. Frees the ring; Dart must have stopped reading it.
+  // Returns false if |participant_id| was not subscribed.
+  bool Unsubscribe(uint32_t participant_id);
+
+  // Main thread only. Also hands every raw audio block, before resampling,
+  // to |recorder|, or stops doing so with nullptr. Returns false if raw
+  // audio is unavailable.
+  bool SetRecorder(MeetingBackend::AudioSink* recorder);
+
+  // Main thread only. Like SetRecorder(), for a speaker detector.
+  bool SetDetector(MeetingBackend::AudioSink* detector);
+
+  // Safe to call from any thread. Re-arms notifications for
+  // |participant_id|.
+  void AcknowledgeNotification(uint32_t participant_id);
+
+  // Safe to call from any thread. Posts the participant IDs of streams with
+  // new samples to the Dart port |port| instead of calling |notify|, or
+  // goes back to |notify| with kNoDartPort. |notify| is still called if a
+  // post fails.
+  void SetNotifyPort(int64_t port);
+
+  size_t stream_count() const;
+
+  // MeetingBackend::AudioSink:
+  void OnAudioData(uint32_t participant_id,
+                   const int16_t* samples,
+                   size_t frames,
+                   int sample_rate,
+                   int channels) override;
+
+ private:
+  struct Stream {
+    std::unique_ptr<PcmRingBuffer> ring;
+    std::unique_ptr<StreamingResampler> resampler;
+    uint64_t notified_position = 0;
+    bool notify_pending = false;
+  };
+
+  MeetingBackend* const backend_;
+  const Config config_;
+  const NotifyCallback notify_;
+  std::atomic<int64_t> notify_port_{kNoDartPort};
+
+  // Only touched on the main thread.
+  bool audio_running_ = false;
+
+  // Starts raw audio if it is not running. Main thread only.
+  bool EnsureAudioRunning();
+  // Stops raw audio once nothing needs it. Main thread only.
+  void StopAudioIfUnused();
+
+  // Attaches |tap| to |*slot|, starting raw audio, or detaches it with
+  // nullptr. Main thread only.
+  bool SetTap(MeetingBackend::AudioSink** slot,
+              MeetingBackend::AudioSink* tap);
+
+  // Guards |streams_|, the taps and |scratch_| against the audio thread.
+  mutable std::mutex mutex_;
+  std::map<uint32_t, Stream> streams_;
+  MeetingBackend::AudioSink* recorder_ = nullptr;
+  MeetingBackend::AudioSink* detector_ = nullptr;
+  std::vector<int16_t> scratch_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_AUDIO_STREAM_ROUTER_H_
@@ -0,0 +1,350 @@
+#include "auth_token_cache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+// Returns the value of base64url digit |c|, or -1.
+int Base64UrlDigit(char c) {
+  if (c >= 'A' && c <= 'Z') {
+    return c - 'A';
+  }
+  if (c >= 'a' && c <= 'z') {
+    return c - 'a' + 26;
+  }
+  if (c >= '0' && c <= '9') {
+    return c - '0' + 52;
+  }
+  if (c == '-') {
+    return 62;
+  }
+  if (c == '_') {
+    return 63;
+  }
+  return -1;
+}
+
+// Decodes unpadded or padded base64url.
+bool DecodeBase64Url(const std::string& text, std::string* out) {
+  size_t length = text.size();
+  while (length > 0 && text[length - 1] == '=') {
+    --length;
+  }
+  if (length % 4 == 1) {
+    return false;
+  }
+  out->clear();
+  out->reserve(length * 3 / 4);
+  uint32_t bits = 0;
+  int bit_count = 0;
+  for (size_t i = 0; i < length; ++i) {
+    int digit = Base64UrlDigit(text[i]);
+    if (digit < 0) {
+      return false;
+    }
+    bits = (bits << 6) | static_cast<uint32_t>(digit);
+    bit_count += 6;
+    if (bit_count >= 8) {
+      bit_count -= 8;
+      out->push_back(static_cast<char>((bits >> bit_count) & 0xff));
+    }
+  }
+  return true;
+}
+
+// Just enough of a JSON reader to pick the claims out of a JWT payload.
+// Values other than strings and numbers are skipped over.
+class ClaimsScanner {
+ public:
+  explicit ClaimsScanner(const std::string& json) : json_(json) {}
+
+  bool Scan(JwtClaims* claims, bool* has_iat, bool* has_exp) {
+    int64_t token_exp = 0;
+    bool has_token_exp = false;
+    SkipSpace();
+    if (!Consume('{')) {
+      return false;
+    }
+    SkipSpace();
+    if (Consume('}')) {
+      return false;
+    }
+    do {
+      std::string key;
+      SkipSpace();
+      if (!ReadString(&key)) {
+        return false;
+      }
+      SkipSpace();
+      if (!Consume(':')) {
+        return false;
+      }
+      SkipSpace();
+      if (key == "appKey" || key == "sdkKey") {
+        std::string value;
+        if (!ReadString(&value)) {
+          return false;
+        }
+        if (key == "appKey" || claims->app_key.empty()) {
+          claims->app_key = value;
+        }
+      } else if (key == "iat") {
+        if (!ReadInteger(&claims->issued_at)) {
+          return false;
+        }
+        *has_iat = true;
+      } else if (key == "exp") {
+        if (!ReadInteger(&claims->expires_at)) {
+          return false;
+        }
+        *has_exp = true;
+      } else if (key == "tokenExp") {
+        if (!ReadInteger(&token_exp)) {
+          return false;
+        }
+        has_token_exp = true;
+      } else if (!SkipValue()) {
+        return false;
+      }
+      SkipSpace();
+    } while (Consume(','));
+    if (!Consume('}')) {
+      return false;
+    }
+    if (has_token_exp && *has_exp) {
+      claims->expires_at = std::min(claims->expires_at, token_exp);
+    }
+    return true;
+  }
+
+ private:
+  bool AtEnd() const { return position_ >= json_.size(); }
+
+  void SkipSpace() {
+    while (!AtEnd() && (json_[position_] == ' ' || json_[position_] == '\t' ||
+                        json_[position_] == '\n' || json_[position_] == '\r')) {
+      ++position_;
+    }
+  }
+
+  bool Consume(char c) {
+    if (AtEnd() || json_[position_] != c) {
+      return false;
+    }
+    ++position_;
+    return true;
+  }
+
+  // Reads a string, keeping escapes other than \" and \\ as they are,
+  // since claim names and app keys never use them.
+  bool ReadString(std::string* out) {
+    if (!Consume('"')) {
+      return false;
+    }
+    out->clear();
+    while (!AtEnd()) {
+      char c = json_[position_++];
+      if (c == '"') {
+        return true;
+      }
+      if (c == '\\') {
+        if (AtEnd()) {
+          return false;
+        }
+        char escaped = json_[position_++];
+        if (escaped != '"' && escaped != '\\') {
+          out->push_back('\\');
+        }
+        c = escaped;
+      }
+      out->push_back(c);
+    }
+    return false;
+  }
+
+  // Reads a number, dropping any fraction. Exponents are not accepted.
+  bool ReadInteger(int64_t* out) {
+    size_t start = position_;
+    Consume('-');
+    size_t digits = position_;
+    while (!AtEnd() && json_[position_] >= '0' && json_[position_] <= '9') {
+      ++position_;
+    }
+    if (position_ == digits || position_ - digits > 18) {
+      return false;
+    }
+    *out = std::strtoll(json_.c_str() + start, nullptr, 10);
+    if (Consume('.')) {
+      while (!AtEnd() && json_[position_] >= '0' && json_[position_] <= '9') {
+        ++position_;
+      }
+    }
+    return AtEnd() || (json_[position_] != 'e' && json_[position_] != 'E');
+  }
+
+  // Skips a value of any type, tracking nesting and strings.
+  bool SkipValue() {
+    int depth = 0;
+    bool skipped = false;
+    std::string ignored;
+    while (true) {
+      SkipSpace();
+      if (AtEnd()) {
+        return false;
+      }
+      char c = json_[position_];
+      if (depth == 0 && (c == ',' || c == '}')) {
+        return skipped;
+      }
+      if (c == '"') {
+        if (!ReadString(&ignored)) {
+          return false;
+        }
+      } else {
+        if (c == '{' || c == '[') {
+          ++depth;
+        } else if (c == '}' || c == ']') {
+          if (depth == 0) {
+            return false;
+          }
+          --depth;
+        }
+        ++position_;
+      }
+      skipped = true;
+    }
+  }
+
+  const std::string& json_;
+  size_t position_ = 0;
+};
+
+// FNV-1a, so that a token's jitter is the same in every process.
+uint64_t HashToken(const std::string& token) {
+  uint64_t hash = 14695981039346656037ull;
+  for (char c : token) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+}  // namespace
+
+bool ParseJwtClaims(const std::string& token, JwtClaims* claims) {
+  size_t first_dot = token.find('.');
+  if (first_dot == std::string::npos) {
+    return false;
+  }
+  size_t second_dot = token.find('.', first_dot + 1);
+  if (second_dot == std::string::npos ||
+      token.find('.', second_dot + 1) != std::string::npos) {
+    return false;
+  }
+  std::string payload;
+  if (!DecodeBase64Url(
+          token.substr(first_dot + 1, second_dot - first_dot - 1),
+          &payload)) {
+    return false;
+  }
+  JwtClaims parsed;
+  bool has_iat = false;
+  bool has_exp = false;
+  if (!ClaimsScanner(payload).Scan(&parsed, &has_iat, &has_exp) ||
+      !has_iat || !has_exp || parsed.expires_at <= parsed.issued_at) {
+    return false;
+  }
+  *claims = parsed;
+  return true;
+}
+
+AuthTokenCache::AuthTokenCache(const Config& config, Clock clock)
+    : config_(config), clock_(clock) {}
+
+int64_t AuthTokenCache::UnixNowSeconds() {
+  return std::chrono::duration_cast<std::chrono::seconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+AuthTokenCache::Status AuthTokenCache::Store(const std::string& token) {
+  Token entry;
+  if (!ParseJwtClaims(token, &entry.claims)) {
+    return Status::kMalformed;
+  }
+  int64_t now = clock_();
+  if (entry.claims.expires_at <= now) {
+    return Status::kExpired;
+  }
+  entry.token = token;
+  int64_t lifetime = entry.claims.expires_at - entry.claims.issued_at;
+  int64_t lead = std::min(config_.refresh_lead_s, lifetime / 4);
+  int64_t jitter =
+      config_.refresh_jitter_s > 0
+          ? static_cast<int64_t>(HashToken(token) %
+                                 static_cast<uint64_t>(
+                                     config_.refresh_jitter_s + 1))
+          : 0;
+  entry.refresh_at = std::max(entry.claims.issued_at,
+                              entry.claims.expires_at - lead - jitter);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  DropExpired(now);
+  std::string app_key = entry.claims.app_key;
+  auto existing = entries_.find(app_key);
+  if (existing == entries_.end() ||
+      existing->second.token.claims.expires_at < entry.claims.expires_at) {
+    entries_[app_key] = Entry{std::move(entry), false};
+  }
+  last_app_key_ = app_key;
+  return Status::kValid;
+}
+
+std::string AuthTokenCache::Get(const std::string& app_key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  DropExpired(clock_());
+  auto entry = entries_.find(app_key.empty() ? last_app_key_ : app_key);
+  return entry == entries_.end() ? std::string() : entry->second.token.token;
+}
+
+int64_t AuthTokenCache::NextRefreshAt() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  int64_t next = 0;
+  for (const auto& entry : entries_) {
+    if (!entry.second.reported &&
+        (next == 0 || entry.second.token.refresh_at < next)) {
+      next = entry.second.token.refresh_at;
+    }
+  }
+  return next;
+}
+
+std::vector<AuthTokenCache::Token> AuthTokenCache::TakeDue() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  int64_t now = clock_();
+  DropExpired(now);
+  std::vector<Token> due;
+  for (auto& entry : entries_) {
+    if (!entry.second.reported && entry.second.token.refresh_at <= now) {
+      entry.second.reported = true;
+      due.push_back(entry.second.token);
+    }
+  }
+  return due;
+}
+
+void AuthTokenCache::DropExpired(int64_t now) {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.token.claims.expires_at <= now) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,101 @@
+#ifndef FLUTTER_PLUGIN_AUTH_TOKEN_CACHE_H_
+#define FLUTTER_PLUGIN_AUTH_TOKEN_CACHE_H_
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+
+// The claims of a Meeting SDK JWT that the plugin schedules around.
+struct JwtClaims {
+  // "appKey", or "sdkKey" in newer tokens.
+  std::string app_key;
+  // Unix time in seconds. |expires_at| is the earlier of "exp" and, when
+  // present, "tokenExp".
+  int64_t issued_at = 0;
+  int64_t expires_at = 0;
+};
+
+// Reads the claims from the payload of |token| without checking its
+// signature, which only Zoom can. Returns false unless |token| is three
+// base64url parts whose payload is a JSON object with integer "iat" and
+// "exp" claims, "exp" after "iat".
+bool ParseJwtClaims(const std::string& token, JwtClaims* claims);
+
+// Valid SDK tokens for each app key, and when each is due for a refresh.
+//
+// A token is due |refresh_lead_s| before it expires, or a quarter of its
+// lifetime before for short-lived tokens, and a further share of
+// |refresh_jitter_s| earlier picked from the token itself, so that a fleet
+// holding tokens minted together does not refresh them all at once. Each
+// token is reported due once. Tokens are dropped once expired.
+//
+// Safe to use from any thread.
+class AuthTokenCache {
+ public:
+  struct Config {
+    int64_t refresh_lead_s = 300;
+    int64_t refresh_jitter_s = 120;
+  };
+
+  enum class Status {
+    kValid,
+    // Not a JWT with the claims above.
+    kMalformed,
+    kExpired,
+  };
+
+  struct Token {
+    std::string token;
+    JwtClaims claims;
+    // Unix time in seconds when the token should be replaced.
+    int64_t refresh_at = 0;
+  };
+
+  // Returns Unix time in seconds.
+  using Clock = int64_t (*)();
+
+  explicit AuthTokenCache(const Config& config, Clock clock = UnixNowSeconds);
+
+  AuthTokenCache(const AuthTokenCache&) = delete;
+  AuthTokenCache& operator=(const AuthTokenCache&) = delete;
+
+  static int64_t UnixNowSeconds();
+
+  // Checks |token| and caches it for its app key if it is valid, unless a
+  // token that expires later is cached already.
+  Status Store(const std::string& token);
+
+  // Returns the cached token for |app_key|, or for the app key stored last
+  // if it is empty, or an empty string if there is none or it expired.
+  std::string Get(const std::string& app_key);
+
+  // Returns when the next cached token is due for a refresh, or 0 if none
+  // is left to report.
+  int64_t NextRefreshAt() const;
+
+  // Returns the tokens due for a refresh that have not been reported yet.
+  std::vector<Token> TakeDue();
+
+ private:
+  struct Entry {
+    Token token;
+    bool reported = false;
+  };
+
+  void DropExpired(int64_t now);
+
+  const Config config_;
+  const Clock clock_;
+
+  mutable std::mutex mutex_;
+  std::map<std::string, Entry> entries_;
+  std::string last_app_key_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_AUTH_TOKEN_CACHE_H_
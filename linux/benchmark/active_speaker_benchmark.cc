@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "active_speaker_detector.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace {
+
+constexpr int kRate = 48000;
+constexpr int kChannels = 2;
+constexpr size_t kChunkFrames = kRate / 100;
+
+// One 10 ms round of audio for state.range(0) participants at 48 kHz
+// stereo, as the SDK delivers it, of whom state.range(1) are talking and
+// the rest send low background noise.
+void BM_ActiveSpeakerRound(benchmark::State& state) {
+  const auto streams = static_cast<uint32_t>(state.range(0));
+  const auto talking = static_cast<uint32_t>(state.range(1));
+  std::vector<int16_t> speech(kChunkFrames * kChannels);
+  std::vector<int16_t> quiet(kChunkFrames * kChannels);
+  uint32_t noise = 1;
+  for (size_t frame = 0; frame < kChunkFrames; ++frame) {
+    auto sample = static_cast<int16_t>(
+        8192 * std::sin(2 * M_PI * 440.0 * frame / kRate));
+    noise = noise * 1664525 + 1013904223;
+    auto hiss = static_cast<int16_t>(static_cast<int32_t>(noise >> 16) - 32768);
+    for (int channel = 0; channel < kChannels; ++channel) {
+      speech[frame * kChannels + channel] = sample;
+      quiet[frame * kChannels + channel] = static_cast<int16_t>(hiss / 256);
+    }
+  }
+
+  ActiveSpeakerDetector detector(
+      ActiveSpeakerDetector::Config(),
+      [](const ActiveSpeakerDetector::SpeakerState&) {});
+  for (auto _ : state) {
+    for (uint32_t i = 0; i < streams; ++i) {
+      const std::vector<int16_t>& chunk = i < talking ? speech : quiet;
+      detector.OnAudioData(1000 + i, chunk.data(), kChunkFrames, kRate,
+                           kChannels);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * streams * kChunkFrames);
+}
+BENCHMARK(BM_ActiveSpeakerRound)
+    ->Args({1, 1})
+    ->Args({50, 0})
+    ->Args({50, 5})
+    ->Args({50, 50});
+
+}  // namespace
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <memory>
+
+#include "video_frame.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace {
+
+// Allocates and drops a frame, as every received frame does.
+void BM_VideoFrameAllocate(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  for (auto _ : state) {
+    std::shared_ptr<VideoFrame> frame = VideoFrame::Allocate(width, height);
+    benchmark::DoNotOptimize(frame->mutable_data_y());
+  }
+}
+BENCHMARK(BM_VideoFrameAllocate)
+    ->Args({640, 360})
+    ->Args({1280, 720})
+    ->Args({1920, 1080})
+    ->ThreadRange(1, 8);
+
+// The same with the planes written, so untouched pages are paid for.
+void BM_VideoFrameAllocateAndFill(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  for (auto _ : state) {
+    std::shared_ptr<VideoFrame> frame = VideoFrame::Allocate(width, height);
+    memset(frame->mutable_data_y(), 0,
+           static_cast<size_t>(frame->stride_y()) * height);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_VideoFrameAllocateAndFill)
+    ->Args({640, 360})
+    ->Args({1280, 720})
+    ->Args({1920, 1080});
+
+}  // namespace
+}  // namespace flutter_zoom_meeting_sdk
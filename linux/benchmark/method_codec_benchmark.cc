@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+#include <flutter_linux/flutter_linux.h>
+
+#include "flutter_zoom_meeting_sdk_plugin_private.h"
+#include "meeting_backend.h"
+#include "meeting_options_codec.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace {
+
+// The string map MethodChannelZoom.joinMeeting sends.
+FlValue* JoinArguments() {
+  FlValue* args = fl_value_new_map();
+  fl_value_set_string_take(args, "userId", fl_value_new_string("bot"));
+  fl_value_set_string_take(args, "meetingId",
+                           fl_value_new_string("84512345678"));
+  fl_value_set_string_take(args, "meetingPassword",
+                           fl_value_new_string("s3cr3t"));
+  fl_value_set_string_take(args, "disableDialIn", fl_value_new_string("true"));
+  fl_value_set_string_take(args, "disableDrive", fl_value_new_string("true"));
+  fl_value_set_string_take(args, "disableInvite",
+                           fl_value_new_string("true"));
+  fl_value_set_string_take(args, "disableShare", fl_value_new_string("false"));
+  fl_value_set_string_take(args, "noDisconnectAudio",
+                           fl_value_new_string("false"));
+  fl_value_set_string_take(args, "noAudio", fl_value_new_string("false"));
+  fl_value_set_string_take(args, "meetingViewOptions",
+                           fl_value_new_string("130"));
+  return args;
+}
+
+// Encodes a "join" call the way the engine does before handing it to Dart.
+void BM_EncodeJoinCall(benchmark::State& state) {
+  g_autoptr(FlStandardMethodCodec) codec = fl_standard_method_codec_new();
+  g_autoptr(FlValue) args = JoinArguments();
+  size_t bytes = 0;
+  for (auto _ : state) {
+    g_autoptr(GBytes) message = fl_method_codec_encode_method_call(
+        FL_METHOD_CODEC(codec), "join", args, nullptr);
+    bytes = g_bytes_get_size(message);
+    benchmark::DoNotOptimize(message);
+  }
+  state.counters["bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(BM_EncodeJoinCall);
+
+// Decodes a "join" call and reads it into MeetingOptions, the work the plugin
+// does on the main loop for every join.
+void BM_DecodeJoinCall(benchmark::State& state) {
+  g_autoptr(FlStandardMethodCodec) codec = fl_standard_method_codec_new();
+  g_autoptr(FlValue) args = JoinArguments();
+  g_autoptr(GBytes) message = fl_method_codec_encode_method_call(
+      FL_METHOD_CODEC(codec), "join", args, nullptr);
+  for (auto _ : state) {
+    g_autofree gchar* name = nullptr;
+    g_autoptr(FlValue) decoded = nullptr;
+    if (!fl_method_codec_decode_method_call(FL_METHOD_CODEC(codec), message,
+                                            &name, &decoded, nullptr)) {
+      state.SkipWithError("decode failed");
+      return;
+    }
+    MeetingOptions options = parse_meeting_options(decoded);
+    benchmark::DoNotOptimize(options);
+  }
+  state.counters["bytes"] = static_cast<double>(g_bytes_get_size(message));
+}
+BENCHMARK(BM_DecodeJoinCall);
+
+// The same "join" call with the options packed as sent on Linux.
+void BM_DecodePackedJoinCall(benchmark::State& state) {
+  g_autoptr(FlStandardMethodCodec) codec = fl_standard_method_codec_new();
+  g_autoptr(FlValue) map = JoinArguments();
+  std::vector<uint8_t> packed =
+      EncodeMeetingOptions(parse_meeting_options(map));
+  g_autoptr(FlValue) args = fl_value_new_uint8_list(packed.data(),
+                                                    packed.size());
+  g_autoptr(GBytes) message = fl_method_codec_encode_method_call(
+      FL_METHOD_CODEC(codec), "join", args, nullptr);
+  for (auto _ : state) {
+    g_autofree gchar* name = nullptr;
+    g_autoptr(FlValue) decoded = nullptr;
+    MeetingOptions options;
+    if (!fl_method_codec_decode_method_call(FL_METHOD_CODEC(codec), message,
+                                            &name, &decoded, nullptr) ||
+        !read_meeting_options(decoded, &options)) {
+      state.SkipWithError("decode failed");
+      return;
+    }
+    benchmark::DoNotOptimize(options);
+  }
+  state.counters["bytes"] = static_cast<double>(g_bytes_get_size(message));
+}
+BENCHMARK(BM_DecodePackedJoinCall);
+
+// Encodes one zoom_event_stream [name, message] event.
+void BM_EncodeStatusStreamEvent(benchmark::State& state) {
+  g_autoptr(FlStandardMethodCodec) codec = fl_standard_method_codec_new();
+  for (auto _ : state) {
+    g_autoptr(FlValue) event = meeting_status_value(MeetingStatus::kInMeeting);
+    g_autoptr(GBytes) message = fl_method_codec_encode_success_envelope(
+        FL_METHOD_CODEC(codec), event, nullptr);
+    benchmark::DoNotOptimize(message);
+  }
+}
+BENCHMARK(BM_EncodeStatusStreamEvent);
+
+}  // namespace
+}  // namespace flutter_zoom_meeting_sdk
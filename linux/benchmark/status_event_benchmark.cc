@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "monotonic_clock.h"
+#include "status_event_codec.h"
+#include "status_event_queue.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace {
+
+constexpr size_t kQueueCapacity = 1024;
+
+MeetingStatusEvent MakeEvent(uint64_t sequence) {
+  MeetingStatusEvent event;
+  event.status = MeetingStatus::kInMeeting;
+  event.sequence = sequence;
+  event.timestamp_us = MonotonicNowUs();
+  return event;
+}
+
+// Pushes a burst of state.range(0) events and drains it as one batch, the
+// path every SDK status callback takes to the main loop.
+void BM_StatusEventQueueBurst(benchmark::State& state) {
+  const size_t burst = static_cast<size_t>(state.range(0));
+  StatusEventQueue queue(kQueueCapacity);
+  std::vector<MeetingStatusEvent> batch;
+  uint64_t sequence = 0;
+  for (auto _ : state) {
+    for (size_t i = 0; i < burst; ++i) {
+      queue.Push(MakeEvent(++sequence));
+    }
+    benchmark::DoNotOptimize(queue.Drain(&batch));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * burst));
+}
+BENCHMARK(BM_StatusEventQueueBurst)->Arg(1)->Arg(16)->Arg(256);
+
+// Several producer threads push into one queue while thread 0 also drains
+// it, as SDK callback threads and the main loop do.
+void BM_StatusEventQueueContended(benchmark::State& state) {
+  static StatusEventQueue* queue = nullptr;
+  static std::vector<MeetingStatusEvent>* batch = nullptr;
+  if (state.thread_index() == 0) {
+    queue = new StatusEventQueue(kQueueCapacity);
+    batch = new std::vector<MeetingStatusEvent>();
+  }
+  uint64_t sequence = 0;
+  for (auto _ : state) {
+    queue->Push(MakeEvent(++sequence));
+    if (state.thread_index() == 0) {
+      queue->Drain(batch);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    state.counters["dropped"] =
+        static_cast<double>(queue->GetStats().dropped);
+    delete queue;
+    delete batch;
+  }
+}
+BENCHMARK(BM_StatusEventQueueContended)->ThreadRange(1, 4)->UseRealTime();
+
+// Encodes and decodes the binary records sent on zoom_status_events for a
+// batch of state.range(0) events.
+void BM_StatusEventCodecBatch(benchmark::State& state) {
+  const size_t count = static_cast<size_t>(state.range(0));
+  std::vector<MeetingStatusEvent> events;
+  for (size_t i = 0; i < count; ++i) {
+    events.push_back(MakeEvent(i));
+  }
+  std::vector<uint8_t> records(count * kStatusEventRecordSize);
+  for (auto _ : state) {
+    for (size_t i = 0; i < count; ++i) {
+      EncodeStatusEvent(events[i], records.data() + i * kStatusEventRecordSize);
+    }
+    for (size_t i = 0; i < count; ++i) {
+      MeetingStatusEvent decoded;
+      DecodeStatusEvent(records.data() + i * kStatusEventRecordSize,
+                        kStatusEventRecordSize, &decoded);
+      benchmark::DoNotOptimize(decoded);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_StatusEventCodecBatch)->Arg(1)->Arg(64);
+
+}  // namespace
+}  // namespace flutter_zoom_meeting_sdk
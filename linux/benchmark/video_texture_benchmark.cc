@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <vector>
+
+#include "gallery_compositor.h"
+#include "video_frame.h"
+#include "video_renderer.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace {
+
+std::shared_ptr<VideoFrame> GreyFrame(int width, int height) {
+  std::shared_ptr<VideoFrame> frame = VideoFrame::Allocate(width, height);
+  memset(frame->mutable_data_y(), 120,
+         static_cast<size_t>(frame->stride_y()) * height);
+  memset(frame->mutable_data_u(), 128,
+         static_cast<size_t>(frame->stride_u()) * frame->chroma_height());
+  memset(frame->mutable_data_v(), 128,
+         static_cast<size_t>(frame->stride_v()) * frame->chroma_height());
+  return frame;
+}
+
+// Hands a frame to a participant texture and renders it, the receive thread
+// and raster thread halves of one subscribeVideo frame.
+void BM_VideoTextureFrame(benchmark::State& state) {
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  std::shared_ptr<VideoFrame> frame = GreyFrame(width, height);
+  VideoRenderer renderer;
+  const uint8_t* rgba = nullptr;
+  uint32_t out_width = 0;
+  uint32_t out_height = 0;
+  for (auto _ : state) {
+    renderer.Push(frame);
+    if (!renderer.Render(&rgba, &out_width, &out_height)) {
+      state.SkipWithError("render failed");
+      return;
+    }
+    benchmark::DoNotOptimize(rgba);
+  }
+  state.counters["fps"] = benchmark::Counter(
+      static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_VideoTextureFrame)->Args({640, 360})->Args({1280, 720});
+
+// Renders one frame for each of 25 participant textures in a 5x5 grid, each
+// receiving 1080p video and drawn state.range(0) x state.range(1) pixels on
+// screen. 0 x 0 reports no display size, so every frame is converted at
+// full resolution.
+void BM_GalleryTexturesAtDisplaySize(benchmark::State& state) {
+  constexpr int kTextures = 25;
+  std::shared_ptr<VideoFrame> frame = GreyFrame(1920, 1080);
+  std::vector<VideoRenderer> renderers(kTextures);
+  for (VideoRenderer& renderer : renderers) {
+    renderer.SetDisplaySize(static_cast<int>(state.range(0)),
+                            static_cast<int>(state.range(1)));
+  }
+  const uint8_t* rgba = nullptr;
+  uint32_t out_width = 0;
+  uint32_t out_height = 0;
+  for (auto _ : state) {
+    for (VideoRenderer& renderer : renderers) {
+      renderer.Push(frame);
+      renderer.Render(&rgba, &out_width, &out_height);
+      benchmark::DoNotOptimize(rgba);
+    }
+  }
+  state.counters["fps"] = benchmark::Counter(
+      static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+  state.counters["upload_bytes"] =
+      static_cast<double>(out_width) * out_height * 4 * kTextures;
+}
+BENCHMARK(BM_GalleryTexturesAtDisplaySize)
+    ->Args({0, 0})
+    ->Args({384, 216})
+    ->Args({256, 144});
+
+// Renders a 1280x720 gallery of state.range(0) x state.range(0) tiles where
+// every participant has a new 640x360 frame.
+void BM_GalleryFrame(benchmark::State& state) {
+  const int columns = static_cast<int>(state.range(0));
+  const int atlas_width = 1280;
+  const int atlas_height = 720;
+  const int tile_width = atlas_width / columns;
+  const int tile_height = atlas_height / columns;
+  std::vector<GalleryTile> tiles;
+  for (int row = 0; row < columns; ++row) {
+    for (int column = 0; column < columns; ++column) {
+      GalleryTile tile;
+      tile.participant_id = static_cast<uint32_t>(row * columns + column + 1);
+      tile.x = column * tile_width;
+      tile.y = row * tile_height;
+      tile.width = tile_width;
+      tile.height = tile_height;
+      tiles.push_back(tile);
+    }
+  }
+  GalleryCompositor compositor;
+  if (!compositor.SetLayout(atlas_width, atlas_height, tiles)) {
+    state.SkipWithError("invalid layout");
+    return;
+  }
+  std::shared_ptr<VideoFrame> frame = GreyFrame(640, 360);
+  const uint8_t* rgba = nullptr;
+  uint32_t out_width = 0;
+  uint32_t out_height = 0;
+  for (auto _ : state) {
+    for (const GalleryTile& tile : tiles) {
+      compositor.Push(tile.participant_id, frame);
+    }
+    compositor.Render(&rgba, &out_width, &out_height);
+    benchmark::DoNotOptimize(rgba);
+  }
+  state.counters["fps"] = benchmark::Counter(
+      static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_GalleryFrame)->Arg(2)->Arg(3)->Arg(5);
+
+}  // namespace
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "yuv_convert.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace {
+
+enum class Format {
+  kI420,
+  kNv12,
+};
+
+// Converts one frame per iteration. The "Mpixels" counter is reported as a
+// rate, i.e. megapixels per second.
+void BM_YuvToRgba(benchmark::State& state,
+                  YuvKernel kernel,
+                  Format format,
+                  YuvMatrix matrix) {
+  if (!IsYuvKernelSupported(kernel)) {
+    state.SkipWithError("kernel not supported on this CPU");
+    return;
+  }
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  const int chroma_width = (width + 1) / 2;
+  const int chroma_height = (height + 1) / 2;
+  std::vector<uint8_t> y(static_cast<size_t>(width) * height, 120);
+  std::vector<uint8_t> u(static_cast<size_t>(chroma_width) * chroma_height, 90);
+  std::vector<uint8_t> v(static_cast<size_t>(chroma_width) * chroma_height,
+                         200);
+  std::vector<uint8_t> uv(static_cast<size_t>(chroma_width) * 2 * chroma_height,
+                          128);
+  std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+
+  for (auto _ : state) {
+    if (format == Format::kI420) {
+      I420ToRgbaWithKernel(kernel, y.data(), width, u.data(), chroma_width,
+                           v.data(), chroma_width, rgba.data(), width * 4,
+                           width, height, matrix, YuvRange::kLimited);
+    } else {
+      Nv12ToRgbaWithKernel(kernel, y.data(), width, uv.data(),
+                           chroma_width * 2, rgba.data(), width * 4, width,
+                           height, matrix, YuvRange::kLimited);
+    }
+    benchmark::DoNotOptimize(rgba.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.counters["Mpixels"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * width * height / 1e6,
+      benchmark::Counter::kIsRate);
+}
+
+#define YUV_BENCHMARK(name, kernel, format)                                 \
+  BENCHMARK_CAPTURE(BM_YuvToRgba, name, kernel, format, YuvMatrix::kBt601) \
+      ->Args({640, 360})                                                    \
+      ->Args({1280, 720})                                                   \
+      ->Args({1920, 1080})
+
+YUV_BENCHMARK(i420_scalar, YuvKernel::kScalar, Format::kI420);
+YUV_BENCHMARK(i420_sse2, YuvKernel::kSse2, Format::kI420);
+YUV_BENCHMARK(i420_avx2, YuvKernel::kAvx2, Format::kI420);
+YUV_BENCHMARK(nv12_scalar, YuvKernel::kScalar, Format::kNv12);
+YUV_BENCHMARK(nv12_sse2, YuvKernel::kSse2, Format::kNv12);
+YUV_BENCHMARK(nv12_avx2, YuvKernel::kAvx2, Format::kNv12);
+
+// Scales a 1920x1080 I420 frame to state.range(0) x state.range(1) while
+// converting it. "Mpixels" counts source pixels, to compare with the
+// full-size conversions above.
+void BM_I420ScaleToRgba(benchmark::State& state, YuvKernel kernel) {
+  if (!IsYuvKernelSupported(kernel)) {
+    state.SkipWithError("kernel not supported on this CPU");
+    return;
+  }
+  const int src_width = 1920;
+  const int src_height = 1080;
+  const int width = static_cast<int>(state.range(0));
+  const int height = static_cast<int>(state.range(1));
+  std::vector<uint8_t> y(static_cast<size_t>(src_width) * src_height, 120);
+  std::vector<uint8_t> u(static_cast<size_t>(src_width / 2) * src_height / 2,
+                         90);
+  std::vector<uint8_t> v(static_cast<size_t>(src_width / 2) * src_height / 2,
+                         200);
+  std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+
+  for (auto _ : state) {
+    I420ScaleToRgbaWithKernel(kernel, y.data(), src_width, u.data(),
+                              src_width / 2, v.data(), src_width / 2,
+                              src_width, src_height, rgba.data(), width * 4,
+                              width, height, YuvMatrix::kBt601,
+                              YuvRange::kLimited);
+    benchmark::DoNotOptimize(rgba.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.counters["Mpixels"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) * src_width * src_height / 1e6,
+      benchmark::Counter::kIsRate);
+}
+
+#define YUV_SCALE_BENCHMARK(name, kernel)             \
+  BENCHMARK_CAPTURE(BM_I420ScaleToRgba, name, kernel) \
+      ->Args({640, 360})                              \
+      ->Args({384, 216})                              \
+      ->Args({256, 144})
+
+YUV_SCALE_BENCHMARK(scale_scalar, YuvKernel::kScalar);
+YUV_SCALE_BENCHMARK(scale_sse2, YuvKernel::kSse2);
+YUV_SCALE_BENCHMARK(scale_avx2, YuvKernel::kAvx2);
+
+BENCHMARK_CAPTURE(BM_YuvToRgba,
+                  i420_avx2_bt709,
+                  YuvKernel::kAvx2,
+                  Format::kI420,
+                  YuvMatrix::kBt709)
+    ->Args({1280, 720});
+
+}  // namespace
+}  // namespace flutter_zoom_meeting_sdk
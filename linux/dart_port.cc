@@ -0,0 +1,48 @@
+#include "dart_port.h"
+
+#include <atomic>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+// Dart_CObject_kInt64 in dart_native_api.h.
+constexpr int32_t kDartCObjectInt64 = 3;
+
+// The start of Dart_CObject from dart_native_api.h, which is all
+// Dart_PostCObject reads of an int message. Building it here keeps the Dart
+// SDK headers out of the build.
+struct DartCObject {
+  int32_t type;
+  union {
+    int64_t as_int64;
+    // Dart_CObject's largest member, so the size matches.
+    void* padding[5];
+  } value;
+};
+
+std::atomic<DartPostCObjectFunction> post_cobject_function{nullptr};
+
+}  // namespace
+
+void SetDartPostCObject(DartPostCObjectFunction post_cobject) {
+  post_cobject_function.store(post_cobject, std::memory_order_release);
+}
+
+bool HasDartPostCObject() {
+  return post_cobject_function.load(std::memory_order_acquire) != nullptr;
+}
+
+bool PostIntToDart(int64_t port, int64_t value) {
+  DartPostCObjectFunction post =
+      post_cobject_function.load(std::memory_order_acquire);
+  if (post == nullptr || port == kNoDartPort) {
+    return false;
+  }
+  DartCObject message;
+  message.type = kDartCObjectInt64;
+  message.value.as_int64 = value;
+  return post(port, &message);
+}
+
+}  // namespace flutter_zoom_meeting_sdk
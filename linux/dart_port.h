@@ -0,0 +1,27 @@
+#ifndef FLUTTER_PLUGIN_DART_PORT_H_
+#define FLUTTER_PLUGIN_DART_PORT_H_
+
+#include <cstdint>
+
+namespace flutter_zoom_meeting_sdk {
+
+// ILLEGAL_PORT from dart_api.h: no port.
+constexpr int64_t kNoDartPort = 0;
+
+// Dart_PostCObject, as handed over from Dart.
+using DartPostCObjectFunction = bool (*)(int64_t port, void* message);
+
+// Sets the function PostIntToDart() posts with. Safe to call from any
+// thread.
+void SetDartPostCObject(DartPostCObjectFunction post_cobject);
+
+bool HasDartPostCObject();
+
+// Posts |value| to the Dart port |port|, where it arrives as an int. Safe to
+// call from any thread, without waiting for Dart. Returns false if there is
+// no Dart_PostCObject yet or the port is closed.
+bool PostIntToDart(int64_t port, int64_t value);
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_DART_PORT_H_
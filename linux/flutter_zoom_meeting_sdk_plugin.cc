@@ -0,0 +1,2148 @@
+#include "include/flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_plugin.h"
+
+#include <flutter_linux/flutter_linux.h>
+#include <gtk/gtk.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "active_speaker_detector.h"
+#include "audio_stream_router.h"
+#include "auth_token_cache.h"
+#include "flutter_zoom_meeting_sdk_plugin_private.h"
+#include "frame_pool.h"
+#include "gallery_texture.h"
+#include "meeting_backend.h"
+#include "meeting_options_codec.h"
+#include "meeting_scenario.h"
+#include "meeting_session_manager.h"
+#include "meeting_state_cache.h"
+#include "memory_accounting.h"
+#include "memory_budget.h"
+#include "participant_roster.h"
+#include "recording_writer.h"
+#include "roster_delta_codec.h"
+#include "simulated_meeting_backend.h"
+#include "startup_timeline.h"
+#include "status_event_codec.h"
+#include "status_event_queue.h"
+#include "trace.h"
+#include "video_texture.h"
+#include "worker_pool.h"
+#include "zoom_core_handle.h"
+
+#define FLUTTER_ZOOM_MEETING_SDK_PLUGIN(obj)                     \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),                             \
+                              flutter_zoom_meeting_sdk_plugin_get_type(), \
+                              FlutterZoomMeetingSdkPlugin))
+
+using flutter_zoom_meeting_sdk::ActiveSpeakerDetector;
+using flutter_zoom_meeting_sdk::AudioStreamRouter;
+using flutter_zoom_meeting_sdk::AuthTokenCache;
+using flutter_zoom_meeting_sdk::FramePool;
+using flutter_zoom_meeting_sdk::GalleryCompositor;
+using flutter_zoom_meeting_sdk::GalleryTile;
+using flutter_zoom_meeting_sdk::InitParams;
+using flutter_zoom_meeting_sdk::InitResult;
+using flutter_zoom_meeting_sdk::MeetingBackend;
+using flutter_zoom_meeting_sdk::MeetingOptions;
+using flutter_zoom_meeting_sdk::MeetingScenario;
+using flutter_zoom_meeting_sdk::MeetingSession;
+using flutter_zoom_meeting_sdk::MeetingSessionManager;
+using flutter_zoom_meeting_sdk::MeetingStateCache;
+using flutter_zoom_meeting_sdk::MeetingStatus;
+using flutter_zoom_meeting_sdk::MeetingStatusEvent;
+using flutter_zoom_meeting_sdk::MemoryAccounting;
+using flutter_zoom_meeting_sdk::MemoryBudget;
+using flutter_zoom_meeting_sdk::MemoryPressure;
+using flutter_zoom_meeting_sdk::ParticipantInfo;
+using flutter_zoom_meeting_sdk::ParticipantRoster;
+using flutter_zoom_meeting_sdk::PcmRingBuffer;
+using flutter_zoom_meeting_sdk::RecordingWriter;
+using flutter_zoom_meeting_sdk::RosterDelta;
+using flutter_zoom_meeting_sdk::SimulatedMeetingBackend;
+using flutter_zoom_meeting_sdk::StartupTimeline;
+using flutter_zoom_meeting_sdk::StatusEventQueue;
+using flutter_zoom_meeting_sdk::StatusEventQueueStats;
+using flutter_zoom_meeting_sdk::Tracer;
+using flutter_zoom_meeting_sdk::VideoFrameStats;
+using flutter_zoom_meeting_sdk::WorkerPool;
+
+namespace {
+
+constexpr char kMethodChannelName[] =
+    "plugins.flutter_zoom_meeting_sdk/zoom_channel";
+constexpr char kEventChannelName[] =
+    "plugins.flutter_zoom_meeting_sdk/zoom_event_stream";
+constexpr char kStatusEventChannelName[] =
+    "plugins.flutter_zoom_meeting_sdk/zoom_status_events";
+
+// A join can block its worker for the whole handshake; the second thread
+// keeps init and start requests from queueing behind it.
+constexpr size_t kWorkerThreadCount = 2;
+
+// Status events that can wait for the main loop before callbacks start
+// dropping them.
+constexpr size_t kStatusEventQueueCapacity = 1024;
+
+// Longest a "wait_for_status_change" call waits before answering with the
+// unchanged state.
+constexpr int32_t kMaxStatusWaitMs = 60000;
+
+#ifdef FLUTTER_ZOOM_BENCHMARK_HOOKS
+// Upper bound for one "emit_benchmark_events" call.
+constexpr int32_t kMaxBenchmarkEvents = 1000000;
+#endif
+
+// Sent on zoom_event_stream as [kAudioDataEventName, participantId] when an
+// audio ring has new samples. The samples themselves never cross a channel.
+constexpr char kAudioDataEventName[] = "AUDIO_DATA_AVAILABLE";
+
+// Sent on zoom_event_stream as [kParticipantDeltasEventName, records] with a
+// batch of roster deltas encoded as in roster_delta_codec.h.
+constexpr char kParticipantDeltasEventName[] = "PARTICIPANT_DELTAS";
+
+// Sent on zoom_event_stream as [kActiveSpeakerEventName, activeSpeakerId,
+// [speakingId, ...]] when the detected speakers change. IDs are decimal
+// strings; the active speaker is null while nobody speaks.
+constexpr char kActiveSpeakerEventName[] = "ACTIVE_SPEAKER_CHANGED";
+
+// Sent on zoom_event_stream as [kTokenExpiringEventName, appKey, expiresAt]
+// when a cached SDK token is due for a refresh. |expiresAt| is Unix time in
+// seconds.
+constexpr char kTokenExpiringEventName[] = "TOKEN_EXPIRING";
+
+// Sent on zoom_event_stream as [kMemoryPressureEventName, level,
+// trackedBytes, rssBytes] when the memory pressure level changes, see
+// memory_budget.h.
+constexpr char kMemoryPressureEventName[] = "MEMORY_PRESSURE";
+
+// How often memory is measured against the budget while one is set.
+constexpr guint kMemoryCheckIntervalS = 1;
+
+class StatusObserver;
+
+// A "wait_for_status_change" call waiting for the state to pass
+// |since_sequence|.
+struct StatusWaiter {
+  FlMethodCall* method_call;
+  uint64_t since_sequence;
+  // Identifies the waiter to its timeout.
+  uint64_t id;
+  // Answers the waiter unchanged when it fires. Destroyed once the waiter is
+  // answered, so it never outlives the plugin.
+  GSource* timeout;
+};
+
+// Parameters for warm-up init, set by the runner before registration.
+InitParams* warm_up_params = nullptr;
+
+// Scenario for the simulated backend, set by the runner before
+// registration.
+MeetingScenario* simulator_scenario = nullptr;
+
+// Meeting shown by each Flutter view, keyed by view ID, for runners that
+// give every meeting its own view on one engine. Main thread only.
+std::map<int64_t, std::string>* view_bindings = nullptr;
+
+}  // namespace
+
+struct _FlutterZoomMeetingSdkPlugin {
+  GObject parent_instance;
+
+  // Context of the thread the plugin was registered on. Channel traffic only
+  // happens there.
+  GMainContext* main_context;
+
+  FlEventChannel* event_channel;
+  gboolean listening;
+
+  // Opt-in binary status records, see status_event_codec.h.
+  FlBasicMessageChannel* status_event_channel;
+  gboolean binary_status_events;
+
+  MeetingBackend* backend;
+  StatusObserver* status_observer;
+  // Meetings being attended, keyed by meeting ID. Sessions are opened by
+  // their first status change and closed once the main loop has delivered
+  // a terminal one.
+  MeetingSessionManager* sessions;
+  WorkerPool* workers;
+
+  // The latest status change, which "meeting_status" and
+  // "wait_for_status_change" read without asking the backend, and the
+  // calls waiting for the next one.
+  MeetingStateCache* state_cache;
+  std::vector<StatusWaiter>* status_waiters;
+  uint64_t last_status_waiter_id;
+
+  // Participants of every session. Dart gets each change once, as a delta,
+  // and catches up with "participant_snapshot".
+  ParticipantRoster* roster;
+
+  // Participant video textures, keyed by participant ID.
+  FlTextureRegistrar* texture_registrar;
+  std::map<uint32_t, ZoomVideoTexture*>* video_textures;
+
+  // Participants composited into the shared gallery atlas. A participant is
+  // shown either in its own texture or in the gallery, never both.
+  ZoomGalleryTexture* gallery_texture;
+  std::set<uint32_t>* gallery_participants;
+
+  // Warm-up init started at registration. While it runs, "init" calls wait
+  // in |init_waiters|; afterwards |warm_up_result| answers them.
+  gboolean warm_up_running;
+  InitResult* warm_up_result;
+  std::vector<FlMethodCall*>* init_waiters;
+
+  // SDK tokens by app key, so that "init" can reuse a valid one, and the
+  // timer that tells Dart when the next one is due for a refresh.
+  AuthTokenCache* auth_tokens;
+  GSource* token_refresh_timer;
+
+  // Budgets set by "set_memory_budget", and the timer that checks them.
+  MemoryBudget* memory_budget;
+  GSource* memory_check_timer;
+
+  // PCM rings shared with Dart, see pcm_ring_buffer.h.
+  AudioStreamRouter* audio_router;
+
+  // What Dart reaches through libzoom_core.so, see zoom_core.h, and the
+  // handle Dart knows it by.
+  ZoomCore* core;
+  ZoomCoreHandle core_handle;
+
+  // Speaker detection on the raw audio while "set_speaker_detection" has
+  // it enabled, or nullptr.
+  ActiveSpeakerDetector* speaker_detector;
+
+  // Recording in progress, or nullptr. It gets all raw audio and the video
+  // of |recorded_participants|, who have no texture and are not in the
+  // gallery, since the backend delivers a participant's video to one sink.
+  RecordingWriter* recording_writer;
+  std::set<uint32_t>* recorded_participants;
+};
+
+G_DEFINE_TYPE(FlutterZoomMeetingSdkPlugin,
+              flutter_zoom_meeting_sdk_plugin,
+              g_object_get_type())
+
+namespace {
+
+// Runs |task| on |context|. Safe to call from any thread.
+void invoke_on_main(GMainContext* context, std::function<void()> task) {
+  g_main_context_invoke_full(
+      context, G_PRIORITY_DEFAULT,
+      [](gpointer user_data) -> gboolean {
+        (*static_cast<std::function<void()>*>(user_data))();
+        return G_SOURCE_REMOVE;
+      },
+      new std::function<void()>(std::move(task)),
+      [](gpointer user_data) {
+        delete static_cast<std::function<void()>*>(user_data);
+      });
+}
+
+// Runs |task| on |context| after |delay_ms|. Returns the source with a
+// reference for the caller, who may destroy it to cancel |task|. Safe to
+// call from any thread.
+GSource* invoke_on_main_after(GMainContext* context,
+                              guint delay_ms,
+                              std::function<void()> task) {
+  GSource* source = g_timeout_source_new(delay_ms);
+  g_source_set_callback(
+      source,
+      [](gpointer user_data) -> gboolean {
+        (*static_cast<std::function<void()>*>(user_data))();
+        return G_SOURCE_REMOVE;
+      },
+      new std::function<void()>(std::move(task)),
+      [](gpointer user_data) {
+        delete static_cast<std::function<void()>*>(user_data);
+      });
+  g_source_attach(source, context);
+  return source;
+}
+
+void respond(FlMethodCall* method_call, FlMethodResponse* response) {
+  g_autoptr(GError) error = nullptr;
+  if (!fl_method_call_respond(method_call, response, &error)) {
+    g_warning("Failed to send method call response: %s", error->message);
+  }
+}
+
+// Builds the response carrying |event| as a status_event_codec.h record.
+FlMethodResponse* status_record_response(const MeetingStatusEvent& event) {
+  uint8_t record[flutter_zoom_meeting_sdk::kStatusEventRecordSize];
+  flutter_zoom_meeting_sdk::EncodeStatusEvent(event, record);
+  g_autoptr(FlValue) result = fl_value_new_uint8_list(record, sizeof(record));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Answers |waiter| with |response| and cancels its timeout.
+void finish_status_waiter(const StatusWaiter& waiter,
+                          FlMethodResponse* response) {
+  respond(waiter.method_call, response);
+  g_object_unref(waiter.method_call);
+  g_source_destroy(waiter.timeout);
+  g_source_unref(waiter.timeout);
+}
+
+// Answers the status waiters that the cached state has moved past, and the
+// waiter |expired_id| whether or not it has. Main loop only.
+void complete_status_waiters(FlutterZoomMeetingSdkPlugin* self,
+                             uint64_t expired_id) {
+  if (self->status_waiters == nullptr || self->status_waiters->empty()) {
+    return;
+  }
+  MeetingStatusEvent latest = self->state_cache->Read();
+  g_autoptr(FlMethodResponse) response = nullptr;
+  auto done = [&](const StatusWaiter& waiter) {
+    if (latest.sequence <= waiter.since_sequence && waiter.id != expired_id) {
+      return false;
+    }
+    if (response == nullptr) {
+      response = status_record_response(latest);
+    }
+    finish_status_waiter(waiter, response);
+    return true;
+  };
+  std::vector<StatusWaiter>& waiters = *self->status_waiters;
+  waiters.erase(std::remove_if(waiters.begin(), waiters.end(), done),
+                waiters.end());
+}
+
+// Runs |work| on the worker pool and sends the response it builds back to
+// Dart from the main context.
+void respond_async(FlutterZoomMeetingSdkPlugin* self,
+                   FlMethodCall* method_call,
+                   std::function<FlMethodResponse*()> work) {
+  g_object_ref(self);
+  g_object_ref(method_call);
+  self->workers->Post([self, method_call, work = std::move(work)]() {
+    FlMethodResponse* response = nullptr;
+    {
+      ZOOM_TRACE_SCOPE("native", fl_method_call_get_name(method_call));
+      response = work();
+    }
+    invoke_on_main(self->main_context, [self, method_call, response]() {
+      ZOOM_TRACE_SCOPE("channel", "respond");
+      respond(method_call, response);
+      g_object_unref(response);
+      g_object_unref(method_call);
+      g_object_unref(self);
+    });
+  });
+}
+
+// Builds the zoom_event_stream event for |status_event|. Events that belong
+// to a meeting carry its ID as a third element.
+FlValue* legacy_status_event(const MeetingStatusEvent& status_event,
+                             const std::string& meeting_id) {
+  FlValue* event = nullptr;
+  if (status_event.status == MeetingStatus::kFailed &&
+      status_event.error_code ==
+          flutter_zoom_meeting_sdk::kMeetingErrorClientIncompatible) {
+    event = fl_value_new_list();
+    fl_value_append_take(event, fl_value_new_string("MEETING_STATUS_UNKNOWN"));
+    fl_value_append_take(event,
+                         fl_value_new_string("Version of ZoomSDK is too low"));
+  } else {
+    event = meeting_status_value(status_event.status);
+  }
+  if (!meeting_id.empty()) {
+    fl_value_append_take(event, fl_value_new_string(meeting_id.c_str()));
+  }
+  return event;
+}
+
+// Collects backend status changes from any thread and forwards them to Dart
+// in batches, one main loop wakeup per batch.
+class StatusObserver : public MeetingBackend::Observer {
+ public:
+  explicit StatusObserver(FlutterZoomMeetingSdkPlugin* plugin)
+      : plugin_(plugin), queue_(kStatusEventQueueCapacity) {}
+
+  void OnMeetingStatusChanged(const std::string& meeting_id,
+                              MeetingStatus status,
+                              int32_t error_code,
+                              int32_t internal_error_code) override {
+    MeetingStatusEvent event;
+    event.status = status;
+    event.error_code = error_code;
+    event.internal_error_code = internal_error_code;
+    MeetingSession session;
+    if (plugin_->sessions->Update(meeting_id, status, error_code,
+                                  internal_error_code, &session)) {
+      event.session_id = session.session_id;
+    }
+    event.timestamp_us = flutter_zoom_meeting_sdk::MonotonicNowUs();
+    event.sequence = ++last_sequence_;
+    plugin_->state_cache->Publish(event);
+    Enqueue(event);
+  }
+
+#ifdef FLUTTER_ZOOM_BENCHMARK_HOOKS
+  // Sends a copy of |status| to Dart like a backend status change, but
+  // leaves sessions, the state cache and status waiters alone. Its sequence
+  // is 0, outside the backend's.
+  void EmitBenchmarkEvent(MeetingStatus status) {
+    MeetingStatusEvent event;
+    event.status = status;
+    event.timestamp_us = flutter_zoom_meeting_sdk::MonotonicNowUs();
+    Enqueue(event);
+  }
+#endif
+
+  void OnParticipantJoined(const std::string& meeting_id,
+                           const ParticipantInfo& participant) override {
+    uint32_t session_id = GetSessionId(meeting_id);
+    if (session_id != flutter_zoom_meeting_sdk::kNoMeetingSession &&
+        plugin_->roster->Join(session_id, participant)) {
+      ScheduleRosterDrain();
+    }
+  }
+
+  void OnParticipantLeft(const std::string& meeting_id,
+                         uint32_t participant_id) override {
+    uint32_t session_id = GetSessionId(meeting_id);
+    if (session_id != flutter_zoom_meeting_sdk::kNoMeetingSession &&
+        plugin_->roster->Leave(session_id, participant_id)) {
+      ScheduleRosterDrain();
+    }
+  }
+
+  void OnParticipantChanged(const std::string& meeting_id,
+                            const ParticipantInfo& participant) override {
+    uint32_t session_id = GetSessionId(meeting_id);
+    if (session_id != flutter_zoom_meeting_sdk::kNoMeetingSession &&
+        plugin_->roster->Change(session_id, participant)) {
+      ScheduleRosterDrain();
+    }
+  }
+
+  StatusEventQueueStats GetStats() const { return queue_.GetStats(); }
+
+ private:
+  void Enqueue(const MeetingStatusEvent& event) {
+    if (!queue_.Push(event)) {
+      return;
+    }
+    // Idle priority lets pending frame work run first, so a burst that
+    // arrives during a frame is drained once after it.
+    g_main_context_invoke_full(plugin_->main_context, G_PRIORITY_DEFAULT_IDLE,
+                               drain_cb, g_object_ref(plugin_),
+                               g_object_unref);
+  }
+
+  uint32_t GetSessionId(const std::string& meeting_id) const {
+    MeetingSession session;
+    return plugin_->sessions->Get(meeting_id, &session)
+               ? session.session_id
+               : flutter_zoom_meeting_sdk::kNoMeetingSession;
+  }
+
+  // Roster deltas are batched like status events, with a drain of their
+  // own.
+  void ScheduleRosterDrain() {
+    g_main_context_invoke_full(plugin_->main_context, G_PRIORITY_DEFAULT_IDLE,
+                               roster_drain_cb, g_object_ref(plugin_),
+                               g_object_unref);
+  }
+
+  static gboolean roster_drain_cb(gpointer user_data) {
+    FlutterZoomMeetingSdkPlugin* plugin =
+        FLUTTER_ZOOM_MEETING_SDK_PLUGIN(user_data);
+    if (plugin->status_observer != nullptr) {
+      plugin->status_observer->DrainRoster();
+    }
+    return G_SOURCE_REMOVE;
+  }
+
+  void DrainRoster() {
+    ZOOM_TRACE_SCOPE("channel", "roster_batch");
+    if (plugin_->roster->TakePending(&deltas_) == 0 || !plugin_->listening) {
+      return;
+    }
+    delta_records_.clear();
+    flutter_zoom_meeting_sdk::EncodeRosterDeltas(deltas_, &delta_records_);
+    g_autoptr(FlValue) event = fl_value_new_list();
+    fl_value_append_take(event,
+                         fl_value_new_string(kParticipantDeltasEventName));
+    fl_value_append_take(event, fl_value_new_uint8_list(delta_records_.data(),
+                                                        delta_records_.size()));
+    g_autoptr(GError) error = nullptr;
+    if (!fl_event_channel_send(plugin_->event_channel, event, nullptr,
+                               &error)) {
+      g_warning("Failed to send participant deltas: %s", error->message);
+    }
+  }
+
+  static gboolean drain_cb(gpointer user_data) {
+    FlutterZoomMeetingSdkPlugin* plugin =
+        FLUTTER_ZOOM_MEETING_SDK_PLUGIN(user_data);
+    if (plugin->status_observer != nullptr) {
+      plugin->status_observer->Drain();
+    }
+    complete_status_waiters(plugin, 0);
+    return G_SOURCE_REMOVE;
+  }
+
+  void Drain() {
+    ZOOM_TRACE_SCOPE("channel", "status_batch");
+    if (queue_.Drain(&batch_) == 0) {
+      return;
+    }
+
+    if (plugin_->binary_status_events) {
+      // One message carries the whole batch of fixed-size records.
+      records_.resize(batch_.size() *
+                      flutter_zoom_meeting_sdk::kStatusEventRecordSize);
+      for (size_t i = 0; i < batch_.size(); ++i) {
+        flutter_zoom_meeting_sdk::EncodeStatusEvent(
+            batch_[i],
+            records_.data() +
+                i * flutter_zoom_meeting_sdk::kStatusEventRecordSize);
+      }
+      g_autoptr(FlValue) message =
+          fl_value_new_uint8_list(records_.data(), records_.size());
+      fl_basic_message_channel_send(plugin_->status_event_channel, message,
+                                    nullptr, nullptr, nullptr);
+    }
+
+    // zoom_event_stream keeps its one [name, message] list per event.
+    if (plugin_->listening) {
+      MeetingSession session;
+      for (const MeetingStatusEvent& status_event : batch_) {
+        if (status_event.session_id != session.session_id &&
+            !plugin_->sessions->GetById(status_event.session_id, &session)) {
+          session = MeetingSession();
+        }
+        g_autoptr(FlValue) event =
+            legacy_status_event(status_event, session.meeting_id);
+        g_autoptr(GError) error = nullptr;
+        if (!fl_event_channel_send(plugin_->event_channel, event, nullptr,
+                                   &error)) {
+          g_warning("Failed to send meeting status: %s", error->message);
+        }
+      }
+    }
+
+    // Sessions whose meeting ended are closed only now, so every event of
+    // the batch could still be routed to its meeting ID. Their participants
+    // go with them, since backends do not report them leaving.
+    for (const MeetingStatusEvent& status_event : batch_) {
+      if (flutter_zoom_meeting_sdk::IsTerminalMeetingStatus(
+              status_event.status) &&
+          plugin_->sessions->CloseIfEnded(status_event.session_id) &&
+          plugin_->roster->EndSession(status_event.session_id)) {
+        ScheduleRosterDrain();
+      }
+    }
+  }
+
+  FlutterZoomMeetingSdkPlugin* plugin_;
+  std::atomic<uint64_t> last_sequence_{0};
+  StatusEventQueue queue_;
+
+  // Main loop only; reused for every drain.
+  std::vector<MeetingStatusEvent> batch_;
+  std::vector<uint8_t> records_;
+  std::vector<RosterDelta> deltas_;
+  std::vector<uint8_t> delta_records_;
+};
+
+const gchar* lookup_string(FlValue* args, const char* key) {
+  if (args == nullptr || fl_value_get_type(args) != FL_VALUE_TYPE_MAP) {
+    return nullptr;
+  }
+  FlValue* value = fl_value_lookup_string(args, key);
+  if (value == nullptr || fl_value_get_type(value) != FL_VALUE_TYPE_STRING) {
+    return nullptr;
+  }
+  return fl_value_get_string(value);
+}
+
+std::string get_string(FlValue* args, const char* key) {
+  const gchar* value = lookup_string(args, key);
+  return value != nullptr ? value : "";
+}
+
+bool parse_boolean(FlValue* args, const char* key, bool default_value) {
+  const gchar* value = lookup_string(args, key);
+  return value == nullptr ? default_value
+                          : g_ascii_strcasecmp(value, "true") == 0;
+}
+
+int32_t parse_int(FlValue* args, const char* key, int32_t default_value) {
+  const gchar* value = lookup_string(args, key);
+  return value == nullptr
+             ? default_value
+             : static_cast<int32_t>(g_ascii_strtoll(value, nullptr, 10));
+}
+
+// Reads a byte count sent as a decimal string, or 0 if it is missing.
+uint64_t parse_byte_count(FlValue* args, const char* key) {
+  const gchar* value = lookup_string(args, key);
+  return value == nullptr ? 0 : g_ascii_strtoull(value, nullptr, 10);
+}
+
+// Reads a participant ID sent as a decimal string. Returns false if it is
+// missing.
+bool parse_participant_id(FlValue* args, uint32_t* participant_id) {
+  const gchar* value = lookup_string(args, "participantId");
+  if (value == nullptr) {
+    return false;
+  }
+  *participant_id = static_cast<uint32_t>(g_ascii_strtoull(value, nullptr, 10));
+  return true;
+}
+
+FlMethodResponse* init_result_response(const InitResult& result) {
+  g_autoptr(FlValue) value = fl_value_new_list();
+  fl_value_append_take(value, fl_value_new_int(result.error_code));
+  fl_value_append_take(value, fl_value_new_int(result.internal_error_code));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(value));
+}
+
+FlMethodResponse* bool_response(bool result) {
+  g_autoptr(FlValue) value = fl_value_new_bool(result);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(value));
+}
+
+}  // namespace
+
+FlMethodResponse* get_platform_version() {
+  struct utsname uname_data = {};
+  uname(&uname_data);
+  g_autofree gchar* version = g_strdup_printf("Linux %s", uname_data.version);
+  g_autoptr(FlValue) result = fl_value_new_string(version);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+InitParams parse_init_params(FlValue* args) {
+  InitParams params;
+  params.domain = get_string(args, "domain");
+  params.jwt_token = get_string(args, "jwtToken");
+  params.app_key = get_string(args, "appKey");
+  params.app_secret = get_string(args, "appSecret");
+  return params;
+}
+
+MeetingOptions parse_meeting_options(FlValue* args) {
+  MeetingOptions options;
+  options.user_id = get_string(args, "userId");
+  options.display_name = get_string(args, "displayName");
+  options.meeting_id = get_string(args, "meetingId");
+  options.meeting_password = get_string(args, "meetingPassword");
+  options.zoom_access_token = get_string(args, "zoomAccessToken");
+  options.disable_dial_in = parse_boolean(args, "disableDialIn", false);
+  options.disable_drive = parse_boolean(args, "disableDrive", false);
+  options.disable_invite = parse_boolean(args, "disableInvite", false);
+  options.disable_share = parse_boolean(args, "disableShare", false);
+  options.no_disconnect_audio = parse_boolean(args, "noDisconnectAudio", false);
+  options.no_audio = parse_boolean(args, "noAudio", false);
+  options.meeting_view_options = parse_int(args, "meetingViewOptions", 0);
+  return options;
+}
+
+bool read_meeting_options(FlValue* args, MeetingOptions* options) {
+  if (args != nullptr && fl_value_get_type(args) == FL_VALUE_TYPE_UINT8_LIST) {
+    return flutter_zoom_meeting_sdk::DecodeMeetingOptions(
+        fl_value_get_uint8_list(args), fl_value_get_length(args), options);
+  }
+  *options = parse_meeting_options(args);
+  return true;
+}
+
+FlValue* meeting_status_value(MeetingStatus status) {
+  FlValue* value = fl_value_new_list();
+  fl_value_append_take(
+      value,
+      fl_value_new_string(flutter_zoom_meeting_sdk::MeetingStatusName(status)));
+  fl_value_append_take(value,
+                       fl_value_new_string(
+                           flutter_zoom_meeting_sdk::MeetingStatusMessage(status)));
+  return value;
+}
+
+// Logs the startup timeline once both the first frame and SDK init are
+// done. Safe to call from any thread.
+static void log_startup_timeline_if_complete() {
+  static std::atomic<bool> logged{false};
+  StartupTimeline* timeline = StartupTimeline::Get();
+  if (!timeline->HasMark(flutter_zoom_meeting_sdk::kStartupFirstFrame) ||
+      !timeline->HasMark(flutter_zoom_meeting_sdk::kStartupSdkInitComplete) ||
+      logged.exchange(true)) {
+    return;
+  }
+  g_debug("Startup timeline:\n%s", timeline->Format().c_str());
+}
+
+// Runs backend initialization. Called on a worker thread.
+static InitResult initialize_backend(MeetingBackend* backend,
+                                     const InitParams& params) {
+  StartupTimeline::Get()->Mark(flutter_zoom_meeting_sdk::kStartupSdkInitStart);
+  InitResult result = backend->Initialize(params);
+  if (result.error_code == flutter_zoom_meeting_sdk::kZoomErrorSuccess) {
+    StartupTimeline::Get()->Mark(
+        flutter_zoom_meeting_sdk::kStartupSdkInitComplete);
+    log_startup_timeline_if_complete();
+  }
+  return result;
+}
+
+static void schedule_token_refresh(FlutterZoomMeetingSdkPlugin* self);
+
+// Tells Dart which cached tokens are due for a refresh, then waits for the
+// next. Runs on the main loop.
+static void notify_tokens_expiring(FlutterZoomMeetingSdkPlugin* self) {
+  for (const AuthTokenCache::Token& token : self->auth_tokens->TakeDue()) {
+    if (!self->listening) {
+      g_warning("SDK token for app key \"%s\" expires at %" G_GINT64_FORMAT
+                " and nobody is listening for a new one",
+                token.claims.app_key.c_str(), token.claims.expires_at);
+      continue;
+    }
+    g_autoptr(FlValue) event = fl_value_new_list();
+    fl_value_append_take(event, fl_value_new_string(kTokenExpiringEventName));
+    fl_value_append_take(event,
+                         fl_value_new_string(token.claims.app_key.c_str()));
+    fl_value_append_take(event, fl_value_new_int(token.claims.expires_at));
+    g_autoptr(GError) error = nullptr;
+    if (!fl_event_channel_send(self->event_channel, event, nullptr, &error)) {
+      g_warning("Failed to send token expiry: %s", error->message);
+    }
+  }
+  schedule_token_refresh(self);
+}
+
+// Arms the timer for the next cached token due for a refresh. Main loop
+// only.
+static void schedule_token_refresh(FlutterZoomMeetingSdkPlugin* self) {
+  if (self->token_refresh_timer != nullptr) {
+    g_source_destroy(self->token_refresh_timer);
+    g_clear_pointer(&self->token_refresh_timer, g_source_unref);
+  }
+  int64_t refresh_at = self->auth_tokens->NextRefreshAt();
+  if (refresh_at == 0) {
+    return;
+  }
+  int64_t delay_s =
+      std::max<int64_t>(refresh_at - AuthTokenCache::UnixNowSeconds(), 0);
+  // Destroyed by dispose, so the callback never outlives |self|.
+  self->token_refresh_timer = g_timeout_source_new_seconds(
+      static_cast<guint>(std::min<int64_t>(delay_s, G_MAXUINT)));
+  g_source_set_callback(
+      self->token_refresh_timer,
+      [](gpointer user_data) -> gboolean {
+        auto* self = static_cast<FlutterZoomMeetingSdkPlugin*>(user_data);
+        g_clear_pointer(&self->token_refresh_timer, g_source_unref);
+        notify_tokens_expiring(self);
+        return G_SOURCE_REMOVE;
+      },
+      self, nullptr);
+  g_source_attach(self->token_refresh_timer, self->main_context);
+}
+
+// Caches |token| if it is a valid SDK token and reschedules refreshes.
+static AuthTokenCache::Status store_auth_token(
+    FlutterZoomMeetingSdkPlugin* self,
+    const std::string& token) {
+  AuthTokenCache::Status status = self->auth_tokens->Store(token);
+  if (status == AuthTokenCache::Status::kValid) {
+    schedule_token_refresh(self);
+  }
+  return status;
+}
+
+// What the plugin gives up at a memory pressure level.
+struct MemoryShedding {
+  // Participant textures render at 1 / |resolution_divisor| of their size.
+  int resolution_divisor;
+  // Gallery tiles that keep their video, or 0 for all of them.
+  size_t max_live_tiles;
+  // Roster deltas kept for "participant_snapshot". Clients further behind
+  // get the whole roster, so fewer deltas coalesce catch-ups into one
+  // snapshot.
+  size_t roster_history;
+};
+
+static MemoryShedding memory_shedding(MemoryPressure level) {
+  switch (level) {
+    case MemoryPressure::kReduced:
+      return {2, 9, 1024};
+    case MemoryPressure::kMinimal:
+      return {4, 4, 256};
+    case MemoryPressure::kNormal:
+      break;
+  }
+  return {1, 0, ParticipantRoster::Config().history};
+}
+
+// Applies the shedding of the current pressure level to every texture, the
+// roster and the frame pool.
+static void apply_memory_shedding(FlutterZoomMeetingSdkPlugin* self) {
+  MemoryPressure level = self->memory_budget->level();
+  MemoryShedding shedding = memory_shedding(level);
+  for (const auto& entry : *self->video_textures) {
+    zoom_video_texture_set_resolution_divisor(entry.second,
+                                              shedding.resolution_divisor);
+  }
+  if (self->gallery_texture != nullptr) {
+    zoom_gallery_texture_set_max_live_tiles(self->gallery_texture,
+                                            shedding.max_live_tiles);
+  }
+  self->roster->SetHistoryLimit(shedding.roster_history);
+  if (level != MemoryPressure::kNormal) {
+    FramePool::Get()->Trim();
+  }
+}
+
+// Measures memory against the budget, and sheds and tells Dart if the
+// pressure level changed. Main loop only.
+static void check_memory_budget(FlutterZoomMeetingSdkPlugin* self) {
+  uint64_t tracked_bytes = MemoryAccounting::GetStats().total_bytes;
+  uint64_t rss_bytes = flutter_zoom_meeting_sdk::ReadProcessRssBytes();
+  MemoryPressure previous = self->memory_budget->level();
+  MemoryPressure level =
+      self->memory_budget->Update(tracked_bytes, rss_bytes);
+  if (level == previous) {
+    return;
+  }
+  g_message("Memory pressure %s: %" G_GUINT64_FORMAT
+            " bytes tracked, %" G_GUINT64_FORMAT " bytes resident",
+            flutter_zoom_meeting_sdk::MemoryPressureName(level), tracked_bytes,
+            rss_bytes);
+  apply_memory_shedding(self);
+  if (!self->listening) {
+    return;
+  }
+  g_autoptr(FlValue) event = fl_value_new_list();
+  fl_value_append_take(event, fl_value_new_string(kMemoryPressureEventName));
+  fl_value_append_take(
+      event,
+      fl_value_new_string(flutter_zoom_meeting_sdk::MemoryPressureName(level)));
+  fl_value_append_take(event, fl_value_new_int(tracked_bytes));
+  fl_value_append_take(event, fl_value_new_int(rss_bytes));
+  g_autoptr(GError) error = nullptr;
+  if (!fl_event_channel_send(self->event_channel, event, nullptr, &error)) {
+    g_warning("Failed to send memory pressure: %s", error->message);
+  }
+}
+
+// Checks the budget every kMemoryCheckIntervalS while one is set. Main loop
+// only.
+static void schedule_memory_check(FlutterZoomMeetingSdkPlugin* self) {
+  if (self->memory_check_timer != nullptr) {
+    g_source_destroy(self->memory_check_timer);
+    g_clear_pointer(&self->memory_check_timer, g_source_unref);
+  }
+  const MemoryBudget::Config& config = self->memory_budget->config();
+  if (config.plugin_bytes == 0 && config.rss_bytes == 0) {
+    return;
+  }
+  // Destroyed by dispose, so the callback never outlives |self|.
+  self->memory_check_timer = g_timeout_source_new_seconds(
+      kMemoryCheckIntervalS);
+  g_source_set_callback(
+      self->memory_check_timer,
+      [](gpointer user_data) -> gboolean {
+        check_memory_budget(
+            static_cast<FlutterZoomMeetingSdkPlugin*>(user_data));
+        return G_SOURCE_CONTINUE;
+      },
+      self, nullptr);
+  g_source_attach(self->memory_check_timer, self->main_context);
+}
+
+// Initializes the backend with the parameters of |method_call| on the worker
+// pool and responds when done. Without a token in |method_call|, the cached
+// one for its app key is used.
+static void start_init(FlutterZoomMeetingSdkPlugin* self,
+                       FlMethodCall* method_call) {
+  InitParams params = parse_init_params(fl_method_call_get_args(method_call));
+  if (params.jwt_token.empty()) {
+    params.jwt_token = self->auth_tokens->Get(params.app_key);
+  }
+  MeetingBackend* backend = self->backend;
+  respond_async(self, method_call, [backend, params]() {
+    return init_result_response(initialize_backend(backend, params));
+  });
+}
+
+// Completes warm-up init on the main loop and answers the "init" calls that
+// arrived while it ran.
+static void finish_warm_up(FlutterZoomMeetingSdkPlugin* self,
+                           const InitResult& result) {
+  self->warm_up_running = FALSE;
+  if (self->init_waiters == nullptr) {
+    // Disposed while warming up.
+    return;
+  }
+  bool succeeded =
+      result.error_code == flutter_zoom_meeting_sdk::kZoomErrorSuccess;
+  if (succeeded) {
+    self->warm_up_result = new InitResult(result);
+  } else {
+    g_warning("Zoom SDK warm-up init failed: %d", result.error_code);
+  }
+  std::vector<FlMethodCall*> waiters;
+  waiters.swap(*self->init_waiters);
+  for (FlMethodCall* method_call : waiters) {
+    if (succeeded) {
+      g_autoptr(FlMethodResponse) response = init_result_response(result);
+      respond(method_call, response);
+    } else {
+      start_init(self, method_call);
+    }
+    g_object_unref(method_call);
+  }
+}
+
+// Starts warm-up init if the runner asked for it.
+static void start_warm_up(FlutterZoomMeetingSdkPlugin* self) {
+  if (warm_up_params == nullptr) {
+    return;
+  }
+  self->warm_up_running = TRUE;
+  InitParams params = *warm_up_params;
+  if (!params.jwt_token.empty()) {
+    store_auth_token(self, params.jwt_token);
+  }
+  MeetingBackend* backend = self->backend;
+  g_object_ref(self);
+  self->workers->Post([self, backend, params]() {
+    InitResult result = initialize_backend(backend, params);
+    invoke_on_main(self->main_context, [self, result]() {
+      finish_warm_up(self, result);
+      g_object_unref(self);
+    });
+  });
+}
+
+// Handles "init". Returns nullptr when the response is sent asynchronously.
+// A token that has already expired fails at once rather than in the SDK;
+// any other is passed on for the SDK to judge.
+static FlMethodResponse* handle_init(FlutterZoomMeetingSdkPlugin* self,
+                                     FlMethodCall* method_call) {
+  std::string jwt_token =
+      get_string(fl_method_call_get_args(method_call), "jwtToken");
+  if (!jwt_token.empty() &&
+      store_auth_token(self, jwt_token) == AuthTokenCache::Status::kExpired &&
+      !self->backend->IsInitialized()) {
+    InitResult result;
+    result.error_code = flutter_zoom_meeting_sdk::kZoomErrorAuthTokenWrong;
+    return init_result_response(result);
+  }
+  if (self->backend->IsInitialized()) {
+    return init_result_response(self->warm_up_result != nullptr
+                                    ? *self->warm_up_result
+                                    : InitResult());
+  }
+  if (self->warm_up_running) {
+    g_object_ref(method_call);
+    self->init_waiters->push_back(method_call);
+    return nullptr;
+  }
+
+  start_init(self, method_call);
+  return nullptr;
+}
+
+// Handles "set_auth_token", which caches a fresh SDK token for later "init"
+// calls. Returns false if it is malformed or expired.
+static FlMethodResponse* handle_set_auth_token(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  std::string jwt_token =
+      get_string(fl_method_call_get_args(method_call), "jwtToken");
+  return bool_response(store_auth_token(self, jwt_token) ==
+                       AuthTokenCache::Status::kValid);
+}
+
+// Handles "view_bindings". Returns the meeting ID bound to each view, keyed
+// by view ID.
+static FlMethodResponse* handle_view_bindings() {
+  g_autoptr(FlValue) result = fl_value_new_map();
+  if (view_bindings != nullptr) {
+    for (const auto& binding : *view_bindings) {
+      fl_value_set_take(result, fl_value_new_int(binding.first),
+                        fl_value_new_string(binding.second.c_str()));
+    }
+  }
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "bind_view", which binds "viewId" to "meetingId", or unbinds it
+// when "meetingId" is missing or empty. Returns false without a valid
+// "viewId".
+static FlMethodResponse* handle_bind_view(FlMethodCall* method_call) {
+  FlValue* args = fl_method_call_get_args(method_call);
+  const gchar* view_id = lookup_string(args, "viewId");
+  gchar* end = nullptr;
+  gint64 id = view_id == nullptr ? -1 : g_ascii_strtoll(view_id, &end, 10);
+  if (view_id == nullptr || *view_id == '\0' || *end != '\0' || id < 0) {
+    return bool_response(false);
+  }
+  std::string meeting_id = get_string(args, "meetingId");
+  flutter_zoom_meeting_sdk_plugin_bind_view(
+      id, meeting_id.empty() ? nullptr : meeting_id.c_str());
+  return bool_response(true);
+}
+
+// Handles "startup_timeline". Returns each startup mark as microseconds
+// since the process started.
+static FlMethodResponse* handle_startup_timeline() {
+  StartupTimeline* timeline = StartupTimeline::Get();
+  int64_t origin = timeline->origin_us();
+  g_autoptr(FlValue) result = fl_value_new_map();
+  for (const StartupTimeline::Milestone& mark : timeline->GetMarks()) {
+    fl_value_set_string_take(result, mark.name.c_str(),
+                             fl_value_new_int(mark.time_us - origin));
+  }
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "join" and "start". Returns nullptr when the response is sent
+// asynchronously.
+static FlMethodResponse* handle_enter_meeting(FlutterZoomMeetingSdkPlugin* self,
+                                              FlMethodCall* method_call,
+                                              bool start) {
+  if (!self->backend->IsInitialized()) {
+    g_warning("Zoom SDK not initialized");
+    return bool_response(false);
+  }
+
+  MeetingOptions options;
+  if (!read_meeting_options(fl_method_call_get_args(method_call), &options)) {
+    g_warning("Malformed meeting options");
+    return bool_response(false);
+  }
+  MeetingBackend* backend = self->backend;
+  respond_async(self, method_call, [backend, options, start]() {
+    return bool_response(start ? backend->StartMeeting(options)
+                               : backend->JoinMeeting(options));
+  });
+  return nullptr;
+}
+
+// Handles "leave_meeting": leaves the meeting "meetingId". Returns nullptr
+// when the response is sent asynchronously.
+static FlMethodResponse* handle_leave_meeting(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  std::string meeting_id =
+      get_string(fl_method_call_get_args(method_call), "meetingId");
+  if (meeting_id.empty() || !self->backend->IsInitialized()) {
+    return bool_response(false);
+  }
+  MeetingBackend* backend = self->backend;
+  respond_async(self, method_call, [backend, meeting_id]() {
+    return bool_response(backend->LeaveMeeting(meeting_id));
+  });
+  return nullptr;
+}
+
+// Handles "meeting_sessions": returns a map from the ID of every meeting
+// being attended to its session ID.
+static FlMethodResponse* handle_meeting_sessions(
+    FlutterZoomMeetingSdkPlugin* self) {
+  g_autoptr(FlValue) result = fl_value_new_map();
+  for (const MeetingSession& session : self->sessions->GetAll()) {
+    fl_value_set_string_take(result, session.meeting_id.c_str(),
+                             fl_value_new_int(session.session_id));
+  }
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "participant_snapshot": returns the roster deltas after
+// "sinceSequence", or the whole roster as join deltas if some of them are
+// no longer kept, with "full" telling which.
+static FlMethodResponse* handle_participant_snapshot(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  const gchar* since =
+      lookup_string(fl_method_call_get_args(method_call), "sinceSequence");
+  ParticipantRoster::Snapshot snapshot = self->roster->GetSnapshot(
+      since != nullptr ? g_ascii_strtoull(since, nullptr, 10) : 0);
+  std::vector<uint8_t> records;
+  flutter_zoom_meeting_sdk::EncodeRosterDeltas(snapshot.deltas, &records);
+  g_autoptr(FlValue) result = fl_value_new_map();
+  fl_value_set_string_take(result, "sequence",
+                           fl_value_new_int(snapshot.sequence));
+  fl_value_set_string_take(result, "full", fl_value_new_bool(snapshot.full));
+  fl_value_set_string_take(
+      result, "deltas",
+      fl_value_new_uint8_list(records.data(), records.size()));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "binary_status_events", which switches the binary status channel
+// on or off.
+static FlMethodResponse* handle_binary_status_events(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  self->binary_status_events =
+      parse_boolean(fl_method_call_get_args(method_call), "enabled", false);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+}
+
+// Stops |participant_id|'s video and releases its texture.
+static void release_video_texture(FlutterZoomMeetingSdkPlugin* self,
+                                  uint32_t participant_id,
+                                  ZoomVideoTexture* texture) {
+  // No frames reach the texture's sink once this returns.
+  self->backend->UnsubscribeVideo(participant_id);
+  fl_texture_registrar_unregister_texture(self->texture_registrar,
+                                          FL_TEXTURE(texture));
+  g_object_unref(texture);
+}
+
+// Handles "subscribe_video". Returns the participant's texture ID, or -1 if
+// their video is unavailable.
+static FlMethodResponse* handle_subscribe_video(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  int64_t texture_id = -1;
+  uint32_t participant_id;
+  if (self->texture_registrar != nullptr &&
+      parse_participant_id(fl_method_call_get_args(method_call),
+                           &participant_id) &&
+      self->gallery_participants->count(participant_id) == 0 &&
+      self->recorded_participants->count(participant_id) == 0) {
+    auto it = self->video_textures->find(participant_id);
+    if (it != self->video_textures->end()) {
+      texture_id = fl_texture_get_id(FL_TEXTURE(it->second));
+    } else {
+      ZoomVideoTexture* texture =
+          zoom_video_texture_new(self->texture_registrar);
+      if (!fl_texture_registrar_register_texture(self->texture_registrar,
+                                                 FL_TEXTURE(texture))) {
+        g_object_unref(texture);
+      } else if (!self->backend->SubscribeVideo(
+                     participant_id, zoom_video_texture_get_sink(texture))) {
+        fl_texture_registrar_unregister_texture(self->texture_registrar,
+                                                FL_TEXTURE(texture));
+        g_object_unref(texture);
+      } else {
+        zoom_video_texture_set_resolution_divisor(
+            texture,
+            memory_shedding(self->memory_budget->level()).resolution_divisor);
+        (*self->video_textures)[participant_id] = texture;
+        texture_id = fl_texture_get_id(FL_TEXTURE(texture));
+      }
+    }
+  }
+
+  g_autoptr(FlValue) result = fl_value_new_int(texture_id);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "unsubscribe_video".
+static FlMethodResponse* handle_unsubscribe_video(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  uint32_t participant_id;
+  if (!parse_participant_id(fl_method_call_get_args(method_call),
+                            &participant_id)) {
+    return bool_response(false);
+  }
+  auto it = self->video_textures->find(participant_id);
+  if (it == self->video_textures->end()) {
+    return bool_response(false);
+  }
+  ZoomVideoTexture* texture = it->second;
+  self->video_textures->erase(it);
+  release_video_texture(self, participant_id, texture);
+  return bool_response(true);
+}
+
+// Handles "set_video_display_size", which tells a participant's texture how
+// large it is drawn so frames are downscaled to match. Returns false if the
+// participant's video is not subscribed.
+static FlMethodResponse* handle_set_video_display_size(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  FlValue* args = fl_method_call_get_args(method_call);
+  uint32_t participant_id;
+  if (!parse_participant_id(args, &participant_id)) {
+    return bool_response(false);
+  }
+  auto it = self->video_textures->find(participant_id);
+  if (it == self->video_textures->end()) {
+    return bool_response(false);
+  }
+  zoom_video_texture_set_display_size(it->second, parse_int(args, "width", 0),
+                                      parse_int(args, "height", 0));
+  return bool_response(true);
+}
+
+// Reads the tiles of a "set_gallery_layout" call, sent as an Int64List of
+// [participantId, x, y, width, height] per tile. Returns false if malformed.
+static bool parse_gallery_tiles(FlValue* args,
+                                std::vector<GalleryTile>* tiles) {
+  if (args == nullptr || fl_value_get_type(args) != FL_VALUE_TYPE_MAP) {
+    return false;
+  }
+  FlValue* value = fl_value_lookup_string(args, "tiles");
+  if (value == nullptr ||
+      fl_value_get_type(value) != FL_VALUE_TYPE_INT64_LIST ||
+      fl_value_get_length(value) % 5 != 0) {
+    return false;
+  }
+  const int64_t* data = fl_value_get_int64_list(value);
+  size_t count = fl_value_get_length(value) / 5;
+  tiles->resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    const int64_t* entry = data + i * 5;
+    for (int field = 1; field < 5; ++field) {
+      if (entry[field] < 0 || entry[field] > GalleryCompositor::kMaxAtlasSize) {
+        return false;
+      }
+    }
+    GalleryTile& tile = (*tiles)[i];
+    tile.participant_id = static_cast<uint32_t>(entry[0]);
+    tile.x = static_cast<int>(entry[1]);
+    tile.y = static_cast<int>(entry[2]);
+    tile.width = static_cast<int>(entry[3]);
+    tile.height = static_cast<int>(entry[4]);
+  }
+  return true;
+}
+
+// Handles "set_gallery_layout". Creates the gallery texture on first use,
+// moves the subscriptions of joining and leaving participants to match the
+// layout, and returns the texture ID, or -1 if the layout is invalid.
+static FlMethodResponse* handle_set_gallery_layout(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  FlValue* args = fl_method_call_get_args(method_call);
+  int32_t width = parse_int(args, "width", 0);
+  int32_t height = parse_int(args, "height", 0);
+  std::vector<GalleryTile> tiles;
+  bool valid = self->texture_registrar != nullptr &&
+               parse_gallery_tiles(args, &tiles) &&
+               GalleryCompositor::IsValidLayout(width, height, tiles);
+  std::set<uint32_t> participants;
+  for (const GalleryTile& tile : tiles) {
+    participants.insert(tile.participant_id);
+    if (self->video_textures->count(tile.participant_id) != 0 ||
+        self->recorded_participants->count(tile.participant_id) != 0) {
+      valid = false;
+    }
+  }
+  if (!valid) {
+    g_autoptr(FlValue) result = fl_value_new_int(-1);
+    return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+  }
+
+  if (self->gallery_texture == nullptr) {
+    ZoomGalleryTexture* texture =
+        zoom_gallery_texture_new(self->texture_registrar);
+    if (!fl_texture_registrar_register_texture(self->texture_registrar,
+                                               FL_TEXTURE(texture))) {
+      g_object_unref(texture);
+      g_autoptr(FlValue) result = fl_value_new_int(-1);
+      return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+    }
+    zoom_gallery_texture_set_max_live_tiles(
+        texture, memory_shedding(self->memory_budget->level()).max_live_tiles);
+    self->gallery_texture = texture;
+  }
+
+  // Apply the layout first so frames from new subscriptions land in it, and
+  // frames still in flight for leaving participants are dropped.
+  zoom_gallery_texture_set_layout(self->gallery_texture, width, height,
+                                  std::move(tiles));
+  for (uint32_t participant_id : *self->gallery_participants) {
+    if (participants.count(participant_id) == 0) {
+      self->backend->UnsubscribeVideo(participant_id);
+    }
+  }
+  MeetingBackend::VideoSink* sink =
+      zoom_gallery_texture_get_sink(self->gallery_texture);
+  for (uint32_t participant_id : participants) {
+    if (self->gallery_participants->count(participant_id) == 0) {
+      // A participant whose video is unavailable keeps an empty tile.
+      self->backend->SubscribeVideo(participant_id, sink);
+    }
+  }
+  *self->gallery_participants = std::move(participants);
+
+  g_autoptr(FlValue) result =
+      fl_value_new_int(fl_texture_get_id(FL_TEXTURE(self->gallery_texture)));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Stops every gallery participant's video and releases the gallery texture.
+static void release_gallery(FlutterZoomMeetingSdkPlugin* self) {
+  for (uint32_t participant_id : *self->gallery_participants) {
+    self->backend->UnsubscribeVideo(participant_id);
+  }
+  self->gallery_participants->clear();
+  if (self->gallery_texture != nullptr) {
+    fl_texture_registrar_unregister_texture(self->texture_registrar,
+                                            FL_TEXTURE(self->gallery_texture));
+    g_clear_object(&self->gallery_texture);
+  }
+}
+
+// Handles "clear_gallery".
+static FlMethodResponse* handle_clear_gallery(
+    FlutterZoomMeetingSdkPlugin* self) {
+  bool had_gallery = self->gallery_texture != nullptr;
+  release_gallery(self);
+  return bool_response(had_gallery);
+}
+
+// Tells Dart that |participant_id|'s audio ring has new samples. Runs on
+// the main loop.
+static void notify_audio_data(FlutterZoomMeetingSdkPlugin* self,
+                              uint32_t participant_id) {
+  if (self->audio_router == nullptr) {
+    return;
+  }
+  self->audio_router->AcknowledgeNotification(participant_id);
+  if (!self->listening) {
+    return;
+  }
+  g_autofree gchar* id = g_strdup_printf("%u", participant_id);
+  g_autoptr(FlValue) event = fl_value_new_list();
+  fl_value_append_take(event, fl_value_new_string(kAudioDataEventName));
+  fl_value_append_take(event, fl_value_new_string(id));
+  g_autoptr(GError) error = nullptr;
+  if (!fl_event_channel_send(self->event_channel, event, nullptr, &error)) {
+    g_warning("Failed to send audio notification: %s", error->message);
+  }
+}
+
+// Handles "subscribe_audio". Returns the address of the stream's PCM ring,
+// or -1 if audio is unavailable. Participant ID 0 is the meeting mix.
+static FlMethodResponse* handle_subscribe_audio(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  int64_t address = -1;
+  uint32_t participant_id;
+  if (parse_participant_id(fl_method_call_get_args(method_call),
+                           &participant_id)) {
+    const PcmRingBuffer* ring = self->audio_router->Subscribe(participant_id);
+    if (ring != nullptr) {
+      address = static_cast<int64_t>(ring->address());
+    }
+  }
+  g_autoptr(FlValue) result = fl_value_new_int(address);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "core_handle": the handle of the plugin's ZoomCore, for the C ABI
+// in zoom_core.h. It goes stale when the plugin is disposed.
+static FlMethodResponse* handle_core_handle(FlutterZoomMeetingSdkPlugin* self) {
+  g_autoptr(FlValue) result =
+      fl_value_new_int(static_cast<int64_t>(self->core_handle));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "unsubscribe_audio". Dart stops reading the ring before calling.
+static FlMethodResponse* handle_unsubscribe_audio(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  uint32_t participant_id;
+  if (!parse_participant_id(fl_method_call_get_args(method_call),
+                            &participant_id)) {
+    return bool_response(false);
+  }
+  return bool_response(self->audio_router->Unsubscribe(participant_id));
+}
+
+// Tells Dart who is speaking now. Runs on the main loop.
+static void notify_active_speaker(
+    FlutterZoomMeetingSdkPlugin* self,
+    const ActiveSpeakerDetector::SpeakerState& state) {
+  if (!self->listening) {
+    return;
+  }
+  g_autoptr(FlValue) event = fl_value_new_list();
+  fl_value_append_take(event, fl_value_new_string(kActiveSpeakerEventName));
+  if (state.active_speaker == flutter_zoom_meeting_sdk::kNoActiveSpeaker) {
+    fl_value_append_take(event, fl_value_new_null());
+  } else {
+    g_autofree gchar* id = g_strdup_printf("%u", state.active_speaker);
+    fl_value_append_take(event, fl_value_new_string(id));
+  }
+  FlValue* speaking = fl_value_new_list();
+  for (uint32_t participant_id : state.speaking) {
+    g_autofree gchar* id = g_strdup_printf("%u", participant_id);
+    fl_value_append_take(speaking, fl_value_new_string(id));
+  }
+  fl_value_append_take(event, speaking);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_event_channel_send(self->event_channel, event, nullptr, &error)) {
+    g_warning("Failed to send active speaker: %s", error->message);
+  }
+}
+
+// Handles "set_speaker_detection", which starts or stops detecting speakers
+// on the raw audio. Returns false if raw audio is unavailable.
+static FlMethodResponse* handle_set_speaker_detection(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  bool enabled =
+      parse_boolean(fl_method_call_get_args(method_call), "enabled", true);
+  if (!enabled) {
+    if (self->speaker_detector != nullptr) {
+      self->audio_router->SetDetector(nullptr);
+      // Nobody is speaking any more as far as Dart is concerned.
+      self->speaker_detector->Reset();
+      delete self->speaker_detector;
+      self->speaker_detector = nullptr;
+    }
+    return bool_response(true);
+  }
+  if (self->speaker_detector != nullptr) {
+    return bool_response(true);
+  }
+  auto detector = std::make_unique<ActiveSpeakerDetector>(
+      ActiveSpeakerDetector::Config(),
+      [self](const ActiveSpeakerDetector::SpeakerState& state) {
+        g_object_ref(self);
+        invoke_on_main(self->main_context, [self, state]() {
+          notify_active_speaker(self, state);
+          g_object_unref(self);
+        });
+      });
+  if (!self->audio_router->SetDetector(detector.get())) {
+    return bool_response(false);
+  }
+  self->speaker_detector = detector.release();
+  return bool_response(true);
+}
+
+// Detaches the recording from the backend's video and audio and returns it,
+// or nullptr if none is in progress. Deleting it finishes the last segment.
+static RecordingWriter* detach_recording(FlutterZoomMeetingSdkPlugin* self) {
+  RecordingWriter* writer = self->recording_writer;
+  if (writer == nullptr) {
+    return nullptr;
+  }
+  for (uint32_t participant_id : *self->recorded_participants) {
+    self->backend->UnsubscribeVideo(participant_id);
+  }
+  self->recorded_participants->clear();
+  self->audio_router->SetRecorder(nullptr);
+  self->recording_writer = nullptr;
+  return writer;
+}
+
+// Handles "start_recording": starts recording all raw audio into segments
+// in "directory". Video is added per participant with "record_video".
+static FlMethodResponse* handle_start_recording(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  std::string directory =
+      get_string(fl_method_call_get_args(method_call), "directory");
+  if (directory.empty() || self->recording_writer != nullptr) {
+    return bool_response(false);
+  }
+  std::string error;
+  std::unique_ptr<RecordingWriter> writer =
+      RecordingWriter::Create(directory, RecordingWriter::Config(), &error);
+  if (writer == nullptr) {
+    g_warning("Failed to start recording: %s", error.c_str());
+    return bool_response(false);
+  }
+  if (!self->audio_router->SetRecorder(writer.get())) {
+    return bool_response(false);
+  }
+  self->recording_writer = writer.release();
+  return bool_response(true);
+}
+
+// Handles "record_video": adds a participant's video to the recording.
+static FlMethodResponse* handle_record_video(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  uint32_t participant_id;
+  if (self->recording_writer == nullptr ||
+      !parse_participant_id(fl_method_call_get_args(method_call),
+                            &participant_id) ||
+      self->video_textures->count(participant_id) != 0 ||
+      self->gallery_participants->count(participant_id) != 0) {
+    return bool_response(false);
+  }
+  if (self->recorded_participants->count(participant_id) != 0) {
+    return bool_response(true);
+  }
+  if (!self->backend->SubscribeVideo(participant_id,
+                                     self->recording_writer)) {
+    return bool_response(false);
+  }
+  self->recorded_participants->insert(participant_id);
+  return bool_response(true);
+}
+
+// Handles "stop_recording". The queued records are written out and the
+// last segment finished on the worker pool. Returns nullptr when the
+// response is sent asynchronously.
+static FlMethodResponse* handle_stop_recording(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  RecordingWriter* writer = detach_recording(self);
+  if (writer == nullptr) {
+    return bool_response(false);
+  }
+  respond_async(self, method_call, [writer]() {
+    bool ok = !writer->GetStats().failed;
+    delete writer;
+    return bool_response(ok);
+  });
+  return nullptr;
+}
+
+// Handles "recording_stats". Every count is 0 when nothing is recording.
+static FlMethodResponse* handle_recording_stats(
+    FlutterZoomMeetingSdkPlugin* self) {
+  RecordingWriter::Stats stats;
+  if (self->recording_writer != nullptr) {
+    stats = self->recording_writer->GetStats();
+  }
+  g_autoptr(FlValue) result = fl_value_new_map();
+  fl_value_set_string_take(result, "recordsWritten",
+                           fl_value_new_int(stats.records_written));
+  fl_value_set_string_take(result, "recordsDropped",
+                           fl_value_new_int(stats.records_dropped));
+  fl_value_set_string_take(result, "bytesWritten",
+                           fl_value_new_int(stats.bytes_written));
+  fl_value_set_string_take(result, "segmentsFinished",
+                           fl_value_new_int(stats.segments_finished));
+  fl_value_set_string_take(result, "failed",
+                           fl_value_new_int(stats.failed ? 1 : 0));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "frame_pool_stats": byte counts for the pool video frames are
+// allocated from, in total and for each size class it has used.
+static FlMethodResponse* handle_frame_pool_stats() {
+  FramePool::Stats stats = FramePool::Get()->GetStats();
+  g_autoptr(FlValue) classes = fl_value_new_list();
+  for (const FramePool::ClassStats& class_stats : stats.classes) {
+    g_autoptr(FlValue) entry = fl_value_new_map();
+    fl_value_set_string_take(entry, "bufferSize",
+                             fl_value_new_int(class_stats.buffer_size));
+    fl_value_set_string_take(entry, "inUseBytes",
+                             fl_value_new_int(class_stats.in_use_bytes));
+    fl_value_set_string_take(entry, "freeBytes",
+                             fl_value_new_int(class_stats.free_bytes));
+    fl_value_set_string_take(entry, "peakBytes",
+                             fl_value_new_int(class_stats.peak_bytes));
+    fl_value_append(classes, entry);
+  }
+  g_autoptr(FlValue) result = fl_value_new_map();
+  fl_value_set_string_take(result, "maxBytes",
+                           fl_value_new_int(stats.max_bytes));
+  fl_value_set_string_take(result, "inUseBytes",
+                           fl_value_new_int(stats.in_use_bytes));
+  fl_value_set_string_take(result, "freeBytes",
+                           fl_value_new_int(stats.free_bytes));
+  fl_value_set_string_take(result, "peakBytes",
+                           fl_value_new_int(stats.peak_bytes));
+  fl_value_set_string_take(result, "failedAllocations",
+                           fl_value_new_int(stats.failed_allocations));
+  fl_value_set_string(result, "classes", classes);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "memory_stats": the bytes each subsystem holds now and at its
+// peak, see memory_accounting.h, the process's resident set and the
+// pressure level.
+static FlMethodResponse* handle_memory_stats(
+    FlutterZoomMeetingSdkPlugin* self) {
+  MemoryAccounting::Stats stats = MemoryAccounting::GetStats();
+  g_autoptr(FlValue) categories = fl_value_new_map();
+  for (size_t i = 0; i < flutter_zoom_meeting_sdk::kMemoryCategoryCount; ++i) {
+    g_autoptr(FlValue) entry = fl_value_new_map();
+    fl_value_set_string_take(
+        entry, "currentBytes",
+        fl_value_new_int(stats.categories[i].current_bytes));
+    fl_value_set_string_take(entry, "peakBytes",
+                             fl_value_new_int(stats.categories[i].peak_bytes));
+    fl_value_set_string(
+        categories,
+        flutter_zoom_meeting_sdk::MemoryCategoryName(
+            static_cast<flutter_zoom_meeting_sdk::MemoryCategory>(i)),
+        entry);
+  }
+  g_autoptr(FlValue) result = fl_value_new_map();
+  fl_value_set_string(result, "categories", categories);
+  fl_value_set_string_take(result, "trackedBytes",
+                           fl_value_new_int(stats.total_bytes));
+  fl_value_set_string_take(result, "peakBytes",
+                           fl_value_new_int(stats.peak_bytes));
+  fl_value_set_string_take(
+      result, "rssBytes",
+      fl_value_new_int(flutter_zoom_meeting_sdk::ReadProcessRssBytes()));
+  fl_value_set_string_take(
+      result, "pressure",
+      fl_value_new_string(flutter_zoom_meeting_sdk::MemoryPressureName(
+          self->memory_budget->level())));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "set_memory_budget" with "pluginBytes" for the bytes the plugin
+// tracks and "rssBytes" for the whole process; a missing or zero budget is
+// not enforced. Checks the new budgets right away.
+static FlMethodResponse* handle_set_memory_budget(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  FlValue* args = fl_method_call_get_args(method_call);
+  MemoryBudget::Config config;
+  config.plugin_bytes = parse_byte_count(args, "pluginBytes");
+  config.rss_bytes = parse_byte_count(args, "rssBytes");
+  self->memory_budget->SetConfig(config);
+  check_memory_budget(self);
+  schedule_memory_check(self);
+  return bool_response(true);
+}
+
+// Builds the Dart map for one mailbox's VideoFrameStats.
+static FlValue* video_frame_stats_value(const VideoFrameStats& stats) {
+  FlValue* value = fl_value_new_map();
+  fl_value_set_string_take(value, "produced",
+                           fl_value_new_int(stats.produced));
+  fl_value_set_string_take(value, "displayed",
+                           fl_value_new_int(stats.displayed));
+  fl_value_set_string_take(value, "dropped", fl_value_new_int(stats.dropped));
+  fl_value_set_string_take(value, "lastAgeUs",
+                           fl_value_new_int(stats.last_age_us));
+  fl_value_set_string_take(value, "meanAgeUs",
+                           fl_value_new_int(stats.mean_age_us()));
+  fl_value_set_string_take(value, "maxAgeUs",
+                           fl_value_new_int(stats.max_age_us));
+  return value;
+}
+
+// Handles "video_stats": frame counts for each participant's video texture,
+// keyed by participant ID, and for the gallery when it exists.
+static FlMethodResponse* handle_video_stats(
+    FlutterZoomMeetingSdkPlugin* self) {
+  g_autoptr(FlValue) participants = fl_value_new_map();
+  for (const auto& entry : *self->video_textures) {
+    fl_value_set_take(participants, fl_value_new_int(entry.first),
+                      video_frame_stats_value(
+                          zoom_video_texture_get_stats(entry.second)));
+  }
+  g_autoptr(FlValue) result = fl_value_new_map();
+  fl_value_set_string(result, "participants", participants);
+  if (self->gallery_texture != nullptr) {
+    fl_value_set_string_take(
+        result, "gallery",
+        video_frame_stats_value(
+            zoom_gallery_texture_get_stats(self->gallery_texture)));
+  }
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "event_queue_stats".
+static FlMethodResponse* handle_event_queue_stats(
+    FlutterZoomMeetingSdkPlugin* self) {
+  StatusEventQueueStats stats = self->status_observer->GetStats();
+  g_autoptr(FlValue) result = fl_value_new_map();
+  fl_value_set_string_take(result, "pushed", fl_value_new_int(stats.pushed));
+  fl_value_set_string_take(result, "dropped", fl_value_new_int(stats.dropped));
+  fl_value_set_string_take(result, "wakeups", fl_value_new_int(stats.wakeups));
+  fl_value_set_string_take(result, "coalesced",
+                           fl_value_new_int(stats.coalesced));
+  fl_value_set_string_take(result, "drains", fl_value_new_int(stats.drains));
+  fl_value_set_string_take(result, "depth", fl_value_new_int(stats.depth));
+  fl_value_set_string_take(result, "peakDepth",
+                           fl_value_new_int(stats.peak_depth));
+  fl_value_set_string_take(result, "lastDrainLatencyUs",
+                           fl_value_new_int(stats.last_drain_latency_us));
+  fl_value_set_string_take(result, "maxDrainLatencyUs",
+                           fl_value_new_int(stats.max_drain_latency_us));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+#ifdef FLUTTER_ZOOM_BENCHMARK_HOOKS
+// Handles "emit_benchmark_events": reports "count" status changes with the
+// current status from a worker thread, "intervalUs" apart, through the same
+// queue and channels as backend callbacks. They do not reach the state
+// cache, sessions or "wait_for_status_change". Used by the event throughput
+// benchmark, and only built with FLUTTER_ZOOM_BENCHMARK_HOOKS since any
+// caller could inject events with it. Returns nullptr as the response is
+// sent asynchronously.
+static FlMethodResponse* handle_emit_benchmark_events(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  FlValue* args = fl_method_call_get_args(method_call);
+  int32_t count = parse_int(args, "count", 0);
+  int32_t interval_us = parse_int(args, "intervalUs", 0);
+  if (count < 0 || count > kMaxBenchmarkEvents || interval_us < 0) {
+    g_autoptr(FlValue) result = fl_value_new_int(-1);
+    return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+  }
+  StatusObserver* observer = self->status_observer;
+  MeetingStatus status = self->backend->GetMeetingStatus();
+  respond_async(self, method_call, [observer, status, count, interval_us]() {
+    for (int32_t i = 0; i < count; ++i) {
+      observer->EmitBenchmarkEvent(status);
+      if (interval_us > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(interval_us));
+      }
+    }
+    g_autoptr(FlValue) result = fl_value_new_int(count);
+    return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+  });
+  return nullptr;
+}
+#endif  // FLUTTER_ZOOM_BENCHMARK_HOOKS
+
+// Handles "start_trace".
+static FlMethodResponse* handle_start_trace() {
+  Tracer::Get()->Start();
+  return bool_response(true);
+}
+
+// Handles "dump_trace": stops tracing and writes the native events, plus the
+// Dart spans serialized in "dartEvents", to "path" as Chrome trace JSON.
+// Returns nullptr when the response is sent asynchronously.
+static FlMethodResponse* handle_dump_trace(FlutterZoomMeetingSdkPlugin* self,
+                                           FlMethodCall* method_call) {
+  FlValue* args = fl_method_call_get_args(method_call);
+  std::string path = get_string(args, "path");
+  if (path.empty()) {
+    return bool_response(false);
+  }
+  Tracer* tracer = Tracer::Get();
+  tracer->Stop();
+  if (tracer->dropped() > 0) {
+    g_warning("Trace buffers overflowed; %" G_GUINT64_FORMAT
+              " events were dropped",
+              static_cast<guint64>(tracer->dropped()));
+  }
+  std::string native_events = flutter_zoom_meeting_sdk::FormatTraceEvents(
+      tracer->GetEvents(), static_cast<int32_t>(getpid()));
+  std::string dart_events = get_string(args, "dartEvents");
+  respond_async(self, method_call, [path, native_events, dart_events]() {
+    return bool_response(flutter_zoom_meeting_sdk::WriteChromeTrace(
+        path, native_events, dart_events));
+  });
+  return nullptr;
+}
+
+// Handles "meeting_status". With a "meetingId" argument it reports that
+// meeting's status, MEETING_STATUS_IDLE if it is not being attended.
+// Without one it reports the most recent status, which is only meaningful
+// while at most one meeting is open, so it is refused while several are.
+// Neither asks the backend.
+static FlMethodResponse* handle_meeting_status(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  g_autoptr(FlValue) result = nullptr;
+  if (!self->backend->IsInitialized()) {
+    result = fl_value_new_list();
+    fl_value_append_take(result, fl_value_new_string("MEETING_STATUS_UNKNOWN"));
+    fl_value_append_take(result, fl_value_new_string("SDK not initialized"));
+  } else {
+    std::string meeting_id =
+        get_string(fl_method_call_get_args(method_call), "meetingId");
+    if (meeting_id.empty() && self->sessions->size() > 1) {
+      result = fl_value_new_list();
+      fl_value_append_take(result,
+                           fl_value_new_string("MEETING_STATUS_UNKNOWN"));
+      fl_value_append_take(
+          result,
+          fl_value_new_string("meetingId is required with several meetings"));
+      return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+    }
+    MeetingStatus status = self->state_cache->Read().status;
+    if (!meeting_id.empty()) {
+      MeetingSession session;
+      status = self->sessions->Get(meeting_id, &session)
+                   ? session.status
+                   : MeetingStatus::kIdle;
+    }
+    result = fl_value_new_list();
+    fl_value_append_take(
+        result, fl_value_new_string(
+                    flutter_zoom_meeting_sdk::MeetingStatusName(status)));
+    fl_value_append_take(result, fl_value_new_string(""));
+  }
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Handles "meeting_state": the latest status change of any meeting, as a
+// status_event_codec.h record with sequence 0 before the first.
+static FlMethodResponse* handle_meeting_state(
+    FlutterZoomMeetingSdkPlugin* self) {
+  return status_record_response(self->state_cache->Read());
+}
+
+// Handles "wait_for_status_change": answers like "meeting_state" once the
+// sequence passes "sinceSequence", or after "timeoutMs" with the state
+// unchanged. Returns nullptr when the response is sent later.
+static FlMethodResponse* handle_wait_for_status_change(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  FlValue* args = fl_method_call_get_args(method_call);
+  const gchar* since = lookup_string(args, "sinceSequence");
+  uint64_t since_sequence =
+      since == nullptr ? 0 : g_ascii_strtoull(since, nullptr, 10);
+  int32_t timeout_ms = std::min(
+      std::max(parse_int(args, "timeoutMs", kMaxStatusWaitMs), 0),
+      kMaxStatusWaitMs);
+
+  MeetingStatusEvent latest = self->state_cache->Read();
+  if (latest.sequence > since_sequence || timeout_ms == 0) {
+    return status_record_response(latest);
+  }
+  uint64_t id = ++self->last_status_waiter_id;
+  g_object_ref(method_call);
+  // The waiter's timeout is destroyed with it, at the latest by dispose, so
+  // it needs no reference to |self|.
+  GSource* timeout = invoke_on_main_after(
+      self->main_context, timeout_ms,
+      [self, id]() { complete_status_waiters(self, id); });
+  self->status_waiters->push_back({method_call, since_sequence, id, timeout});
+  return nullptr;
+}
+
+// Called when a method call is received from Flutter.
+static void flutter_zoom_meeting_sdk_plugin_handle_method_call(
+    FlutterZoomMeetingSdkPlugin* self,
+    FlMethodCall* method_call) {
+  g_autoptr(FlMethodResponse) response = nullptr;
+
+  const gchar* method = fl_method_call_get_name(method_call);
+  ZOOM_TRACE_SCOPE("channel", method);
+
+  if (strcmp(method, "init") == 0) {
+    response = handle_init(self, method_call);
+  } else if (strcmp(method, "set_auth_token") == 0) {
+    response = handle_set_auth_token(self, method_call);
+  } else if (strcmp(method, "join") == 0) {
+    response = handle_enter_meeting(self, method_call, false);
+  } else if (strcmp(method, "start") == 0) {
+    response = handle_enter_meeting(self, method_call, true);
+  } else if (strcmp(method, "leave_meeting") == 0) {
+    response = handle_leave_meeting(self, method_call);
+  } else if (strcmp(method, "meeting_status") == 0) {
+    response = handle_meeting_status(self, method_call);
+  } else if (strcmp(method, "meeting_state") == 0) {
+    response = handle_meeting_state(self);
+  } else if (strcmp(method, "wait_for_status_change") == 0) {
+    response = handle_wait_for_status_change(self, method_call);
+  } else if (strcmp(method, "view_bindings") == 0) {
+    response = handle_view_bindings();
+  } else if (strcmp(method, "bind_view") == 0) {
+    response = handle_bind_view(method_call);
+  } else if (strcmp(method, "meeting_sessions") == 0) {
+    response = handle_meeting_sessions(self);
+  } else if (strcmp(method, "participant_snapshot") == 0) {
+    response = handle_participant_snapshot(self, method_call);
+  } else if (strcmp(method, "binary_status_events") == 0) {
+    response = handle_binary_status_events(self, method_call);
+  } else if (strcmp(method, "event_queue_stats") == 0) {
+    response = handle_event_queue_stats(self);
+  } else if (strcmp(method, "subscribe_video") == 0) {
+    response = handle_subscribe_video(self, method_call);
+  } else if (strcmp(method, "unsubscribe_video") == 0) {
+    response = handle_unsubscribe_video(self, method_call);
+  } else if (strcmp(method, "set_video_display_size") == 0) {
+    response = handle_set_video_display_size(self, method_call);
+  } else if (strcmp(method, "set_gallery_layout") == 0) {
+    response = handle_set_gallery_layout(self, method_call);
+  } else if (strcmp(method, "clear_gallery") == 0) {
+    response = handle_clear_gallery(self);
+  } else if (strcmp(method, "subscribe_audio") == 0) {
+    response = handle_subscribe_audio(self, method_call);
+  } else if (strcmp(method, "unsubscribe_audio") == 0) {
+    response = handle_unsubscribe_audio(self, method_call);
+  } else if (strcmp(method, "core_handle") == 0) {
+    response = handle_core_handle(self);
+  } else if (strcmp(method, "set_speaker_detection") == 0) {
+    response = handle_set_speaker_detection(self, method_call);
+  } else if (strcmp(method, "start_recording") == 0) {
+    response = handle_start_recording(self, method_call);
+  } else if (strcmp(method, "record_video") == 0) {
+    response = handle_record_video(self, method_call);
+  } else if (strcmp(method, "stop_recording") == 0) {
+    response = handle_stop_recording(self, method_call);
+  } else if (strcmp(method, "recording_stats") == 0) {
+    response = handle_recording_stats(self);
+  } else if (strcmp(method, "frame_pool_stats") == 0) {
+    response = handle_frame_pool_stats();
+  } else if (strcmp(method, "memory_stats") == 0) {
+    response = handle_memory_stats(self);
+  } else if (strcmp(method, "set_memory_budget") == 0) {
+    response = handle_set_memory_budget(self, method_call);
+  } else if (strcmp(method, "video_stats") == 0) {
+    response = handle_video_stats(self);
+  } else if (strcmp(method, "startup_timeline") == 0) {
+    response = handle_startup_timeline();
+#ifdef FLUTTER_ZOOM_BENCHMARK_HOOKS
+  } else if (strcmp(method, "emit_benchmark_events") == 0) {
+    response = handle_emit_benchmark_events(self, method_call);
+#endif
+  } else if (strcmp(method, "start_trace") == 0) {
+    response = handle_start_trace();
+  } else if (strcmp(method, "dump_trace") == 0) {
+    response = handle_dump_trace(self, method_call);
+  } else if (strcmp(method, "getPlatformVersion") == 0) {
+    response = get_platform_version();
+  } else {
+    response = FL_METHOD_RESPONSE(fl_method_not_implemented_response_new());
+  }
+
+  // Handlers that hand off to the worker pool respond later.
+  if (response != nullptr) {
+    respond(method_call, response);
+  }
+}
+
+static void flutter_zoom_meeting_sdk_plugin_dispose(GObject* object) {
+  FlutterZoomMeetingSdkPlugin* self = FLUTTER_ZOOM_MEETING_SDK_PLUGIN(object);
+
+  if (self->backend != nullptr) {
+    self->backend->SetObserver(nullptr);
+  }
+  if (self->init_waiters != nullptr) {
+    for (FlMethodCall* method_call : *self->init_waiters) {
+      g_object_unref(method_call);
+    }
+    delete self->init_waiters;
+    self->init_waiters = nullptr;
+  }
+  if (self->status_waiters != nullptr) {
+    for (const StatusWaiter& waiter : *self->status_waiters) {
+      g_object_unref(waiter.method_call);
+      g_source_destroy(waiter.timeout);
+      g_source_unref(waiter.timeout);
+    }
+    delete self->status_waiters;
+    self->status_waiters = nullptr;
+  }
+  delete self->warm_up_result;
+  self->warm_up_result = nullptr;
+  if (self->token_refresh_timer != nullptr) {
+    g_source_destroy(self->token_refresh_timer);
+    g_clear_pointer(&self->token_refresh_timer, g_source_unref);
+  }
+  delete self->auth_tokens;
+  self->auth_tokens = nullptr;
+  if (self->memory_check_timer != nullptr) {
+    g_source_destroy(self->memory_check_timer);
+    g_clear_pointer(&self->memory_check_timer, g_source_unref);
+  }
+  delete self->memory_budget;
+  self->memory_budget = nullptr;
+  if (self->video_textures != nullptr) {
+    for (const auto& entry : *self->video_textures) {
+      release_video_texture(self, entry.first, entry.second);
+    }
+    delete self->video_textures;
+    self->video_textures = nullptr;
+  }
+  if (self->gallery_participants != nullptr) {
+    release_gallery(self);
+    delete self->gallery_participants;
+    self->gallery_participants = nullptr;
+  }
+  g_clear_object(&self->texture_registrar);
+  if (self->recorded_participants != nullptr) {
+    delete detach_recording(self);
+    delete self->recorded_participants;
+    self->recorded_participants = nullptr;
+  }
+  if (self->speaker_detector != nullptr) {
+    self->audio_router->SetDetector(nullptr);
+    delete self->speaker_detector;
+    self->speaker_detector = nullptr;
+  }
+  // Waits for C ABI calls still using the core.
+  flutter_zoom_meeting_sdk::UnregisterZoomCore(self->core_handle);
+  self->core_handle = 0;
+  delete self->core;
+  self->core = nullptr;
+  // Stops raw audio, so no notification is scheduled after this.
+  delete self->audio_router;
+  self->audio_router = nullptr;
+  delete self->workers;
+  self->workers = nullptr;
+  delete self->status_observer;
+  self->status_observer = nullptr;
+  delete self->sessions;
+  self->sessions = nullptr;
+  delete self->state_cache;
+  self->state_cache = nullptr;
+  delete self->roster;
+  self->roster = nullptr;
+  delete self->backend;
+  self->backend = nullptr;
+
+  if (self->event_channel != nullptr) {
+    fl_event_channel_set_stream_handlers(self->event_channel, nullptr, nullptr,
+                                         nullptr, nullptr);
+  }
+  g_clear_object(&self->event_channel);
+  g_clear_object(&self->status_event_channel);
+  g_clear_pointer(&self->main_context, g_main_context_unref);
+
+  G_OBJECT_CLASS(flutter_zoom_meeting_sdk_plugin_parent_class)->dispose(object);
+}
+
+static void flutter_zoom_meeting_sdk_plugin_class_init(
+    FlutterZoomMeetingSdkPluginClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_zoom_meeting_sdk_plugin_dispose;
+}
+
+static void flutter_zoom_meeting_sdk_plugin_init(
+    FlutterZoomMeetingSdkPlugin* self) {
+  self->main_context = g_main_context_ref_thread_default();
+  self->backend =
+      simulator_scenario != nullptr
+          ? new SimulatedMeetingBackend(*simulator_scenario)
+          : flutter_zoom_meeting_sdk::CreateMeetingBackend().release();
+  self->sessions = new MeetingSessionManager();
+  self->state_cache = new MeetingStateCache();
+  self->status_waiters = new std::vector<StatusWaiter>();
+  self->roster = new ParticipantRoster(ParticipantRoster::Config());
+  self->status_observer = new StatusObserver(self);
+  self->backend->SetObserver(self->status_observer);
+  self->workers = new WorkerPool(kWorkerThreadCount);
+  self->video_textures = new std::map<uint32_t, ZoomVideoTexture*>();
+  self->gallery_participants = new std::set<uint32_t>();
+  self->recorded_participants = new std::set<uint32_t>();
+  self->init_waiters = new std::vector<FlMethodCall*>();
+  self->auth_tokens = new AuthTokenCache(AuthTokenCache::Config());
+  self->memory_budget = new MemoryBudget();
+  self->audio_router = new AudioStreamRouter(
+      self->backend, AudioStreamRouter::Config(),
+      [self](uint32_t participant_id) {
+        g_object_ref(self);
+        invoke_on_main(self->main_context, [self, participant_id]() {
+          notify_audio_data(self, participant_id);
+          g_object_unref(self);
+        });
+      });
+  self->core = new ZoomCore{self->audio_router};
+  self->core_handle = flutter_zoom_meeting_sdk::RegisterZoomCore(self->core);
+}
+
+static void method_call_cb(FlMethodChannel* channel,
+                           FlMethodCall* method_call,
+                           gpointer user_data) {
+  FlutterZoomMeetingSdkPlugin* plugin =
+      FLUTTER_ZOOM_MEETING_SDK_PLUGIN(user_data);
+  flutter_zoom_meeting_sdk_plugin_handle_method_call(plugin, method_call);
+}
+
+static FlMethodErrorResponse* event_listen_cb(FlEventChannel* channel,
+                                              FlValue* args,
+                                              gpointer user_data) {
+  FLUTTER_ZOOM_MEETING_SDK_PLUGIN(user_data)->listening = TRUE;
+  return nullptr;
+}
+
+static FlMethodErrorResponse* event_cancel_cb(FlEventChannel* channel,
+                                              FlValue* args,
+                                              gpointer user_data) {
+  FLUTTER_ZOOM_MEETING_SDK_PLUGIN(user_data)->listening = FALSE;
+  return nullptr;
+}
+
+void flutter_zoom_meeting_sdk_plugin_register_with_registrar(
+    FlPluginRegistrar* registrar) {
+  FlutterZoomMeetingSdkPlugin* plugin = FLUTTER_ZOOM_MEETING_SDK_PLUGIN(
+      g_object_new(flutter_zoom_meeting_sdk_plugin_get_type(), nullptr));
+
+  // An engine without a view has nothing to draw textures into, so video is
+  // not offered there; raw media still reaches Dart through the native rings.
+  if (fl_plugin_registrar_get_view(registrar) != nullptr) {
+    plugin->texture_registrar = FL_TEXTURE_REGISTRAR(
+        g_object_ref(fl_plugin_registrar_get_texture_registrar(registrar)));
+  }
+
+  FlBinaryMessenger* messenger = fl_plugin_registrar_get_messenger(registrar);
+  g_autoptr(FlStandardMethodCodec) codec = fl_standard_method_codec_new();
+  g_autoptr(FlMethodChannel) channel = fl_method_channel_new(
+      messenger, kMethodChannelName, FL_METHOD_CODEC(codec));
+  fl_method_channel_set_method_call_handler(channel, method_call_cb,
+                                            g_object_ref(plugin),
+                                            g_object_unref);
+
+  // The method channel keeps the plugin alive, so the event channel handlers
+  // borrow it; dispose clears them.
+  plugin->event_channel =
+      fl_event_channel_new(messenger, kEventChannelName, FL_METHOD_CODEC(codec));
+  fl_event_channel_set_stream_handlers(plugin->event_channel, event_listen_cb,
+                                       event_cancel_cb, plugin, nullptr);
+
+  g_autoptr(FlBinaryCodec) binary_codec = fl_binary_codec_new();
+  plugin->status_event_channel = fl_basic_message_channel_new(
+      messenger, kStatusEventChannelName, FL_MESSAGE_CODEC(binary_codec));
+
+  start_warm_up(plugin);
+
+  g_object_unref(plugin);
+}
+
+void flutter_zoom_meeting_sdk_plugin_mark_startup(const gchar* name) {
+  if (name != nullptr && StartupTimeline::Get()->Mark(name)) {
+    log_startup_timeline_if_complete();
+  }
+}
+
+void flutter_zoom_meeting_sdk_plugin_set_warm_up_init(const gchar* domain,
+                                                      const gchar* jwt_token,
+                                                      const gchar* app_key,
+                                                      const gchar* app_secret) {
+  delete warm_up_params;
+  warm_up_params = new InitParams();
+  warm_up_params->domain = domain != nullptr ? domain : "";
+  warm_up_params->jwt_token = jwt_token != nullptr ? jwt_token : "";
+  warm_up_params->app_key = app_key != nullptr ? app_key : "";
+  warm_up_params->app_secret = app_secret != nullptr ? app_secret : "";
+}
+
+gboolean flutter_zoom_meeting_sdk_plugin_set_simulator_scenario(
+    const gchar* path) {
+  MeetingScenario scenario;
+  std::string error;
+  if (path == nullptr ||
+      !flutter_zoom_meeting_sdk::LoadMeetingScenario(path, &scenario,
+                                                     &error)) {
+    g_warning("Ignoring simulator scenario: %s",
+              path == nullptr ? "no path" : error.c_str());
+    return FALSE;
+  }
+  delete simulator_scenario;
+  simulator_scenario = new MeetingScenario(scenario);
+  return TRUE;
+}
+
+void flutter_zoom_meeting_sdk_plugin_bind_view(gint64 view_id,
+                                               const gchar* meeting_id) {
+  if (meeting_id == nullptr || *meeting_id == '\0') {
+    if (view_bindings != nullptr) {
+      view_bindings->erase(view_id);
+    }
+    return;
+  }
+  if (view_bindings == nullptr) {
+    view_bindings = new std::map<int64_t, std::string>();
+  }
+  (*view_bindings)[view_id] = meeting_id;
+}
@@ -0,0 +1,28 @@
+#include <flutter_linux/flutter_linux.h>
+
+#include "include/flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_plugin.h"
+#include "meeting_backend.h"
+
+// This file exposes some plugin internals for unit testing. See
+// https://github.com/flutter/flutter/issues/88724 for current limitations
+// in the unit-testable API.
+
+// Handles the getPlatformVersion method call.
+FlMethodResponse* get_platform_version();
+
+// Reads the string map sent by MethodChannelZoom.initZoom.
+flutter_zoom_meeting_sdk::InitParams parse_init_params(FlValue* args);
+
+// Reads the string map that MethodChannelZoom.joinMeeting and
+// MethodChannelZoom.startMeeting send on platforms without packed options.
+flutter_zoom_meeting_sdk::MeetingOptions parse_meeting_options(FlValue* args);
+
+// Reads the arguments of "join" or "start": either the packed record from
+// meeting_options_codec.h or the legacy string map. Returns false if a packed
+// record is malformed.
+bool read_meeting_options(FlValue* args,
+                          flutter_zoom_meeting_sdk::MeetingOptions* options);
+
+// Builds the [name, message] list used for meeting_status results and
+// zoom_event_stream events.
+FlValue* meeting_status_value(flutter_zoom_meeting_sdk::MeetingStatus status);
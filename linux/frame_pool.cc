@@ -0,0 +1,263 @@
+#include "frame_pool.h"
+
+#include <cstdlib>
+#include <limits>
+
+#include "memory_accounting.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+constexpr int kMinClassShift = 12;
+constexpr int kMaxClassShift = 26;
+constexpr size_t kClassesPerDoubling = 4;
+
+// Raises |peak| to |value| if it is lower.
+void UpdatePeak(std::atomic<uint64_t>* peak, uint64_t value) {
+  uint64_t current = peak->load(std::memory_order_relaxed);
+  while (current < value &&
+         !peak->compare_exchange_weak(current, value,
+                                      std::memory_order_relaxed)) {
+  }
+}
+
+// The shard of the calling thread, fixed for its lifetime.
+size_t ThreadShard(size_t shard_count) {
+  static std::atomic<size_t> next_thread{0};
+  thread_local size_t thread_index =
+      next_thread.fetch_add(1, std::memory_order_relaxed);
+  return thread_index % shard_count;
+}
+
+}  // namespace
+
+FramePool* FramePool::Get() {
+  static FramePool* pool = new FramePool(Config());
+  return pool;
+}
+
+FramePool::FramePool(const Config& config)
+    : max_bytes_(config.max_bytes),
+      thread_cache_buffers_(config.thread_cache_buffers),
+      shards_(new Shard[kShardCount]) {
+  for (int shift = kMinClassShift; shift < kMaxClassShift; ++shift) {
+    size_t base = size_t{1} << shift;
+    for (size_t step = 0; step < kClassesPerDoubling; ++step) {
+      classes_.push_back(std::make_unique<SizeClass>());
+      classes_.back()->buffer_size =
+          base + step * (base / kClassesPerDoubling);
+    }
+  }
+  classes_.push_back(std::make_unique<SizeClass>());
+  classes_.back()->buffer_size = kMaxBufferSize;
+  for (size_t i = 0; i < kShardCount; ++i) {
+    shards_[i].free.resize(classes_.size());
+  }
+}
+
+FramePool::~FramePool() {
+  Trim();
+}
+
+size_t FramePool::ClassIndex(size_t size) const {
+  if (size <= (size_t{1} << kMinClassShift)) {
+    return 0;
+  }
+  // |size| is in (2^shift, 2^(shift + 1)], which holds four classes.
+  int shift = 63 - __builtin_clzll(static_cast<uint64_t>(size - 1));
+  size_t base = size_t{1} << shift;
+  size_t step = base / kClassesPerDoubling;
+  size_t within = (size - base + step - 1) / step;
+  return (shift - kMinClassShift) * kClassesPerDoubling + within;
+}
+
+void* FramePool::Allocate(size_t size) {
+  if (size > kMaxBufferSize) {
+    failed_allocations_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  size_t index = ClassIndex(size);
+  SizeClass* size_class = classes_[index].get();
+  void* buffer = TakeFree(index);
+  if (buffer == nullptr) {
+    if (!Reserve(size_class->buffer_size)) {
+      failed_allocations_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    buffer = aligned_alloc(kFrameBufferAlignment, size_class->buffer_size);
+    if (buffer == nullptr) {
+      held_bytes_.fetch_sub(size_class->buffer_size,
+                            std::memory_order_relaxed);
+      failed_allocations_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    MemoryAccounting::Charge(MemoryCategory::kVideoFrames,
+                             static_cast<int64_t>(size_class->buffer_size));
+  }
+  MarkInUse(size_class);
+  return buffer;
+}
+
+void* FramePool::TakeFree(size_t index) {
+  SizeClass* size_class = classes_[index].get();
+  {
+    Shard& shard = shards_[ThreadShard(kShardCount)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    std::vector<void*>& free = shard.free[index];
+    if (!free.empty()) {
+      void* buffer = free.back();
+      free.pop_back();
+      size_class->free_bytes.fetch_sub(size_class->buffer_size,
+                                       std::memory_order_relaxed);
+      return buffer;
+    }
+  }
+  std::lock_guard<std::mutex> lock(size_class->mutex);
+  if (size_class->free.empty()) {
+    return nullptr;
+  }
+  void* buffer = size_class->free.back();
+  size_class->free.pop_back();
+  size_class->free_bytes.fetch_sub(size_class->buffer_size,
+                                   std::memory_order_relaxed);
+  return buffer;
+}
+
+void FramePool::Release(void* buffer, size_t size) {
+  if (buffer == nullptr) {
+    return;
+  }
+  size_t index = ClassIndex(size);
+  SizeClass* size_class = classes_[index].get();
+  size_class->in_use_bytes.fetch_sub(size_class->buffer_size,
+                                     std::memory_order_relaxed);
+
+  // Keep nothing while over a cap that was lowered.
+  if (held_bytes_.load(std::memory_order_relaxed) >
+      max_bytes_.load(std::memory_order_relaxed)) {
+    FreeHeld(buffer, size_class->buffer_size);
+    return;
+  }
+  {
+    Shard& shard = shards_[ThreadShard(kShardCount)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    std::vector<void*>& free = shard.free[index];
+    if (free.size() < thread_cache_buffers_) {
+      free.push_back(buffer);
+      size_class->free_bytes.fetch_add(size_class->buffer_size,
+                                       std::memory_order_relaxed);
+      return;
+    }
+  }
+  std::lock_guard<std::mutex> lock(size_class->mutex);
+  size_class->free.push_back(buffer);
+  size_class->free_bytes.fetch_add(size_class->buffer_size,
+                                   std::memory_order_relaxed);
+}
+
+void FramePool::Trim() {
+  ReleaseFree(std::numeric_limits<uint64_t>::max());
+}
+
+void FramePool::SetMaxBytes(size_t max_bytes) {
+  max_bytes_.store(max_bytes, std::memory_order_relaxed);
+  uint64_t held = held_bytes_.load(std::memory_order_relaxed);
+  if (held > max_bytes) {
+    ReleaseFree(held - max_bytes);
+  }
+}
+
+bool FramePool::Reserve(size_t bytes) {
+  uint64_t held = held_bytes_.load(std::memory_order_relaxed);
+  while (true) {
+    uint64_t max_bytes = max_bytes_.load(std::memory_order_relaxed);
+    if (held + bytes > max_bytes) {
+      if (ReleaseFree(held + bytes - max_bytes) == 0) {
+        return false;
+      }
+      held = held_bytes_.load(std::memory_order_relaxed);
+      continue;
+    }
+    if (held_bytes_.compare_exchange_weak(held, held + bytes,
+                                          std::memory_order_relaxed)) {
+      UpdatePeak(&peak_bytes_, held + bytes);
+      return true;
+    }
+  }
+}
+
+uint64_t FramePool::ReleaseFree(uint64_t bytes) {
+  uint64_t released = 0;
+  // Largest classes first, so the fewest buffers are lost.
+  for (size_t index = classes_.size(); index-- > 0 && released < bytes;) {
+    SizeClass* size_class = classes_[index].get();
+    std::vector<void*> buffers;
+    {
+      std::lock_guard<std::mutex> lock(size_class->mutex);
+      while (!size_class->free.empty() && released < bytes) {
+        buffers.push_back(size_class->free.back());
+        size_class->free.pop_back();
+        size_class->free_bytes.fetch_sub(size_class->buffer_size,
+                                         std::memory_order_relaxed);
+        released += size_class->buffer_size;
+      }
+    }
+    for (size_t i = 0; i < kShardCount && released < bytes; ++i) {
+      std::lock_guard<std::mutex> lock(shards_[i].mutex);
+      std::vector<void*>& free = shards_[i].free[index];
+      while (!free.empty() && released < bytes) {
+        buffers.push_back(free.back());
+        free.pop_back();
+        size_class->free_bytes.fetch_sub(size_class->buffer_size,
+                                         std::memory_order_relaxed);
+        released += size_class->buffer_size;
+      }
+    }
+    for (void* buffer : buffers) {
+      FreeHeld(buffer, size_class->buffer_size);
+    }
+  }
+  return released;
+}
+
+void FramePool::FreeHeld(void* buffer, size_t buffer_size) {
+  free(buffer);
+  held_bytes_.fetch_sub(buffer_size, std::memory_order_relaxed);
+  MemoryAccounting::Charge(MemoryCategory::kVideoFrames,
+                           -static_cast<int64_t>(buffer_size));
+}
+
+void FramePool::MarkInUse(SizeClass* size_class) {
+  uint64_t in_use = size_class->in_use_bytes.fetch_add(
+                        size_class->buffer_size, std::memory_order_relaxed) +
+                    size_class->buffer_size;
+  UpdatePeak(&size_class->peak_bytes, in_use);
+}
+
+FramePool::Stats FramePool::GetStats() const {
+  Stats stats;
+  stats.max_bytes = max_bytes_.load(std::memory_order_relaxed);
+  stats.peak_bytes = peak_bytes_.load(std::memory_order_relaxed);
+  stats.failed_allocations =
+      failed_allocations_.load(std::memory_order_relaxed);
+  for (const std::unique_ptr<SizeClass>& size_class : classes_) {
+    ClassStats class_stats;
+    class_stats.buffer_size = size_class->buffer_size;
+    class_stats.in_use_bytes =
+        size_class->in_use_bytes.load(std::memory_order_relaxed);
+    class_stats.free_bytes =
+        size_class->free_bytes.load(std::memory_order_relaxed);
+    class_stats.peak_bytes =
+        size_class->peak_bytes.load(std::memory_order_relaxed);
+    if (class_stats.peak_bytes == 0 && class_stats.free_bytes == 0) {
+      continue;
+    }
+    stats.in_use_bytes += class_stats.in_use_bytes;
+    stats.free_bytes += class_stats.free_bytes;
+    stats.classes.push_back(class_stats);
+  }
+  return stats;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
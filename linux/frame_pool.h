@@ -0,0 +1,141 @@
+#ifndef FLUTTER_PLUGIN_FRAME_POOL_H_
+#define FLUTTER_PLUGIN_FRAME_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+
+// Alignment of every pooled buffer, and of each plane VideoFrame places in
+// one.
+constexpr size_t kFrameBufferAlignment = 64;
+
+// Recycles media plane buffers so that a meeting's steady stream of
+// same-sized frames stops going through malloc.
+//
+// Requests are rounded up to a size class, four per doubling from 4 KiB to
+// 64 MiB, so at most a fifth of a buffer is slack. Released buffers go on
+// a small per-thread free list first, then on their class's shared list;
+// allocation looks in the same places before asking the system. Threads
+// are mapped onto a fixed set of free list shards, so each list has its
+// own lock, which only threads sharing a shard ever contend for.
+//
+// Config::max_bytes caps every byte the pool holds, in use or free. An
+// allocation that would go over it first releases free buffers to the
+// system, then fails.
+class FramePool {
+ public:
+  struct Config {
+    size_t max_bytes = 512 << 20;
+    // Free buffers of each class kept on a thread's own list.
+    size_t thread_cache_buffers = 2;
+  };
+
+  struct ClassStats {
+    size_t buffer_size = 0;
+    uint64_t in_use_bytes = 0;
+    uint64_t free_bytes = 0;
+    // Highest |in_use_bytes| so far.
+    uint64_t peak_bytes = 0;
+  };
+
+  struct Stats {
+    size_t max_bytes = 0;
+    uint64_t in_use_bytes = 0;
+    uint64_t free_bytes = 0;
+    // Highest in use and free total so far.
+    uint64_t peak_bytes = 0;
+    uint64_t failed_allocations = 0;
+    // Only the classes that have held a buffer.
+    std::vector<ClassStats> classes;
+  };
+
+  // Largest buffer the pool hands out.
+  static constexpr size_t kMaxBufferSize = 64 << 20;
+
+  // The pool VideoFrame::Allocate() draws from. Never destroyed.
+  static FramePool* Get();
+
+  explicit FramePool(const Config& config);
+
+  // Every buffer must have been released.
+  ~FramePool();
+
+  FramePool(const FramePool&) = delete;
+  FramePool& operator=(const FramePool&) = delete;
+
+  // Returns a kFrameBufferAlignment-aligned buffer of at least |size|
+  // bytes, or nullptr if |size| exceeds kMaxBufferSize or the pool is at
+  // its cap. Safe to call from any thread.
+  void* Allocate(size_t size);
+
+  // Returns |buffer|, allocated with the same |size|, to the pool. Safe to
+  // call from any thread.
+  void Release(void* buffer, size_t size);
+
+  // Gives every free buffer back to the system.
+  void Trim();
+
+  // Changes the cap. Buffers already allocated are not affected.
+  void SetMaxBytes(size_t max_bytes);
+
+  Stats GetStats() const;
+
+ private:
+  static constexpr size_t kShardCount = 16;
+
+  struct SizeClass {
+    size_t buffer_size = 0;
+    std::atomic<uint64_t> in_use_bytes{0};
+    std::atomic<uint64_t> free_bytes{0};
+    std::atomic<uint64_t> peak_bytes{0};
+    // Guards |free|.
+    std::mutex mutex;
+    std::vector<void*> free;
+  };
+
+  // A set of per-class free lists used by the threads mapped to it.
+  struct Shard {
+    std::mutex mutex;
+    std::vector<std::vector<void*>> free;
+  };
+
+  // Index of the smallest class that holds |size|.
+  size_t ClassIndex(size_t size) const;
+
+  // Takes a free buffer of |index| from the calling thread's shard or the
+  // shared list, or returns nullptr.
+  void* TakeFree(size_t index);
+
+  // Counts |bytes| more held by the pool, releasing free buffers as needed
+  // to stay under the cap. Returns false if it cannot.
+  bool Reserve(size_t bytes);
+
+  // Gives free buffers back to the system, the shared lists' before the
+  // shards', until at least |bytes| are released or none are left.
+  // Returns the bytes released.
+  uint64_t ReleaseFree(uint64_t bytes);
+
+  // Frees a buffer that is no longer counted in any free list.
+  void FreeHeld(void* buffer, size_t buffer_size);
+
+  void MarkInUse(SizeClass* size_class);
+
+  std::atomic<size_t> max_bytes_;
+  const size_t thread_cache_buffers_;
+  std::vector<std::unique_ptr<SizeClass>> classes_;
+  std::unique_ptr<Shard[]> shards_;
+
+  // In use and free bytes together.
+  std::atomic<uint64_t> held_bytes_{0};
+  std::atomic<uint64_t> peak_bytes_{0};
+  std::atomic<uint64_t> failed_allocations_{0};
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_FRAME_POOL_H_
@@ -0,0 +1,291 @@
+#include "gallery_compositor.h"
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <utility>
+
+#include "trace.h"
+#include "yuv_convert.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+// Letterbox bars, opaque black in RGBA byte order.
+constexpr uint32_t kBarColor = 0xff000000;
+
+}  // namespace
+
+GalleryCompositor::GalleryCompositor(Clock clock) : clock_(clock) {}
+
+GalleryCompositor::~GalleryCompositor() = default;
+
+bool GalleryCompositor::IsValidLayout(int width,
+                                      int height,
+                                      const std::vector<GalleryTile>& tiles) {
+  if (width <= 0 || height <= 0 || width > kMaxAtlasSize ||
+      height > kMaxAtlasSize) {
+    return false;
+  }
+  std::set<uint32_t> participants;
+  for (const GalleryTile& tile : tiles) {
+    if (tile.x < 0 || tile.y < 0 || tile.width <= 0 || tile.height <= 0 ||
+        tile.width > width - tile.x || tile.height > height - tile.y) {
+      return false;
+    }
+    if (!participants.insert(tile.participant_id).second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool GalleryCompositor::SetLayout(int width,
+                                  int height,
+                                  std::vector<GalleryTile> tiles) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<TileState> states(tiles.size());
+  std::map<uint32_t, size_t> index;
+  for (size_t i = 0; i < tiles.size(); ++i) {
+    states[i].tile = tiles[i];
+    auto previous = tile_index_.find(tiles[i].participant_id);
+    if (previous != tile_index_.end()) {
+      TileState& old_state = tiles_[previous->second];
+      states[i].pending = std::move(old_state.pending);
+      states[i].pending_since_us = old_state.pending_since_us;
+      states[i].shown = std::move(old_state.shown);
+    }
+    index[tiles[i].participant_id] = i;
+  }
+  // Frames still pending for tiles that left the layout are never drawn.
+  for (const TileState& old_state : tiles_) {
+    if (old_state.pending != nullptr) {
+      stats_.dropped++;
+    }
+  }
+  tiles_ = std::move(states);
+  tile_index_ = std::move(index);
+  ReleaseFrozenTiles();
+  layout_width_ = width;
+  layout_height_ = height;
+  layout_changed_ = true;
+
+  bool request = !frame_requested_;
+  frame_requested_ = true;
+  return request;
+}
+
+bool GalleryCompositor::Push(uint32_t participant_id,
+                             std::shared_ptr<const VideoFrame> frame) {
+  if (frame == nullptr) {
+    return false;
+  }
+  const int64_t since_us =
+      frame->timestamp_us() != 0 ? frame->timestamp_us() : clock_();
+  std::shared_ptr<const VideoFrame> replaced;
+  bool request;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tile_index_.find(participant_id);
+    if (it == tile_index_.end() ||
+        (max_live_tiles_ != 0 && it->second >= max_live_tiles_)) {
+      return false;
+    }
+    TileState& state = tiles_[it->second];
+    replaced = std::move(state.pending);
+    state.pending = std::move(frame);
+    state.pending_since_us = since_us;
+    stats_.produced++;
+    if (replaced != nullptr) {
+      stats_.dropped++;
+    }
+    request = !frame_requested_;
+    frame_requested_ = true;
+  }
+  // |replaced| is released outside the lock, since that may hand its planes
+  // back to the producer.
+  return request;
+}
+
+bool GalleryCompositor::SetMaxLiveTiles(size_t count) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (count == max_live_tiles_) {
+    return false;
+  }
+  max_live_tiles_ = count;
+  ReleaseFrozenTiles();
+  // Redraw everything, which blanks the tiles that lost their video.
+  layout_changed_ = true;
+  bool request = !frame_requested_;
+  frame_requested_ = true;
+  return request;
+}
+
+void GalleryCompositor::ReleaseFrozenTiles() {
+  if (max_live_tiles_ == 0) {
+    return;
+  }
+  for (size_t i = max_live_tiles_; i < tiles_.size(); ++i) {
+    if (tiles_[i].pending != nullptr) {
+      stats_.dropped++;
+    }
+    tiles_[i].pending.reset();
+    tiles_[i].shown.reset();
+  }
+}
+
+bool GalleryCompositor::Render(const uint8_t** rgba,
+                               uint32_t* width,
+                               uint32_t* height) {
+  ZOOM_TRACE_SCOPE("video", "render_gallery");
+  bool relayout;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    frame_requested_ = false;
+    relayout = layout_changed_;
+    layout_changed_ = false;
+    if (relayout) {
+      atlas_width_ = layout_width_;
+      atlas_height_ = layout_height_;
+    }
+    for (TileState& state : tiles_) {
+      int64_t since_us = 0;
+      if (state.pending != nullptr) {
+        state.shown = std::move(state.pending);
+        since_us = state.pending_since_us;
+      } else if (!relayout || state.shown == nullptr) {
+        continue;
+      }
+      blits_.push_back({state.tile, state.shown, since_us});
+    }
+  }
+
+  if (atlas_width_ == 0 || atlas_height_ == 0) {
+    blits_.clear();
+    return false;
+  }
+  if (relayout) {
+    // Areas outside every tile, and tiles still waiting for video, stay
+    // transparent.
+    atlas_.assign(static_cast<size_t>(atlas_width_) * atlas_height_ * 4, 0);
+  }
+  for (const Blit& blit : blits_) {
+    DrawTile(blit.tile, *blit.frame);
+  }
+  blit_count_ += blits_.size();
+  const int64_t now_us = clock_();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const Blit& blit : blits_) {
+      if (blit.since_us != 0) {
+        stats_.RecordDisplayed(now_us - blit.since_us);
+      }
+    }
+  }
+  blits_.clear();
+
+  *rgba = atlas_.data();
+  *width = static_cast<uint32_t>(atlas_width_);
+  *height = static_cast<uint32_t>(atlas_height_);
+  return true;
+}
+
+VideoFrameStats GalleryCompositor::GetStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+void GalleryCompositor::DrawTile(const GalleryTile& tile,
+                                 const VideoFrame& frame) {
+  if (frame.width() <= 0 || frame.height() <= 0) {
+    return;
+  }
+
+  // Fit the frame inside the tile, centered, and letterbox the rest.
+  int fit_width = tile.width;
+  int fit_height = tile.height;
+  if (static_cast<int64_t>(frame.width()) * tile.height >
+      static_cast<int64_t>(tile.width) * frame.height()) {
+    fit_height = std::max<int>(
+        1, static_cast<int64_t>(tile.width) * frame.height() / frame.width());
+  } else {
+    fit_width = std::max<int>(
+        1, static_cast<int64_t>(tile.height) * frame.width() / frame.height());
+  }
+  const int fit_x = tile.x + (tile.width - fit_width) / 2;
+  const int fit_y = tile.y + (tile.height - fit_height) / 2;
+  FillRect(tile.x, tile.y, tile.width, fit_y - tile.y, kBarColor);
+  FillRect(tile.x, fit_y + fit_height, tile.width,
+           tile.y + tile.height - fit_y - fit_height, kBarColor);
+  FillRect(tile.x, fit_y, fit_x - tile.x, fit_height, kBarColor);
+  FillRect(fit_x + fit_width, fit_y, tile.x + tile.width - fit_x - fit_width,
+           fit_height, kBarColor);
+
+  const size_t atlas_stride = static_cast<size_t>(atlas_width_) * 4;
+  if (fit_width <= frame.width() && fit_height <= frame.height()) {
+    // Tiles are usually smaller than the frame: box-filter it down while
+    // converting, straight into the atlas.
+    I420ScaleToRgba(frame.data_y(), frame.stride_y(), frame.data_u(),
+                    frame.stride_u(), frame.data_v(), frame.stride_v(),
+                    frame.width(), frame.height(),
+                    atlas_.data() + fit_y * atlas_stride + fit_x * 4,
+                    static_cast<int>(atlas_stride), fit_width, fit_height);
+    return;
+  }
+
+  // Nearest-neighbour upscaling, sampling at pixel centers. Each source row
+  // is converted once, however many output rows repeat it.
+  const bool same_width = fit_width == frame.width();
+  if (!same_width) {
+    row_.resize(static_cast<size_t>(frame.width()) * 4);
+    column_map_.resize(fit_width);
+    for (int col = 0; col < fit_width; ++col) {
+      column_map_[col] = static_cast<int>(
+          (2 * static_cast<int64_t>(col) + 1) * frame.width() /
+          (2 * static_cast<int64_t>(fit_width)));
+    }
+  }
+  int converted_row = -1;
+  for (int row = 0; row < fit_height; ++row) {
+    int source_row =
+        static_cast<int>((2 * static_cast<int64_t>(row) + 1) * frame.height() /
+                         (2 * static_cast<int64_t>(fit_height)));
+    uint8_t* out = atlas_.data() + (fit_y + row) * atlas_stride + fit_x * 4;
+    uint8_t* target = same_width ? out : row_.data();
+    if (same_width || source_row != converted_row) {
+      I420ToRgba(frame.data_y() + source_row * frame.stride_y(),
+                 frame.stride_y(),
+                 frame.data_u() + (source_row / 2) * frame.stride_u(),
+                 frame.stride_u(),
+                 frame.data_v() + (source_row / 2) * frame.stride_v(),
+                 frame.stride_v(), target, frame.width() * 4, frame.width(),
+                 1);
+      converted_row = source_row;
+    }
+    if (!same_width) {
+      const uint32_t* source = reinterpret_cast<const uint32_t*>(row_.data());
+      uint32_t* dest = reinterpret_cast<uint32_t*>(out);
+      for (int col = 0; col < fit_width; ++col) {
+        dest[col] = source[column_map_[col]];
+      }
+    }
+  }
+}
+
+void GalleryCompositor::FillRect(int x,
+                                 int y,
+                                 int width,
+                                 int height,
+                                 uint32_t rgba) {
+  if (width <= 0 || height <= 0) {
+    return;
+  }
+  for (int row = y; row < y + height; ++row) {
+    uint32_t* out = reinterpret_cast<uint32_t*>(
+        atlas_.data() + (static_cast<size_t>(row) * atlas_width_ + x) * 4);
+    std::fill(out, out + width, rgba);
+  }
+}
+
+}  // namespace flutter_zoom_meeting_sdk
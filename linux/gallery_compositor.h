@@ -0,0 +1,130 @@
+#ifndef FLUTTER_PLUGIN_GALLERY_COMPOSITOR_H_
+#define FLUTTER_PLUGIN_GALLERY_COMPOSITOR_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "memory_accounting.h"
+#include "monotonic_clock.h"
+#include "video_frame.h"
+#include "video_frame_stats.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Where one participant's video is drawn in the gallery atlas, in pixels.
+struct GalleryTile {
+  uint32_t participant_id = 0;
+  int x = 0;
+  int y = 0;
+  int width = 0;
+  int height = 0;
+};
+
+// Composites many participants' video into a single RGBA atlas, so a
+// gallery costs one texture update per frame however many tiles it has.
+//
+// Frames arrive on receive threads and only replace the tile's pending
+// frame, counting the replaced one as dropped. Render() re-blits just the
+// tiles with a new frame since the last call, scaling each frame to fit its
+// tile while keeping the aspect ratio; frames larger than their tile are
+// box-filtered down as they are converted.
+class GalleryCompositor {
+ public:
+  // Largest atlas side, the common GL texture size limit.
+  static constexpr int kMaxAtlasSize = 8192;
+
+  // Returns the time in microseconds.
+  using Clock = int64_t (*)();
+
+  explicit GalleryCompositor(Clock clock = MonotonicNowUs);
+  ~GalleryCompositor();
+
+  GalleryCompositor(const GalleryCompositor&) = delete;
+  GalleryCompositor& operator=(const GalleryCompositor&) = delete;
+
+  // Returns true if every tile lies inside a |width| x |height| atlas, no
+  // participant appears twice and the atlas is no larger than kMaxAtlasSize.
+  static bool IsValidLayout(int width,
+                            int height,
+                            const std::vector<GalleryTile>& tiles);
+
+  // Replaces the layout, which must be valid. Tiles that stay in the gallery
+  // are redrawn from their last frame at their new position. Returns true if
+  // the caller must announce a new atlas frame.
+  bool SetLayout(int width, int height, std::vector<GalleryTile> tiles);
+
+  // Safe to call from any thread. Frames for participants outside the
+  // layout are dropped. Returns true if the caller must announce a new atlas
+  // frame; further pushes before the next Render() return false.
+  bool Push(uint32_t participant_id, std::shared_ptr<const VideoFrame> frame);
+
+  // Safe to call from any thread. Only the first |count| tiles of the layout
+  // show video; the others are blanked, their frames released and further
+  // frames for them dropped. 0 lifts the limit. Returns true if the caller
+  // must announce a new atlas frame.
+  bool SetMaxLiveTiles(size_t count);
+
+  // Called from the raster thread. Points |rgba| at the atlas, which stays
+  // valid until the next call. Returns false if there is no layout.
+  bool Render(const uint8_t** rgba, uint32_t* width, uint32_t* height);
+
+  // Tiles drawn by Render() so far.
+  uint64_t blit_count() const { return blit_count_; }
+
+  // Safe to call from any thread. Frames of every tile together; frames
+  // redrawn for a layout change are not counted again.
+  VideoFrameStats GetStats();
+
+ private:
+  struct TileState {
+    GalleryTile tile;
+    // Newest frame not drawn yet, and when it was captured, or arrived if
+    // that is unknown.
+    std::shared_ptr<const VideoFrame> pending;
+    int64_t pending_since_us = 0;
+    // Frame currently drawn, kept so a layout change can redraw it.
+    std::shared_ptr<const VideoFrame> shown;
+  };
+
+  struct Blit {
+    GalleryTile tile;
+    std::shared_ptr<const VideoFrame> frame;
+    // Zero for a redraw of a frame already displayed.
+    int64_t since_us;
+  };
+
+  // Drops the frames of the tiles past |max_live_tiles_|.
+  void ReleaseFrozenTiles();
+
+  // Raster thread only.
+  void DrawTile(const GalleryTile& tile, const VideoFrame& frame);
+  void FillRect(int x, int y, int width, int height, uint32_t rgba);
+
+  const Clock clock_;
+
+  std::mutex mutex_;
+  VideoFrameStats stats_;
+  int layout_width_ = 0;
+  int layout_height_ = 0;
+  bool layout_changed_ = false;
+  bool frame_requested_ = false;
+  size_t max_live_tiles_ = 0;
+  std::vector<TileState> tiles_;
+  std::map<uint32_t, size_t> tile_index_;
+
+  // Raster thread only.
+  std::vector<Blit> blits_;
+  TrackedVector<uint8_t, MemoryCategory::kVideoTextures> atlas_;
+  int atlas_width_ = 0;
+  int atlas_height_ = 0;
+  TrackedVector<uint8_t, MemoryCategory::kVideoTextures> row_;
+  TrackedVector<int, MemoryCategory::kVideoTextures> column_map_;
+  uint64_t blit_count_ = 0;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_GALLERY_COMPOSITOR_H_
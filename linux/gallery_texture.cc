@@ -0,0 +1,118 @@
+#include "gallery_texture.h"
+
+#include <utility>
+
+using flutter_zoom_meeting_sdk::GalleryCompositor;
+using flutter_zoom_meeting_sdk::GalleryTile;
+using flutter_zoom_meeting_sdk::MeetingBackend;
+using flutter_zoom_meeting_sdk::VideoFrame;
+using flutter_zoom_meeting_sdk::VideoFrameStats;
+
+namespace {
+
+// Passes every gallery participant's frames to the compositor. The texture
+// is marked once per atlas frame, not once per participant frame.
+class GalleryVideoSink : public MeetingBackend::VideoSink {
+ public:
+  GalleryVideoSink(FlTextureRegistrar* registrar, FlTexture* texture)
+      : registrar_(registrar), texture_(texture) {}
+
+  void OnVideoFrame(uint32_t participant_id,
+                    std::shared_ptr<const VideoFrame> frame) override {
+    if (compositor_.Push(participant_id, std::move(frame))) {
+      MarkFrameAvailable();
+    }
+  }
+
+  void MarkFrameAvailable() {
+    fl_texture_registrar_mark_texture_frame_available(registrar_, texture_);
+  }
+
+  GalleryCompositor* compositor() { return &compositor_; }
+
+ private:
+  FlTextureRegistrar* registrar_;
+  FlTexture* texture_;
+  GalleryCompositor compositor_;
+};
+
+}  // namespace
+
+struct _ZoomGalleryTexture {
+  FlPixelBufferTexture parent_instance;
+
+  FlTextureRegistrar* registrar;
+  GalleryVideoSink* sink;
+};
+
+G_DEFINE_TYPE(ZoomGalleryTexture,
+              zoom_gallery_texture,
+              fl_pixel_buffer_texture_get_type())
+
+// Implements FlPixelBufferTexture::copy_pixels. Called on the raster thread.
+static gboolean zoom_gallery_texture_copy_pixels(FlPixelBufferTexture* texture,
+                                                 const uint8_t** out_buffer,
+                                                 uint32_t* width,
+                                                 uint32_t* height,
+                                                 GError** error) {
+  ZoomGalleryTexture* self = ZOOM_GALLERY_TEXTURE(texture);
+  if (!self->sink->compositor()->Render(out_buffer, width, height)) {
+    static const uint8_t kTransparentPixel[4] = {0, 0, 0, 0};
+    *out_buffer = kTransparentPixel;
+    *width = 1;
+    *height = 1;
+  }
+  return TRUE;
+}
+
+static void zoom_gallery_texture_dispose(GObject* object) {
+  ZoomGalleryTexture* self = ZOOM_GALLERY_TEXTURE(object);
+
+  delete self->sink;
+  self->sink = nullptr;
+  g_clear_object(&self->registrar);
+
+  G_OBJECT_CLASS(zoom_gallery_texture_parent_class)->dispose(object);
+}
+
+static void zoom_gallery_texture_class_init(ZoomGalleryTextureClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = zoom_gallery_texture_dispose;
+  FL_PIXEL_BUFFER_TEXTURE_CLASS(klass)->copy_pixels =
+      zoom_gallery_texture_copy_pixels;
+}
+
+static void zoom_gallery_texture_init(ZoomGalleryTexture* self) {}
+
+ZoomGalleryTexture* zoom_gallery_texture_new(FlTextureRegistrar* registrar) {
+  ZoomGalleryTexture* self = ZOOM_GALLERY_TEXTURE(
+      g_object_new(zoom_gallery_texture_get_type(), nullptr));
+  self->registrar = FL_TEXTURE_REGISTRAR(g_object_ref(registrar));
+  self->sink = new GalleryVideoSink(self->registrar, FL_TEXTURE(self));
+  return self;
+}
+
+void zoom_gallery_texture_set_layout(ZoomGalleryTexture* texture,
+                                     int width,
+                                     int height,
+                                     std::vector<GalleryTile> tiles) {
+  if (texture->sink->compositor()->SetLayout(width, height,
+                                             std::move(tiles))) {
+    texture->sink->MarkFrameAvailable();
+  }
+}
+
+void zoom_gallery_texture_set_max_live_tiles(ZoomGalleryTexture* texture,
+                                             size_t count) {
+  if (texture->sink->compositor()->SetMaxLiveTiles(count)) {
+    texture->sink->MarkFrameAvailable();
+  }
+}
+
+MeetingBackend::VideoSink* zoom_gallery_texture_get_sink(
+    ZoomGalleryTexture* texture) {
+  return texture->sink;
+}
+
+VideoFrameStats zoom_gallery_texture_get_stats(ZoomGalleryTexture* texture) {
+  return texture->sink->compositor()->GetStats();
+}
@@ -0,0 +1,44 @@
+#ifndef FLUTTER_PLUGIN_GALLERY_TEXTURE_H_
+#define FLUTTER_PLUGIN_GALLERY_TEXTURE_H_
+
+#include <flutter_linux/flutter_linux.h>
+
+#include <vector>
+
+#include "gallery_compositor.h"
+#include "meeting_backend.h"
+
+G_DECLARE_FINAL_TYPE(ZoomGalleryTexture,
+                     zoom_gallery_texture,
+                     ZOOM,
+                     GALLERY_TEXTURE,
+                     FlPixelBufferTexture)
+
+// Creates a texture that shows every gallery participant in one atlas, see
+// GalleryCompositor. New frames are announced through |registrar|, which the
+// texture must be registered with.
+ZoomGalleryTexture* zoom_gallery_texture_new(FlTextureRegistrar* registrar);
+
+// Replaces the layout, which must pass GalleryCompositor::IsValidLayout.
+void zoom_gallery_texture_set_layout(
+    ZoomGalleryTexture* texture,
+    int width,
+    int height,
+    std::vector<flutter_zoom_meeting_sdk::GalleryTile> tiles);
+
+// Shows video in only the first |count| tiles of the layout, see
+// GalleryCompositor::SetMaxLiveTiles. 0 lifts the limit.
+void zoom_gallery_texture_set_max_live_tiles(ZoomGalleryTexture* texture,
+                                             size_t count);
+
+// Returns the sink to subscribe every gallery participant with. It is owned
+// by the texture; unsubscribe before the texture is released.
+flutter_zoom_meeting_sdk::MeetingBackend::VideoSink*
+zoom_gallery_texture_get_sink(ZoomGalleryTexture* texture);
+
+// Returns the frame counts of every tile together. May be called from any
+// thread.
+flutter_zoom_meeting_sdk::VideoFrameStats zoom_gallery_texture_get_stats(
+    ZoomGalleryTexture* texture);
+
+#endif  // FLUTTER_PLUGIN_GALLERY_TEXTURE_H_
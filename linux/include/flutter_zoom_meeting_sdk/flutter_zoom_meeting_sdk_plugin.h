@@ -0,0 +1,64 @@
+#ifndef FLUTTER_PLUGIN_FLUTTER_ZOOM_MEETING_SDK_PLUGIN_H_
+#define FLUTTER_PLUGIN_FLUTTER_ZOOM_MEETING_SDK_PLUGIN_H_
+
+#include <flutter_linux/flutter_linux.h>
+
+G_BEGIN_DECLS
+
+#ifdef FLUTTER_PLUGIN_IMPL
+#define FLUTTER_PLUGIN_EXPORT __attribute__((visibility("default")))
+#else
+#define FLUTTER_PLUGIN_EXPORT
+#endif
+
+typedef struct _FlutterZoomMeetingSdkPlugin FlutterZoomMeetingSdkPlugin;
+typedef struct {
+  GObjectClass parent_class;
+} FlutterZoomMeetingSdkPluginClass;
+
+FLUTTER_PLUGIN_EXPORT GType flutter_zoom_meeting_sdk_plugin_get_type();
+
+FLUTTER_PLUGIN_EXPORT void flutter_zoom_meeting_sdk_plugin_register_with_registrar(
+    FlPluginRegistrar* registrar);
+
+// Records that startup reached |name|, e.g. "main", "activate",
+// "register_plugins", "plugins_registered" or "first_frame". The plugin adds
+// "sdk_init_start" and "sdk_init_complete" itself. Only the first mark of each
+// name counts. The timeline is logged with g_debug once the first frame and
+// SDK init have both happened, and Dart can read it with startupTimeline().
+FLUTTER_PLUGIN_EXPORT void flutter_zoom_meeting_sdk_plugin_mark_startup(
+    const gchar* name);
+
+// Opts in to warm-up: as soon as the plugin is registered it initializes the
+// SDK with these parameters on a worker thread, in parallel with Dart
+// startup, and the first "init" from Dart gets the cached result. If warm-up
+// fails, that "init" runs with Dart's own parameters instead. Call before
+// fl_register_plugins(). Any argument may be NULL.
+FLUTTER_PLUGIN_EXPORT void flutter_zoom_meeting_sdk_plugin_set_warm_up_init(
+    const gchar* domain,
+    const gchar* jwt_token,
+    const gchar* app_key,
+    const gchar* app_secret);
+
+// Replaces the meeting backend with a simulator that replays the scenario
+// file at |path| (see linux/meeting_scenario.h) for load and soak testing
+// without a network. Call before fl_register_plugins(). Returns FALSE, and
+// logs why, if the file cannot be read or parsed; the plugin then keeps its
+// usual backend.
+FLUTTER_PLUGIN_EXPORT gboolean
+flutter_zoom_meeting_sdk_plugin_set_simulator_scenario(const gchar* path);
+
+// Records that the Flutter view |view_id| shows the meeting |meeting_id|, or
+// forgets the view's meeting if |meeting_id| is NULL or empty. For runners
+// that open a view per meeting on one engine with fl_view_new_for_engine(),
+// so that every meeting shares the engine, the Dart heap and the plugin.
+// Dart reads the bindings with viewBindings() and finds its own view's ID
+// with View.of(context).viewId. Bindings are kept for the whole process.
+// Call on the main thread, before or after fl_register_plugins().
+FLUTTER_PLUGIN_EXPORT void flutter_zoom_meeting_sdk_plugin_bind_view(
+    gint64 view_id,
+    const gchar* meeting_id);
+
+G_END_DECLS
+
+#endif  // FLUTTER_PLUGIN_FLUTTER_ZOOM_MEETING_SDK_PLUGIN_H_
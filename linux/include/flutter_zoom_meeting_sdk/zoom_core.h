@@ -0,0 +1,57 @@
+#ifndef FLUTTER_PLUGIN_ZOOM_CORE_H_
+#define FLUTTER_PLUGIN_ZOOM_CORE_H_
+
+// C ABI of libzoom_core.so, the plugin's native core, for Dart to call
+// through dart:ffi without a platform channel round trip. ZoomCore in
+// lib/flutter_zoom_meeting_sdk_core.dart binds it. Functions are only ever
+// added; a change to an existing one bumps ZOOM_CORE_ABI_VERSION.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef ZOOM_CORE_IMPL
+#define ZOOM_CORE_EXPORT __attribute__((visibility("default")))
+#else
+#define ZOOM_CORE_EXPORT
+#endif
+
+#define ZOOM_CORE_ABI_VERSION 2
+
+// Names one plugin instance's native state. Dart gets it from the
+// "core_handle" method call. Handles are never reused: once the plugin is
+// disposed its handle goes stale, and calls with it fail or do nothing.
+typedef uint64_t ZoomCoreHandle;
+
+// Dart_PostCObject from dart_native_api.h, which Dart hands over as
+// NativeApi.postCObject.
+typedef bool (*ZoomCorePostCObject)(int64_t port, void* message);
+
+ZOOM_CORE_EXPORT int32_t zoom_core_abi_version(void);
+
+// Lets the core post to Dart ports. Call once per process before any
+// zoom_core_set_*_port(). Safe to call from any thread.
+ZOOM_CORE_EXPORT void zoom_core_init_dart_api(ZoomCorePostCObject post_cobject);
+
+// Sends the IDs of audio streams with new samples straight from the audio
+// thread to the Dart port |port|, as ints, instead of through the event
+// channel and the main loop. Port 0 goes back to the event channel. As on
+// the channel, a stream is notified once until zoom_core_acknowledge_audio().
+// Returns false if zoom_core_init_dart_api() has not been called or |handle|
+// is stale.
+ZOOM_CORE_EXPORT bool zoom_core_set_audio_port(ZoomCoreHandle handle,
+                                               int64_t port);
+
+// Re-arms notifications for |participant_id|'s audio stream. Safe to call
+// from any thread; does nothing if |handle| is stale.
+ZOOM_CORE_EXPORT void zoom_core_acknowledge_audio(ZoomCoreHandle handle,
+                                                  uint32_t participant_id);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // FLUTTER_PLUGIN_ZOOM_CORE_H_
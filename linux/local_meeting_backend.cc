@@ -0,0 +1,150 @@
+#include "local_meeting_backend.h"
+
+#include <thread>
+
+#include "trace.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+LocalMeetingBackend::LocalMeetingBackend() : LocalMeetingBackend(Config()) {}
+
+LocalMeetingBackend::LocalMeetingBackend(const Config& config)
+    : config_(config) {}
+
+LocalMeetingBackend::~LocalMeetingBackend() = default;
+
+InitResult LocalMeetingBackend::Initialize(const InitParams& params) {
+  ZOOM_TRACE_SCOPE("backend", "Initialize");
+  InitResult result;
+  std::lock_guard<std::mutex> lock(init_mutex_);
+  if (initialized_) {
+    return result;
+  }
+  if (params.domain.empty()) {
+    result.error_code = kZoomErrorInvalidArguments;
+    return result;
+  }
+
+  std::this_thread::sleep_for(config_.init_delay);
+  initialized_ = true;
+  return result;
+}
+
+bool LocalMeetingBackend::IsInitialized() const {
+  return initialized_;
+}
+
+bool LocalMeetingBackend::JoinMeeting(const MeetingOptions& options) {
+  return EnterMeeting(options);
+}
+
+bool LocalMeetingBackend::StartMeeting(const MeetingOptions& options) {
+  if (options.zoom_access_token.empty()) {
+    return false;
+  }
+  return EnterMeeting(options);
+}
+
+bool LocalMeetingBackend::LeaveMeeting(const std::string& meeting_id) {
+  {
+    std::lock_guard<std::mutex> lock(meetings_mutex_);
+    if (meetings_.erase(meeting_id) == 0) {
+      return false;
+    }
+  }
+  SetStatus(meeting_id, MeetingStatus::kDisconnecting, 0);
+  SetStatus(meeting_id, MeetingStatus::kIdle, 0);
+  return true;
+}
+
+MeetingStatus LocalMeetingBackend::GetMeetingStatus() const {
+  return status_;
+}
+
+void LocalMeetingBackend::SetObserver(Observer* observer) {
+  std::lock_guard<std::mutex> lock(observer_mutex_);
+  observer_ = observer;
+}
+
+bool LocalMeetingBackend::SubscribeVideo(uint32_t participant_id,
+                                         VideoSink* sink) {
+  if (!initialized_ || sink == nullptr) {
+    return false;
+  }
+  auto source = std::make_unique<SyntheticVideoSource>(participant_id,
+                                                      config_.video, sink);
+  {
+    std::lock_guard<std::mutex> lock(video_mutex_);
+    video_sources_[participant_id].swap(source);
+  }
+  // |source| now holds the replaced subscription, if any, and is stopped
+  // outside the lock.
+  return true;
+}
+
+void LocalMeetingBackend::UnsubscribeVideo(uint32_t participant_id) {
+  std::unique_ptr<SyntheticVideoSource> source;
+  {
+    std::lock_guard<std::mutex> lock(video_mutex_);
+    auto it = video_sources_.find(participant_id);
+    if (it == video_sources_.end()) {
+      return;
+    }
+    source = std::move(it->second);
+    video_sources_.erase(it);
+  }
+  // Destroying the source joins its thread.
+}
+
+bool LocalMeetingBackend::StartRawAudio(AudioSink* sink) {
+  if (!initialized_ || sink == nullptr) {
+    return false;
+  }
+  auto source = std::make_unique<SyntheticAudioSource>(config_.audio, sink);
+  {
+    std::lock_guard<std::mutex> lock(audio_mutex_);
+    audio_source_.swap(source);
+  }
+  // |source| now holds the replaced source, if any, and is stopped outside
+  // the lock.
+  return true;
+}
+
+void LocalMeetingBackend::StopRawAudio() {
+  std::unique_ptr<SyntheticAudioSource> source;
+  {
+    std::lock_guard<std::mutex> lock(audio_mutex_);
+    source = std::move(audio_source_);
+  }
+  // Destroying the source joins its thread.
+}
+
+bool LocalMeetingBackend::EnterMeeting(const MeetingOptions& options) {
+  ZOOM_TRACE_SCOPE("backend", "EnterMeeting");
+  if (!initialized_ || options.meeting_id.empty()) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(meetings_mutex_);
+    if (!meetings_.insert(options.meeting_id).second) {
+      return false;
+    }
+  }
+
+  SetStatus(options.meeting_id, MeetingStatus::kConnecting, 0);
+  std::this_thread::sleep_for(config_.join_delay);
+  SetStatus(options.meeting_id, MeetingStatus::kInMeeting, 0);
+  return true;
+}
+
+void LocalMeetingBackend::SetStatus(const std::string& meeting_id,
+                                    MeetingStatus status,
+                                    int32_t error_code) {
+  status_ = status;
+  std::lock_guard<std::mutex> lock(observer_mutex_);
+  if (observer_ != nullptr) {
+    observer_->OnMeetingStatusChanged(meeting_id, status, error_code, 0);
+  }
+}
+
+}  // namespace flutter_zoom_meeting_sdk
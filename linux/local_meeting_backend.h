@@ -0,0 +1,82 @@
+#ifndef FLUTTER_PLUGIN_LOCAL_MEETING_BACKEND_H_
+#define FLUTTER_PLUGIN_LOCAL_MEETING_BACKEND_H_
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include "meeting_backend.h"
+#include "synthetic_audio_source.h"
+#include "synthetic_video_source.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// In-process stand-in for the Zoom SDK. It accepts any non-empty domain and
+// meeting ID and walks through the same status transitions as a real join,
+// for any number of concurrent meetings,
+// with configurable delays standing in for the network handshakes. Video
+// subscriptions are served by SyntheticVideoSource and raw audio by
+// SyntheticAudioSource.
+class LocalMeetingBackend : public MeetingBackend {
+ public:
+  struct Config {
+    std::chrono::milliseconds init_delay{50};
+    std::chrono::milliseconds join_delay{200};
+    SyntheticVideoSource::Config video;
+    SyntheticAudioSource::Config audio;
+  };
+
+  LocalMeetingBackend();
+  explicit LocalMeetingBackend(const Config& config);
+  ~LocalMeetingBackend() override;
+
+  LocalMeetingBackend(const LocalMeetingBackend&) = delete;
+  LocalMeetingBackend& operator=(const LocalMeetingBackend&) = delete;
+
+  // MeetingBackend:
+  InitResult Initialize(const InitParams& params) override;
+  bool IsInitialized() const override;
+  bool JoinMeeting(const MeetingOptions& options) override;
+  bool StartMeeting(const MeetingOptions& options) override;
+  bool LeaveMeeting(const std::string& meeting_id) override;
+  MeetingStatus GetMeetingStatus() const override;
+  void SetObserver(Observer* observer) override;
+  bool SubscribeVideo(uint32_t participant_id, VideoSink* sink) override;
+  void UnsubscribeVideo(uint32_t participant_id) override;
+  bool StartRawAudio(AudioSink* sink) override;
+  void StopRawAudio() override;
+
+ private:
+  bool EnterMeeting(const MeetingOptions& options);
+  void SetStatus(const std::string& meeting_id,
+                 MeetingStatus status,
+                 int32_t error_code);
+
+  const Config config_;
+  // Held for the whole of Initialize() so concurrent calls initialize once.
+  std::mutex init_mutex_;
+  std::atomic<bool> initialized_{false};
+  std::atomic<MeetingStatus> status_{MeetingStatus::kIdle};
+
+  std::mutex meetings_mutex_;
+  std::set<std::string> meetings_;
+
+  // Held while delivering a callback so SetObserver(nullptr) can wait for
+  // in-flight notifications.
+  std::mutex observer_mutex_;
+  Observer* observer_ = nullptr;
+
+  std::mutex video_mutex_;
+  std::map<uint32_t, std::unique_ptr<SyntheticVideoSource>> video_sources_;
+
+  std::mutex audio_mutex_;
+  std::unique_ptr<SyntheticAudioSource> audio_source_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_LOCAL_MEETING_BACKEND_H_
@@ -0,0 +1,70 @@
+#include "meeting_backend.h"
+
+#include "local_meeting_backend.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+const char* MeetingStatusName(MeetingStatus status) {
+  switch (status) {
+    case MeetingStatus::kIdle:
+      return "MEETING_STATUS_IDLE";
+    case MeetingStatus::kConnecting:
+      return "MEETING_STATUS_CONNECTING";
+    case MeetingStatus::kWaitingForHost:
+      return "MEETING_STATUS_WAITINGFORHOST";
+    case MeetingStatus::kInMeeting:
+      return "MEETING_STATUS_INMEETING";
+    case MeetingStatus::kDisconnecting:
+      return "MEETING_STATUS_DISCONNECTING";
+    case MeetingStatus::kReconnecting:
+      return "MEETING_STATUS_RECONNECTING";
+    case MeetingStatus::kFailed:
+      return "MEETING_STATUS_FAILED";
+    case MeetingStatus::kInWaitingRoom:
+      return "MEETING_STATUS_IN_WAITING_ROOM";
+    case MeetingStatus::kWebinarPromote:
+      return "MEETING_STATUS_WEBINAR_PROMOTE";
+    case MeetingStatus::kWebinarDepromote:
+      return "MEETING_STATUS_WEBINAR_DEPROMOTE";
+    case MeetingStatus::kUnknown:
+      return "MEETING_STATUS_UNKNOWN";
+  }
+  return "MEETING_STATUS_UNKNOWN";
+}
+
+const char* MeetingStatusMessage(MeetingStatus status) {
+  switch (status) {
+    case MeetingStatus::kIdle:
+      return "No meeting is running";
+    case MeetingStatus::kConnecting:
+      return "Connect to the meeting server.";
+    case MeetingStatus::kWaitingForHost:
+      return "Waiting for the host to start the meeting.";
+    case MeetingStatus::kInMeeting:
+      return "Meeting is ready and in process.";
+    case MeetingStatus::kDisconnecting:
+      return "Disconnect the meeting server, user leaves meeting.";
+    case MeetingStatus::kReconnecting:
+      return "Reconnecting meeting server.";
+    case MeetingStatus::kFailed:
+      return "Failed to connect the meeting server.";
+    case MeetingStatus::kInWaitingRoom:
+      return "Participants who join the meeting before the start are in the "
+             "waiting room.";
+    case MeetingStatus::kWebinarPromote:
+      return "Upgrade the attendees to panelist in webinar.";
+    case MeetingStatus::kWebinarDepromote:
+      return "Demote the attendees from the panelist.";
+    case MeetingStatus::kUnknown:
+      return "Unknown status.";
+  }
+  return "No status available.";
+}
+
+std::unique_ptr<MeetingBackend> CreateMeetingBackend() {
+  // The Zoom Meeting SDK is not distributed for this platform yet, so the
+  // local stand-in is the only implementation.
+  return std::make_unique<LocalMeetingBackend>();
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,189 @@
+#ifndef FLUTTER_PLUGIN_MEETING_BACKEND_H_
+#define FLUTTER_PLUGIN_MEETING_BACKEND_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "video_frame.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Meeting states reported by the SDK. The names match the Android
+// MeetingStatus enum so Dart sees the same strings on every platform.
+enum class MeetingStatus : int32_t {
+  kIdle = 0,
+  kConnecting = 1,
+  kWaitingForHost = 2,
+  kInMeeting = 3,
+  kDisconnecting = 4,
+  kReconnecting = 5,
+  kFailed = 6,
+  kInWaitingRoom = 7,
+  kWebinarPromote = 8,
+  kWebinarDepromote = 9,
+  kUnknown = 10,
+};
+
+// Participant ID under which the mixed meeting audio is delivered.
+constexpr uint32_t kMixedAudioParticipantId = 0;
+
+// Error codes reported from Initialize(), matching ZoomError.
+constexpr int32_t kZoomErrorSuccess = 0;
+constexpr int32_t kZoomErrorInvalidArguments = 1;
+constexpr int32_t kZoomErrorAuthTokenWrong = 5;
+
+// Meeting error reported with MeetingStatus::kFailed when the SDK is too old,
+// matching MeetingError.MEETING_ERROR_CLIENT_INCOMPATIBLE.
+constexpr int32_t kMeetingErrorClientIncompatible = 4;
+
+// Meeting error reported with MeetingStatus::kFailed when the connection to
+// the meeting server fails, matching MeetingError.MEETING_ERROR_NETWORK_ERROR.
+constexpr int32_t kMeetingErrorNetworkError = 5;
+
+// Returns the wire name of |status|, e.g. "MEETING_STATUS_INMEETING".
+const char* MeetingStatusName(MeetingStatus status);
+
+// Returns the human readable description of |status|.
+const char* MeetingStatusMessage(MeetingStatus status);
+
+struct InitParams {
+  std::string domain;
+  std::string jwt_token;
+  std::string app_key;
+  std::string app_secret;
+};
+
+struct InitResult {
+  int32_t error_code = kZoomErrorSuccess;
+  int32_t internal_error_code = 0;
+};
+
+// Options shared by join and start requests.
+struct MeetingOptions {
+  std::string user_id;
+  std::string display_name;
+  std::string meeting_id;
+  std::string meeting_password;
+  std::string zoom_access_token;
+  bool disable_dial_in = false;
+  bool disable_drive = false;
+  bool disable_invite = false;
+  bool disable_share = false;
+  bool no_disconnect_audio = false;
+  bool no_audio = false;
+  int32_t meeting_view_options = 0;
+};
+
+// A participant's name and state as shown in the meeting's roster.
+struct ParticipantInfo {
+  uint32_t participant_id = 0;
+  std::string display_name;
+  bool audio_muted = false;
+  bool video_on = false;
+  bool hand_raised = false;
+};
+
+// Interface between the plugin and a meeting implementation.
+//
+// A backend may attend several meetings at once, each identified by its
+// meeting ID. Initialize(), JoinMeeting(), StartMeeting() and LeaveMeeting()
+// may block for the length of a network handshake and are only ever called
+// from the plugin's worker pool. The remaining methods must be cheap and
+// safe to call from any thread.
+class MeetingBackend {
+ public:
+  // Receives meeting events. Callbacks may arrive on any thread.
+  class Observer {
+   public:
+    virtual ~Observer() = default;
+
+    // |meeting_id| is the meeting whose status changed, or empty for
+    // changes not tied to a meeting.
+    virtual void OnMeetingStatusChanged(const std::string& meeting_id,
+                                        MeetingStatus status,
+                                        int32_t error_code,
+                                        int32_t internal_error_code) = 0;
+
+    // Participant churn in |meeting_id|, for backends that report it.
+    // Participants still present when a meeting ends are not reported as
+    // leaving.
+    virtual void OnParticipantJoined(const std::string& meeting_id,
+                                     const ParticipantInfo& participant) {}
+    virtual void OnParticipantLeft(const std::string& meeting_id,
+                                   uint32_t participant_id) {}
+
+    // A present participant was renamed, muted or unmuted, turned video on
+    // or off, or raised or lowered a hand. |participant| is its new state.
+    virtual void OnParticipantChanged(const std::string& meeting_id,
+                                      const ParticipantInfo& participant) {}
+  };
+
+  // Receives raw video. Callbacks arrive on the backend's receive threads.
+  class VideoSink {
+   public:
+    virtual ~VideoSink() = default;
+
+    virtual void OnVideoFrame(uint32_t participant_id,
+                              std::shared_ptr<const VideoFrame> frame) = 0;
+  };
+
+  // Receives raw audio as interleaved 16-bit PCM, both the meeting mix
+  // (kMixedAudioParticipantId) and each speaking participant on their own.
+  // Callbacks arrive on the backend's audio thread.
+  class AudioSink {
+   public:
+    virtual ~AudioSink() = default;
+
+    virtual void OnAudioData(uint32_t participant_id,
+                             const int16_t* samples,
+                             size_t frames,
+                             int sample_rate,
+                             int channels) = 0;
+  };
+
+  virtual ~MeetingBackend() = default;
+
+  virtual InitResult Initialize(const InitParams& params) = 0;
+  virtual bool IsInitialized() const = 0;
+
+  // Returns false if the request could not be issued, including when
+  // |options.meeting_id| is already being attended.
+  virtual bool JoinMeeting(const MeetingOptions& options) = 0;
+  virtual bool StartMeeting(const MeetingOptions& options) = 0;
+
+  // Leaves |meeting_id|. Returns false if it is not being attended.
+  virtual bool LeaveMeeting(const std::string& meeting_id) = 0;
+
+  // Returns the most recently reported status of any meeting.
+  virtual MeetingStatus GetMeetingStatus() const = 0;
+
+  // Sets the observer for meeting events, or clears it with nullptr. Once
+  // this returns no callback is running on, or will be made to, the
+  // previous observer.
+  virtual void SetObserver(Observer* observer) = 0;
+
+  // Starts delivering |participant_id|'s video to |sink|, replacing any
+  // previous sink for that participant. Returns false if the participant's
+  // video is unavailable.
+  virtual bool SubscribeVideo(uint32_t participant_id, VideoSink* sink) = 0;
+
+  // Stops delivering |participant_id|'s video. Once this returns the sink
+  // gets no further frames for it.
+  virtual void UnsubscribeVideo(uint32_t participant_id) = 0;
+
+  // Starts delivering raw audio to |sink|, replacing any previous sink.
+  // Returns false if raw audio is unavailable.
+  virtual bool StartRawAudio(AudioSink* sink) = 0;
+
+  // Stops raw audio. Once this returns the sink gets no further callbacks.
+  virtual void StopRawAudio() = 0;
+};
+
+// Creates the backend used by the plugin.
+std::unique_ptr<MeetingBackend> CreateMeetingBackend();
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_BACKEND_H_
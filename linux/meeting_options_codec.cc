@@ -0,0 +1,105 @@
+#include "meeting_options_codec.h"
+
+#include <string>
+#include <utility>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+void AppendUint32(uint32_t value, std::vector<uint8_t>* out) {
+  for (int i = 0; i < 4; ++i) {
+    out->push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+void AppendString(const std::string& value, std::vector<uint8_t>* out) {
+  AppendUint32(static_cast<uint32_t>(value.size()), out);
+  out->insert(out->end(), value.begin(), value.end());
+}
+
+uint32_t ReadUint32(const uint8_t* data) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    value |= static_cast<uint32_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+// Reads a length-prefixed string at |*offset| and advances past it. Returns
+// false if it runs past |size|.
+bool ReadString(const uint8_t* data,
+                size_t size,
+                size_t* offset,
+                std::string* value) {
+  if (size - *offset < 4) {
+    return false;
+  }
+  size_t length = ReadUint32(data + *offset);
+  *offset += 4;
+  if (size - *offset < length) {
+    return false;
+  }
+  value->assign(reinterpret_cast<const char*>(data + *offset), length);
+  *offset += length;
+  return true;
+}
+
+}  // namespace
+
+std::vector<uint8_t> EncodeMeetingOptions(const MeetingOptions& options) {
+  uint32_t flags = 0;
+  flags |= options.disable_dial_in ? kMeetingOptionDisableDialIn : 0;
+  flags |= options.disable_drive ? kMeetingOptionDisableDrive : 0;
+  flags |= options.disable_invite ? kMeetingOptionDisableInvite : 0;
+  flags |= options.disable_share ? kMeetingOptionDisableShare : 0;
+  flags |= options.no_disconnect_audio ? kMeetingOptionNoDisconnectAudio : 0;
+  flags |= options.no_audio ? kMeetingOptionNoAudio : 0;
+
+  std::vector<uint8_t> out;
+  out.reserve(kMeetingOptionsMinSize + options.user_id.size() +
+              options.display_name.size() + options.meeting_id.size() +
+              options.meeting_password.size() +
+              options.zoom_access_token.size());
+  AppendUint32(kMeetingOptionsFormatVersion, &out);
+  AppendUint32(flags, &out);
+  AppendUint32(static_cast<uint32_t>(options.meeting_view_options), &out);
+  AppendString(options.user_id, &out);
+  AppendString(options.display_name, &out);
+  AppendString(options.meeting_id, &out);
+  AppendString(options.meeting_password, &out);
+  AppendString(options.zoom_access_token, &out);
+  return out;
+}
+
+bool DecodeMeetingOptions(const uint8_t* data,
+                          size_t size,
+                          MeetingOptions* options) {
+  if (size < kMeetingOptionsMinSize ||
+      ReadUint32(data) != kMeetingOptionsFormatVersion) {
+    return false;
+  }
+  uint32_t flags = ReadUint32(data + 4);
+  MeetingOptions result;
+  result.disable_dial_in = (flags & kMeetingOptionDisableDialIn) != 0;
+  result.disable_drive = (flags & kMeetingOptionDisableDrive) != 0;
+  result.disable_invite = (flags & kMeetingOptionDisableInvite) != 0;
+  result.disable_share = (flags & kMeetingOptionDisableShare) != 0;
+  result.no_disconnect_audio = (flags & kMeetingOptionNoDisconnectAudio) != 0;
+  result.no_audio = (flags & kMeetingOptionNoAudio) != 0;
+  result.meeting_view_options = static_cast<int32_t>(ReadUint32(data + 8));
+
+  size_t offset = 12;
+  if (!ReadString(data, size, &offset, &result.user_id) ||
+      !ReadString(data, size, &offset, &result.display_name) ||
+      !ReadString(data, size, &offset, &result.meeting_id) ||
+      !ReadString(data, size, &offset, &result.meeting_password) ||
+      !ReadString(data, size, &offset, &result.zoom_access_token) ||
+      offset != size) {
+    return false;
+  }
+  *options = std::move(result);
+  return true;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
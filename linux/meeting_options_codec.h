@@ -0,0 +1,51 @@
+#ifndef FLUTTER_PLUGIN_MEETING_OPTIONS_CODEC_H_
+#define FLUTTER_PLUGIN_MEETING_OPTIONS_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "meeting_backend.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Packed form of MeetingOptions sent by MethodChannelZoom with "join" and
+// "start" on Linux, so the plugin reads every option in one pass instead of
+// looking up and parsing a string per key. The little-endian layout is:
+//
+//   0  uint32  format version, kMeetingOptionsFormatVersion
+//   4  uint32  MeetingOptionFlags
+//   8  int32   meeting view options
+//   12 five strings, each a uint32 byte count followed by that many bytes
+//      of UTF-8: user ID, display name, meeting ID, meeting password and
+//      Zoom access token
+//
+// PackedMeetingOptions in lib/flutter_zoom_meeting_sdk_options_codec.dart
+// writes the same layout.
+constexpr uint32_t kMeetingOptionsFormatVersion = 1;
+
+// Size of a record whose strings are all empty.
+constexpr size_t kMeetingOptionsMinSize = 12 + 5 * 4;
+
+// Bits of the flags word, one per boolean option.
+enum MeetingOptionFlags : uint32_t {
+  kMeetingOptionDisableDialIn = 1u << 0,
+  kMeetingOptionDisableDrive = 1u << 1,
+  kMeetingOptionDisableInvite = 1u << 2,
+  kMeetingOptionDisableShare = 1u << 3,
+  kMeetingOptionNoDisconnectAudio = 1u << 4,
+  kMeetingOptionNoAudio = 1u << 5,
+};
+
+// Returns the packed record for |options|.
+std::vector<uint8_t> EncodeMeetingOptions(const MeetingOptions& options);
+
+// Reads a packed record of |size| bytes into |options|. Returns false if the
+// version is unknown or the record is truncated or has trailing bytes.
+bool DecodeMeetingOptions(const uint8_t* data,
+                          size_t size,
+                          MeetingOptions* options);
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_OPTIONS_CODEC_H_
@@ -0,0 +1,496 @@
+#include "meeting_scenario.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+constexpr char kStatusPrefix[] = "MEETING_STATUS_";
+
+// Distinct constants keep the per-process random streams independent.
+constexpr uint64_t kJoinStream = 0x6a6f696e;
+constexpr uint64_t kChurnStream = 0x636875726e;
+constexpr uint64_t kReconnectStream = 0x7265636f6e;
+constexpr uint64_t kUpdateStream = 0x757064617465;
+
+bool ParseStatus(const std::string& name, MeetingStatus* status) {
+  for (int32_t code = 0;
+       code <= static_cast<int32_t>(MeetingStatus::kUnknown); ++code) {
+    auto candidate = static_cast<MeetingStatus>(code);
+    const char* full_name = MeetingStatusName(candidate);
+    if (name == full_name ||
+        name == full_name + (sizeof(kStatusPrefix) - 1)) {
+      *status = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ParseInt64(const std::string& text, int64_t* value) {
+  if (text.empty()) {
+    return false;
+  }
+  errno = 0;
+  char* end = nullptr;
+  long long parsed = strtoll(text.c_str(), &end, 10);
+  if (errno != 0 || *end != '\0') {
+    return false;
+  }
+  *value = parsed;
+  return true;
+}
+
+bool ParseNonNegative(const std::string& text, int64_t* value) {
+  return ParseInt64(text, value) && *value >= 0;
+}
+
+bool ParseCount(const std::string& text, int32_t* value) {
+  int64_t parsed;
+  if (!ParseNonNegative(text, &parsed) || parsed > INT32_MAX) {
+    return false;
+  }
+  *value = static_cast<int32_t>(parsed);
+  return true;
+}
+
+bool ParsePositive(const std::string& text, int32_t* value) {
+  return ParseCount(text, value) && *value > 0;
+}
+
+bool ParseDouble(const std::string& text, double* value) {
+  if (text.empty()) {
+    return false;
+  }
+  errno = 0;
+  char* end = nullptr;
+  double parsed = strtod(text.c_str(), &end);
+  if (errno != 0 || *end != '\0' || !std::isfinite(parsed) || parsed < 0) {
+    return false;
+  }
+  *value = parsed;
+  return true;
+}
+
+bool ParseShare(const std::string& text, double* value) {
+  return ParseDouble(text, value) && *value <= 1;
+}
+
+bool ParseStep(const std::vector<std::string>& values, ScenarioStep* step) {
+  if (values.empty() || values.size() > 3 ||
+      !ParseStatus(values[0], &step->status)) {
+    return false;
+  }
+  step->duration_ms = 0;
+  step->jitter_ms = 0;
+  return (values.size() < 2 ||
+          ParseNonNegative(values[1], &step->duration_ms)) &&
+         (values.size() < 3 || ParseNonNegative(values[2], &step->jitter_ms));
+}
+
+// Applies one "key value..." line. Returns false if it is invalid.
+bool ApplySetting(const std::string& key,
+                  const std::vector<std::string>& values,
+                  MeetingScenario* scenario,
+                  bool* has_steps) {
+  if (key == "step") {
+    ScenarioStep step;
+    if (!ParseStep(values, &step)) {
+      return false;
+    }
+    if (!*has_steps) {
+      scenario->join_steps.clear();
+      *has_steps = true;
+    }
+    scenario->join_steps.push_back(step);
+    return true;
+  }
+  if (values.size() != 1) {
+    return false;
+  }
+  const std::string& value = values[0];
+  if (key == "seed") {
+    int64_t seed;
+    if (!ParseNonNegative(value, &seed)) {
+      return false;
+    }
+    scenario->seed = static_cast<uint64_t>(seed);
+    return true;
+  }
+  if (key == "speed") {
+    return ParseDouble(value, &scenario->speed) && scenario->speed > 0;
+  }
+  if (key == "init_delay_ms") {
+    return ParseNonNegative(value, &scenario->init_delay_ms);
+  }
+  if (key == "join_failure_rate") {
+    return ParseShare(value, &scenario->join_failure_rate);
+  }
+  if (key == "reconnect_count") {
+    return ParseCount(value, &scenario->reconnect_count);
+  }
+  if (key == "reconnect_interval_ms") {
+    return ParseNonNegative(value, &scenario->reconnect_interval_ms);
+  }
+  if (key == "reconnect_jitter_ms") {
+    return ParseNonNegative(value, &scenario->reconnect_jitter_ms);
+  }
+  if (key == "reconnect_duration_ms") {
+    return ParseNonNegative(value, &scenario->reconnect_duration_ms);
+  }
+  if (key == "participants") {
+    return ParseCount(value, &scenario->participants);
+  }
+  if (key == "max_participants") {
+    return ParseCount(value, &scenario->max_participants);
+  }
+  if (key == "joins_per_minute") {
+    return ParseDouble(value, &scenario->joins_per_minute);
+  }
+  if (key == "leaves_per_minute") {
+    return ParseDouble(value, &scenario->leaves_per_minute);
+  }
+  if (key == "updates_per_minute") {
+    return ParseDouble(value, &scenario->updates_per_minute);
+  }
+  if (key == "video_share") {
+    return ParseShare(value, &scenario->video_share);
+  }
+  if (key == "duration_ms") {
+    return ParseNonNegative(value, &scenario->duration_ms);
+  }
+  if (key == "video_width") {
+    return ParsePositive(value, &scenario->video_width);
+  }
+  if (key == "video_height") {
+    return ParsePositive(value, &scenario->video_height);
+  }
+  if (key == "video_fps") {
+    return ParsePositive(value, &scenario->video_fps);
+  }
+  if (key == "audio_speakers") {
+    return ParseCount(value, &scenario->audio_speakers);
+  }
+  if (key == "speaker_turn_ms") {
+    return ParseNonNegative(value, &scenario->speaker_turn_ms);
+  }
+  if (key == "audio_sample_rate") {
+    return ParsePositive(value, &scenario->audio_sample_rate);
+  }
+  if (key == "audio_channels") {
+    return ParsePositive(value, &scenario->audio_channels);
+  }
+  return false;
+}
+
+uint64_t Mix(uint64_t value) {
+  value = (value ^ (value >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+  value = (value ^ (value >> 27)) * UINT64_C(0x94d049bb133111eb);
+  return value ^ (value >> 31);
+}
+
+uint64_t MeetingSeed(uint64_t seed, const std::string& meeting_id) {
+  uint64_t hash = UINT64_C(14695981039346656037);
+  for (char c : meeting_id) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= UINT64_C(1099511628211);
+  }
+  return Mix(seed ^ hash);
+}
+
+}  // namespace
+
+bool ParseMeetingScenario(const std::string& text,
+                          MeetingScenario* scenario,
+                          std::string* error) {
+  MeetingScenario parsed;
+  bool has_steps = false;
+  std::istringstream lines(text);
+  std::string line;
+  for (int line_number = 1; std::getline(lines, line); ++line_number) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream tokens(line);
+    std::string key;
+    if (!(tokens >> key)) {
+      continue;
+    }
+    std::vector<std::string> values;
+    for (std::string value; tokens >> value;) {
+      values.push_back(value);
+    }
+    if (!ApplySetting(key, values, &parsed, &has_steps)) {
+      *error = "line " + std::to_string(line_number) + ": invalid \"" + key +
+               "\" setting";
+      return false;
+    }
+  }
+  if (parsed.join_steps.back().status != MeetingStatus::kInMeeting) {
+    *error = "the last step must be INMEETING";
+    return false;
+  }
+  *scenario = parsed;
+  return true;
+}
+
+bool LoadMeetingScenario(const std::string& path,
+                         MeetingScenario* scenario,
+                         std::string* error) {
+  std::ifstream file(path);
+  if (!file) {
+    *error = "cannot read " + path;
+    return false;
+  }
+  std::ostringstream text;
+  text << file.rdbuf();
+  return ParseMeetingScenario(text.str(), scenario, error);
+}
+
+uint64_t ScenarioTimeline::Random::NextUint64() {
+  state_ += UINT64_C(0x9e3779b97f4a7c15);
+  return Mix(state_);
+}
+
+double ScenarioTimeline::Random::NextDouble() {
+  return static_cast<double>(NextUint64() >> 11) * 0x1.0p-53;
+}
+
+int64_t ScenarioTimeline::Random::NextJitter(int64_t range) {
+  if (range <= 0) {
+    return 0;
+  }
+  uint64_t span = static_cast<uint64_t>(range) * 2 + 1;
+  return static_cast<int64_t>(NextUint64() % span) - range;
+}
+
+int64_t ScenarioTimeline::Random::NextInterarrivalMs(double per_minute) {
+  double mean_ms = 60000.0 / per_minute;
+  double interval = -std::log(1.0 - NextDouble()) * mean_ms;
+  // At least 1 ms so a very high rate still lets time advance.
+  return std::max<int64_t>(1, static_cast<int64_t>(interval));
+}
+
+ScenarioTimeline::ScenarioTimeline(const MeetingScenario& scenario,
+                                   const std::string& meeting_id,
+                                   uint32_t first_participant_id)
+    : scenario_(scenario),
+      first_participant_id_(first_participant_id),
+      join_random_(MeetingSeed(scenario.seed, meeting_id) ^ kJoinStream),
+      churn_random_(MeetingSeed(scenario.seed, meeting_id) ^ kChurnStream),
+      reconnect_random_(MeetingSeed(scenario.seed, meeting_id) ^
+                        kReconnectStream),
+      update_random_(MeetingSeed(scenario.seed, meeting_id) ^ kUpdateStream) {
+  join_fails_ = join_random_.NextDouble() < scenario_.join_failure_rate;
+}
+
+void ScenarioTimeline::Emit(ScenarioEvent* event,
+                            MeetingStatus status,
+                            int32_t error_code) {
+  *event = ScenarioEvent();
+  event->type = ScenarioEvent::Type::kStatus;
+  event->at_ms = now_ms_;
+  event->status = status;
+  event->error_code = error_code;
+}
+
+void ScenarioTimeline::JoinParticipant(ScenarioEvent* event) {
+  uint32_t participant_id = first_participant_id_ + next_participant_++;
+  *event = ScenarioEvent();
+  event->type = ScenarioEvent::Type::kParticipantJoined;
+  event->at_ms = now_ms_;
+  event->participant_id = participant_id;
+  event->has_video = churn_random_.NextDouble() < scenario_.video_share;
+  event->participant.participant_id = participant_id;
+  event->participant.display_name =
+      "Participant " + std::to_string(next_participant_);
+  event->participant.video_on = event->has_video;
+  present_.push_back(event->participant);
+}
+
+void ScenarioTimeline::ChangeParticipant(ScenarioEvent* event) {
+  ParticipantInfo& participant =
+      present_[update_random_.NextUint64() % present_.size()];
+  switch (update_random_.NextUint64() % 4) {
+    case 0:
+      participant.audio_muted = !participant.audio_muted;
+      break;
+    case 1:
+      participant.video_on = !participant.video_on;
+      break;
+    case 2:
+      participant.hand_raised = !participant.hand_raised;
+      break;
+    default:
+      participant.display_name =
+          "Attendee " + std::to_string(update_random_.NextUint64() % 10000);
+      break;
+  }
+  *event = ScenarioEvent();
+  event->type = ScenarioEvent::Type::kParticipantChanged;
+  event->at_ms = now_ms_;
+  event->participant_id = participant.participant_id;
+  event->participant = participant;
+}
+
+bool ScenarioTimeline::Next(ScenarioEvent* event) {
+  switch (phase_) {
+    case Phase::kJoining: {
+      const ScenarioStep& step = scenario_.join_steps[step_];
+      if (++step_ < scenario_.join_steps.size()) {
+        Emit(event, step.status, 0);
+        now_ms_ += std::max<int64_t>(
+            0, step.duration_ms + join_random_.NextJitter(step.jitter_ms));
+        return true;
+      }
+      if (join_fails_) {
+        Emit(event, MeetingStatus::kFailed, kMeetingErrorNetworkError);
+        phase_ = Phase::kDone;
+        return true;
+      }
+      Emit(event, MeetingStatus::kInMeeting, 0);
+      phase_ = Phase::kInMeeting;
+      pending_participants_ =
+          std::min(scenario_.participants, scenario_.max_participants);
+      if (scenario_.duration_ms > 0) {
+        end_ms_ = now_ms_ + scenario_.duration_ms;
+      }
+      if (scenario_.joins_per_minute > 0 && scenario_.max_participants > 0) {
+        next_join_ms_ =
+            now_ms_ +
+            churn_random_.NextInterarrivalMs(scenario_.joins_per_minute);
+      }
+      if (scenario_.leaves_per_minute > 0) {
+        next_leave_ms_ =
+            now_ms_ +
+            churn_random_.NextInterarrivalMs(scenario_.leaves_per_minute);
+      }
+      if (scenario_.updates_per_minute > 0) {
+        next_update_ms_ =
+            now_ms_ +
+            update_random_.NextInterarrivalMs(scenario_.updates_per_minute);
+      }
+      reconnects_left_ = scenario_.reconnect_count;
+      if (reconnects_left_ > 0) {
+        next_reconnect_ms_ =
+            now_ms_ + std::max<int64_t>(
+                          1, scenario_.reconnect_interval_ms +
+                                 reconnect_random_.NextJitter(
+                                     scenario_.reconnect_jitter_ms));
+      }
+      return true;
+    }
+
+    case Phase::kInMeeting:
+      if (pending_participants_ > 0) {
+        --pending_participants_;
+        JoinParticipant(event);
+        return true;
+      }
+      for (;;) {
+        // The earliest pending process wins; ties go to the first listed.
+        int64_t* next = nullptr;
+        for (int64_t* candidate :
+             {&reconnected_ms_, &next_reconnect_ms_, &next_leave_ms_,
+              &next_join_ms_, &end_ms_, &next_update_ms_}) {
+          if (*candidate >= 0 && (next == nullptr || *candidate < *next)) {
+            next = candidate;
+          }
+        }
+        if (next == nullptr) {
+          phase_ = Phase::kDone;
+          return false;
+        }
+        now_ms_ = *next;
+
+        if (next == &end_ms_) {
+          Emit(event, MeetingStatus::kDisconnecting, 0);
+          phase_ = Phase::kEnding;
+          return true;
+        }
+        if (next == &next_reconnect_ms_) {
+          Emit(event, MeetingStatus::kReconnecting, 0);
+          next_reconnect_ms_ = -1;
+          reconnected_ms_ = now_ms_ + scenario_.reconnect_duration_ms;
+          return true;
+        }
+        if (next == &reconnected_ms_) {
+          Emit(event, MeetingStatus::kInMeeting, 0);
+          reconnected_ms_ = -1;
+          if (--reconnects_left_ > 0) {
+            next_reconnect_ms_ =
+                now_ms_ + std::max<int64_t>(
+                              1, scenario_.reconnect_interval_ms +
+                                     reconnect_random_.NextJitter(
+                                         scenario_.reconnect_jitter_ms));
+          }
+          return true;
+        }
+        if (next == &next_join_ms_) {
+          next_join_ms_ =
+              now_ms_ +
+              churn_random_.NextInterarrivalMs(scenario_.joins_per_minute);
+          if (present_.size() <
+              static_cast<size_t>(scenario_.max_participants)) {
+            JoinParticipant(event);
+            return true;
+          }
+          if (next_leave_ms_ < 0) {
+            // Nobody leaves, so there will never be room.
+            next_join_ms_ = -1;
+          }
+          continue;
+        }
+
+        if (next == &next_update_ms_) {
+          next_update_ms_ =
+              now_ms_ +
+              update_random_.NextInterarrivalMs(scenario_.updates_per_minute);
+          if (present_.empty()) {
+            if (next_join_ms_ < 0) {
+              // Nobody can arrive, so nobody is left to change.
+              next_update_ms_ = -1;
+            }
+            continue;
+          }
+          ChangeParticipant(event);
+          return true;
+        }
+
+        // A leave.
+        next_leave_ms_ =
+            now_ms_ +
+            churn_random_.NextInterarrivalMs(scenario_.leaves_per_minute);
+        if (present_.empty()) {
+          if (next_join_ms_ < 0) {
+            // Nobody can arrive, so nobody is left to leave.
+            next_leave_ms_ = -1;
+          }
+          continue;
+        }
+        size_t index = churn_random_.NextUint64() % present_.size();
+        *event = ScenarioEvent();
+        event->type = ScenarioEvent::Type::kParticipantLeft;
+        event->at_ms = now_ms_;
+        event->participant_id = present_[index].participant_id;
+        present_[index] = present_.back();
+        present_.pop_back();
+        return true;
+      }
+
+    case Phase::kEnding:
+      Emit(event, MeetingStatus::kIdle, 0);
+      phase_ = Phase::kDone;
+      return true;
+
+    case Phase::kDone:
+      return false;
+  }
+  return false;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,191 @@
+#ifndef FLUTTER_PLUGIN_MEETING_SCENARIO_H_
+#define FLUTTER_PLUGIN_MEETING_SCENARIO_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "meeting_backend.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// One status of the join sequence and how long it lasts.
+struct ScenarioStep {
+  MeetingStatus status = MeetingStatus::kConnecting;
+  int64_t duration_ms = 0;
+  // The duration varies uniformly by up to this much either way.
+  int64_t jitter_ms = 0;
+};
+
+// A meeting as replayed by SimulatedMeetingBackend. Every random choice is
+// drawn from |seed|, so a scenario plays out the same way on every run.
+//
+// Scenario files are plain text with one "key value" setting per line and
+// '#' comments:
+//
+//   seed 42
+//   speed 10                  # play ten times faster than real time
+//   step CONNECTING 300 100   # status, duration ms, jitter ms
+//   step WAITINGFORHOST 2000 1000
+//   step INMEETING
+//   participants 500
+//   joins_per_minute 60
+//   leaves_per_minute 60
+//   updates_per_minute 120
+//   reconnect_count 1000
+//   reconnect_interval_ms 500
+//
+// Statuses are MeetingStatusName() values with or without the
+// "MEETING_STATUS_" prefix. Keys are the field names below; each "step"
+// line appends to |join_steps|.
+struct MeetingScenario {
+  uint64_t seed = 1;
+  // Time scale: 10 plays the scenario ten times faster than real time.
+  double speed = 1.0;
+  int64_t init_delay_ms = 50;
+
+  // Statuses reported while joining. The last one must be kInMeeting.
+  std::vector<ScenarioStep> join_steps = {
+      {MeetingStatus::kConnecting, 200, 0},
+      {MeetingStatus::kInMeeting, 0, 0},
+  };
+  // Chance that a join ends with kFailed in place of kInMeeting.
+  double join_failure_rate = 0;
+
+  // Reconnects once in the meeting: kReconnecting for
+  // |reconnect_duration_ms|, then kInMeeting again.
+  int32_t reconnect_count = 0;
+  int64_t reconnect_interval_ms = 60000;
+  int64_t reconnect_jitter_ms = 0;
+  int64_t reconnect_duration_ms = 2000;
+
+  // Participants present when the join completes, and their churn
+  // afterwards as Poisson arrivals.
+  int32_t participants = 2;
+  int32_t max_participants = 1000;
+  double joins_per_minute = 0;
+  double leaves_per_minute = 0;
+  // Share of participants that send video.
+  double video_share = 1.0;
+  // Renames, mute, video and raised hand changes of present participants,
+  // as Poisson arrivals across the whole meeting.
+  double updates_per_minute = 0;
+
+  // Time in the meeting after which the host ends it, or 0 to stay until
+  // the meeting is left.
+  int64_t duration_ms = 0;
+
+  // Synthetic media. Audio is sent by the first |audio_speakers|
+  // participants present, all at once, or taking turns of
+  // |speaker_turn_ms| when it is set.
+  int32_t video_width = 640;
+  int32_t video_height = 360;
+  int32_t video_fps = 15;
+  int32_t audio_speakers = 2;
+  int64_t speaker_turn_ms = 0;
+  int32_t audio_sample_rate = 48000;
+  int32_t audio_channels = 2;
+};
+
+// Parses scenario file contents. Unset keys keep their defaults. On failure
+// returns false and describes the first bad line in |error|.
+bool ParseMeetingScenario(const std::string& text,
+                          MeetingScenario* scenario,
+                          std::string* error);
+
+// Reads and parses the scenario file at |path|.
+bool LoadMeetingScenario(const std::string& path,
+                         MeetingScenario* scenario,
+                         std::string* error);
+
+struct ScenarioEvent {
+  enum class Type {
+    kStatus,
+    kParticipantJoined,
+    kParticipantLeft,
+    kParticipantChanged,
+  };
+
+  Type type = Type::kStatus;
+  // Scenario time since the join started, before scaling by speed.
+  int64_t at_ms = 0;
+  MeetingStatus status = MeetingStatus::kIdle;
+  int32_t error_code = 0;
+  uint32_t participant_id = 0;
+  // Whether a joining participant sends video.
+  bool has_video = false;
+  // State of a joining or changed participant.
+  ParticipantInfo participant;
+};
+
+// Generates one meeting's events in time order. Events are produced lazily,
+// so a meeting without an end runs for as long as it is played. The
+// sequence depends only on the scenario and |meeting_id|, which is mixed
+// into the seed so concurrent meetings differ.
+class ScenarioTimeline {
+ public:
+  // Participant IDs are |first_participant_id| plus a per-meeting counter.
+  ScenarioTimeline(const MeetingScenario& scenario,
+                   const std::string& meeting_id,
+                   uint32_t first_participant_id);
+
+  // Returns the next event, or false once there will be no more. The
+  // meeting is only over if the last event was kIdle or kFailed.
+  bool Next(ScenarioEvent* event);
+
+ private:
+  // splitmix64: tiny, and unlike the <random> distributions it gives the
+  // same numbers with every standard library.
+  class Random {
+   public:
+    explicit Random(uint64_t seed) : state_(seed) {}
+    uint64_t NextUint64();
+    // Uniform in [0, 1).
+    double NextDouble();
+    // Uniform in [-range, range].
+    int64_t NextJitter(int64_t range);
+    // Exponential interarrival time for |per_minute| events per minute.
+    int64_t NextInterarrivalMs(double per_minute);
+
+   private:
+    uint64_t state_;
+  };
+
+  enum class Phase { kJoining, kInMeeting, kEnding, kDone };
+
+  void Emit(ScenarioEvent* event, MeetingStatus status, int32_t error_code);
+  void JoinParticipant(ScenarioEvent* event);
+  void ChangeParticipant(ScenarioEvent* event);
+
+  const MeetingScenario scenario_;
+  const uint32_t first_participant_id_;
+
+  // Separate streams so that, e.g., changing the churn rate does not move
+  // the reconnects.
+  Random join_random_;
+  Random churn_random_;
+  Random reconnect_random_;
+  Random update_random_;
+
+  Phase phase_ = Phase::kJoining;
+  int64_t now_ms_ = 0;
+  size_t step_ = 0;
+  bool join_fails_ = false;
+
+  // Participants still to announce when the join completes.
+  int32_t pending_participants_ = 0;
+  std::vector<ParticipantInfo> present_;
+  uint32_t next_participant_ = 0;
+
+  int64_t end_ms_ = -1;
+  int64_t next_join_ms_ = -1;
+  int64_t next_leave_ms_ = -1;
+  int64_t next_update_ms_ = -1;
+  int64_t next_reconnect_ms_ = -1;
+  int64_t reconnected_ms_ = -1;
+  int32_t reconnects_left_ = 0;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_SCENARIO_H_
@@ -0,0 +1,206 @@
+#include "meeting_session_manager.h"
+
+#include <cstdint>
+#include <utility>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+constexpr size_t kInitialCapacity = 16;
+constexpr size_t kNotFound = SIZE_MAX;
+
+}  // namespace
+
+bool IsTerminalMeetingStatus(MeetingStatus status) {
+  return status == MeetingStatus::kIdle || status == MeetingStatus::kFailed;
+}
+
+MeetingSessionManager::MeetingSessionManager(size_t max_sessions)
+    : max_sessions_(max_sessions), slots_(kInitialCapacity) {}
+
+// FNV-1a. Meeting IDs are short digit strings, which it spreads well.
+uint64_t MeetingSessionManager::Hash(const std::string& meeting_id) {
+  uint64_t hash = UINT64_C(14695981039346656037);
+  for (char c : meeting_id) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= UINT64_C(1099511628211);
+  }
+  return hash;
+}
+
+size_t MeetingSessionManager::Find(const std::string& meeting_id,
+                                   uint64_t hash) const {
+  const size_t mask = slots_.size() - 1;
+  for (size_t i = hash & mask;; i = (i + 1) & mask) {
+    const Slot& slot = slots_[i];
+    if (slot.state == SlotState::kEmpty) {
+      return kNotFound;
+    }
+    if (slot.state == SlotState::kFull && slot.hash == hash &&
+        slot.session.meeting_id == meeting_id) {
+      return i;
+    }
+  }
+}
+
+void MeetingSessionManager::Rehash(size_t capacity) {
+  std::vector<Slot> old_slots(capacity);
+  old_slots.swap(slots_);
+  const size_t mask = slots_.size() - 1;
+  for (Slot& slot : old_slots) {
+    if (slot.state != SlotState::kFull) {
+      continue;
+    }
+    size_t i = slot.hash & mask;
+    while (slots_[i].state != SlotState::kEmpty) {
+      i = (i + 1) & mask;
+    }
+    slots_[i] = std::move(slot);
+  }
+  deleted_ = 0;
+}
+
+void MeetingSessionManager::Remove(size_t index) {
+  slots_[index].state = SlotState::kDeleted;
+  slots_[index].session = MeetingSession();
+  --size_;
+  ++deleted_;
+}
+
+uint32_t MeetingSessionManager::Open(const std::string& meeting_id) {
+  if (meeting_id.empty()) {
+    return kNoMeetingSession;
+  }
+  const uint64_t hash = Hash(meeting_id);
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t index = Find(meeting_id, hash);
+  if (index != kNotFound) {
+    return slots_[index].session.session_id;
+  }
+  if (size_ >= max_sessions_) {
+    return kNoMeetingSession;
+  }
+
+  if ((size_ + deleted_ + 1) * 4 > slots_.size() * 3) {
+    // Grow only if live sessions need it; otherwise just clear tombstones.
+    size_t capacity = slots_.size();
+    while ((size_ + 1) * 2 > capacity) {
+      capacity *= 2;
+    }
+    Rehash(capacity);
+  }
+
+  // Reuse the first tombstone on the probe path, if any.
+  const size_t mask = slots_.size() - 1;
+  size_t i = hash & mask;
+  while (slots_[i].state == SlotState::kFull) {
+    i = (i + 1) & mask;
+  }
+  if (slots_[i].state == SlotState::kDeleted) {
+    --deleted_;
+  }
+  Slot& slot = slots_[i];
+  slot.state = SlotState::kFull;
+  slot.hash = hash;
+  slot.session = MeetingSession();
+  slot.session.meeting_id = meeting_id;
+  slot.session.session_id = next_session_id_++;
+  ++size_;
+  return slot.session.session_id;
+}
+
+bool MeetingSessionManager::Update(const std::string& meeting_id,
+                                   MeetingStatus status,
+                                   int32_t error_code,
+                                   int32_t internal_error_code,
+                                   MeetingSession* session) {
+  if (Open(meeting_id) == kNoMeetingSession) {
+    return false;
+  }
+  const uint64_t hash = Hash(meeting_id);
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t index = Find(meeting_id, hash);
+  if (index == kNotFound) {
+    // Closed between Open() and here.
+    return false;
+  }
+  MeetingSession& current = slots_[index].session;
+  current.status = status;
+  current.error_code = error_code;
+  current.internal_error_code = internal_error_code;
+  ++current.event_count;
+  *session = current;
+  return true;
+}
+
+bool MeetingSessionManager::Get(const std::string& meeting_id,
+                                MeetingSession* session) const {
+  const uint64_t hash = Hash(meeting_id);
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t index = Find(meeting_id, hash);
+  if (index == kNotFound) {
+    return false;
+  }
+  *session = slots_[index].session;
+  return true;
+}
+
+bool MeetingSessionManager::GetById(uint32_t session_id,
+                                    MeetingSession* session) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const Slot& slot : slots_) {
+    if (slot.state == SlotState::kFull &&
+        slot.session.session_id == session_id) {
+      *session = slot.session;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool MeetingSessionManager::Close(const std::string& meeting_id) {
+  const uint64_t hash = Hash(meeting_id);
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t index = Find(meeting_id, hash);
+  if (index == kNotFound) {
+    return false;
+  }
+  Remove(index);
+  return true;
+}
+
+bool MeetingSessionManager::CloseIfEnded(uint32_t session_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < slots_.size(); ++i) {
+    const Slot& slot = slots_[i];
+    if (slot.state == SlotState::kFull &&
+        slot.session.session_id == session_id) {
+      if (!IsTerminalMeetingStatus(slot.session.status)) {
+        return false;
+      }
+      Remove(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+std::vector<MeetingSession> MeetingSessionManager::GetAll() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<MeetingSession> sessions;
+  sessions.reserve(size_);
+  for (const Slot& slot : slots_) {
+    if (slot.state == SlotState::kFull) {
+      sessions.push_back(slot.session);
+    }
+  }
+  return sessions;
+}
+
+size_t MeetingSessionManager::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size_;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
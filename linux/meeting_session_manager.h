@@ -0,0 +1,115 @@
+#ifndef FLUTTER_PLUGIN_MEETING_SESSION_MANAGER_H_
+#define FLUTTER_PLUGIN_MEETING_SESSION_MANAGER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "meeting_backend.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Session ID reported for events that belong to no meeting.
+constexpr uint32_t kNoMeetingSession = 0;
+
+// State of one meeting the process is attending.
+struct MeetingSession {
+  std::string meeting_id;
+  // Unique for the life of the process; never reused.
+  uint32_t session_id = kNoMeetingSession;
+  MeetingStatus status = MeetingStatus::kIdle;
+  int32_t error_code = 0;
+  int32_t internal_error_code = 0;
+  // Status changes reported for this session.
+  uint64_t event_count = 0;
+};
+
+// Returns true for statuses after which a session is over.
+bool IsTerminalMeetingStatus(MeetingStatus status);
+
+// Tracks every concurrent meeting by meeting ID.
+//
+// Sessions live in one flat open-addressing table with linear probing, so a
+// lookup hashes the ID once and scans adjacent slots without chasing
+// pointers. Removed sessions leave tombstones that are dropped when the
+// table is rebuilt. All methods are thread-safe: status callbacks update
+// sessions from SDK threads while the main loop queries them.
+class MeetingSessionManager {
+ public:
+  static constexpr size_t kDefaultMaxSessions = 32;
+
+  explicit MeetingSessionManager(size_t max_sessions = kDefaultMaxSessions);
+
+  MeetingSessionManager(const MeetingSessionManager&) = delete;
+  MeetingSessionManager& operator=(const MeetingSessionManager&) = delete;
+
+  // Returns the ID of |meeting_id|'s session, opening one if needed.
+  // Returns kNoMeetingSession if |meeting_id| is empty or max_sessions are
+  // already open.
+  uint32_t Open(const std::string& meeting_id);
+
+  // Records a status change for |meeting_id|, opening its session if
+  // needed, and copies the updated session to |session|. Returns false if
+  // no session could be opened.
+  bool Update(const std::string& meeting_id,
+              MeetingStatus status,
+              int32_t error_code,
+              int32_t internal_error_code,
+              MeetingSession* session);
+
+  // Copies |meeting_id|'s session to |session|. Returns false if it has
+  // none.
+  bool Get(const std::string& meeting_id, MeetingSession* session) const;
+
+  // Like Get() but by session ID. Scans the table, which only holds a few
+  // dozen sessions.
+  bool GetById(uint32_t session_id, MeetingSession* session) const;
+
+  // Closes |meeting_id|'s session. Returns false if it had none.
+  bool Close(const std::string& meeting_id);
+
+  // Closes session |session_id| if its latest status is terminal, so a
+  // session that was rejoined in the meantime survives. Returns whether it
+  // was closed.
+  bool CloseIfEnded(uint32_t session_id);
+
+  // Every open session, in table order.
+  std::vector<MeetingSession> GetAll() const;
+
+  size_t size() const;
+  size_t max_sessions() const { return max_sessions_; }
+
+ private:
+  enum class SlotState : uint8_t { kEmpty, kFull, kDeleted };
+
+  struct Slot {
+    SlotState state = SlotState::kEmpty;
+    uint64_t hash = 0;
+    MeetingSession session;
+  };
+
+  static uint64_t Hash(const std::string& meeting_id);
+
+  // Returns the slot holding |meeting_id|, or SIZE_MAX.
+  size_t Find(const std::string& meeting_id, uint64_t hash) const;
+
+  // Rebuilds the table with |capacity| slots, dropping tombstones.
+  void Rehash(size_t capacity);
+
+  void Remove(size_t index);
+
+  const size_t max_sessions_;
+
+  mutable std::mutex mutex_;
+  // Power-of-two size, at most 3/4 full counting tombstones.
+  std::vector<Slot> slots_;
+  size_t size_ = 0;
+  size_t deleted_ = 0;
+  uint32_t next_session_id_ = 1;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_SESSION_MANAGER_H_
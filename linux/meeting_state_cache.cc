@@ -0,0 +1,63 @@
+#include "meeting_state_cache.h"
+
+#include <cstring>
+
+namespace flutter_zoom_meeting_sdk {
+
+MeetingStateCache::MeetingStateCache() {
+  MeetingStatusEvent idle;
+  idle.status = MeetingStatus::kIdle;
+  uint8_t record[kStatusEventRecordSize];
+  EncodeStatusEvent(idle, record);
+  for (size_t i = 0; i < kWords; ++i) {
+    uint64_t word;
+    memcpy(&word, record + i * 8, sizeof(word));
+    words_[i].store(word, std::memory_order_relaxed);
+  }
+}
+
+bool MeetingStateCache::Publish(const MeetingStatusEvent& event) {
+  uint8_t record[kStatusEventRecordSize];
+  EncodeStatusEvent(event, record);
+
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  if (event.sequence <= sequence_) {
+    return false;
+  }
+  sequence_ = event.sequence;
+  uint64_t version = version_.load(std::memory_order_relaxed);
+  version_.store(version + 1, std::memory_order_relaxed);
+  // Orders the odd version before the words for readers.
+  std::atomic_thread_fence(std::memory_order_release);
+  for (size_t i = 0; i < kWords; ++i) {
+    uint64_t word;
+    memcpy(&word, record + i * 8, sizeof(word));
+    words_[i].store(word, std::memory_order_relaxed);
+  }
+  version_.store(version + 2, std::memory_order_release);
+  return true;
+}
+
+MeetingStatusEvent MeetingStateCache::Read() const {
+  uint8_t record[kStatusEventRecordSize];
+  while (true) {
+    uint64_t before = version_.load(std::memory_order_acquire);
+    if (before & 1) {
+      continue;
+    }
+    for (size_t i = 0; i < kWords; ++i) {
+      uint64_t word = words_[i].load(std::memory_order_relaxed);
+      memcpy(record + i * 8, &word, sizeof(word));
+    }
+    // Orders the words before the second version check.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (version_.load(std::memory_order_relaxed) == before) {
+      break;
+    }
+  }
+  MeetingStatusEvent event;
+  DecodeStatusEvent(record, sizeof(record), &event);
+  return event;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,47 @@
+#ifndef FLUTTER_PLUGIN_MEETING_STATE_CACHE_H_
+#define FLUTTER_PLUGIN_MEETING_STATE_CACHE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "status_event_codec.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// The latest meeting status change, readable from any thread without a
+// lock.
+//
+// The event is kept as its status_event_codec.h record behind a seqlock: a
+// writer makes the version odd, stores the record's words and makes it even
+// again, and a reader retries until it sees the same even version before
+// and after copying the words. Writers, one per status callback, serialize
+// on a mutex that readers never take.
+class MeetingStateCache {
+ public:
+  // Starts out idle at sequence 0.
+  MeetingStateCache();
+
+  MeetingStateCache(const MeetingStateCache&) = delete;
+  MeetingStateCache& operator=(const MeetingStateCache&) = delete;
+
+  // Safe to call from any thread. Ignores |event| unless its sequence is
+  // newer than the cached one's, since status callbacks on different
+  // threads may publish out of order. Returns whether it was cached.
+  bool Publish(const MeetingStatusEvent& event);
+
+  // Safe to call from any thread; never blocks a writer.
+  MeetingStatusEvent Read() const;
+
+ private:
+  static constexpr size_t kWords = kStatusEventRecordSize / 8;
+
+  std::mutex write_mutex_;
+  uint64_t sequence_ = 0;  // Guarded by |write_mutex_|.
+  std::atomic<uint64_t> version_{0};
+  std::atomic<uint64_t> words_[kWords];
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_STATE_CACHE_H_
@@ -0,0 +1,139 @@
+#include "memory_accounting.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+struct SharedCounters {
+  std::atomic<int64_t> current[kMemoryCategoryCount] = {};
+  std::atomic<int64_t> peak[kMemoryCategoryCount] = {};
+  std::atomic<int64_t> total{0};
+  std::atomic<int64_t> total_peak{0};
+};
+
+// Never destroyed, so threads that exit during shutdown can still flush.
+SharedCounters& Shared() {
+  static SharedCounters* counters = new SharedCounters();
+  return *counters;
+}
+
+void RaisePeak(std::atomic<int64_t>* peak, int64_t value) {
+  int64_t seen = peak->load(std::memory_order_relaxed);
+  while (value > seen &&
+         !peak->compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+  }
+}
+
+void Land(size_t index, int64_t bytes) {
+  SharedCounters& shared = Shared();
+  RaisePeak(&shared.peak[index],
+            shared.current[index].fetch_add(bytes, std::memory_order_relaxed) +
+                bytes);
+  RaisePeak(&shared.total_peak,
+            shared.total.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+// The calling thread's charges not yet counted. Plain data, so it stays
+// usable while other thread_local objects are destroyed.
+thread_local int64_t pending_bytes[kMemoryCategoryCount] = {};
+thread_local bool thread_exiting = false;
+
+void FlushThread() {
+  for (size_t i = 0; i < kMemoryCategoryCount; ++i) {
+    if (pending_bytes[i] != 0) {
+      Land(i, pending_bytes[i]);
+      pending_bytes[i] = 0;
+    }
+  }
+}
+
+// Counts a thread's batched charges when it exits. Charges made after that
+// are counted right away.
+struct ThreadFlusher {
+  ~ThreadFlusher() {
+    FlushThread();
+    thread_exiting = true;
+  }
+  void Register() {}
+};
+
+thread_local ThreadFlusher thread_flusher;
+
+uint64_t Clamped(int64_t bytes) {
+  return bytes > 0 ? static_cast<uint64_t>(bytes) : 0;
+}
+
+}  // namespace
+
+const char* MemoryCategoryName(MemoryCategory category) {
+  switch (category) {
+    case MemoryCategory::kVideoFrames:
+      return "videoFrames";
+    case MemoryCategory::kVideoTextures:
+      return "videoTextures";
+    case MemoryCategory::kAudioRings:
+      return "audioRings";
+    case MemoryCategory::kRoster:
+      return "roster";
+    case MemoryCategory::kEventQueues:
+      return "eventQueues";
+    case MemoryCategory::kRecording:
+      return "recording";
+  }
+  return "unknown";
+}
+
+void MemoryAccounting::Charge(MemoryCategory category, int64_t bytes) {
+  const auto index = static_cast<size_t>(category);
+  if (thread_exiting || bytes >= kFlushBytes || bytes <= -kFlushBytes) {
+    Land(index, bytes);
+    return;
+  }
+  thread_flusher.Register();
+  int64_t& pending = pending_bytes[index];
+  pending += bytes;
+  if (pending >= kFlushBytes || pending <= -kFlushBytes) {
+    Land(index, pending);
+    pending = 0;
+  }
+}
+
+MemoryAccounting::Stats MemoryAccounting::GetStats() {
+  FlushThread();
+  SharedCounters& shared = Shared();
+  Stats stats;
+  for (size_t i = 0; i < kMemoryCategoryCount; ++i) {
+    // Memory freed on another thread than it was allocated on can land
+    // first, so totals may dip below zero for a moment.
+    stats.categories[i].current_bytes =
+        Clamped(shared.current[i].load(std::memory_order_relaxed));
+    stats.categories[i].peak_bytes =
+        Clamped(shared.peak[i].load(std::memory_order_relaxed));
+  }
+  stats.total_bytes = Clamped(shared.total.load(std::memory_order_relaxed));
+  stats.peak_bytes = Clamped(shared.total_peak.load(std::memory_order_relaxed));
+  return stats;
+}
+
+uint64_t ReadProcessRssBytes() {
+  FILE* statm = fopen("/proc/self/statm", "r");
+  if (statm == nullptr) {
+    return 0;
+  }
+  unsigned long long size_pages = 0;
+  unsigned long long resident_pages = 0;
+  int fields = fscanf(statm, "%llu %llu", &size_pages, &resident_pages);
+  fclose(statm);
+  long page_size = sysconf(_SC_PAGESIZE);
+  if (fields != 2 || page_size <= 0) {
+    return 0;
+  }
+  return resident_pages * static_cast<uint64_t>(page_size);
+}
+
+}  // namespace flutter_zoom_meeting_sdk
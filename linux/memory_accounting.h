@@ -0,0 +1,111 @@
+#ifndef FLUTTER_PLUGIN_MEMORY_ACCOUNTING_H_
+#define FLUTTER_PLUGIN_MEMORY_ACCOUNTING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+
+// What the plugin's own memory is spent on.
+enum class MemoryCategory {
+  // I420 planes held by the frame pool, in use or free.
+  kVideoFrames,
+  // RGBA buffers of video textures and the gallery atlas.
+  kVideoTextures,
+  // PCM rings shared with Dart.
+  kAudioRings,
+  kRoster,
+  kEventQueues,
+  // Mapped recording segments and records waiting to be written.
+  kRecording,
+};
+
+constexpr size_t kMemoryCategoryCount = 6;
+
+// Returns the name of |category| as reported to Dart, e.g. "videoFrames".
+const char* MemoryCategoryName(MemoryCategory category);
+
+// Bytes allocated by each plugin subsystem, so that the plugin's share of the
+// process can be told apart from the engine's and the SDK's.
+//
+// Charges are batched per thread and only reach the shared counters once a
+// thread's balance for a category passes kFlushBytes either way, or the
+// thread exits, so the frequent small allocations of busy threads cost no
+// shared writes. Totals can thus lag by up to kFlushBytes per thread and
+// category; peaks are sampled when batches land. Safe to call from any
+// thread.
+class MemoryAccounting {
+ public:
+  struct CategoryStats {
+    uint64_t current_bytes = 0;
+    uint64_t peak_bytes = 0;
+  };
+
+  struct Stats {
+    CategoryStats categories[kMemoryCategoryCount];
+    uint64_t total_bytes = 0;
+    // Highest |total_bytes| so far.
+    uint64_t peak_bytes = 0;
+  };
+
+  static constexpr int64_t kFlushBytes = 64 << 10;
+
+  // Counts |bytes| allocated, or released if negative, for |category|.
+  static void Charge(MemoryCategory category, int64_t bytes);
+
+  // Counts the calling thread's batched charges, then returns the totals.
+  static Stats GetStats();
+};
+
+// Standard allocator that charges what it hands out to |Category|, for
+// containers owned by a plugin subsystem.
+template <typename T, MemoryCategory Category>
+class TrackingAllocator {
+ public:
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = TrackingAllocator<U, Category>;
+  };
+
+  TrackingAllocator() = default;
+  template <typename U>
+  TrackingAllocator(const TrackingAllocator<U, Category>&) {}
+
+  T* allocate(size_t count) {
+    T* memory = std::allocator<T>().allocate(count);
+    MemoryAccounting::Charge(Category,
+                             static_cast<int64_t>(count * sizeof(T)));
+    return memory;
+  }
+
+  void deallocate(T* memory, size_t count) {
+    MemoryAccounting::Charge(Category,
+                             -static_cast<int64_t>(count * sizeof(T)));
+    std::allocator<T>().deallocate(memory, count);
+  }
+
+  template <typename U>
+  bool operator==(const TrackingAllocator<U, Category>&) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const TrackingAllocator<U, Category>&) const {
+    return false;
+  }
+};
+
+// A vector whose storage is charged to |Category|.
+template <typename T, MemoryCategory Category>
+using TrackedVector = std::vector<T, TrackingAllocator<T, Category>>;
+
+// Returns the resident set size of the process in bytes, or 0 if it cannot
+// be read.
+uint64_t ReadProcessRssBytes();
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_MEMORY_ACCOUNTING_H_
@@ -0,0 +1,64 @@
+#include "memory_budget.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+// The minimal level starts at this share of a budget, in percent.
+constexpr uint64_t kMinimalPercent = 150;
+// A level is left below this share of where it starts, in percent.
+constexpr uint64_t kReleasePercent = 90;
+
+bool Over(uint64_t bytes, uint64_t budget, uint64_t percent) {
+  return budget > 0 && bytes * 100 > budget * percent;
+}
+
+}  // namespace
+
+const char* MemoryPressureName(MemoryPressure pressure) {
+  switch (pressure) {
+    case MemoryPressure::kNormal:
+      return "normal";
+    case MemoryPressure::kReduced:
+      return "reduced";
+    case MemoryPressure::kMinimal:
+      return "minimal";
+  }
+  return "normal";
+}
+
+MemoryBudget::MemoryBudget(const Config& config) : config_(config) {}
+
+void MemoryBudget::SetConfig(const Config& config) {
+  config_ = config;
+}
+
+MemoryPressure MemoryBudget::Update(uint64_t plugin_bytes,
+                                    uint64_t rss_bytes) {
+  MemoryPressure entered = LevelOver(plugin_bytes, rss_bytes, 100);
+  MemoryPressure held =
+      LevelOver(plugin_bytes, rss_bytes, kReleasePercent);
+  // Climb straight to the level entered, but only step down as far as the
+  // level still held with the release margin.
+  level_ = std::max(entered, std::min(level_, held));
+  return level_;
+}
+
+MemoryPressure MemoryBudget::LevelOver(uint64_t plugin_bytes,
+                                       uint64_t rss_bytes,
+                                       uint64_t percent) const {
+  if (Over(plugin_bytes, config_.plugin_bytes,
+           kMinimalPercent * percent / 100) ||
+      Over(rss_bytes, config_.rss_bytes, kMinimalPercent * percent / 100)) {
+    return MemoryPressure::kMinimal;
+  }
+  if (Over(plugin_bytes, config_.plugin_bytes, percent) ||
+      Over(rss_bytes, config_.rss_bytes, percent)) {
+    return MemoryPressure::kReduced;
+  }
+  return MemoryPressure::kNormal;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
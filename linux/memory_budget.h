@@ -0,0 +1,59 @@
+#ifndef FLUTTER_PLUGIN_MEMORY_BUDGET_H_
+#define FLUTTER_PLUGIN_MEMORY_BUDGET_H_
+
+#include <cstdint>
+
+namespace flutter_zoom_meeting_sdk {
+
+// How much the plugin should shed to get back under its memory budget.
+enum class MemoryPressure {
+  kNormal,
+  // Over budget: fewer live gallery tiles, smaller textures.
+  kReduced,
+  // Half again over budget: the least the plugin can show.
+  kMinimal,
+};
+
+// Returns the name of |pressure| as reported to Dart, e.g. "reduced".
+const char* MemoryPressureName(MemoryPressure pressure);
+
+// Soft budgets for the bytes the plugin tracks itself and for the resident
+// set of the whole process, and the pressure level they put the plugin at.
+//
+// A level is entered once either measure passes its threshold and only left
+// once both are back under 90% of it, so that memory freed by shedding does
+// not immediately undo it. Not thread-safe.
+class MemoryBudget {
+ public:
+  struct Config {
+    // Zero disables a budget.
+    uint64_t plugin_bytes = 0;
+    uint64_t rss_bytes = 0;
+  };
+
+  MemoryBudget() = default;
+  explicit MemoryBudget(const Config& config);
+
+  const Config& config() const { return config_; }
+  MemoryPressure level() const { return level_; }
+
+  // Replaces the budgets. The level is kept until the next Update().
+  void SetConfig(const Config& config);
+
+  // Returns the level for the given measurements.
+  MemoryPressure Update(uint64_t plugin_bytes, uint64_t rss_bytes);
+
+ private:
+  // Returns the highest level whose threshold, scaled by |percent|, either
+  // measurement is over.
+  MemoryPressure LevelOver(uint64_t plugin_bytes,
+                           uint64_t rss_bytes,
+                           uint64_t percent) const;
+
+  Config config_;
+  MemoryPressure level_ = MemoryPressure::kNormal;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_MEMORY_BUDGET_H_
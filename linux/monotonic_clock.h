@@ -0,0 +1,19 @@
+#ifndef FLUTTER_PLUGIN_MONOTONIC_CLOCK_H_
+#define FLUTTER_PLUGIN_MONOTONIC_CLOCK_H_
+
+#include <chrono>
+#include <cstdint>
+
+namespace flutter_zoom_meeting_sdk {
+
+// Returns the monotonic clock in microseconds, the same clock as
+// g_get_monotonic_time().
+inline int64_t MonotonicNowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_MONOTONIC_CLOCK_H_
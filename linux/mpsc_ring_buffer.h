@@ -0,0 +1,113 @@
+#ifndef FLUTTER_PLUGIN_MPSC_RING_BUFFER_H_
+#define FLUTTER_PLUGIN_MPSC_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace flutter_zoom_meeting_sdk {
+
+// Bounded lock-free queue with any number of producers and one consumer.
+//
+// Every slot carries a sequence number that tells producers and the consumer
+// whose turn it is, so neither side ever waits on the other: TryPush fails
+// instead of blocking when the queue is full and TryPop fails when it is
+// empty.
+template <typename T>
+class MpscRingBuffer {
+ public:
+  // |capacity| is rounded up to a power of two.
+  explicit MpscRingBuffer(size_t capacity)
+      : capacity_(RoundUpToPowerOfTwo(capacity)),
+        mask_(capacity_ - 1),
+        slots_(new Slot[capacity_]) {
+    for (size_t i = 0; i < capacity_; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpscRingBuffer(const MpscRingBuffer&) = delete;
+  MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+
+  // Safe to call from any thread. Returns false if the queue is full.
+  bool TryPush(T value) {
+    size_t position = enqueue_position_.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+      slot = &slots_[position & mask_];
+      size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      intptr_t difference =
+          static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+      if (difference == 0) {
+        if (enqueue_position_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = enqueue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    slot->value = std::move(value);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Only called from the consumer thread. Returns false if the queue is
+  // empty.
+  bool TryPop(T* value) {
+    size_t position = dequeue_position_.load(std::memory_order_relaxed);
+    Slot* slot = &slots_[position & mask_];
+    size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    if (static_cast<intptr_t>(sequence) -
+            static_cast<intptr_t>(position + 1) <
+        0) {
+      return false;
+    }
+    *value = std::move(slot->value);
+    slot->sequence.store(position + capacity_, std::memory_order_release);
+    dequeue_position_.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Number of queued items. Only a snapshot while producers are active.
+  size_t SizeApprox() const {
+    size_t enqueued = enqueue_position_.load(std::memory_order_acquire);
+    size_t dequeued = dequeue_position_.load(std::memory_order_acquire);
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+  }
+
+  size_t capacity() const { return capacity_; }
+
+  // Bytes of slot storage allocated up front.
+  size_t memory_bytes() const { return capacity_ * sizeof(Slot); }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  static size_t RoundUpToPowerOfTwo(size_t value) {
+    size_t result = 2;
+    while (result < value) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  const size_t capacity_;
+  const size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+
+  // Producers and the consumer each get their own cache line.
+  alignas(64) std::atomic<size_t> enqueue_position_{0};
+  alignas(64) std::atomic<size_t> dequeue_position_{0};
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_MPSC_RING_BUFFER_H_
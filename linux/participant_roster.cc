@@ -0,0 +1,221 @@
+#include "participant_roster.h"
+
+#include <utility>
+
+namespace flutter_zoom_meeting_sdk {
+
+ParticipantRoster::ParticipantRoster(const Config& config)
+    : config_(config), history_limit_(config.history) {}
+
+uint8_t ParticipantRoster::StateBits(const ParticipantInfo& participant) {
+  return (participant.audio_muted ? kRosterAudioMuted : 0) |
+         (participant.video_on ? kRosterVideoOn : 0) |
+         (participant.hand_raised ? kRosterHandRaised : 0);
+}
+
+bool ParticipantRoster::Join(uint32_t session_id,
+                             const ParticipantInfo& participant) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = slots_.find(Key(session_id, participant.participant_id));
+  if (it != slots_.end()) {
+    return ChangeLocked(it->second, participant);
+  }
+  return JoinLocked(session_id, participant);
+}
+
+bool ParticipantRoster::Leave(uint32_t session_id, uint32_t participant_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = slots_.find(Key(session_id, participant_id));
+  if (it == slots_.end()) {
+    return false;
+  }
+  uint32_t slot = it->second;
+  slots_.erase(it);
+  present_[slot] = 0;
+  names_[slot].clear();
+  free_slots_.push_back(slot);
+
+  RosterDelta delta;
+  delta.type = RosterDeltaType::kLeft;
+  delta.session_id = session_id;
+  delta.slot = slot;
+  delta.participant_id = participant_id;
+  return RecordLocked(std::move(delta));
+}
+
+bool ParticipantRoster::Change(uint32_t session_id,
+                               const ParticipantInfo& participant) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = slots_.find(Key(session_id, participant.participant_id));
+  if (it == slots_.end()) {
+    return JoinLocked(session_id, participant);
+  }
+  return ChangeLocked(it->second, participant);
+}
+
+bool ParticipantRoster::EndSession(uint32_t session_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  bool had_participants = false;
+  for (uint32_t slot = 0; slot < session_ids_.size(); ++slot) {
+    if (!present_[slot] || session_ids_[slot] != session_id) {
+      continue;
+    }
+    had_participants = true;
+    slots_.erase(Key(session_id, participant_ids_[slot]));
+    present_[slot] = 0;
+    names_[slot].clear();
+    free_slots_.push_back(slot);
+  }
+  if (!had_participants) {
+    return false;
+  }
+  RosterDelta delta;
+  delta.type = RosterDeltaType::kSessionEnded;
+  delta.session_id = session_id;
+  return RecordLocked(std::move(delta));
+}
+
+bool ParticipantRoster::JoinLocked(uint32_t session_id,
+                                   const ParticipantInfo& participant) {
+  uint32_t slot;
+  if (!free_slots_.empty()) {
+    slot = free_slots_.back();
+    free_slots_.pop_back();
+  } else {
+    slot = static_cast<uint32_t>(participant_ids_.size());
+    participant_ids_.push_back(0);
+    session_ids_.push_back(0);
+    states_.push_back(0);
+    present_.push_back(0);
+    names_.emplace_back();
+  }
+  participant_ids_[slot] = participant.participant_id;
+  session_ids_[slot] = session_id;
+  states_[slot] = StateBits(participant);
+  present_[slot] = 1;
+  names_[slot] = participant.display_name;
+  slots_[Key(session_id, participant.participant_id)] = slot;
+
+  RosterDelta delta;
+  delta.type = RosterDeltaType::kJoined;
+  delta.state = states_[slot];
+  delta.session_id = session_id;
+  delta.slot = slot;
+  delta.participant_id = participant.participant_id;
+  delta.display_name = participant.display_name;
+  return RecordLocked(std::move(delta));
+}
+
+bool ParticipantRoster::ChangeLocked(uint32_t slot,
+                                     const ParticipantInfo& participant) {
+  uint8_t state = StateBits(participant);
+  uint8_t changed_bits = states_[slot] ^ state;
+  uint8_t changes = 0;
+  if (names_[slot] != participant.display_name) {
+    changes |= kRosterNameChanged;
+  }
+  if (changed_bits & kRosterAudioMuted) {
+    changes |= kRosterAudioChanged;
+  }
+  if (changed_bits & kRosterVideoOn) {
+    changes |= kRosterVideoChanged;
+  }
+  if (changed_bits & kRosterHandRaised) {
+    changes |= kRosterHandChanged;
+  }
+  if (changes == 0) {
+    return false;
+  }
+  states_[slot] = state;
+
+  RosterDelta delta;
+  delta.type = RosterDeltaType::kChanged;
+  delta.changes = changes;
+  delta.state = state;
+  delta.session_id = session_ids_[slot];
+  delta.slot = slot;
+  delta.participant_id = participant_ids_[slot];
+  if (changes & kRosterNameChanged) {
+    names_[slot] = participant.display_name;
+    delta.display_name = participant.display_name;
+  }
+  return RecordLocked(std::move(delta));
+}
+
+bool ParticipantRoster::RecordLocked(RosterDelta delta) {
+  delta.sequence = ++sequence_;
+  if (history_limit_ > 0) {
+    if (history_.size() == history_limit_) {
+      history_.pop_front();
+    }
+    history_.push_back(delta);
+  }
+  if (pending_.size() >= config_.max_pending) {
+    return false;
+  }
+  pending_.push_back(std::move(delta));
+  return pending_.size() == 1;
+}
+
+size_t ParticipantRoster::TakePending(std::vector<RosterDelta>* deltas) {
+  deltas->clear();
+  std::lock_guard<std::mutex> lock(mutex_);
+  deltas->swap(pending_);
+  return deltas->size();
+}
+
+void ParticipantRoster::SetHistoryLimit(size_t history) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  history_limit_ = history;
+  if (history_.size() > history) {
+    history_.erase(history_.begin(),
+                   history_.end() - static_cast<ptrdiff_t>(history));
+    history_.shrink_to_fit();
+  }
+}
+
+ParticipantRoster::Snapshot ParticipantRoster::GetSnapshot(
+    uint64_t since_sequence) const {
+  Snapshot snapshot;
+  std::lock_guard<std::mutex> lock(mutex_);
+  snapshot.sequence = sequence_;
+  if (since_sequence >= sequence_) {
+    return snapshot;
+  }
+  if (!history_.empty() && history_.front().sequence <= since_sequence + 1) {
+    snapshot.deltas.assign(
+        history_.end() - static_cast<ptrdiff_t>(sequence_ - since_sequence),
+        history_.end());
+    return snapshot;
+  }
+
+  snapshot.full = true;
+  snapshot.deltas.reserve(slots_.size());
+  for (uint32_t slot = 0; slot < present_.size(); ++slot) {
+    if (!present_[slot]) {
+      continue;
+    }
+    RosterDelta delta;
+    delta.sequence = sequence_;
+    delta.type = RosterDeltaType::kJoined;
+    delta.state = states_[slot];
+    delta.session_id = session_ids_[slot];
+    delta.slot = slot;
+    delta.participant_id = participant_ids_[slot];
+    delta.display_name = names_[slot];
+    snapshot.deltas.push_back(std::move(delta));
+  }
+  return snapshot;
+}
+
+size_t ParticipantRoster::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return slots_.size();
+}
+
+uint64_t ParticipantRoster::sequence() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return sequence_;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
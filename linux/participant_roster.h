@@ -0,0 +1,141 @@
+#ifndef FLUTTER_PLUGIN_PARTICIPANT_ROSTER_H_
+#define FLUTTER_PLUGIN_PARTICIPANT_ROSTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "meeting_backend.h"
+#include "memory_accounting.h"
+#include "roster_delta_codec.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// The participants of every meeting being attended, kept so that Dart only
+// ever receives what changed.
+//
+// Participants live in slots of a structure of arrays: one column each for
+// IDs, sessions, state bits and names, so scanning a column for a session
+// or a full snapshot touches only the bytes it needs. A participant keeps
+// its slot while present; freed slots are reused by later joins.
+//
+// Every join, leave and change becomes a RosterDelta with the next
+// sequence number. Deltas queue for the main loop, which sends them to
+// Dart as a batch, and the most recent Config::history of them are kept so
+// that a client that missed some can catch up with GetSnapshot() at the
+// cost of the changes, not of the roster's size.
+//
+// All methods are thread-safe.
+class ParticipantRoster {
+ public:
+  struct Config {
+    // Deltas kept for GetSnapshot().
+    size_t history = 4096;
+    // Deltas that can wait for the main loop before further ones are
+    // dropped, leaving a gap in the sequence for Dart to resync over.
+    size_t max_pending = 65536;
+  };
+
+  struct Snapshot {
+    // Sequence of the latest delta included.
+    uint64_t sequence = 0;
+    // Whether |deltas| is the whole roster, as kJoined deltas, rather than
+    // the changes since the requested sequence.
+    bool full = false;
+    std::vector<RosterDelta> deltas;
+  };
+
+  explicit ParticipantRoster(const Config& config);
+
+  ParticipantRoster(const ParticipantRoster&) = delete;
+  ParticipantRoster& operator=(const ParticipantRoster&) = delete;
+
+  // Each of the following records a delta, if anything changed, and
+  // returns true if the caller must schedule a TakePending() on the main
+  // loop. Participants are identified by session and participant ID, as
+  // IDs may repeat across meetings.
+
+  // A participant that is already present is changed instead.
+  bool Join(uint32_t session_id, const ParticipantInfo& participant);
+  bool Leave(uint32_t session_id, uint32_t participant_id);
+  // A participant that is not present joins instead.
+  bool Change(uint32_t session_id, const ParticipantInfo& participant);
+  // Drops every participant of |session_id| with a single kSessionEnded
+  // delta, if it had any.
+  bool EndSession(uint32_t session_id);
+
+  // Main loop only. Replaces the contents of |deltas| with every queued
+  // delta in order and returns how many there were.
+  size_t TakePending(std::vector<RosterDelta>* deltas);
+
+  // Every delta after |since_sequence| if they are all still kept, or else
+  // the whole roster.
+  Snapshot GetSnapshot(uint64_t since_sequence) const;
+
+  // Keeps only the most recent |history| deltas for GetSnapshot() from now
+  // on, releasing older ones. Clients further behind than that get the
+  // whole roster instead, so a smaller history trades memory for larger
+  // catch-ups.
+  void SetHistoryLimit(size_t history);
+
+  // Participants present in every session.
+  size_t size() const;
+
+  // Sequence of the latest delta.
+  uint64_t sequence() const;
+
+ private:
+  static uint64_t Key(uint32_t session_id, uint32_t participant_id) {
+    return static_cast<uint64_t>(session_id) << 32 | participant_id;
+  }
+
+  static uint8_t StateBits(const ParticipantInfo& participant);
+
+  template <typename T>
+  using Column = TrackedVector<T, MemoryCategory::kRoster>;
+
+  // Requires |mutex_|. Stamps |delta| with the next sequence number and
+  // records it. Returns true if it is the first delta pending.
+  bool RecordLocked(RosterDelta delta);
+
+  // Requires |mutex_|.
+  bool JoinLocked(uint32_t session_id, const ParticipantInfo& participant);
+  bool ChangeLocked(uint32_t slot, const ParticipantInfo& participant);
+
+  const Config config_;
+
+  mutable std::mutex mutex_;
+
+  // Columns, indexed by slot.
+  Column<uint32_t> participant_ids_;
+  Column<uint32_t> session_ids_;
+  Column<uint8_t> states_;
+  Column<uint8_t> present_;
+  Column<std::string> names_;
+
+  Column<uint32_t> free_slots_;
+  // Slot of each present participant, keyed by Key().
+  std::unordered_map<
+      uint64_t,
+      uint32_t,
+      std::hash<uint64_t>,
+      std::equal_to<uint64_t>,
+      TrackingAllocator<std::pair<const uint64_t, uint32_t>,
+                        MemoryCategory::kRoster>>
+      slots_;
+
+  uint64_t sequence_ = 0;
+  size_t history_limit_;
+  std::deque<RosterDelta,
+             TrackingAllocator<RosterDelta, MemoryCategory::kRoster>>
+      history_;
+  std::vector<RosterDelta> pending_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_PARTICIPANT_ROSTER_H_
@@ -0,0 +1,112 @@
+#include "pcm_ring_buffer.h"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "memory_accounting.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+}  // namespace
+
+std::unique_ptr<PcmRingBuffer> PcmRingBuffer::Create(uint32_t participant_id,
+                                                     uint32_t sample_rate,
+                                                     size_t capacity) {
+  capacity = RoundUpToPowerOfTwo(std::max<size_t>(capacity, 2));
+  size_t mapping_size = kPcmRingDataOffset + capacity * sizeof(int16_t);
+  void* memory = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED) {
+    return nullptr;
+  }
+
+  // The mapping is zero-filled, which is also the initial state of the
+  // atomics.
+  PcmRingHeader* header = new (memory) PcmRingHeader();
+  header->magic = kPcmRingMagic;
+  header->version = kPcmRingVersion;
+  header->sample_rate = sample_rate;
+  header->channels = 1;
+  header->capacity = static_cast<uint32_t>(capacity);
+  header->participant_id = participant_id;
+  header->data_offset = kPcmRingDataOffset;
+  return std::unique_ptr<PcmRingBuffer>(
+      new PcmRingBuffer(header, mapping_size));
+}
+
+PcmRingBuffer::PcmRingBuffer(PcmRingHeader* header, size_t mapping_size)
+    : header_(header),
+      data_(reinterpret_cast<int16_t*>(reinterpret_cast<uint8_t*>(header) +
+                                       kPcmRingDataOffset)),
+      mapping_size_(mapping_size) {
+  MemoryAccounting::Charge(MemoryCategory::kAudioRings,
+                           static_cast<int64_t>(mapping_size_));
+}
+
+PcmRingBuffer::~PcmRingBuffer() {
+  header_->~PcmRingHeader();
+  munmap(header_, mapping_size_);
+  MemoryAccounting::Charge(MemoryCategory::kAudioRings,
+                           -static_cast<int64_t>(mapping_size_));
+}
+
+void PcmRingBuffer::Write(const int16_t* samples, size_t count) {
+  const size_t capacity = header_->capacity;
+  uint64_t position = header_->write_position.load(std::memory_order_relaxed);
+  if (count > capacity) {
+    samples += count - capacity;
+    position += count - capacity;
+    count = capacity;
+  }
+
+  // Readers must see the claim before any of the samples it covers change,
+  // as in a seqlock.
+  uint64_t end = position + count;
+  header_->claim_position.store(end, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  size_t offset = static_cast<size_t>(position & (capacity - 1));
+  size_t first = std::min(count, capacity - offset);
+  memcpy(data_ + offset, samples, first * sizeof(int16_t));
+  memcpy(data_, samples + first, (count - first) * sizeof(int16_t));
+
+  // Samples before end - capacity are gone now. Count the ones Dart had not
+  // read and that were not already counted by an earlier write.
+  uint64_t previous_end =
+      header_->write_position.load(std::memory_order_relaxed);
+  uint64_t oldest = end > capacity ? end - capacity : 0;
+  uint64_t previous_oldest =
+      previous_end > capacity ? previous_end - capacity : 0;
+  uint64_t unread = std::max(
+      header_->read_position.load(std::memory_order_relaxed), previous_oldest);
+  if (oldest > unread) {
+    header_->dropped_samples.fetch_add(oldest - unread,
+                                       std::memory_order_relaxed);
+  }
+
+  header_->write_position.store(end, std::memory_order_release);
+}
+
+void PcmRingBuffer::CopyOut(uint64_t position,
+                            size_t count,
+                            int16_t* out) const {
+  const size_t capacity = header_->capacity;
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = data_[(position + i) & (capacity - 1)];
+  }
+}
+
+}  // namespace flutter_zoom_meeting_sdk
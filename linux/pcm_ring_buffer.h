@@ -0,0 +1,94 @@
+#ifndef FLUTTER_PLUGIN_PCM_RING_BUFFER_H_
+#define FLUTTER_PLUGIN_PCM_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace flutter_zoom_meeting_sdk {
+
+constexpr uint32_t kPcmRingMagic = 0x4d43505a;  // "ZPCM"
+constexpr uint32_t kPcmRingVersion = 2;
+
+// Layout of the memory shared with Dart. PcmRingReader in
+// lib/flutter_zoom_meeting_sdk_audio.dart reads it through dart:ffi, so the
+// offsets are part of the wire format.
+//
+// The positions count samples since the ring was created; sample n lives at
+// data[n % capacity]. Before copying samples in, the producer advances
+// |claim_position| to where the write will end, and it advances
+// |write_position| once they are in place. A reader may read up to
+// |write_position|, but after copying must treat everything before
+// |claim_position| - capacity as overwritten, since a write still in
+// progress may already have replaced it. Dart advances |read_position| as
+// it consumes, which only feeds the |dropped_samples| counter: the producer
+// never waits.
+struct PcmRingHeader {
+  uint32_t magic;           // 0
+  uint32_t version;         // 4
+  uint32_t sample_rate;     // 8
+  uint32_t channels;        // 12
+  uint32_t capacity;        // 16, in samples, a power of two
+  uint32_t participant_id;  // 20
+  uint32_t data_offset;     // 24, in bytes from the header
+  uint32_t reserved;        // 28
+  // Written by the native producer.
+  alignas(64) std::atomic<uint64_t> write_position;  // 64
+  std::atomic<uint64_t> claim_position;               // 72
+  // Written by the Dart consumer.
+  alignas(64) std::atomic<uint64_t> read_position;  // 128
+  // Samples overwritten before Dart read them, as seen by the producer.
+  alignas(64) std::atomic<uint64_t> dropped_samples;  // 192
+};
+
+constexpr size_t kPcmRingDataOffset = 256;
+
+static_assert(sizeof(PcmRingHeader) <= kPcmRingDataOffset,
+              "PCM ring header overlaps the samples");
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Dart reads the positions as plain 64-bit integers");
+
+// Single-producer ring of 16-bit mono PCM in its own anonymous mapping,
+// shared in-process with Dart by address.
+class PcmRingBuffer {
+ public:
+  // Returns nullptr if the mapping fails. |capacity| is rounded up to a
+  // power of two.
+  static std::unique_ptr<PcmRingBuffer> Create(uint32_t participant_id,
+                                               uint32_t sample_rate,
+                                               size_t capacity);
+
+  ~PcmRingBuffer();
+
+  PcmRingBuffer(const PcmRingBuffer&) = delete;
+  PcmRingBuffer& operator=(const PcmRingBuffer&) = delete;
+
+  // Producer only. If |count| exceeds the capacity only the newest samples
+  // are kept.
+  void Write(const int16_t* samples, size_t count);
+
+  // Address of the header, handed to Dart.
+  uintptr_t address() const { return reinterpret_cast<uintptr_t>(header_); }
+
+  const PcmRingHeader& header() const { return *header_; }
+  size_t capacity() const { return header_->capacity; }
+  uint64_t write_position() const {
+    return header_->write_position.load(std::memory_order_relaxed);
+  }
+
+  // Copies samples [position, position + count) out of the ring, for tests.
+  // They must not have been overwritten yet.
+  void CopyOut(uint64_t position, size_t count, int16_t* out) const;
+
+ private:
+  PcmRingBuffer(PcmRingHeader* header, size_t mapping_size);
+
+  PcmRingHeader* const header_;
+  int16_t* const data_;
+  const size_t mapping_size_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_PCM_RING_BUFFER_H_
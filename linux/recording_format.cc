@@ -0,0 +1,162 @@
+#include "recording_format.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+void WriteUint16(uint16_t value, uint8_t* out) {
+  out[0] = static_cast<uint8_t>(value);
+  out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void WriteUint32(uint32_t value, uint8_t* out) {
+  for (int i = 0; i < 4; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+void WriteUint64(uint64_t value, uint8_t* out) {
+  for (int i = 0; i < 8; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+uint16_t ReadUint16(const uint8_t* data) {
+  return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+uint32_t ReadUint32(const uint8_t* data) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    value |= static_cast<uint32_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+uint64_t ReadUint64(const uint8_t* data) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; ++i) {
+    value |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+// CRC-32 (IEEE 802.3) lookup table, built on first use.
+struct CrcTable {
+  CrcTable() {
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t crc = i;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1)));
+      }
+      entries[i] = crc;
+    }
+  }
+
+  uint32_t entries[256];
+};
+
+// Bytes of the record header covered by its CRC.
+constexpr size_t kRecordCrcOffset = 24;
+
+}  // namespace
+
+void SegmentFileName(uint32_t segment_number, bool partial, char* out) {
+  snprintf(out, 32, "segment-%06u%s", segment_number,
+           partial ? kPartialSegmentSuffix : kSegmentSuffix);
+}
+
+uint32_t Crc32(const uint8_t* data, size_t size, uint32_t crc) {
+  static const CrcTable table;
+  crc = ~crc;
+  for (size_t i = 0; i < size; ++i) {
+    crc = table.entries[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+void EncodeSegmentHeader(const SegmentHeader& header, uint8_t* out) {
+  memset(out, 0, kSegmentHeaderSize);
+  memcpy(out, kSegmentMagic, sizeof(kSegmentMagic));
+  WriteUint32(kRecordingFormatVersion, out + 8);
+  WriteUint32(header.segment_number, out + 12);
+  WriteUint64(static_cast<uint64_t>(header.recording_start_unix_us), out + 16);
+  WriteUint64(static_cast<uint64_t>(header.first_timestamp_us), out + 24);
+  WriteUint64(header.index_offset, out + 32);
+  WriteUint32(header.index_count, out + 40);
+  WriteUint64(static_cast<uint64_t>(header.last_timestamp_us), out + 48);
+}
+
+bool DecodeSegmentHeader(const uint8_t* data,
+                         size_t size,
+                         SegmentHeader* header) {
+  if (size < kSegmentHeaderSize ||
+      memcmp(data, kSegmentMagic, sizeof(kSegmentMagic)) != 0 ||
+      ReadUint32(data + 8) != kRecordingFormatVersion) {
+    return false;
+  }
+  header->segment_number = ReadUint32(data + 12);
+  header->recording_start_unix_us = static_cast<int64_t>(ReadUint64(data + 16));
+  header->first_timestamp_us = static_cast<int64_t>(ReadUint64(data + 24));
+  header->index_offset = ReadUint64(data + 32);
+  header->index_count = ReadUint32(data + 40);
+  header->last_timestamp_us = static_cast<int64_t>(ReadUint64(data + 48));
+  return true;
+}
+
+void EncodeRecordHeader(const RecordHeader& header,
+                        const uint8_t* payload,
+                        uint8_t* out) {
+  memset(out, 0, kRecordHeaderSize);
+  WriteUint32(kRecordMagic, out);
+  WriteUint16(static_cast<uint16_t>(header.type), out + 4);
+  WriteUint32(header.participant_id, out + 8);
+  WriteUint32(header.payload_size, out + 12);
+  WriteUint64(static_cast<uint64_t>(header.timestamp_us), out + 16);
+  uint32_t crc = Crc32(out, kRecordCrcOffset);
+  WriteUint32(Crc32(payload, header.payload_size, crc), out + 24);
+}
+
+bool DecodeRecord(const uint8_t* data,
+                  size_t size,
+                  RecordHeader* header,
+                  const uint8_t** payload) {
+  if (size < kRecordHeaderSize || ReadUint32(data) != kRecordMagic) {
+    return false;
+  }
+  uint32_t payload_size = ReadUint32(data + 12);
+  if (payload_size > size - kRecordHeaderSize) {
+    return false;
+  }
+  uint32_t crc = Crc32(data, kRecordCrcOffset);
+  if (Crc32(data + kRecordHeaderSize, payload_size, crc) !=
+      ReadUint32(data + 24)) {
+    return false;
+  }
+  header->type = static_cast<RecordType>(ReadUint16(data + 4));
+  header->participant_id = ReadUint32(data + 8);
+  header->payload_size = payload_size;
+  header->timestamp_us = static_cast<int64_t>(ReadUint64(data + 16));
+  *payload = data + kRecordHeaderSize;
+  return true;
+}
+
+void EncodeIndexEntry(const RecordIndexEntry& entry, uint8_t* out) {
+  WriteUint32(entry.participant_id, out);
+  WriteUint16(static_cast<uint16_t>(entry.type), out + 4);
+  WriteUint16(0, out + 6);
+  WriteUint64(static_cast<uint64_t>(entry.timestamp_us), out + 8);
+  WriteUint64(entry.offset, out + 16);
+}
+
+void DecodeIndexEntry(const uint8_t* data, RecordIndexEntry* entry) {
+  entry->participant_id = ReadUint32(data);
+  entry->type = static_cast<RecordType>(ReadUint16(data + 4));
+  entry->timestamp_us = static_cast<int64_t>(ReadUint64(data + 8));
+  entry->offset = ReadUint64(data + 16);
+}
+
+}  // namespace flutter_zoom_meeting_sdk
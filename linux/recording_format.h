@@ -0,0 +1,136 @@
+#ifndef FLUTTER_PLUGIN_RECORDING_FORMAT_H_
+#define FLUTTER_PLUGIN_RECORDING_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flutter_zoom_meeting_sdk {
+
+// On-disk layout of a meeting recording, shared by RecordingWriter and
+// RecordingSegmentReader.
+//
+// A recording is a directory of numbered segment files. The writer fills
+// "segment-NNNNNN.zrec.part" and renames it to "segment-NNNNNN.zrec" once
+// its index is written, so a crash leaves at most one unfinished segment,
+// whose records can still be recovered by scanning. All integers are
+// little-endian.
+//
+// Segment header, kSegmentHeaderSize bytes:
+//
+//   0  char[8] kSegmentMagic
+//   8  uint32  format version (kRecordingFormatVersion)
+//   12 uint32  segment number, from 0
+//   16 int64   recording start, wall clock (us since the Unix epoch)
+//   24 int64   first record timestamp (us since the recording started)
+//   32 uint64  index offset, or 0 while the segment is being written
+//   40 uint32  index entry count
+//   44 uint32  reserved
+//   48 int64   last record timestamp (us since the recording started)
+//   56 uint64  reserved
+//
+// Records follow the header back to back, each a kRecordHeaderSize header
+// and its payload, padded to a multiple of kRecordAlignment:
+//
+//   0  uint32  kRecordMagic
+//   4  uint16  RecordType
+//   6  uint16  reserved
+//   8  uint32  participant ID
+//   12 uint32  payload size, excluding padding
+//   16 int64   timestamp (us since the recording started)
+//   24 uint32  CRC-32 of header bytes 0-23 and the payload
+//   28 uint32  reserved
+//
+// A video payload is uint32 width, uint32 height, then the I420 planes
+// tightly packed. An audio payload is uint32 sample rate, uint32 channel
+// count, then interleaved 16-bit PCM.
+//
+// The index follows the last record: one kIndexEntrySize entry per record,
+// in record order:
+//
+//   0  uint32  participant ID
+//   4  uint16  RecordType
+//   6  uint16  reserved
+//   8  int64   timestamp (us since the recording started)
+//   16 uint64  record offset in the segment
+constexpr char kSegmentMagic[8] = {'Z', 'R', 'E', 'C', 'S', 'E', 'G', '1'};
+constexpr uint32_t kRecordingFormatVersion = 1;
+constexpr size_t kSegmentHeaderSize = 64;
+constexpr uint32_t kRecordMagic = 0x4452435a;  // "ZCRD"
+constexpr size_t kRecordHeaderSize = 32;
+constexpr size_t kRecordAlignment = 8;
+constexpr size_t kIndexEntrySize = 24;
+constexpr size_t kVideoPayloadHeaderSize = 8;
+constexpr size_t kAudioPayloadHeaderSize = 8;
+
+// File name suffixes of finished and unfinished segments.
+constexpr char kSegmentSuffix[] = ".zrec";
+constexpr char kPartialSegmentSuffix[] = ".zrec.part";
+
+enum class RecordType : uint16_t {
+  kVideo = 1,
+  kAudio = 2,
+};
+
+struct SegmentHeader {
+  uint32_t segment_number = 0;
+  int64_t recording_start_unix_us = 0;
+  int64_t first_timestamp_us = 0;
+  int64_t last_timestamp_us = 0;
+  uint64_t index_offset = 0;
+  uint32_t index_count = 0;
+};
+
+struct RecordHeader {
+  RecordType type = RecordType::kVideo;
+  uint32_t participant_id = 0;
+  uint32_t payload_size = 0;
+  int64_t timestamp_us = 0;
+};
+
+struct RecordIndexEntry {
+  RecordType type = RecordType::kVideo;
+  uint32_t participant_id = 0;
+  int64_t timestamp_us = 0;
+  uint64_t offset = 0;
+};
+
+// Returns the file name of segment |segment_number|, unfinished or not.
+// |out| needs room for 32 characters.
+void SegmentFileName(uint32_t segment_number, bool partial, char* out);
+
+// Size of a record with a |payload_size| payload, including padding.
+inline size_t RecordSize(size_t payload_size) {
+  return (kRecordHeaderSize + payload_size + kRecordAlignment - 1) &
+         ~(kRecordAlignment - 1);
+}
+
+uint32_t Crc32(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+void EncodeSegmentHeader(const SegmentHeader& header, uint8_t* out);
+
+// Returns false if |data| does not start with a segment header of this
+// format version.
+bool DecodeSegmentHeader(const uint8_t* data,
+                         size_t size,
+                         SegmentHeader* header);
+
+// Writes |header| to |out| with the CRC of the header and |payload|, which
+// must be |header.payload_size| bytes.
+void EncodeRecordHeader(const RecordHeader& header,
+                        const uint8_t* payload,
+                        uint8_t* out);
+
+// Reads the record at the start of |data|. Returns false if it is cut off,
+// or its magic or CRC does not match, as for the tail of a segment that
+// was being written when the process died.
+bool DecodeRecord(const uint8_t* data,
+                  size_t size,
+                  RecordHeader* header,
+                  const uint8_t** payload);
+
+void EncodeIndexEntry(const RecordIndexEntry& entry, uint8_t* out);
+void DecodeIndexEntry(const uint8_t* data, RecordIndexEntry* entry);
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_RECORDING_FORMAT_H_
@@ -0,0 +1,296 @@
+#include "recording_reader.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+constexpr char kSegmentPrefix[] = "segment-";
+
+bool HasSuffix(const std::string& value, const char* suffix) {
+  size_t length = strlen(suffix);
+  return value.size() >= length &&
+         value.compare(value.size() - length, length, suffix) == 0;
+}
+
+uint32_t ReadUint32(const uint8_t* data) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    value |= static_cast<uint32_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+void WriteUint16(uint16_t value, uint8_t* out) {
+  out[0] = static_cast<uint8_t>(value);
+  out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void WriteUint32(uint32_t value, uint8_t* out) {
+  for (int i = 0; i < 4; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+// A record selected for extraction.
+struct Selected {
+  int64_t timestamp_us;
+  const uint8_t* data;
+  size_t size;
+};
+
+bool WriteAll(FILE* out, const void* data, size_t size) {
+  return fwrite(data, 1, size, out) == size;
+}
+
+bool WriteVideo(const std::vector<Selected>& frames,
+                uint32_t width,
+                uint32_t height,
+                FILE* out) {
+  // Frame rate estimated from the timestamps, in thousandths.
+  long rate = 30000;
+  if (frames.size() > 1 &&
+      frames.back().timestamp_us > frames.front().timestamp_us) {
+    double seconds =
+        (frames.back().timestamp_us - frames.front().timestamp_us) / 1e6;
+    rate = std::max(1L, std::lround((frames.size() - 1) / seconds * 1000));
+  }
+  char header[96];
+  int length =
+      snprintf(header, sizeof(header),
+               "YUV4MPEG2 W%u H%u F%ld:1000 Ip A1:1 C420jpeg\n", width,
+               height, rate);
+  if (!WriteAll(out, header, length)) {
+    return false;
+  }
+  static const char kFrameHeader[] = "FRAME\n";
+  for (const Selected& frame : frames) {
+    if (!WriteAll(out, kFrameHeader, sizeof(kFrameHeader) - 1) ||
+        !WriteAll(out, frame.data, frame.size)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool WriteAudio(const std::vector<Selected>& blocks,
+                uint32_t sample_rate,
+                uint32_t channels,
+                FILE* out) {
+  uint32_t data_size = 0;
+  for (const Selected& block : blocks) {
+    data_size += static_cast<uint32_t>(block.size);
+  }
+  uint8_t header[44];
+  memcpy(header, "RIFF", 4);
+  WriteUint32(36 + data_size, header + 4);
+  memcpy(header + 8, "WAVEfmt ", 8);
+  WriteUint32(16, header + 16);
+  WriteUint16(1, header + 20);  // PCM
+  WriteUint16(static_cast<uint16_t>(channels), header + 22);
+  WriteUint32(sample_rate, header + 24);
+  WriteUint32(sample_rate * channels * 2, header + 28);
+  WriteUint16(static_cast<uint16_t>(channels * 2), header + 32);
+  WriteUint16(16, header + 34);
+  memcpy(header + 36, "data", 4);
+  WriteUint32(data_size, header + 40);
+  if (!WriteAll(out, header, sizeof(header))) {
+    return false;
+  }
+  for (const Selected& block : blocks) {
+    if (!WriteAll(out, block.data, block.size)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+std::unique_ptr<RecordingSegmentReader> RecordingSegmentReader::Open(
+    const std::string& path,
+    std::string* error) {
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    *error = "open " + path + ": " + strerror(errno);
+    return nullptr;
+  }
+  struct stat info;
+  void* mapping = MAP_FAILED;
+  if (fstat(fd, &info) == 0 &&
+      static_cast<size_t>(info.st_size) >= kSegmentHeaderSize) {
+    mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    *error = path + " is not a recording segment";
+    return nullptr;
+  }
+
+  std::unique_ptr<RecordingSegmentReader> reader(new RecordingSegmentReader(
+      static_cast<const uint8_t*>(mapping), info.st_size));
+  if (!DecodeSegmentHeader(reader->data_, reader->size_, &reader->header_)) {
+    *error = path + " is not a recording segment";
+    return nullptr;
+  }
+  if (reader->header_.index_offset != 0) {
+    if (!reader->LoadIndex(error)) {
+      *error = path + ": " + *error;
+      return nullptr;
+    }
+  } else {
+    reader->ScanRecords();
+  }
+  return reader;
+}
+
+RecordingSegmentReader::RecordingSegmentReader(const uint8_t* data,
+                                               size_t size)
+    : data_(data), size_(size) {}
+
+RecordingSegmentReader::~RecordingSegmentReader() {
+  munmap(const_cast<uint8_t*>(data_), size_);
+}
+
+bool RecordingSegmentReader::Read(const RecordIndexEntry& entry,
+                                  RecordHeader* header,
+                                  const uint8_t** payload) const {
+  return entry.offset >= kSegmentHeaderSize && entry.offset < size_ &&
+         DecodeRecord(data_ + entry.offset, size_ - entry.offset, header,
+                      payload);
+}
+
+bool RecordingSegmentReader::LoadIndex(std::string* error) {
+  uint64_t offset = header_.index_offset;
+  uint64_t count = header_.index_count;
+  if (offset < kSegmentHeaderSize || offset > size_ ||
+      count > (size_ - offset) / kIndexEntrySize) {
+    *error = "index out of bounds";
+    return false;
+  }
+  index_.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    DecodeIndexEntry(data_ + offset + i * kIndexEntrySize, &index_[i]);
+  }
+  finished_ = true;
+  return true;
+}
+
+void RecordingSegmentReader::ScanRecords() {
+  size_t offset = kSegmentHeaderSize;
+  RecordHeader header;
+  const uint8_t* payload;
+  while (offset < size_ &&
+         DecodeRecord(data_ + offset, size_ - offset, &header, &payload)) {
+    RecordIndexEntry entry;
+    entry.type = header.type;
+    entry.participant_id = header.participant_id;
+    entry.timestamp_us = header.timestamp_us;
+    entry.offset = offset;
+    index_.push_back(entry);
+    offset += RecordSize(header.payload_size);
+  }
+}
+
+std::vector<std::string> ListRecordingSegments(const std::string& directory) {
+  std::vector<std::string> names;
+  DIR* dir = opendir(directory.c_str());
+  if (dir == nullptr) {
+    return names;
+  }
+  while (struct dirent* entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    if (name.compare(0, strlen(kSegmentPrefix), kSegmentPrefix) == 0 &&
+        (HasSuffix(name, kSegmentSuffix) ||
+         HasSuffix(name, kPartialSegmentSuffix))) {
+      names.push_back(name);
+    }
+  }
+  closedir(dir);
+  // Segment numbers are zero-padded, so names sort in recording order.
+  std::sort(names.begin(), names.end());
+  for (std::string& name : names) {
+    name = directory + "/" + name;
+  }
+  return names;
+}
+
+bool ExtractRecording(const std::string& directory,
+                      const RecordingExtractOptions& options,
+                      FILE* out,
+                      RecordingExtractResult* result,
+                      std::string* error) {
+  *result = RecordingExtractResult();
+  std::vector<std::unique_ptr<RecordingSegmentReader>> segments;
+  std::vector<Selected> selected;
+  // Frame size or audio format of the first record selected.
+  uint32_t format[2] = {0, 0};
+
+  for (const std::string& path : ListRecordingSegments(directory)) {
+    std::string segment_error;
+    std::unique_ptr<RecordingSegmentReader> segment =
+        RecordingSegmentReader::Open(path, &segment_error);
+    if (segment == nullptr) {
+      ++result->unreadable_segments;
+      continue;
+    }
+    if (!segment->finished()) {
+      ++result->partial_segments;
+    }
+    for (const RecordIndexEntry& entry : segment->index()) {
+      if (entry.participant_id != options.participant_id ||
+          entry.type != options.type || entry.timestamp_us < options.start_us ||
+          entry.timestamp_us >= options.end_us) {
+        continue;
+      }
+      RecordHeader header;
+      const uint8_t* payload;
+      if (!segment->Read(entry, &header, &payload) ||
+          header.payload_size < kVideoPayloadHeaderSize) {
+        ++result->skipped;
+        continue;
+      }
+      uint32_t record_format[2] = {ReadUint32(payload),
+                                   ReadUint32(payload + 4)};
+      if (selected.empty()) {
+        format[0] = record_format[0];
+        format[1] = record_format[1];
+      } else if (record_format[0] != format[0] ||
+                 record_format[1] != format[1]) {
+        ++result->skipped;
+        continue;
+      }
+      // Both payload headers are the same size.
+      selected.push_back({entry.timestamp_us,
+                          payload + kVideoPayloadHeaderSize,
+                          header.payload_size - kVideoPayloadHeaderSize});
+    }
+    segments.push_back(std::move(segment));
+  }
+
+  if (selected.empty()) {
+    *error = "no matching records";
+    return false;
+  }
+  bool written = options.type == RecordType::kVideo
+                     ? WriteVideo(selected, format[0], format[1], out)
+                     : WriteAudio(selected, format[0], format[1], out);
+  if (!written || fflush(out) != 0) {
+    *error = std::string("write failed: ") + strerror(errno);
+    return false;
+  }
+  result->records = selected.size();
+  return true;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
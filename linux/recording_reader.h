@@ -0,0 +1,95 @@
+#ifndef FLUTTER_PLUGIN_RECORDING_READER_H_
+#define FLUTTER_PLUGIN_RECORDING_READER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "recording_format.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Read-only view of one segment of a recording written by RecordingWriter.
+//
+// A finished segment is read through its index. An unfinished one, left
+// by a crash, has no index; its records are recovered by scanning up to
+// the first one that is cut off or fails its CRC.
+class RecordingSegmentReader {
+ public:
+  // Returns nullptr, with the reason in |error|, if |path| is not a
+  // segment.
+  static std::unique_ptr<RecordingSegmentReader> Open(const std::string& path,
+                                                      std::string* error);
+
+  ~RecordingSegmentReader();
+
+  RecordingSegmentReader(const RecordingSegmentReader&) = delete;
+  RecordingSegmentReader& operator=(const RecordingSegmentReader&) = delete;
+
+  const SegmentHeader& header() const { return header_; }
+
+  // False if the records were recovered by scanning.
+  bool finished() const { return finished_; }
+
+  // Every record in the segment, in the order written.
+  const std::vector<RecordIndexEntry>& index() const { return index_; }
+
+  // Reads and verifies the record at |entry|. |payload| points into the
+  // segment and stays valid as long as the reader.
+  bool Read(const RecordIndexEntry& entry,
+            RecordHeader* header,
+            const uint8_t** payload) const;
+
+ private:
+  RecordingSegmentReader(const uint8_t* data, size_t size);
+
+  bool LoadIndex(std::string* error);
+  void ScanRecords();
+
+  const uint8_t* const data_;
+  const size_t size_;
+  SegmentHeader header_;
+  bool finished_ = false;
+  std::vector<RecordIndexEntry> index_;
+};
+
+// Returns the segment files of the recording in |directory|, finished or
+// not, in recording order.
+std::vector<std::string> ListRecordingSegments(const std::string& directory);
+
+struct RecordingExtractOptions {
+  uint32_t participant_id = 0;
+  RecordType type = RecordType::kAudio;
+  // Microseconds since the recording started; records in [start, end) are
+  // extracted.
+  int64_t start_us = 0;
+  int64_t end_us = std::numeric_limits<int64_t>::max();
+};
+
+struct RecordingExtractResult {
+  size_t records = 0;
+  // Records of the stream that were skipped because their frame size or
+  // audio format differs from the first one extracted.
+  size_t skipped = 0;
+  // Segments that were unfinished, or could not be read at all.
+  size_t partial_segments = 0;
+  size_t unreadable_segments = 0;
+};
+
+// Writes one participant's video or audio between two times to |out|:
+// video as a YUV4MPEG2 stream, audio as a WAV file. Returns false, with the
+// reason in |error|, if the recording has no such records or |out| cannot
+// be written.
+bool ExtractRecording(const std::string& directory,
+                      const RecordingExtractOptions& options,
+                      FILE* out,
+                      RecordingExtractResult* result,
+                      std::string* error);
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_RECORDING_READER_H_
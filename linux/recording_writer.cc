@@ -0,0 +1,388 @@
+#include "recording_writer.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+#include "monotonic_clock.h"
+#include "trace.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+// How long the idle writer thread sleeps between checks of the queue.
+constexpr auto kIdleWait = std::chrono::milliseconds(20);
+
+int64_t UnixNowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+std::string SegmentPath(const std::string& directory,
+                        uint32_t segment_number,
+                        bool partial) {
+  char name[32];
+  SegmentFileName(segment_number, partial, name);
+  return directory + "/" + name;
+}
+
+std::string ErrnoMessage(const char* operation, const std::string& path) {
+  return std::string(operation) + " " + path + ": " + strerror(errno);
+}
+
+size_t VideoPayloadSize(const VideoFrame& frame) {
+  return kVideoPayloadHeaderSize +
+         static_cast<size_t>(frame.width()) * frame.height() +
+         2 * static_cast<size_t>(frame.chroma_width()) * frame.chroma_height();
+}
+
+void WriteUint32(uint32_t value, uint8_t* out) {
+  for (int i = 0; i < 4; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+// Copies |height| rows of |width| bytes to |out|, tightly packed. Returns
+// the end of the copy.
+uint8_t* CopyPlane(const uint8_t* plane,
+                   int stride,
+                   int width,
+                   int height,
+                   uint8_t* out) {
+  for (int row = 0; row < height; ++row) {
+    memcpy(out, plane + static_cast<size_t>(row) * stride, width);
+    out += width;
+  }
+  return out;
+}
+
+}  // namespace
+
+std::unique_ptr<RecordingWriter> RecordingWriter::Create(
+    const std::string& directory,
+    const Config& config,
+    std::string* error) {
+  if (config.segment_bytes <= kSegmentHeaderSize + kRecordHeaderSize +
+                                  kIndexEntrySize ||
+      config.queue_capacity == 0 || config.batch_size == 0) {
+    *error = "invalid recording config";
+    return nullptr;
+  }
+  if (mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST) {
+    *error = ErrnoMessage("mkdir", directory);
+    return nullptr;
+  }
+  std::unique_ptr<RecordingWriter> writer(
+      new RecordingWriter(directory, config));
+  if (!writer->OpenSegment(error)) {
+    return nullptr;
+  }
+  writer->thread_ = std::thread(&RecordingWriter::Run, writer.get());
+  return writer;
+}
+
+RecordingWriter::RecordingWriter(const std::string& directory,
+                                 const Config& config)
+    : directory_(directory),
+      config_(config),
+      start_us_(MonotonicNowUs()),
+      start_unix_us_(UnixNowUs()),
+      queue_(config.queue_capacity) {}
+
+RecordingWriter::~RecordingWriter() {
+  if (thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+  } else {
+    CloseSegment();
+  }
+}
+
+RecordingWriter::Stats RecordingWriter::GetStats() const {
+  Stats stats;
+  stats.records_written = records_written_.load(std::memory_order_relaxed);
+  stats.records_dropped = records_dropped_.load(std::memory_order_relaxed);
+  stats.bytes_written = bytes_written_.load(std::memory_order_relaxed);
+  stats.segments_finished =
+      segments_finished_.load(std::memory_order_relaxed);
+  stats.failed = failed_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void RecordingWriter::OnVideoFrame(uint32_t participant_id,
+                                   std::shared_ptr<const VideoFrame> frame) {
+  Pending record;
+  record.type = RecordType::kVideo;
+  record.participant_id = participant_id;
+  record.timestamp_us =
+      frame->timestamp_us() != 0 ? frame->timestamp_us() : MonotonicNowUs();
+  record.frame = std::move(frame);
+  Enqueue(std::move(record));
+}
+
+void RecordingWriter::OnAudioData(uint32_t participant_id,
+                                  const int16_t* samples,
+                                  size_t frames,
+                                  int sample_rate,
+                                  int channels) {
+  Pending record;
+  record.type = RecordType::kAudio;
+  record.participant_id = participant_id;
+  record.timestamp_us = MonotonicNowUs();
+  record.samples.assign(samples, samples + frames * channels);
+  record.sample_rate = sample_rate;
+  record.channels = channels;
+  Enqueue(std::move(record));
+}
+
+void RecordingWriter::Enqueue(Pending record) {
+  if (failed_.load(std::memory_order_relaxed) ||
+      !queue_.TryPush(std::move(record))) {
+    records_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  // A wakeup lost to the writer going to sleep only delays the batch by
+  // kIdleWait.
+  if (queue_.SizeApprox() >= config_.batch_size) {
+    wake_.notify_one();
+  }
+}
+
+void RecordingWriter::Run() {
+  Pending record;
+  for (;;) {
+    size_t written = 0;
+    while (written < config_.batch_size && queue_.TryPop(&record)) {
+      Write(record);
+      // Hands a borrowed frame back to its producer right away.
+      record = Pending();
+      ++written;
+    }
+    if (written > 0) {
+      RequestWriteBack();
+      if (written == config_.batch_size) {
+        continue;
+      }
+    }
+
+    std::unique_lock<std::mutex> lock(wake_mutex_);
+    if (stopping_ && queue_.SizeApprox() == 0) {
+      break;
+    }
+    wake_.wait_for(lock, kIdleWait, [this] {
+      return stopping_ || queue_.SizeApprox() >= config_.batch_size;
+    });
+  }
+
+  if (segment_ != nullptr && !segment_index_.empty()) {
+    FinishSegment();
+  } else if (segment_ != nullptr) {
+    // Nothing was recorded since the last segment, so leave no empty one.
+    CloseSegment();
+    unlink(SegmentPath(directory_, segment_number_, true).c_str());
+  }
+}
+
+bool RecordingWriter::OpenSegment(std::string* error) {
+  std::string path = SegmentPath(directory_, segment_number_, true);
+  segment_fd_ =
+      open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (segment_fd_ < 0) {
+    *error = ErrnoMessage("open", path);
+    return false;
+  }
+  // Allocating the whole segment up front keeps the writer from extending
+  // the file, and its blocks, record by record.
+  off_t size = static_cast<off_t>(config_.segment_bytes);
+  int result = posix_fallocate(segment_fd_, 0, size);
+  if (result != 0 && ftruncate(segment_fd_, size) != 0) {
+    errno = result;
+    *error = ErrnoMessage("allocate", path);
+    CloseSegment();
+    return false;
+  }
+  void* mapping = mmap(nullptr, config_.segment_bytes, PROT_READ | PROT_WRITE,
+                       MAP_SHARED, segment_fd_, 0);
+  if (mapping == MAP_FAILED) {
+    *error = ErrnoMessage("mmap", path);
+    CloseSegment();
+    return false;
+  }
+  segment_ = static_cast<uint8_t*>(mapping);
+  MemoryAccounting::Charge(MemoryCategory::kRecording,
+                           static_cast<int64_t>(config_.segment_bytes));
+  madvise(segment_, config_.segment_bytes, MADV_SEQUENTIAL);
+
+  segment_header_ = SegmentHeader();
+  segment_header_.segment_number = segment_number_;
+  segment_header_.recording_start_unix_us = start_unix_us_;
+  EncodeSegmentHeader(segment_header_, segment_);
+  segment_offset_ = kSegmentHeaderSize;
+  written_back_offset_ = 0;
+  segment_index_.clear();
+  return true;
+}
+
+void RecordingWriter::Write(const Pending& record) {
+  ZOOM_TRACE_SCOPE("recording", "write_record");
+  if (failed_.load(std::memory_order_relaxed)) {
+    records_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  size_t payload_size =
+      record.type == RecordType::kVideo
+          ? VideoPayloadSize(*record.frame)
+          : kAudioPayloadHeaderSize + record.samples.size() * sizeof(int16_t);
+  size_t record_size = RecordSize(payload_size);
+  int64_t timestamp_us = record.timestamp_us > start_us_
+                             ? record.timestamp_us - start_us_
+                             : 0;
+
+  // Room for the record and for its index entry.
+  auto fits = [&] {
+    return segment_offset_ + record_size +
+               (segment_index_.size() + 1) * kIndexEntrySize <=
+           config_.segment_bytes;
+  };
+  if (segment_ != nullptr && !segment_index_.empty() &&
+      (!fits() || timestamp_us - segment_header_.first_timestamp_us >=
+                      config_.segment_duration_us)) {
+    if (!FinishSegment()) {
+      records_dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+  if (segment_ == nullptr) {
+    std::string error;
+    if (!OpenSegment(&error)) {
+      Fail();
+      records_dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+  if (!fits()) {
+    // Larger than a whole segment.
+    records_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  uint8_t* out = segment_ + segment_offset_;
+  uint8_t* payload = out + kRecordHeaderSize;
+  if (record.type == RecordType::kVideo) {
+    const VideoFrame& frame = *record.frame;
+    WriteUint32(static_cast<uint32_t>(frame.width()), payload);
+    WriteUint32(static_cast<uint32_t>(frame.height()), payload + 4);
+    uint8_t* plane = payload + kVideoPayloadHeaderSize;
+    plane = CopyPlane(frame.data_y(), frame.stride_y(), frame.width(),
+                      frame.height(), plane);
+    plane = CopyPlane(frame.data_u(), frame.stride_u(), frame.chroma_width(),
+                      frame.chroma_height(), plane);
+    CopyPlane(frame.data_v(), frame.stride_v(), frame.chroma_width(),
+              frame.chroma_height(), plane);
+  } else {
+    WriteUint32(static_cast<uint32_t>(record.sample_rate), payload);
+    WriteUint32(static_cast<uint32_t>(record.channels), payload + 4);
+    memcpy(payload + kAudioPayloadHeaderSize, record.samples.data(),
+           record.samples.size() * sizeof(int16_t));
+  }
+
+  RecordHeader header;
+  header.type = record.type;
+  header.participant_id = record.participant_id;
+  header.payload_size = static_cast<uint32_t>(payload_size);
+  header.timestamp_us = timestamp_us;
+  EncodeRecordHeader(header, payload, out);
+
+  RecordIndexEntry entry;
+  entry.type = record.type;
+  entry.participant_id = record.participant_id;
+  entry.timestamp_us = timestamp_us;
+  entry.offset = segment_offset_;
+  if (segment_index_.empty()) {
+    segment_header_.first_timestamp_us = timestamp_us;
+  }
+  segment_header_.last_timestamp_us = timestamp_us;
+  segment_index_.push_back(entry);
+  segment_offset_ += record_size;
+  records_written_.fetch_add(1, std::memory_order_relaxed);
+  bytes_written_.fetch_add(record_size, std::memory_order_relaxed);
+}
+
+void RecordingWriter::RequestWriteBack() {
+  if (segment_ == nullptr || segment_offset_ <= written_back_offset_) {
+    return;
+  }
+  // Starts write-back of the batch without waiting for it; msync needs a
+  // page-aligned start.
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t start = written_back_offset_ & ~(page_size - 1);
+  msync(segment_ + start, segment_offset_ - start, MS_ASYNC);
+  written_back_offset_ = segment_offset_;
+}
+
+bool RecordingWriter::FinishSegment() {
+  ZOOM_TRACE_SCOPE("recording", "finish_segment");
+  uint8_t* index = segment_ + segment_offset_;
+  for (size_t i = 0; i < segment_index_.size(); ++i) {
+    EncodeIndexEntry(segment_index_[i], index + i * kIndexEntrySize);
+  }
+  segment_header_.index_offset = segment_offset_;
+  segment_header_.index_count = static_cast<uint32_t>(segment_index_.size());
+  EncodeSegmentHeader(segment_header_, segment_);
+  size_t used = segment_offset_ + segment_index_.size() * kIndexEntrySize;
+
+  // The segment is durable, at its final size, before it is renamed, so a
+  // finished name always means a complete segment.
+  std::string partial_path = SegmentPath(directory_, segment_number_, true);
+  std::string path = SegmentPath(directory_, segment_number_, false);
+  bool ok = msync(segment_, used, MS_SYNC) == 0 &&
+            ftruncate(segment_fd_, static_cast<off_t>(used)) == 0 &&
+            fdatasync(segment_fd_) == 0;
+  CloseSegment();
+  if (!ok || rename(partial_path.c_str(), path.c_str()) != 0) {
+    Fail();
+    return false;
+  }
+  int directory_fd = open(directory_.c_str(), O_RDONLY | O_CLOEXEC);
+  if (directory_fd >= 0) {
+    fsync(directory_fd);
+    close(directory_fd);
+  }
+
+  ++segment_number_;
+  segments_finished_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void RecordingWriter::CloseSegment() {
+  if (segment_ != nullptr) {
+    munmap(segment_, config_.segment_bytes);
+    segment_ = nullptr;
+    MemoryAccounting::Charge(MemoryCategory::kRecording,
+                             -static_cast<int64_t>(config_.segment_bytes));
+  }
+  if (segment_fd_ >= 0) {
+    close(segment_fd_);
+    segment_fd_ = -1;
+  }
+}
+
+void RecordingWriter::Fail() {
+  CloseSegment();
+  failed_.store(true, std::memory_order_relaxed);
+}
+
+}  // namespace flutter_zoom_meeting_sdk
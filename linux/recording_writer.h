@@ -0,0 +1,142 @@
+#ifndef FLUTTER_PLUGIN_RECORDING_WRITER_H_
+#define FLUTTER_PLUGIN_RECORDING_WRITER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "meeting_backend.h"
+#include "memory_accounting.h"
+#include "mpsc_ring_buffer.h"
+#include "recording_format.h"
+#include "video_frame.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Streams raw participant video and audio into a segmented recording (see
+// recording_format.h) without holding up the threads that deliver it.
+//
+// The sink callbacks only queue the frame or PCM block; a writer thread
+// copies queued records into the current segment, which is a pre-sized,
+// memory-mapped file, and asks for write-back once per batch. A segment is
+// finished, with its index, when the next record would not fit or when it
+// is older than Config::segment_duration_us. Records that arrive while the
+// queue is full are dropped and counted rather than waited for.
+class RecordingWriter : public MeetingBackend::VideoSink,
+                        public MeetingBackend::AudioSink {
+ public:
+  struct Config {
+    // Size each segment file is allocated at. A record larger than a whole
+    // segment is dropped.
+    size_t segment_bytes = 64 << 20;
+    // Age, from its first record, at which a segment is finished.
+    int64_t segment_duration_us = 60 * 1000000LL;
+    // Records waiting for the writer thread before new ones are dropped.
+    size_t queue_capacity = 512;
+    // Records written between write-back requests.
+    size_t batch_size = 32;
+  };
+
+  struct Stats {
+    uint64_t records_written = 0;
+    uint64_t records_dropped = 0;
+    // Record bytes written, including headers and padding.
+    uint64_t bytes_written = 0;
+    uint32_t segments_finished = 0;
+    // Set once a file operation fails; nothing is written after that.
+    bool failed = false;
+  };
+
+  // Creates |directory| if needed, opens the first segment and starts the
+  // writer thread. Returns nullptr, with the reason in |error|, if the
+  // segment cannot be created.
+  static std::unique_ptr<RecordingWriter> Create(const std::string& directory,
+                                                 const Config& config,
+                                                 std::string* error);
+
+  // Writes the queued records and finishes the current segment. The
+  // writer must no longer be subscribed to any video or audio.
+  ~RecordingWriter() override;
+
+  RecordingWriter(const RecordingWriter&) = delete;
+  RecordingWriter& operator=(const RecordingWriter&) = delete;
+
+  Stats GetStats() const;
+
+  // MeetingBackend::VideoSink:
+  void OnVideoFrame(uint32_t participant_id,
+                    std::shared_ptr<const VideoFrame> frame) override;
+
+  // MeetingBackend::AudioSink:
+  void OnAudioData(uint32_t participant_id,
+                   const int16_t* samples,
+                   size_t frames,
+                   int sample_rate,
+                   int channels) override;
+
+ private:
+  // A record waiting for the writer thread.
+  struct Pending {
+    RecordType type = RecordType::kVideo;
+    uint32_t participant_id = 0;
+    // Monotonic clock.
+    int64_t timestamp_us = 0;
+    std::shared_ptr<const VideoFrame> frame;
+    TrackedVector<int16_t, MemoryCategory::kRecording> samples;
+    int sample_rate = 0;
+    int channels = 0;
+  };
+
+  RecordingWriter(const std::string& directory, const Config& config);
+
+  void Enqueue(Pending record);
+  void Run();
+
+  // Writer thread only, apart from the first segment opened by Create().
+  bool OpenSegment(std::string* error);
+  void Write(const Pending& record);
+  void RequestWriteBack();
+  // Writes the index, flushes the segment and gives it its final name.
+  bool FinishSegment();
+  // Unmaps and closes the current segment.
+  void CloseSegment();
+  void Fail();
+
+  const std::string directory_;
+  const Config config_;
+  const int64_t start_us_;
+  const int64_t start_unix_us_;
+
+  MpscRingBuffer<Pending> queue_;
+
+  std::mutex wake_mutex_;
+  std::condition_variable wake_;
+  bool stopping_ = false;
+
+  // Owned by the writer thread.
+  int segment_fd_ = -1;
+  uint8_t* segment_ = nullptr;
+  uint32_t segment_number_ = 0;
+  size_t segment_offset_ = 0;
+  size_t written_back_offset_ = 0;
+  SegmentHeader segment_header_;
+  std::vector<RecordIndexEntry> segment_index_;
+
+  std::atomic<uint64_t> records_written_{0};
+  std::atomic<uint64_t> records_dropped_{0};
+  std::atomic<uint64_t> bytes_written_{0};
+  std::atomic<uint32_t> segments_finished_{0};
+  std::atomic<bool> failed_{false};
+
+  std::thread thread_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_RECORDING_WRITER_H_
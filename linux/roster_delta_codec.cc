@@ -0,0 +1,103 @@
+#include "roster_delta_codec.h"
+
+#include <utility>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+void WriteUint32(uint32_t value, uint8_t* out) {
+  for (int i = 0; i < 4; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+void WriteUint64(uint64_t value, uint8_t* out) {
+  for (int i = 0; i < 8; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+uint32_t ReadUint32(const uint8_t* data) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    value |= static_cast<uint32_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+uint64_t ReadUint64(const uint8_t* data) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; ++i) {
+    value |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+size_t PaddedNameSize(size_t length) {
+  return (length + 3) & ~static_cast<size_t>(3);
+}
+
+}  // namespace
+
+size_t EncodedRosterDeltaSize(const RosterDelta& delta) {
+  return kRosterDeltaHeaderSize + PaddedNameSize(delta.display_name.size());
+}
+
+void EncodeRosterDeltas(const std::vector<RosterDelta>& deltas,
+                        std::vector<uint8_t>* out) {
+  size_t size = out->size();
+  for (const RosterDelta& delta : deltas) {
+    size += EncodedRosterDeltaSize(delta);
+  }
+  size_t offset = out->size();
+  out->resize(size, 0);
+  for (const RosterDelta& delta : deltas) {
+    uint8_t* record = out->data() + offset;
+    WriteUint64(delta.sequence, record);
+    WriteUint32(delta.session_id, record + 8);
+    WriteUint32(delta.slot, record + 12);
+    WriteUint32(delta.participant_id, record + 16);
+    record[20] = static_cast<uint8_t>(delta.type);
+    record[21] = delta.changes;
+    record[22] = delta.state;
+    WriteUint32(static_cast<uint32_t>(delta.display_name.size()), record + 24);
+    delta.display_name.copy(reinterpret_cast<char*>(record) +
+                                kRosterDeltaHeaderSize,
+                            delta.display_name.size());
+    offset += EncodedRosterDeltaSize(delta);
+  }
+}
+
+bool DecodeRosterDeltas(const uint8_t* data,
+                        size_t size,
+                        std::vector<RosterDelta>* deltas) {
+  size_t offset = 0;
+  while (offset < size) {
+    if (size - offset < kRosterDeltaHeaderSize) {
+      return false;
+    }
+    const uint8_t* record = data + offset;
+    size_t name_length = ReadUint32(record + 24);
+    if (size - offset - kRosterDeltaHeaderSize <
+        PaddedNameSize(name_length)) {
+      return false;
+    }
+    RosterDelta delta;
+    delta.sequence = ReadUint64(record);
+    delta.session_id = ReadUint32(record + 8);
+    delta.slot = ReadUint32(record + 12);
+    delta.participant_id = ReadUint32(record + 16);
+    delta.type = static_cast<RosterDeltaType>(record[20]);
+    delta.changes = record[21];
+    delta.state = record[22];
+    delta.display_name.assign(
+        reinterpret_cast<const char*>(record) + kRosterDeltaHeaderSize,
+        name_length);
+    deltas->push_back(std::move(delta));
+    offset += kRosterDeltaHeaderSize + PaddedNameSize(name_length);
+  }
+  return true;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,79 @@
+#ifndef FLUTTER_PLUGIN_ROSTER_DELTA_CODEC_H_
+#define FLUTTER_PLUGIN_ROSTER_DELTA_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+
+enum class RosterDeltaType : uint8_t {
+  kJoined = 0,
+  kLeft = 1,
+  kChanged = 2,
+  // Every participant of the session is gone; the meeting ended.
+  kSessionEnded = 3,
+};
+
+// Bits of RosterDelta::state.
+constexpr uint8_t kRosterAudioMuted = 1 << 0;
+constexpr uint8_t kRosterVideoOn = 1 << 1;
+constexpr uint8_t kRosterHandRaised = 1 << 2;
+
+// Bits of RosterDelta::changes, set on kChanged deltas.
+constexpr uint8_t kRosterNameChanged = 1 << 0;
+constexpr uint8_t kRosterAudioChanged = 1 << 1;
+constexpr uint8_t kRosterVideoChanged = 1 << 2;
+constexpr uint8_t kRosterHandChanged = 1 << 3;
+
+// One change to the participant roster, see ParticipantRoster.
+struct RosterDelta {
+  // Increases by one for every delta of the roster.
+  uint64_t sequence = 0;
+  RosterDeltaType type = RosterDeltaType::kJoined;
+  uint8_t changes = 0;
+  // The participant's state after the change.
+  uint8_t state = 0;
+  // Session of the participant's meeting (see MeetingSessionManager).
+  uint32_t session_id = 0;
+  // The participant's roster slot, fixed while it is present and reused
+  // only after a kLeft or kSessionEnded delta for it.
+  uint32_t slot = 0;
+  uint32_t participant_id = 0;
+  // Set on kJoined, and on kChanged with kRosterNameChanged.
+  std::string display_name;
+};
+
+// Size of an encoded delta before its name. The little-endian layout is:
+//
+//   0  uint64  sequence
+//   8  uint32  session ID
+//   12 uint32  slot
+//   16 uint32  participant ID
+//   20 uint8   type
+//   21 uint8   changes
+//   22 uint8   state
+//   23 uint8   reserved, 0
+//   24 uint32  name length in bytes
+//   28         UTF-8 name, zero-padded to a multiple of 4 bytes
+//
+// RosterDelta.decodeAll in lib/flutter_zoom_meeting_sdk_roster.dart reads
+// the same layout.
+constexpr size_t kRosterDeltaHeaderSize = 28;
+
+// Size of |delta| once encoded.
+size_t EncodedRosterDeltaSize(const RosterDelta& delta);
+
+// Appends |deltas|, in order, to |out|.
+void EncodeRosterDeltas(const std::vector<RosterDelta>& deltas,
+                        std::vector<uint8_t>* out);
+
+// Reads every delta in |data|. Returns false if a record is cut off.
+bool DecodeRosterDeltas(const uint8_t* data,
+                        size_t size,
+                        std::vector<RosterDelta>* deltas);
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_ROSTER_DELTA_CODEC_H_
@@ -0,0 +1,410 @@
+#include "simulated_meeting_backend.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "trace.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+struct SimulatedMeetingBackend::Meeting {
+  Meeting(const MeetingScenario& scenario,
+          const std::string& meeting_id,
+          uint32_t first_participant_id)
+      : meeting_id(meeting_id),
+        timeline(scenario, meeting_id, first_participant_id),
+        start(std::chrono::steady_clock::now()) {}
+
+  const std::string meeting_id;
+  // Played by the joining worker until the join completes, then by
+  // |thread|.
+  ScenarioTimeline timeline;
+  const std::chrono::steady_clock::time_point start;
+
+  std::mutex mutex;
+  std::condition_variable stop_requested;
+  // Guarded by |mutex|. Once set no further event is applied.
+  bool stopping = false;
+  // Guarded by |mutex|. Set when the scenario ended the meeting.
+  bool ended = false;
+  // Guarded by |mutex|.
+  std::vector<uint32_t> participants;
+  std::thread thread;
+};
+
+SimulatedMeetingBackend::SimulatedMeetingBackend(
+    const MeetingScenario& scenario)
+    : scenario_(scenario) {}
+
+SimulatedMeetingBackend::~SimulatedMeetingBackend() {
+  // Meeting threads use the roster and media members, so stop them before
+  // those are destroyed.
+  std::map<std::string, std::shared_ptr<Meeting>> meetings;
+  {
+    std::lock_guard<std::mutex> lock(meetings_mutex_);
+    meetings.swap(meetings_);
+  }
+  for (const auto& entry : meetings) {
+    StopMeeting(entry.second, false);
+  }
+  StopRawAudio();
+}
+
+InitResult SimulatedMeetingBackend::Initialize(const InitParams& params) {
+  ZOOM_TRACE_SCOPE("backend", "Initialize");
+  InitResult result;
+  std::lock_guard<std::mutex> lock(init_mutex_);
+  if (initialized_) {
+    return result;
+  }
+  if (params.domain.empty()) {
+    result.error_code = kZoomErrorInvalidArguments;
+    return result;
+  }
+
+  std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(
+      scenario_.init_delay_ms / scenario_.speed));
+  initialized_ = true;
+  return result;
+}
+
+bool SimulatedMeetingBackend::IsInitialized() const {
+  return initialized_;
+}
+
+bool SimulatedMeetingBackend::JoinMeeting(const MeetingOptions& options) {
+  return EnterMeeting(options);
+}
+
+bool SimulatedMeetingBackend::StartMeeting(const MeetingOptions& options) {
+  if (options.zoom_access_token.empty()) {
+    return false;
+  }
+  return EnterMeeting(options);
+}
+
+bool SimulatedMeetingBackend::LeaveMeeting(const std::string& meeting_id) {
+  std::shared_ptr<Meeting> meeting;
+  {
+    std::lock_guard<std::mutex> lock(meetings_mutex_);
+    auto it = meetings_.find(meeting_id);
+    if (it == meetings_.end()) {
+      return false;
+    }
+    meeting = std::move(it->second);
+    meetings_.erase(it);
+  }
+  bool ended;
+  {
+    std::lock_guard<std::mutex> lock(meeting->mutex);
+    ended = meeting->ended;
+  }
+  StopMeeting(meeting, true);
+  // A meeting the scenario already ended cannot be left.
+  return !ended;
+}
+
+MeetingStatus SimulatedMeetingBackend::GetMeetingStatus() const {
+  return status_;
+}
+
+void SimulatedMeetingBackend::SetObserver(Observer* observer) {
+  std::lock_guard<std::mutex> lock(observer_mutex_);
+  observer_ = observer;
+}
+
+bool SimulatedMeetingBackend::SubscribeVideo(uint32_t participant_id,
+                                             VideoSink* sink) {
+  if (!initialized_ || sink == nullptr) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(roster_mutex_);
+    auto it = has_video_.find(participant_id);
+    if (it == has_video_.end() || !it->second) {
+      return false;
+    }
+  }
+  SyntheticVideoSource::Config config;
+  config.width = scenario_.video_width;
+  config.height = scenario_.video_height;
+  config.frames_per_second = scenario_.video_fps;
+  auto source =
+      std::make_unique<SyntheticVideoSource>(participant_id, config, sink);
+  {
+    std::lock_guard<std::mutex> lock(video_mutex_);
+    video_sources_[participant_id].swap(source);
+  }
+  // |source| now holds the replaced subscription, if any, and is stopped
+  // outside the lock.
+  return true;
+}
+
+void SimulatedMeetingBackend::UnsubscribeVideo(uint32_t participant_id) {
+  std::unique_ptr<SyntheticVideoSource> source;
+  {
+    std::lock_guard<std::mutex> lock(video_mutex_);
+    auto it = video_sources_.find(participant_id);
+    if (it == video_sources_.end()) {
+      return;
+    }
+    source = std::move(it->second);
+    video_sources_.erase(it);
+  }
+  // Destroying the source joins its thread.
+}
+
+bool SimulatedMeetingBackend::StartRawAudio(AudioSink* sink) {
+  if (!initialized_ || sink == nullptr) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(audio_mutex_);
+  // Stop the previous source before its sink is replaced.
+  audio_source_.reset();
+  audio_sink_ = sink;
+  RefreshAudioLocked();
+  return true;
+}
+
+void SimulatedMeetingBackend::StopRawAudio() {
+  std::unique_ptr<SyntheticAudioSource> source;
+  {
+    std::lock_guard<std::mutex> lock(audio_mutex_);
+    audio_sink_ = nullptr;
+    audio_speakers_.clear();
+    source = std::move(audio_source_);
+  }
+  // Destroying the source joins its thread. No new source can start now
+  // that the sink is cleared.
+}
+
+std::vector<uint32_t> SimulatedMeetingBackend::GetParticipants() const {
+  std::lock_guard<std::mutex> lock(roster_mutex_);
+  return participants_;
+}
+
+bool SimulatedMeetingBackend::EnterMeeting(const MeetingOptions& options) {
+  ZOOM_TRACE_SCOPE("backend", "EnterMeeting");
+  if (!initialized_ || options.meeting_id.empty()) {
+    return false;
+  }
+
+  std::shared_ptr<Meeting> ended_meeting;
+  std::shared_ptr<Meeting> meeting;
+  {
+    std::lock_guard<std::mutex> lock(meetings_mutex_);
+    auto it = meetings_.find(options.meeting_id);
+    if (it != meetings_.end()) {
+      std::lock_guard<std::mutex> meeting_lock(it->second->mutex);
+      if (!it->second->ended) {
+        return false;
+      }
+      // Ended by the scenario and never left; replace it.
+      ended_meeting = std::move(it->second);
+    }
+    uint32_t first_participant_id =
+        kFirstParticipantId + meetings_started_++ * kParticipantIdsPerMeeting;
+    meeting = std::make_shared<Meeting>(scenario_, options.meeting_id,
+                                        first_participant_id);
+    meetings_[options.meeting_id] = meeting;
+  }
+  if (ended_meeting != nullptr) {
+    StopMeeting(ended_meeting, false);
+  }
+
+  // The join is played here; a LeaveMeeting() meanwhile ends the wait.
+  ScenarioEvent event;
+  while (meeting->timeline.Next(&event)) {
+    if (!WaitFor(meeting.get(), event)) {
+      return true;
+    }
+    Apply(meeting.get(), event);
+    if (event.type == ScenarioEvent::Type::kStatus &&
+        (event.status == MeetingStatus::kInMeeting ||
+         event.status == MeetingStatus::kFailed)) {
+      break;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(meeting->mutex);
+  if (!meeting->stopping && !meeting->ended) {
+    meeting->thread = std::thread(&SimulatedMeetingBackend::Play, this,
+                                  meeting.get());
+  }
+  return true;
+}
+
+void SimulatedMeetingBackend::Play(Meeting* meeting) {
+  ScenarioEvent event;
+  while (meeting->timeline.Next(&event)) {
+    if (!WaitFor(meeting, event)) {
+      return;
+    }
+    Apply(meeting, event);
+  }
+}
+
+bool SimulatedMeetingBackend::WaitFor(Meeting* meeting,
+                                      const ScenarioEvent& event) {
+  auto due = meeting->start +
+             std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                 std::chrono::duration<double, std::milli>(event.at_ms /
+                                                           scenario_.speed));
+  std::unique_lock<std::mutex> lock(meeting->mutex);
+  return !meeting->stop_requested.wait_until(
+      lock, due, [meeting] { return meeting->stopping; });
+}
+
+void SimulatedMeetingBackend::Apply(Meeting* meeting,
+                                    const ScenarioEvent& event) {
+  std::vector<uint32_t> departed;
+  {
+    // Held while reporting, so nothing is reported after StopMeeting().
+    std::lock_guard<std::mutex> lock(meeting->mutex);
+    if (meeting->stopping) {
+      return;
+    }
+    switch (event.type) {
+      case ScenarioEvent::Type::kStatus:
+        SetStatus(meeting->meeting_id, event.status, event.error_code);
+        if (event.status == MeetingStatus::kIdle ||
+            event.status == MeetingStatus::kFailed) {
+          meeting->ended = true;
+          departed.swap(meeting->participants);
+        }
+        break;
+      case ScenarioEvent::Type::kParticipantJoined: {
+        meeting->participants.push_back(event.participant_id);
+        {
+          std::lock_guard<std::mutex> roster_lock(roster_mutex_);
+          participants_.push_back(event.participant_id);
+          has_video_[event.participant_id] = event.has_video;
+        }
+        NotifyParticipantJoined(meeting->meeting_id, event.participant);
+        break;
+      }
+      case ScenarioEvent::Type::kParticipantChanged:
+        NotifyParticipantChanged(meeting->meeting_id, event.participant);
+        break;
+      case ScenarioEvent::Type::kParticipantLeft: {
+        auto& present = meeting->participants;
+        present.erase(
+            std::find(present.begin(), present.end(), event.participant_id));
+        departed.push_back(event.participant_id);
+        NotifyParticipantLeft(meeting->meeting_id, event.participant_id);
+        break;
+      }
+    }
+  }
+  if (!departed.empty()) {
+    RemoveParticipants(departed);
+  } else if (event.type == ScenarioEvent::Type::kParticipantJoined) {
+    std::lock_guard<std::mutex> lock(audio_mutex_);
+    RefreshAudioLocked();
+  }
+}
+
+void SimulatedMeetingBackend::StopMeeting(
+    const std::shared_ptr<Meeting>& meeting,
+    bool report_leave) {
+  bool ended;
+  std::vector<uint32_t> departed;
+  {
+    std::lock_guard<std::mutex> lock(meeting->mutex);
+    meeting->stopping = true;
+    ended = meeting->ended;
+    departed.swap(meeting->participants);
+  }
+  meeting->stop_requested.notify_all();
+  if (meeting->thread.joinable()) {
+    meeting->thread.join();
+  }
+  RemoveParticipants(departed);
+  if (report_leave && !ended) {
+    SetStatus(meeting->meeting_id, MeetingStatus::kDisconnecting, 0);
+    SetStatus(meeting->meeting_id, MeetingStatus::kIdle, 0);
+  }
+}
+
+void SimulatedMeetingBackend::RemoveParticipants(
+    const std::vector<uint32_t>& departed) {
+  {
+    std::lock_guard<std::mutex> lock(roster_mutex_);
+    for (uint32_t participant_id : departed) {
+      participants_.erase(std::find(participants_.begin(), participants_.end(),
+                                    participant_id));
+      has_video_.erase(participant_id);
+    }
+  }
+  // Their video stops with them.
+  for (uint32_t participant_id : departed) {
+    UnsubscribeVideo(participant_id);
+  }
+  std::lock_guard<std::mutex> lock(audio_mutex_);
+  RefreshAudioLocked();
+}
+
+void SimulatedMeetingBackend::SetStatus(const std::string& meeting_id,
+                                        MeetingStatus status,
+                                        int32_t error_code) {
+  status_ = status;
+  std::lock_guard<std::mutex> lock(observer_mutex_);
+  if (observer_ != nullptr) {
+    observer_->OnMeetingStatusChanged(meeting_id, status, error_code, 0);
+  }
+}
+
+void SimulatedMeetingBackend::NotifyParticipantJoined(
+    const std::string& meeting_id,
+    const ParticipantInfo& participant) {
+  std::lock_guard<std::mutex> lock(observer_mutex_);
+  if (observer_ != nullptr) {
+    observer_->OnParticipantJoined(meeting_id, participant);
+  }
+}
+
+void SimulatedMeetingBackend::NotifyParticipantLeft(
+    const std::string& meeting_id,
+    uint32_t participant_id) {
+  std::lock_guard<std::mutex> lock(observer_mutex_);
+  if (observer_ != nullptr) {
+    observer_->OnParticipantLeft(meeting_id, participant_id);
+  }
+}
+
+void SimulatedMeetingBackend::NotifyParticipantChanged(
+    const std::string& meeting_id,
+    const ParticipantInfo& participant) {
+  std::lock_guard<std::mutex> lock(observer_mutex_);
+  if (observer_ != nullptr) {
+    observer_->OnParticipantChanged(meeting_id, participant);
+  }
+}
+
+void SimulatedMeetingBackend::RefreshAudioLocked() {
+  if (audio_sink_ == nullptr) {
+    return;
+  }
+  std::vector<uint32_t> speakers;
+  {
+    std::lock_guard<std::mutex> lock(roster_mutex_);
+    size_t count = std::min(participants_.size(),
+                            static_cast<size_t>(scenario_.audio_speakers));
+    speakers.assign(participants_.begin(), participants_.begin() + count);
+  }
+  if (audio_source_ != nullptr && speakers == audio_speakers_) {
+    return;
+  }
+  // Stopped under the lock so that StopRawAudio() never returns while a
+  // replaced source is still delivering.
+  audio_source_.reset();
+  SyntheticAudioSource::Config config;
+  config.sample_rate = scenario_.audio_sample_rate;
+  config.channels = scenario_.audio_channels;
+  config.turn_ms = scenario_.speaker_turn_ms;
+  config.participants = speakers;
+  audio_speakers_ = std::move(speakers);
+  audio_source_ = std::make_unique<SyntheticAudioSource>(config, audio_sink_);
+}
+
+}  // namespace flutter_zoom_meeting_sdk
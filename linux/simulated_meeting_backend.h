@@ -0,0 +1,123 @@
+#ifndef FLUTTER_PLUGIN_SIMULATED_MEETING_BACKEND_H_
+#define FLUTTER_PLUGIN_SIMULATED_MEETING_BACKEND_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "meeting_backend.h"
+#include "meeting_scenario.h"
+#include "synthetic_audio_source.h"
+#include "synthetic_video_source.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Backend that replays a MeetingScenario for load and soak tests, without
+// a network. Each joined meeting plays its own ScenarioTimeline: the join
+// sequence on the calling worker, as a real join blocks for the handshake,
+// then reconnects, participant churn and roster changes on a thread of its
+// own. Present participants with video can be subscribed to and are served
+// by SyntheticVideoSource; raw audio carries the first
+// scenario.audio_speakers participants present.
+class SimulatedMeetingBackend : public MeetingBackend {
+ public:
+  // First participant ID of the first meeting. Each meeting gets its own
+  // block of kParticipantIdsPerMeeting IDs.
+  static constexpr uint32_t kFirstParticipantId = 16778240;
+  static constexpr uint32_t kParticipantIdsPerMeeting = 1 << 20;
+
+  explicit SimulatedMeetingBackend(const MeetingScenario& scenario);
+  ~SimulatedMeetingBackend() override;
+
+  SimulatedMeetingBackend(const SimulatedMeetingBackend&) = delete;
+  SimulatedMeetingBackend& operator=(const SimulatedMeetingBackend&) = delete;
+
+  // MeetingBackend:
+  InitResult Initialize(const InitParams& params) override;
+  bool IsInitialized() const override;
+  bool JoinMeeting(const MeetingOptions& options) override;
+  bool StartMeeting(const MeetingOptions& options) override;
+  bool LeaveMeeting(const std::string& meeting_id) override;
+  MeetingStatus GetMeetingStatus() const override;
+  void SetObserver(Observer* observer) override;
+  bool SubscribeVideo(uint32_t participant_id, VideoSink* sink) override;
+  void UnsubscribeVideo(uint32_t participant_id) override;
+  bool StartRawAudio(AudioSink* sink) override;
+  void StopRawAudio() override;
+
+  // Participants present in every meeting, in join order.
+  std::vector<uint32_t> GetParticipants() const;
+
+ private:
+  struct Meeting;
+
+  bool EnterMeeting(const MeetingOptions& options);
+
+  // Plays |meeting|'s timeline after the join on its own thread.
+  void Play(Meeting* meeting);
+
+  // Waits until |event| is due. Returns false if |meeting| is stopped first.
+  bool WaitFor(Meeting* meeting, const ScenarioEvent& event);
+
+  // Reports |event| and applies it to the roster.
+  void Apply(Meeting* meeting, const ScenarioEvent& event);
+
+  // Stops |meeting|'s thread and reports it left if |report_leave|.
+  void StopMeeting(const std::shared_ptr<Meeting>& meeting,
+                   bool report_leave);
+
+  // Drops |departed| from the roster and stops their media.
+  void RemoveParticipants(const std::vector<uint32_t>& departed);
+
+  void SetStatus(const std::string& meeting_id,
+                 MeetingStatus status,
+                 int32_t error_code);
+  void NotifyParticipantJoined(const std::string& meeting_id,
+                               const ParticipantInfo& participant);
+  void NotifyParticipantLeft(const std::string& meeting_id,
+                             uint32_t participant_id);
+  void NotifyParticipantChanged(const std::string& meeting_id,
+                                const ParticipantInfo& participant);
+
+  // Restarts raw audio if the speakers changed. Requires |audio_mutex_|.
+  void RefreshAudioLocked();
+
+  const MeetingScenario scenario_;
+  // Held for the whole of Initialize() so concurrent calls initialize once.
+  std::mutex init_mutex_;
+  std::atomic<bool> initialized_{false};
+  std::atomic<MeetingStatus> status_{MeetingStatus::kIdle};
+
+  std::mutex observer_mutex_;
+  Observer* observer_ = nullptr;
+
+  std::mutex meetings_mutex_;
+  // Shared with the worker playing a meeting's join, which a concurrent
+  // LeaveMeeting() may remove it under.
+  std::map<std::string, std::shared_ptr<Meeting>> meetings_;
+  uint32_t meetings_started_ = 0;
+
+  // Present participants and whether each sends video.
+  mutable std::mutex roster_mutex_;
+  std::vector<uint32_t> participants_;
+  std::map<uint32_t, bool> has_video_;
+
+  std::mutex video_mutex_;
+  std::map<uint32_t, std::unique_ptr<SyntheticVideoSource>> video_sources_;
+
+  std::mutex audio_mutex_;
+  AudioSink* audio_sink_ = nullptr;
+  std::vector<uint32_t> audio_speakers_;
+  std::unique_ptr<SyntheticAudioSource> audio_source_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_SIMULATED_MEETING_BACKEND_H_
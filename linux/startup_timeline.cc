@@ -0,0 +1,122 @@
+#include "startup_timeline.h"
+
+#include <time.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "monotonic_clock.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+constexpr int64_t kUnknown = -1;
+
+// Returns when this process was created on the monotonic clock, or kUnknown.
+//
+// /proc/self/stat reports the start time in clock ticks since boot, which is
+// CLOCK_BOOTTIME. The monotonic clock excludes suspend, so the process age is
+// taken on the boot clock and subtracted from the monotonic now.
+int64_t ReadProcessStartUs() {
+  std::ifstream stat("/proc/self/stat");
+  std::string line;
+  if (!std::getline(stat, line)) {
+    return kUnknown;
+  }
+  // The command name may contain spaces, so count fields from its closing
+  // parenthesis. starttime is field 22; field 3 follows the parenthesis.
+  size_t name_end = line.rfind(')');
+  if (name_end == std::string::npos) {
+    return kUnknown;
+  }
+  std::istringstream fields(line.substr(name_end + 2));
+  std::string field;
+  for (int index = 3; index < 22; ++index) {
+    fields >> field;
+  }
+  unsigned long long start_ticks = 0;
+  if (!(fields >> start_ticks)) {
+    return kUnknown;
+  }
+  long ticks_per_second = sysconf(_SC_CLK_TCK);
+  struct timespec boot_now = {};
+  if (ticks_per_second <= 0 || clock_gettime(CLOCK_BOOTTIME, &boot_now) != 0) {
+    return kUnknown;
+  }
+  int64_t boot_now_us = boot_now.tv_sec * INT64_C(1000000) +
+                        boot_now.tv_nsec / 1000;
+  int64_t start_us =
+      static_cast<int64_t>(start_ticks) * 1000000 / ticks_per_second;
+  int64_t age_us = boot_now_us - start_us;
+  if (age_us < 0) {
+    return kUnknown;
+  }
+  return MonotonicNowUs() - age_us;
+}
+
+}  // namespace
+
+StartupTimeline::StartupTimeline()
+    : process_start_us_(ReadProcessStartUs()) {}
+
+StartupTimeline* StartupTimeline::Get() {
+  static StartupTimeline* timeline = new StartupTimeline();
+  return timeline;
+}
+
+bool StartupTimeline::Mark(const char* name) {
+  int64_t now = MonotonicNowUs();
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const Milestone& mark : marks_) {
+    if (mark.name == name) {
+      return false;
+    }
+  }
+  marks_.push_back({name, now});
+  return true;
+}
+
+std::vector<StartupTimeline::Milestone> StartupTimeline::GetMarks() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return marks_;
+}
+
+bool StartupTimeline::HasMark(const char* name) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const Milestone& mark : marks_) {
+    if (mark.name == name) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int64_t StartupTimeline::origin_us() const {
+  if (process_start_us_ != kUnknown) {
+    return process_start_us_;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  return marks_.empty() ? MonotonicNowUs() : marks_.front().time_us;
+}
+
+std::string StartupTimeline::Format() const {
+  int64_t origin = origin_us();
+  std::vector<Milestone> marks = GetMarks();
+  std::string result;
+  int64_t previous = origin;
+  for (const Milestone& mark : marks) {
+    char line[128];
+    snprintf(line, sizeof(line), "%-20s %9.1f ms  (+%.1f ms)\n",
+             mark.name.c_str(), (mark.time_us - origin) / 1000.0,
+             (mark.time_us - previous) / 1000.0);
+    result += line;
+    previous = mark.time_us;
+  }
+  return result;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
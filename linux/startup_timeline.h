@@ -0,0 +1,65 @@
+#ifndef FLUTTER_PLUGIN_STARTUP_TIMELINE_H_
+#define FLUTTER_PLUGIN_STARTUP_TIMELINE_H_
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+
+// Milestones recorded by the runner and the plugin, in the order they are
+// expected to happen.
+constexpr char kStartupMain[] = "main";
+constexpr char kStartupActivate[] = "activate";
+constexpr char kStartupRegisterPlugins[] = "register_plugins";
+constexpr char kStartupPluginsRegistered[] = "plugins_registered";
+constexpr char kStartupFirstFrame[] = "first_frame";
+constexpr char kStartupSdkInitStart[] = "sdk_init_start";
+constexpr char kStartupSdkInitComplete[] = "sdk_init_complete";
+
+// Process-wide record of when startup milestones were reached, measured from
+// process creation where the kernel reports it.
+class StartupTimeline {
+ public:
+  struct Milestone {
+    std::string name;
+    // Monotonic clock, microseconds.
+    int64_t time_us;
+  };
+
+  StartupTimeline();
+
+  StartupTimeline(const StartupTimeline&) = delete;
+  StartupTimeline& operator=(const StartupTimeline&) = delete;
+
+  // The timeline shared by the runner and the plugin.
+  static StartupTimeline* Get();
+
+  // Records |name| at the current time. Safe to call from any thread; only
+  // the first mark of each name is kept. Returns false if it was already
+  // marked.
+  bool Mark(const char* name);
+
+  // Marks in the order they were recorded.
+  std::vector<Milestone> GetMarks() const;
+
+  bool HasMark(const char* name) const;
+
+  // When the process was created, on the monotonic clock. Falls back to the
+  // first mark if /proc is unavailable.
+  int64_t origin_us() const;
+
+  // One line per mark with the time since process start and since the
+  // previous mark, for logs.
+  std::string Format() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<Milestone> marks_;
+  int64_t process_start_us_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_STARTUP_TIMELINE_H_
@@ -0,0 +1,61 @@
+#include "status_event_codec.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+void WriteUint32(uint32_t value, uint8_t* out) {
+  for (int i = 0; i < 4; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+void WriteUint64(uint64_t value, uint8_t* out) {
+  for (int i = 0; i < 8; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+uint32_t ReadUint32(const uint8_t* data) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    value |= static_cast<uint32_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+uint64_t ReadUint64(const uint8_t* data) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; ++i) {
+    value |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+}  // namespace
+
+void EncodeStatusEvent(const MeetingStatusEvent& event, uint8_t* out) {
+  WriteUint32(static_cast<uint32_t>(event.status), out);
+  WriteUint32(static_cast<uint32_t>(event.error_code), out + 4);
+  WriteUint32(static_cast<uint32_t>(event.internal_error_code), out + 8);
+  WriteUint32(event.session_id, out + 12);
+  WriteUint64(static_cast<uint64_t>(event.timestamp_us), out + 16);
+  WriteUint64(event.sequence, out + 24);
+}
+
+bool DecodeStatusEvent(const uint8_t* data,
+                       size_t size,
+                       MeetingStatusEvent* event) {
+  if (size < kStatusEventRecordSize) {
+    return false;
+  }
+  event->status = static_cast<MeetingStatus>(ReadUint32(data));
+  event->error_code = static_cast<int32_t>(ReadUint32(data + 4));
+  event->internal_error_code = static_cast<int32_t>(ReadUint32(data + 8));
+  event->session_id = ReadUint32(data + 12);
+  event->timestamp_us = static_cast<int64_t>(ReadUint64(data + 16));
+  event->sequence = ReadUint64(data + 24);
+  return true;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,48 @@
+#ifndef FLUTTER_PLUGIN_STATUS_EVENT_CODEC_H_
+#define FLUTTER_PLUGIN_STATUS_EVENT_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "meeting_backend.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// A meeting status change as sent on the binary status channel.
+struct MeetingStatusEvent {
+  MeetingStatus status = MeetingStatus::kUnknown;
+  int32_t error_code = 0;
+  int32_t internal_error_code = 0;
+  // Session of the meeting the change belongs to (see
+  // MeetingSessionManager), or 0 if it belongs to none.
+  uint32_t session_id = 0;
+  // Microseconds on the monotonic clock (g_get_monotonic_time()).
+  int64_t timestamp_us = 0;
+  // Increases by one for every status change the backend reports.
+  uint64_t sequence = 0;
+};
+
+// Size of an encoded MeetingStatusEvent. The little-endian layout is:
+//
+//   0  int32   status
+//   4  int32   error code
+//   8  int32   internal error code
+//   12 uint32  session ID
+//   16 int64   timestamp (us)
+//   24 uint64  sequence
+//
+// MeetingStatusEvent.decode in lib/flutter_zoom_meeting_sdk_events.dart reads
+// the same layout.
+constexpr size_t kStatusEventRecordSize = 32;
+
+// Writes |event| to the first kStatusEventRecordSize bytes of |out|.
+void EncodeStatusEvent(const MeetingStatusEvent& event, uint8_t* out);
+
+// Reads an event from |data|. Returns false if |size| is too small.
+bool DecodeStatusEvent(const uint8_t* data,
+                       size_t size,
+                       MeetingStatusEvent* event);
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_STATUS_EVENT_CODEC_H_
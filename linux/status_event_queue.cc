@@ -0,0 +1,83 @@
+#include "status_event_queue.h"
+
+#include "memory_accounting.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+template <typename T>
+void StoreMax(std::atomic<T>* target, T value) {
+  T current = target->load(std::memory_order_relaxed);
+  while (current < value &&
+         !target->compare_exchange_weak(current, value,
+                                        std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+StatusEventQueue::StatusEventQueue(size_t capacity) : ring_(capacity) {
+  MemoryAccounting::Charge(MemoryCategory::kEventQueues,
+                           static_cast<int64_t>(ring_.memory_bytes()));
+}
+
+StatusEventQueue::~StatusEventQueue() {
+  MemoryAccounting::Charge(MemoryCategory::kEventQueues,
+                           -static_cast<int64_t>(ring_.memory_bytes()));
+}
+
+bool StatusEventQueue::Push(const MeetingStatusEvent& event) {
+  if (!ring_.TryPush(event)) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  pushed_.fetch_add(1, std::memory_order_relaxed);
+  StoreMax(&peak_depth_, ring_.SizeApprox());
+
+  if (!drain_pending_.exchange(true)) {
+    wakeups_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+  coalesced_.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+size_t StatusEventQueue::Drain(std::vector<MeetingStatusEvent>* batch) {
+  // Cleared before popping: an event pushed after this point either lands in
+  // this batch or schedules the next drain, never neither.
+  drain_pending_.store(false);
+
+  batch->clear();
+  MeetingStatusEvent event;
+  while (ring_.TryPop(&event)) {
+    batch->push_back(event);
+  }
+  if (batch->empty()) {
+    return 0;
+  }
+
+  drains_.fetch_add(1, std::memory_order_relaxed);
+  int64_t latency = MonotonicNowUs() - batch->front().timestamp_us;
+  last_drain_latency_us_.store(latency, std::memory_order_relaxed);
+  StoreMax(&max_drain_latency_us_, latency);
+  return batch->size();
+}
+
+StatusEventQueueStats StatusEventQueue::GetStats() const {
+  StatusEventQueueStats stats;
+  stats.pushed = pushed_.load(std::memory_order_relaxed);
+  stats.dropped = dropped_.load(std::memory_order_relaxed);
+  stats.wakeups = wakeups_.load(std::memory_order_relaxed);
+  stats.coalesced = coalesced_.load(std::memory_order_relaxed);
+  stats.drains = drains_.load(std::memory_order_relaxed);
+  stats.depth = ring_.SizeApprox();
+  stats.peak_depth = peak_depth_.load(std::memory_order_relaxed);
+  stats.last_drain_latency_us =
+      last_drain_latency_us_.load(std::memory_order_relaxed);
+  stats.max_drain_latency_us =
+      max_drain_latency_us_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,71 @@
+#ifndef FLUTTER_PLUGIN_STATUS_EVENT_QUEUE_H_
+#define FLUTTER_PLUGIN_STATUS_EVENT_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "monotonic_clock.h"
+#include "mpsc_ring_buffer.h"
+#include "status_event_codec.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+struct StatusEventQueueStats {
+  uint64_t pushed = 0;
+  // Events rejected because the queue was full.
+  uint64_t dropped = 0;
+  // Main loop wakeups requested by producers.
+  uint64_t wakeups = 0;
+  // Events that joined a batch whose wakeup was already pending.
+  uint64_t coalesced = 0;
+  uint64_t drains = 0;
+  size_t depth = 0;
+  size_t peak_depth = 0;
+  // Time between the oldest event of a batch being queued and the batch
+  // being drained.
+  int64_t last_drain_latency_us = 0;
+  int64_t max_drain_latency_us = 0;
+};
+
+// Hands status events from SDK callback threads to the main loop.
+//
+// Producers never block. Only the producer that finds no drain pending is
+// told to schedule one, so a burst of events costs a single main loop wakeup
+// and is delivered as one batch.
+class StatusEventQueue {
+ public:
+  explicit StatusEventQueue(size_t capacity);
+  ~StatusEventQueue();
+
+  StatusEventQueue(const StatusEventQueue&) = delete;
+  StatusEventQueue& operator=(const StatusEventQueue&) = delete;
+
+  // Safe to call from any thread. Returns true if the caller must schedule a
+  // Drain() on the main loop.
+  bool Push(const MeetingStatusEvent& event);
+
+  // Main loop only. Replaces the contents of |batch| with every queued event
+  // in order and returns how many there were.
+  size_t Drain(std::vector<MeetingStatusEvent>* batch);
+
+  StatusEventQueueStats GetStats() const;
+
+ private:
+  MpscRingBuffer<MeetingStatusEvent> ring_;
+  std::atomic<bool> drain_pending_{false};
+
+  std::atomic<uint64_t> pushed_{0};
+  std::atomic<uint64_t> dropped_{0};
+  std::atomic<uint64_t> wakeups_{0};
+  std::atomic<uint64_t> coalesced_{0};
+  std::atomic<uint64_t> drains_{0};
+  std::atomic<size_t> peak_depth_{0};
+  std::atomic<int64_t> last_drain_latency_us_{0};
+  std::atomic<int64_t> max_drain_latency_us_{0};
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_STATUS_EVENT_QUEUE_H_
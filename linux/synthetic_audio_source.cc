@@ -0,0 +1,81 @@
+#include "synthetic_audio_source.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Each participant's tone peaks at a quarter of full scale so the mix of a
+// few never clips.
+constexpr double kToneAmplitude = 8192;
+
+double ToneFrequency(size_t participant_index) {
+  return 300.0 + 200.0 * participant_index;
+}
+
+}  // namespace
+
+SyntheticAudioSource::SyntheticAudioSource(const Config& config,
+                                           MeetingBackend::AudioSink* sink)
+    : config_(config), sink_(sink) {
+  thread_ = std::thread(&SyntheticAudioSource::Run, this);
+}
+
+SyntheticAudioSource::~SyntheticAudioSource() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  stop_requested_.notify_all();
+  thread_.join();
+}
+
+void SyntheticAudioSource::Run() {
+  const int channels = config_.channels > 0 ? config_.channels : 1;
+  const size_t frames =
+      static_cast<size_t>(config_.sample_rate) * config_.chunk_ms / 1000;
+  const auto chunk_interval = std::chrono::milliseconds(config_.chunk_ms);
+  std::vector<int16_t> mixed(frames * channels);
+  std::vector<int16_t> single(frames * channels);
+  auto next_chunk = std::chrono::steady_clock::now();
+  for (uint64_t first_frame = 0;; first_frame += frames) {
+    std::fill(mixed.begin(), mixed.end(), 0);
+    size_t speaker = config_.participants.size();
+    if (config_.turn_ms > 0 && !config_.participants.empty()) {
+      uint64_t elapsed_ms = first_frame * 1000 / config_.sample_rate;
+      speaker = (elapsed_ms / config_.turn_ms) % config_.participants.size();
+    }
+    for (size_t i = 0; i < config_.participants.size(); ++i) {
+      if (config_.turn_ms > 0 && i != speaker) {
+        continue;
+      }
+      double step = 2 * kPi * ToneFrequency(i) / config_.sample_rate;
+      for (size_t frame = 0; frame < frames; ++frame) {
+        auto sample = static_cast<int16_t>(
+            kToneAmplitude * std::sin(step * (first_frame + frame)));
+        for (int channel = 0; channel < channels; ++channel) {
+          single[frame * channels + channel] = sample;
+          mixed[frame * channels + channel] += sample;
+        }
+      }
+      sink_->OnAudioData(config_.participants[i], single.data(), frames,
+                         config_.sample_rate, channels);
+    }
+    sink_->OnAudioData(kMixedAudioParticipantId, mixed.data(), frames,
+                       config_.sample_rate, channels);
+
+    next_chunk += chunk_interval;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stop_requested_.wait_until(lock, next_chunk,
+                                   [this] { return stopping_; })) {
+      return;
+    }
+  }
+}
+
+}  // namespace flutter_zoom_meeting_sdk
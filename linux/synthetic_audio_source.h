@@ -0,0 +1,53 @@
+#ifndef FLUTTER_PLUGIN_SYNTHETIC_AUDIO_SOURCE_H_
+#define FLUTTER_PLUGIN_SYNTHETIC_AUDIO_SOURCE_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "meeting_backend.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Produces raw meeting audio on its own thread, standing in for the SDK's
+// audio thread: one sine tone per participant plus their mix, in chunks of
+// interleaved PCM at the SDK's usual 48 kHz stereo.
+//
+// With |turn_ms| set, participants instead take turns speaking for that
+// long each, in order, and like the SDK send nothing while quiet.
+class SyntheticAudioSource {
+ public:
+  struct Config {
+    int sample_rate = 48000;
+    int channels = 2;
+    int chunk_ms = 10;
+    int64_t turn_ms = 0;
+    std::vector<uint32_t> participants = {16778240, 16779264};
+  };
+
+  // Starts delivering audio to |sink| immediately.
+  SyntheticAudioSource(const Config& config, MeetingBackend::AudioSink* sink);
+
+  // Stops the thread. No audio is delivered after this returns.
+  ~SyntheticAudioSource();
+
+  SyntheticAudioSource(const SyntheticAudioSource&) = delete;
+  SyntheticAudioSource& operator=(const SyntheticAudioSource&) = delete;
+
+ private:
+  void Run();
+
+  const Config config_;
+  MeetingBackend::AudioSink* const sink_;
+
+  std::mutex mutex_;
+  std::condition_variable stop_requested_;
+  bool stopping_ = false;
+  std::thread thread_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_SYNTHETIC_AUDIO_SOURCE_H_
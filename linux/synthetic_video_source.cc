@@ -0,0 +1,74 @@
+#include "synthetic_video_source.h"
+
+#include <chrono>
+#include <cstring>
+
+#include "monotonic_clock.h"
+#include "video_frame.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+// Draws diagonal luma stripes that scroll with |frame_number| over a flat
+// chroma tint picked from the participant ID.
+void DrawPattern(VideoFrame* frame, uint32_t participant_id,
+                 uint32_t frame_number) {
+  for (int row = 0; row < frame->height(); ++row) {
+    uint8_t* y = frame->mutable_data_y() + row * frame->stride_y();
+    for (int col = 0; col < frame->width(); ++col) {
+      y[col] = static_cast<uint8_t>(16 + ((col + row + frame_number * 4) & 0x7f));
+    }
+  }
+  uint8_t u = static_cast<uint8_t>(64 + (participant_id * 53) % 128);
+  uint8_t v = static_cast<uint8_t>(64 + (participant_id * 97) % 128);
+  for (int row = 0; row < frame->chroma_height(); ++row) {
+    memset(frame->mutable_data_u() + row * frame->stride_u(), u,
+           frame->chroma_width());
+    memset(frame->mutable_data_v() + row * frame->stride_v(), v,
+           frame->chroma_width());
+  }
+}
+
+}  // namespace
+
+SyntheticVideoSource::SyntheticVideoSource(uint32_t participant_id,
+                                           const Config& config,
+                                           MeetingBackend::VideoSink* sink)
+    : participant_id_(participant_id), config_(config), sink_(sink) {
+  thread_ = std::thread(&SyntheticVideoSource::Run, this);
+}
+
+SyntheticVideoSource::~SyntheticVideoSource() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  stop_requested_.notify_all();
+  thread_.join();
+}
+
+void SyntheticVideoSource::Run() {
+  const auto frame_interval = std::chrono::microseconds(
+      1000000 / (config_.frames_per_second > 0 ? config_.frames_per_second : 1));
+  auto next_frame = std::chrono::steady_clock::now();
+  for (uint32_t frame_number = 0;; ++frame_number) {
+    std::shared_ptr<VideoFrame> frame =
+        VideoFrame::Allocate(config_.width, config_.height);
+    // At the frame pool's cap the frame is skipped, like a dropped one.
+    if (frame != nullptr) {
+      DrawPattern(frame.get(), participant_id_, frame_number);
+      frame->set_timestamp_us(MonotonicNowUs());
+      sink_->OnVideoFrame(participant_id_, std::move(frame));
+    }
+
+    next_frame += frame_interval;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stop_requested_.wait_until(lock, next_frame,
+                                   [this] { return stopping_; })) {
+      return;
+    }
+  }
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,49 @@
+#ifndef FLUTTER_PLUGIN_SYNTHETIC_VIDEO_SOURCE_H_
+#define FLUTTER_PLUGIN_SYNTHETIC_VIDEO_SOURCE_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "meeting_backend.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Produces a moving I420 test pattern for one participant on its own thread,
+// standing in for the SDK's video receive thread.
+class SyntheticVideoSource {
+ public:
+  struct Config {
+    int width = 1280;
+    int height = 720;
+    int frames_per_second = 30;
+  };
+
+  // Starts delivering frames to |sink| immediately.
+  SyntheticVideoSource(uint32_t participant_id,
+                       const Config& config,
+                       MeetingBackend::VideoSink* sink);
+
+  // Stops the thread. No frame is delivered after this returns.
+  ~SyntheticVideoSource();
+
+  SyntheticVideoSource(const SyntheticVideoSource&) = delete;
+  SyntheticVideoSource& operator=(const SyntheticVideoSource&) = delete;
+
+ private:
+  void Run();
+
+  const uint32_t participant_id_;
+  const Config config_;
+  MeetingBackend::VideoSink* const sink_;
+
+  std::mutex mutex_;
+  std::condition_variable stop_requested_;
+  bool stopping_ = false;
+  std::thread thread_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_SYNTHETIC_VIDEO_SOURCE_H_
@@ -0,0 +1,213 @@
+#include "active_speaker_detector.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+constexpr int kRate = 48000;
+constexpr int kChannels = 2;
+constexpr int kChunkMs = 10;
+constexpr size_t kChunkFrames = kRate * kChunkMs / 1000;
+constexpr uint32_t kAlice = 16778240;
+constexpr uint32_t kBob = 16779264;
+
+int64_t fake_now_us = 0;
+
+int64_t FakeNow() {
+  return fake_now_us;
+}
+
+enum class Signal { kSilence, kTone, kHum, kNoise };
+
+// Generates 10 ms chunks of interleaved stereo at 48 kHz, continuing the
+// signal across calls.
+class SignalSource {
+ public:
+  SignalSource(Signal signal, double amplitude, double frequency = 440)
+      : signal_(signal), amplitude_(amplitude), frequency_(frequency) {}
+
+  const std::vector<int16_t>& Next() {
+    chunk_.resize(kChunkFrames * kChannels);
+    for (size_t frame = 0; frame < kChunkFrames; ++frame, ++position_) {
+      double value = 0;
+      switch (signal_) {
+        case Signal::kSilence:
+          break;
+        case Signal::kTone:
+          value = std::sin(2 * M_PI * frequency_ * position_ / kRate);
+          break;
+        case Signal::kHum:
+          value = std::sin(2 * M_PI * 50.0 * position_ / kRate);
+          break;
+        case Signal::kNoise:
+          noise_state_ = noise_state_ * 6364136223846793005ull + 1;
+          value = static_cast<double>(noise_state_ >> 40) / (1 << 23) - 1;
+          break;
+      }
+      auto sample = static_cast<int16_t>(amplitude_ * value);
+      chunk_[frame * kChannels] = sample;
+      chunk_[frame * kChannels + 1] = sample;
+    }
+    return chunk_;
+  }
+
+ private:
+  const Signal signal_;
+  const double amplitude_;
+  const double frequency_;
+  uint64_t position_ = 0;
+  uint64_t noise_state_ = 7;
+  std::vector<int16_t> chunk_;
+};
+
+class DetectorTest : public ::testing::Test {
+ protected:
+  DetectorTest()
+      : detector_(ActiveSpeakerDetector::Config(),
+                  [this](const ActiveSpeakerDetector::SpeakerState& state) {
+                    changes_.push_back(state);
+                  },
+                  FakeNow) {
+    fake_now_us = 1000000;
+  }
+
+  // Feeds |ms| of audio from |source| as |participant_id|, with the meeting
+  // mix alongside as the backend sends it.
+  void Feed(uint32_t participant_id, SignalSource* source, int ms) {
+    Feed({{participant_id, source}}, ms);
+  }
+
+  void Feed(const std::vector<std::pair<uint32_t, SignalSource*>>& streams,
+            int ms) {
+    std::vector<int16_t> mix(kChunkFrames * kChannels);
+    for (int elapsed = 0; elapsed < ms; elapsed += kChunkMs) {
+      for (const auto& stream : streams) {
+        const std::vector<int16_t>& chunk = stream.second->Next();
+        detector_.OnAudioData(stream.first, chunk.data(), kChunkFrames, kRate,
+                              kChannels);
+      }
+      detector_.OnAudioData(kMixedAudioParticipantId, mix.data(),
+                            kChunkFrames, kRate, kChannels);
+      fake_now_us += kChunkMs * 1000;
+    }
+  }
+
+  ActiveSpeakerDetector::SpeakerState State() { return detector_.GetState(); }
+
+  ActiveSpeakerDetector detector_;
+  std::vector<ActiveSpeakerDetector::SpeakerState> changes_;
+};
+
+}  // namespace
+
+TEST_F(DetectorTest, StartsAfterAttackAndStopsAfterRelease) {
+  SignalSource speech(Signal::kTone, 8192);
+  SignalSource silence(Signal::kSilence, 0);
+
+  Feed(kAlice, &speech, 40);
+  EXPECT_TRUE(changes_.empty());
+
+  Feed(kAlice, &speech, 200);
+  ASSERT_EQ(changes_.size(), 1u);
+  EXPECT_EQ(changes_[0].active_speaker, kAlice);
+  EXPECT_EQ(changes_[0].speaking, std::vector<uint32_t>{kAlice});
+
+  // Short pauses between words keep the speaker.
+  Feed(kAlice, &silence, 400);
+  Feed(kAlice, &speech, 100);
+  EXPECT_EQ(changes_.size(), 1u);
+
+  Feed(kAlice, &silence, 700);
+  ASSERT_EQ(changes_.size(), 2u);
+  EXPECT_EQ(changes_[1].active_speaker, kNoActiveSpeaker);
+  EXPECT_TRUE(changes_[1].speaking.empty());
+}
+
+TEST_F(DetectorTest, RejectsNoiseAndHum) {
+  SignalSource noise(Signal::kNoise, 8192);
+  SignalSource hum(Signal::kHum, 8192);
+  Feed({{kAlice, &noise}, {kBob, &hum}}, 2000);
+  EXPECT_TRUE(changes_.empty());
+}
+
+TEST_F(DetectorTest, IgnoresTheMix) {
+  SignalSource speech(Signal::kTone, 8192);
+  Feed(kMixedAudioParticipantId, &speech, 1000);
+  EXPECT_TRUE(changes_.empty());
+}
+
+TEST_F(DetectorTest, SwitchesOnlyToAClearlyLouderSpeaker) {
+  SignalSource alice(Signal::kTone, 4096, 440);
+  SignalSource bob_similar(Signal::kTone, 4800, 600);
+  SignalSource bob_louder(Signal::kTone, 16384, 600);
+
+  Feed(kAlice, &alice, 200);
+  ASSERT_EQ(State().active_speaker, kAlice);
+
+  // Less than the switch margin louder: Alice stays active.
+  Feed({{kAlice, &alice}, {kBob, &bob_similar}}, 1000);
+  EXPECT_EQ(State().active_speaker, kAlice);
+  EXPECT_EQ(State().speaking, (std::vector<uint32_t>{kAlice, kBob}));
+
+  // Clearly louder, but not yet for long enough.
+  Feed({{kAlice, &alice}, {kBob, &bob_louder}}, 200);
+  EXPECT_EQ(State().active_speaker, kAlice);
+
+  Feed({{kAlice, &alice}, {kBob, &bob_louder}}, 400);
+  EXPECT_EQ(State().active_speaker, kBob);
+}
+
+TEST_F(DetectorTest, StopsSpeakersWhoseAudioStops) {
+  SignalSource speech(Signal::kTone, 8192);
+  SignalSource silence(Signal::kSilence, 0);
+  Feed(kAlice, &speech, 200);
+  ASSERT_EQ(State().active_speaker, kAlice);
+
+  // Only the mix keeps arriving.
+  Feed(kMixedAudioParticipantId, &silence, 500);
+  EXPECT_EQ(State().active_speaker, kAlice);
+  Feed(kMixedAudioParticipantId, &silence, 200);
+  EXPECT_EQ(State().active_speaker, kNoActiveSpeaker);
+
+  // Speaking again afterwards is picked up as a fresh start.
+  Feed(kAlice, &speech, 200);
+  EXPECT_EQ(State().active_speaker, kAlice);
+}
+
+TEST_F(DetectorTest, HandsOverWhenTheActiveSpeakerStops) {
+  SignalSource alice(Signal::kTone, 8192, 440);
+  SignalSource bob(Signal::kTone, 4096, 600);
+  SignalSource silence(Signal::kSilence, 0);
+
+  Feed(kAlice, &alice, 200);
+  Feed({{kAlice, &alice}, {kBob, &bob}}, 200);
+  EXPECT_EQ(State().active_speaker, kAlice);
+
+  Feed({{kAlice, &silence}, {kBob, &bob}}, 800);
+  EXPECT_EQ(State().active_speaker, kBob);
+  EXPECT_EQ(State().speaking, std::vector<uint32_t>{kBob});
+}
+
+TEST_F(DetectorTest, ResetReportsNobodySpeaking) {
+  SignalSource speech(Signal::kTone, 8192);
+  Feed(kAlice, &speech, 200);
+  ASSERT_EQ(changes_.size(), 1u);
+
+  detector_.Reset();
+  ASSERT_EQ(changes_.size(), 2u);
+  EXPECT_EQ(changes_[1].active_speaker, kNoActiveSpeaker);
+
+  // Nothing to report the second time.
+  detector_.Reset();
+  EXPECT_EQ(changes_.size(), 2u);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
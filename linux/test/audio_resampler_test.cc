@@ -0,0 +1,105 @@
+#include "audio_resampler.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Interleaved stereo sine at |frequency| with both channels equal.
+std::vector<int16_t> StereoTone(double frequency,
+                                int sample_rate,
+                                size_t frames) {
+  std::vector<int16_t> samples(frames * 2);
+  for (size_t i = 0; i < frames; ++i) {
+    auto value = static_cast<int16_t>(
+        10000 * std::sin(2 * kPi * frequency * i / sample_rate));
+    samples[i * 2] = value;
+    samples[i * 2 + 1] = value;
+  }
+  return samples;
+}
+
+// RMS of |samples| after skipping the filter's start-up transient.
+double SteadyStateRms(const std::vector<int16_t>& samples) {
+  size_t start = samples.size() / 4;
+  double sum = 0;
+  for (size_t i = start; i < samples.size(); ++i) {
+    sum += static_cast<double>(samples[i]) * samples[i];
+  }
+  return std::sqrt(sum / (samples.size() - start));
+}
+
+}  // namespace
+
+TEST(StreamingResampler, ProducesOutputRate) {
+  for (int input_rate : {8000, 16000, 32000, 44100, 48000}) {
+    StreamingResampler resampler(input_rate, 2);
+    std::vector<int16_t> input = StereoTone(440, input_rate, input_rate);
+    std::vector<int16_t> output;
+    resampler.Process(input.data(), input_rate, &output);
+    // One second in gives one second out, give or take the filter delay.
+    EXPECT_NEAR(static_cast<double>(output.size()), kAudioOutputSampleRate,
+                kAudioOutputSampleRate / 100.0)
+        << input_rate;
+  }
+}
+
+TEST(StreamingResampler, KeepsPassbandAndRemovesAliases) {
+  StreamingResampler passband(48000, 2);
+  std::vector<int16_t> input = StereoTone(1000, 48000, 48000);
+  std::vector<int16_t> output;
+  passband.Process(input.data(), 48000, &output);
+  // A full-scale 10000 sine has an RMS of 10000 / sqrt(2).
+  EXPECT_NEAR(SteadyStateRms(output), 7071, 250);
+
+  // 12 kHz is above the 8 kHz output Nyquist and would alias to 4 kHz.
+  StreamingResampler stopband(48000, 2);
+  input = StereoTone(12000, 48000, 48000);
+  output.clear();
+  stopband.Process(input.data(), 48000, &output);
+  EXPECT_LT(SteadyStateRms(output), 100);
+}
+
+TEST(StreamingResampler, ChunkingDoesNotChangeOutput) {
+  std::vector<int16_t> input = StereoTone(700, 44100, 44100);
+
+  StreamingResampler whole(44100, 2);
+  std::vector<int16_t> expected;
+  whole.Process(input.data(), 44100, &expected);
+
+  StreamingResampler chunked(44100, 2);
+  std::vector<int16_t> output;
+  size_t offset = 0;
+  for (size_t chunk : {1, 7, 441, 1000, 3}) {
+    chunked.Process(input.data() + offset * 2, chunk, &output);
+    offset += chunk;
+  }
+  chunked.Process(input.data() + offset * 2, 44100 - offset, &output);
+  EXPECT_EQ(output, expected);
+}
+
+TEST(StreamingResampler, DownmixesChannels) {
+  // Opposite channels cancel out in the mix.
+  std::vector<int16_t> input(4800 * 2);
+  for (size_t i = 0; i < 4800; ++i) {
+    input[i * 2] = 5000;
+    input[i * 2 + 1] = -5000;
+  }
+  StreamingResampler resampler(48000, 2);
+  std::vector<int16_t> output;
+  resampler.Process(input.data(), 4800, &output);
+  ASSERT_FALSE(output.empty());
+  for (int16_t sample : output) {
+    EXPECT_EQ(sample, 0);
+  }
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,119 @@
+#include "audio_stream_router.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "local_meeting_backend.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+LocalMeetingBackend::Config FastConfig() {
+  LocalMeetingBackend::Config config;
+  config.init_delay = std::chrono::milliseconds(0);
+  config.join_delay = std::chrono::milliseconds(0);
+  return config;
+}
+
+bool WaitFor(const std::function<bool()>& condition) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  return true;
+}
+
+class RawAudioCounter : public MeetingBackend::AudioSink {
+ public:
+  void OnAudioData(uint32_t participant_id,
+                   const int16_t* samples,
+                   size_t frames,
+                   int rate,
+                   int channels) override {
+    sample_rate = rate;
+    ++blocks;
+  }
+
+  std::atomic<int> blocks{0};
+  std::atomic<int> sample_rate{0};
+};
+
+}  // namespace
+
+TEST(AudioStreamRouter, RequiresInitializedBackend) {
+  LocalMeetingBackend backend(FastConfig());
+  AudioStreamRouter router(&backend, AudioStreamRouter::Config(),
+                           [](uint32_t) {});
+  EXPECT_EQ(router.Subscribe(kMixedAudioParticipantId), nullptr);
+  EXPECT_EQ(router.stream_count(), 0u);
+}
+
+TEST(AudioStreamRouter, StreamsResampledAudioWithCoalescedNotifications) {
+  LocalMeetingBackend backend(FastConfig());
+  InitParams params;
+  params.domain = "zoom.us";
+  backend.Initialize(params);
+
+  std::atomic<int> notifications{0};
+  AudioStreamRouter router(&backend, AudioStreamRouter::Config(),
+                           [&](uint32_t participant_id) {
+                             EXPECT_EQ(participant_id, 16778240u);
+                             notifications++;
+                           });
+  const PcmRingBuffer* ring = router.Subscribe(16778240);
+  ASSERT_NE(ring, nullptr);
+  EXPECT_EQ(router.Subscribe(16778240), ring);
+  EXPECT_EQ(ring->header().sample_rate,
+            static_cast<uint32_t>(kAudioOutputSampleRate));
+
+  ASSERT_TRUE(WaitFor([&] { return ring->write_position() >= 3200; }));
+  // Nothing re-arms the notification, so only one is sent however much
+  // audio arrives.
+  EXPECT_EQ(notifications, 1);
+
+  router.AcknowledgeNotification(16778240);
+  ASSERT_TRUE(WaitFor([&] { return notifications == 2; }));
+
+  EXPECT_TRUE(router.Unsubscribe(16778240));
+  EXPECT_FALSE(router.Unsubscribe(16778240));
+  EXPECT_EQ(router.stream_count(), 0u);
+}
+
+TEST(AudioStreamRouter, HandsRawAudioToTheRecorder) {
+  LocalMeetingBackend backend(FastConfig());
+  AudioStreamRouter router(&backend, AudioStreamRouter::Config(),
+                           [](uint32_t) {});
+  RawAudioCounter recorder;
+  EXPECT_FALSE(router.SetRecorder(&recorder));
+
+  InitParams params;
+  params.domain = "zoom.us";
+  backend.Initialize(params);
+  ASSERT_TRUE(router.SetRecorder(&recorder));
+  // Every stream arrives at its source rate, without a subscription.
+  ASSERT_TRUE(WaitFor([&] { return recorder.blocks > 2; }));
+  EXPECT_NE(recorder.sample_rate, kAudioOutputSampleRate);
+
+  // Unsubscribing the last stream leaves raw audio running for the
+  // recorder.
+  ASSERT_NE(router.Subscribe(kMixedAudioParticipantId), nullptr);
+  EXPECT_TRUE(router.Unsubscribe(kMixedAudioParticipantId));
+  int blocks = recorder.blocks;
+  ASSERT_TRUE(WaitFor([&] { return recorder.blocks > blocks; }));
+
+  EXPECT_TRUE(router.SetRecorder(nullptr));
+  blocks = recorder.blocks;
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(recorder.blocks, blocks);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
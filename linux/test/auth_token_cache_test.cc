@@ -0,0 +1,170 @@
+#include "auth_token_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+constexpr int64_t kIssuedAt = 1700000000;
+
+int64_t fake_now = 0;
+
+int64_t FakeNow() {
+  return fake_now;
+}
+
+std::string Base64Url(const std::string& data) {
+  static const char kDigits[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+  std::string out;
+  uint32_t bits = 0;
+  int bit_count = 0;
+  for (char c : data) {
+    bits = (bits << 8) | static_cast<uint8_t>(c);
+    bit_count += 8;
+    while (bit_count >= 6) {
+      bit_count -= 6;
+      out.push_back(kDigits[(bits >> bit_count) & 0x3f]);
+    }
+  }
+  if (bit_count > 0) {
+    out.push_back(kDigits[(bits << (6 - bit_count)) & 0x3f]);
+  }
+  return out;
+}
+
+// Builds an unsigned token around |payload|.
+std::string MakeToken(const std::string& payload) {
+  return Base64Url(R"({"alg":"HS256","typ":"JWT"})") + "." +
+         Base64Url(payload) + ".c2lnbmF0dXJl";
+}
+
+std::string MakeToken(const std::string& app_key,
+                      int64_t issued_at,
+                      int64_t expires_at) {
+  return MakeToken("{\"appKey\":\"" + app_key +
+                   "\",\"iat\":" + std::to_string(issued_at) +
+                   ",\"exp\":" + std::to_string(expires_at) + "}");
+}
+
+AuthTokenCache::Config NoJitter() {
+  AuthTokenCache::Config config;
+  config.refresh_jitter_s = 0;
+  return config;
+}
+
+}  // namespace
+
+TEST(ParseJwtClaimsTest, ReadsTheClaims) {
+  JwtClaims claims;
+  ASSERT_TRUE(ParseJwtClaims(
+      MakeToken(R"({ "sdkKey" : "key", "role": 0, "mn": "123",
+                     "extra": {"a": [1, "}", {"b": null}]},
+                     "iat": 1700000000, "exp": 1700007200.5,
+                     "tokenExp": 1700003600 })"),
+      &claims));
+  EXPECT_EQ(claims.app_key, "key");
+  EXPECT_EQ(claims.issued_at, 1700000000);
+  EXPECT_EQ(claims.expires_at, 1700003600);
+}
+
+TEST(ParseJwtClaimsTest, RejectsMalformedTokens) {
+  JwtClaims claims;
+  EXPECT_FALSE(ParseJwtClaims("", &claims));
+  EXPECT_FALSE(ParseJwtClaims("not-a-jwt", &claims));
+  EXPECT_FALSE(ParseJwtClaims("a.b.c.d", &claims));
+  EXPECT_FALSE(ParseJwtClaims("a.!!!.c", &claims));
+  EXPECT_FALSE(ParseJwtClaims(MakeToken(R"({"iat": 1})"), &claims));
+  EXPECT_FALSE(ParseJwtClaims(MakeToken(R"({"iat": 1, "exp": "2"})"),
+                              &claims));
+  EXPECT_FALSE(ParseJwtClaims(MakeToken(R"({"iat": 1, "exp": 2e9})"),
+                              &claims));
+  EXPECT_FALSE(ParseJwtClaims(MakeToken(R"({"iat": 5, "exp": 5})"),
+                              &claims));
+  EXPECT_FALSE(ParseJwtClaims(MakeToken(R"({"iat": 1, "exp": 2)"), &claims));
+}
+
+TEST(AuthTokenCacheTest, CachesValidTokensByAppKey) {
+  fake_now = kIssuedAt;
+  AuthTokenCache cache(NoJitter(), FakeNow);
+  std::string first = MakeToken("first", kIssuedAt, kIssuedAt + 3600);
+  std::string second = MakeToken("second", kIssuedAt, kIssuedAt + 3600);
+
+  EXPECT_EQ(cache.Store(first), AuthTokenCache::Status::kValid);
+  EXPECT_EQ(cache.Store(second), AuthTokenCache::Status::kValid);
+  EXPECT_EQ(cache.Store("garbage"), AuthTokenCache::Status::kMalformed);
+  EXPECT_EQ(cache.Store(MakeToken("first", kIssuedAt - 7200, kIssuedAt)),
+            AuthTokenCache::Status::kExpired);
+
+  EXPECT_EQ(cache.Get("first"), first);
+  EXPECT_EQ(cache.Get("second"), second);
+  EXPECT_EQ(cache.Get(""), second);
+  EXPECT_EQ(cache.Get("third"), "");
+
+  // A token expiring sooner does not replace a cached one.
+  EXPECT_EQ(cache.Store(MakeToken("first", kIssuedAt, kIssuedAt + 600)),
+            AuthTokenCache::Status::kValid);
+  EXPECT_EQ(cache.Get("first"), first);
+
+  fake_now = kIssuedAt + 3600;
+  EXPECT_EQ(cache.Get("first"), "");
+  EXPECT_EQ(cache.NextRefreshAt(), 0);
+}
+
+TEST(AuthTokenCacheTest, ReportsTokensOnceAheadOfExpiry) {
+  fake_now = kIssuedAt;
+  AuthTokenCache cache(NoJitter(), FakeNow);
+  cache.Store(MakeToken("hour", kIssuedAt, kIssuedAt + 3600));
+  // Short-lived tokens are refreshed a quarter of their lifetime early.
+  cache.Store(MakeToken("short", kIssuedAt, kIssuedAt + 400));
+
+  EXPECT_EQ(cache.NextRefreshAt(), kIssuedAt + 300);
+  EXPECT_TRUE(cache.TakeDue().empty());
+
+  fake_now = kIssuedAt + 300;
+  std::vector<AuthTokenCache::Token> due = cache.TakeDue();
+  ASSERT_EQ(due.size(), 1u);
+  EXPECT_EQ(due[0].claims.app_key, "short");
+  EXPECT_EQ(due[0].claims.expires_at, kIssuedAt + 400);
+  EXPECT_TRUE(cache.TakeDue().empty());
+  EXPECT_EQ(cache.NextRefreshAt(), kIssuedAt + 3300);
+
+  // A replacement is reported again in its turn.
+  cache.Store(MakeToken("short", kIssuedAt + 300, kIssuedAt + 700));
+  EXPECT_EQ(cache.NextRefreshAt(), kIssuedAt + 600);
+
+  fake_now = kIssuedAt + 3300;
+  due = cache.TakeDue();
+  ASSERT_EQ(due.size(), 1u);
+  EXPECT_EQ(due[0].claims.app_key, "hour");
+  EXPECT_EQ(cache.NextRefreshAt(), 0);
+}
+
+TEST(AuthTokenCacheTest, SpreadsRefreshesOfTokensMintedTogether) {
+  fake_now = kIssuedAt;
+  AuthTokenCache cache(AuthTokenCache::Config(), FakeNow);
+  int64_t earliest = kIssuedAt + 3600;
+  int64_t latest = 0;
+  for (int i = 0; i < 20; ++i) {
+    cache.Store(MakeToken("bot" + std::to_string(i), kIssuedAt,
+                          kIssuedAt + 3600));
+  }
+  fake_now = kIssuedAt + 3600 - 300 - 120;
+  while (fake_now < kIssuedAt + 3600) {
+    for (const AuthTokenCache::Token& token : cache.TakeDue()) {
+      EXPECT_GE(token.refresh_at, kIssuedAt + 3600 - 300 - 120);
+      EXPECT_LE(token.refresh_at, kIssuedAt + 3600 - 300);
+      earliest = std::min(earliest, token.refresh_at);
+      latest = std::max(latest, token.refresh_at);
+    }
+    ++fake_now;
+  }
+  EXPECT_GT(latest - earliest, 30);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,85 @@
+#include <flutter_linux/flutter_linux.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "include/flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_plugin.h"
+#include "flutter_zoom_meeting_sdk_plugin_private.h"
+#include "meeting_options_codec.h"
+
+// This demonstrates a simple unit test of the C portion of this plugin's
+// implementation.
+//
+// Once you have built the plugin's example app, you can run these tests
+// from the command line. For instance, for a plugin called my_plugin
+// built for x64 debug, run:
+// $ build/linux/x64/debug/plugins/my_plugin/my_plugin_test
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+TEST(FlutterZoomMeetingSdkPlugin, GetPlatformVersion) {
+  g_autoptr(FlMethodResponse) response = get_platform_version();
+  ASSERT_NE(response, nullptr);
+  ASSERT_TRUE(FL_IS_METHOD_SUCCESS_RESPONSE(response));
+  FlValue* result = fl_method_success_response_get_result(
+      FL_METHOD_SUCCESS_RESPONSE(response));
+  ASSERT_EQ(fl_value_get_type(result), FL_VALUE_TYPE_STRING);
+  // The full string varies, so just validate that it has the right format.
+  EXPECT_THAT(fl_value_get_string(result), testing::StartsWith("Linux "));
+}
+
+TEST(FlutterZoomMeetingSdkPlugin, ParseMeetingOptions) {
+  g_autoptr(FlValue) args = fl_value_new_map();
+  fl_value_set_string_take(args, "userId", fl_value_new_string("bot"));
+  fl_value_set_string_take(args, "meetingId", fl_value_new_string("123"));
+  fl_value_set_string_take(args, "noAudio", fl_value_new_string("TRUE"));
+  fl_value_set_string_take(args, "disableShare", fl_value_new_string("no"));
+  fl_value_set_string_take(args, "meetingViewOptions",
+                           fl_value_new_string("130"));
+
+  MeetingOptions options = parse_meeting_options(args);
+  EXPECT_EQ(options.user_id, "bot");
+  EXPECT_EQ(options.meeting_id, "123");
+  EXPECT_EQ(options.meeting_password, "");
+  EXPECT_TRUE(options.no_audio);
+  EXPECT_FALSE(options.disable_share);
+  EXPECT_FALSE(options.disable_dial_in);
+  EXPECT_EQ(options.meeting_view_options, 130);
+}
+
+TEST(FlutterZoomMeetingSdkPlugin, ReadPackedMeetingOptions) {
+  MeetingOptions sent;
+  sent.meeting_id = "123";
+  sent.no_audio = true;
+  std::vector<uint8_t> packed = EncodeMeetingOptions(sent);
+  g_autoptr(FlValue) args = fl_value_new_uint8_list(packed.data(),
+                                                    packed.size());
+
+  MeetingOptions options;
+  ASSERT_TRUE(read_meeting_options(args, &options));
+  EXPECT_EQ(options.meeting_id, "123");
+  EXPECT_TRUE(options.no_audio);
+
+  g_autoptr(FlValue) truncated = fl_value_new_uint8_list(packed.data(), 8);
+  EXPECT_FALSE(read_meeting_options(truncated, &options));
+
+  // The string map is still accepted.
+  g_autoptr(FlValue) map = fl_value_new_map();
+  fl_value_set_string_take(map, "meetingId", fl_value_new_string("456"));
+  ASSERT_TRUE(read_meeting_options(map, &options));
+  EXPECT_EQ(options.meeting_id, "456");
+  EXPECT_FALSE(options.no_audio);
+}
+
+TEST(FlutterZoomMeetingSdkPlugin, MeetingStatusValue) {
+  g_autoptr(FlValue) value = meeting_status_value(MeetingStatus::kInMeeting);
+  ASSERT_EQ(fl_value_get_type(value), FL_VALUE_TYPE_LIST);
+  ASSERT_EQ(fl_value_get_length(value), 2u);
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_list_value(value, 0)),
+               "MEETING_STATUS_INMEETING");
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_list_value(value, 1)),
+               "Meeting is ready and in process.");
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,159 @@
+#include "frame_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "video_frame.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+FramePool::Config PoolConfig(size_t max_bytes) {
+  FramePool::Config config;
+  config.max_bytes = max_bytes;
+  return config;
+}
+
+}  // namespace
+
+TEST(FramePool, RoundsUpToASizeClass) {
+  FramePool pool(PoolConfig(64 << 20));
+  void* small = pool.Allocate(100);
+  void* frame = pool.Allocate(640 * 360 * 3 / 2);
+  ASSERT_NE(small, nullptr);
+  ASSERT_NE(frame, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(small) % kFrameBufferAlignment, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(frame) % kFrameBufferAlignment, 0u);
+
+  FramePool::Stats stats = pool.GetStats();
+  ASSERT_EQ(stats.classes.size(), 2u);
+  EXPECT_EQ(stats.classes[0].buffer_size, 4096u);
+  // 345600 bytes fit the 384 KiB class, 256 KiB * 1.5.
+  EXPECT_EQ(stats.classes[1].buffer_size, 393216u);
+  EXPECT_EQ(stats.in_use_bytes, 4096u + 393216u);
+
+  pool.Release(small, 100);
+  pool.Release(frame, 640 * 360 * 3 / 2);
+}
+
+TEST(FramePool, ReusesReleasedBuffers) {
+  FramePool pool(PoolConfig(64 << 20));
+  void* first = pool.Allocate(100000);
+  pool.Release(first, 100000);
+  FramePool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.in_use_bytes, 0u);
+  EXPECT_EQ(stats.free_bytes, 114688u);
+
+  // Any size in the same 112 KiB class gets the buffer back.
+  void* second = pool.Allocate(110000);
+  EXPECT_EQ(second, first);
+  stats = pool.GetStats();
+  EXPECT_EQ(stats.in_use_bytes, 114688u);
+  EXPECT_EQ(stats.free_bytes, 0u);
+  pool.Release(second, 110000);
+}
+
+TEST(FramePool, ReusesBuffersReleasedOnOtherThreads) {
+  FramePool pool(PoolConfig(64 << 20));
+  std::vector<void*> buffers;
+  for (int i = 0; i < 8; ++i) {
+    buffers.push_back(pool.Allocate(8192));
+  }
+  // Beyond the releasing thread's own list, they go to the shared list.
+  std::thread([&] {
+    for (void* buffer : buffers) {
+      pool.Release(buffer, 8192);
+    }
+  }).join();
+  buffers.clear();
+  for (int i = 0; i < 6; ++i) {
+    buffers.push_back(pool.Allocate(8192));
+    EXPECT_NE(buffers.back(), nullptr);
+  }
+  FramePool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.peak_bytes, 8u * 8192);
+  EXPECT_EQ(stats.in_use_bytes, 6u * 8192);
+  EXPECT_EQ(stats.classes[0].peak_bytes, 8u * 8192);
+  for (void* buffer : buffers) {
+    pool.Release(buffer, 8192);
+  }
+}
+
+TEST(FramePool, CapsHeldBytes) {
+  FramePool pool(PoolConfig(3 * 8192));
+  void* first = pool.Allocate(8192);
+  void* second = pool.Allocate(8192);
+  void* third = pool.Allocate(8192);
+  ASSERT_NE(third, nullptr);
+  EXPECT_EQ(pool.Allocate(8192), nullptr);
+  EXPECT_EQ(pool.GetStats().failed_allocations, 1u);
+
+  // Free buffers of another class are given back to make room.
+  pool.Release(first, 8192);
+  pool.Release(second, 8192);
+  void* larger = pool.Allocate(16384);
+  ASSERT_NE(larger, nullptr);
+  FramePool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.free_bytes, 0u);
+  EXPECT_EQ(stats.in_use_bytes, 8192u + 16384u);
+  EXPECT_EQ(pool.Allocate(FramePool::kMaxBufferSize + 1), nullptr);
+
+  pool.Release(third, 8192);
+  pool.Release(larger, 16384);
+}
+
+TEST(FramePool, TrimsFreeBuffers) {
+  FramePool pool(PoolConfig(64 << 20));
+  void* buffer = pool.Allocate(4096);
+  pool.Release(buffer, 4096);
+  pool.Trim();
+  FramePool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.free_bytes, 0u);
+  ASSERT_EQ(stats.classes.size(), 1u);
+  EXPECT_EQ(stats.classes[0].peak_bytes, 4096u);
+}
+
+TEST(FramePool, SurvivesConcurrentUse) {
+  FramePool pool(PoolConfig(64 << 20));
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&pool, t] {
+      for (int i = 0; i < 2000; ++i) {
+        size_t size = 4096 * (1 + (i + t) % 5);
+        void* buffer = pool.Allocate(size);
+        ASSERT_NE(buffer, nullptr);
+        static_cast<uint8_t*>(buffer)[size - 1] = 1;
+        pool.Release(buffer, size);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(pool.GetStats().in_use_bytes, 0u);
+}
+
+TEST(VideoFrame, AllocatesAlignedPlanesFromThePool) {
+  uint64_t in_use = FramePool::Get()->GetStats().in_use_bytes;
+  std::shared_ptr<VideoFrame> frame = VideoFrame::Allocate(33, 17);
+  ASSERT_NE(frame, nullptr);
+  EXPECT_EQ(frame->stride_y(), 33);
+  EXPECT_EQ(frame->stride_u(), 17);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(frame->data_u()) %
+                kFrameBufferAlignment,
+            0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(frame->data_v()) %
+                kFrameBufferAlignment,
+            0u);
+  EXPECT_GT(FramePool::Get()->GetStats().in_use_bytes, in_use);
+  frame.reset();
+  EXPECT_EQ(FramePool::Get()->GetStats().in_use_bytes, in_use);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,198 @@
+#include "gallery_compositor.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+// A grey frame; luma 16 and 235 convert to black and white.
+std::shared_ptr<VideoFrame> SolidFrame(int width, int height, uint8_t luma) {
+  std::shared_ptr<VideoFrame> frame = VideoFrame::Allocate(width, height);
+  memset(frame->mutable_data_y(), luma,
+         static_cast<size_t>(frame->stride_y()) * height);
+  memset(frame->mutable_data_u(), 128,
+         static_cast<size_t>(frame->stride_u()) * frame->chroma_height());
+  memset(frame->mutable_data_v(), 128,
+         static_cast<size_t>(frame->stride_v()) * frame->chroma_height());
+  return frame;
+}
+
+GalleryTile Tile(uint32_t participant_id, int x, int y, int width, int height) {
+  GalleryTile tile;
+  tile.participant_id = participant_id;
+  tile.x = x;
+  tile.y = y;
+  tile.width = width;
+  tile.height = height;
+  return tile;
+}
+
+int64_t fake_now_us = 0;
+
+int64_t FakeNow() {
+  return fake_now_us;
+}
+
+const uint8_t* Pixel(const uint8_t* rgba, uint32_t width, int x, int y) {
+  return rgba + (static_cast<size_t>(y) * width + x) * 4;
+}
+
+}  // namespace
+
+TEST(GalleryCompositor, ValidatesLayout) {
+  EXPECT_TRUE(GalleryCompositor::IsValidLayout(
+      64, 32, {Tile(1, 0, 0, 32, 32), Tile(2, 32, 0, 32, 32)}));
+  EXPECT_FALSE(
+      GalleryCompositor::IsValidLayout(64, 32, {Tile(1, 40, 0, 32, 32)}));
+  EXPECT_FALSE(GalleryCompositor::IsValidLayout(
+      64, 32, {Tile(1, 0, 0, 32, 32), Tile(1, 32, 0, 32, 32)}));
+  EXPECT_FALSE(
+      GalleryCompositor::IsValidLayout(64, 32, {Tile(1, 0, 0, 0, 32)}));
+  EXPECT_FALSE(GalleryCompositor::IsValidLayout(
+      GalleryCompositor::kMaxAtlasSize + 1, 32, {}));
+}
+
+TEST(GalleryCompositor, NothingToRenderWithoutLayout) {
+  GalleryCompositor compositor;
+  EXPECT_FALSE(compositor.Push(1, SolidFrame(16, 16, 235)));
+  const uint8_t* rgba;
+  uint32_t width, height;
+  EXPECT_FALSE(compositor.Render(&rgba, &width, &height));
+}
+
+TEST(GalleryCompositor, DrawsTilesIntoOneAtlas) {
+  GalleryCompositor compositor;
+  EXPECT_TRUE(compositor.SetLayout(
+      64, 32, {Tile(1, 0, 0, 32, 32), Tile(2, 32, 0, 32, 32)}));
+  // One announcement covers every push until the next render.
+  EXPECT_FALSE(compositor.Push(1, SolidFrame(64, 64, 235)));
+  EXPECT_FALSE(compositor.Push(2, SolidFrame(16, 16, 16)));
+  EXPECT_FALSE(compositor.Push(3, SolidFrame(16, 16, 16)));
+
+  const uint8_t* rgba;
+  uint32_t width, height;
+  ASSERT_TRUE(compositor.Render(&rgba, &width, &height));
+  EXPECT_EQ(width, 64u);
+  EXPECT_EQ(height, 32u);
+  EXPECT_EQ(compositor.blit_count(), 2u);
+  EXPECT_EQ(Pixel(rgba, width, 10, 10)[0], 255);
+  EXPECT_EQ(Pixel(rgba, width, 40, 10)[0], 0);
+  EXPECT_EQ(Pixel(rgba, width, 40, 10)[3], 255);
+}
+
+TEST(GalleryCompositor, OnlyRedrawsDirtyTiles) {
+  GalleryCompositor compositor;
+  compositor.SetLayout(64, 32,
+                       {Tile(1, 0, 0, 32, 32), Tile(2, 32, 0, 32, 32)});
+  compositor.Push(1, SolidFrame(32, 32, 235));
+  compositor.Push(2, SolidFrame(32, 32, 235));
+  const uint8_t* rgba;
+  uint32_t width, height;
+  compositor.Render(&rgba, &width, &height);
+  ASSERT_EQ(compositor.blit_count(), 2u);
+
+  EXPECT_TRUE(compositor.Push(2, SolidFrame(32, 32, 16)));
+  compositor.Render(&rgba, &width, &height);
+  EXPECT_EQ(compositor.blit_count(), 3u);
+  EXPECT_EQ(Pixel(rgba, width, 10, 10)[0], 255);
+  EXPECT_EQ(Pixel(rgba, width, 40, 10)[0], 0);
+
+  // Nothing new: the atlas is handed back untouched.
+  compositor.Render(&rgba, &width, &height);
+  EXPECT_EQ(compositor.blit_count(), 3u);
+}
+
+TEST(GalleryCompositor, LetterboxesToKeepAspectRatio) {
+  GalleryCompositor compositor;
+  compositor.SetLayout(32, 32, {Tile(1, 0, 0, 32, 32)});
+  // 2:1 video in a square tile leaves bars above and below.
+  compositor.Push(1, SolidFrame(64, 32, 235));
+  const uint8_t* rgba;
+  uint32_t width, height;
+  compositor.Render(&rgba, &width, &height);
+  EXPECT_EQ(Pixel(rgba, width, 16, 2)[0], 0);
+  EXPECT_EQ(Pixel(rgba, width, 16, 2)[3], 255);
+  EXPECT_EQ(Pixel(rgba, width, 16, 16)[0], 255);
+  EXPECT_EQ(Pixel(rgba, width, 16, 30)[0], 0);
+}
+
+TEST(GalleryCompositor, RelayoutRedrawsLastFrames) {
+  GalleryCompositor compositor;
+  compositor.SetLayout(64, 32, {Tile(1, 0, 0, 32, 32)});
+  compositor.Push(1, SolidFrame(32, 32, 235));
+  const uint8_t* rgba;
+  uint32_t width, height;
+  compositor.Render(&rgba, &width, &height);
+
+  // Moving the tile redraws its last frame without waiting for a new one.
+  EXPECT_TRUE(compositor.SetLayout(64, 32, {Tile(1, 32, 0, 32, 32)}));
+  compositor.Render(&rgba, &width, &height);
+  EXPECT_EQ(compositor.blit_count(), 2u);
+  EXPECT_EQ(Pixel(rgba, width, 10, 10)[3], 0);
+  EXPECT_EQ(Pixel(rgba, width, 40, 10)[0], 255);
+}
+
+TEST(GalleryCompositor, BlanksTilesPastTheLiveLimit) {
+  GalleryCompositor compositor;
+  compositor.SetLayout(64, 32,
+                       {Tile(1, 0, 0, 32, 32), Tile(2, 32, 0, 32, 32)});
+  compositor.Push(1, SolidFrame(32, 32, 235));
+  compositor.Push(2, SolidFrame(32, 32, 235));
+  const uint8_t* rgba;
+  uint32_t width, height;
+  compositor.Render(&rgba, &width, &height);
+  ASSERT_EQ(Pixel(rgba, width, 40, 10)[0], 255);
+
+  EXPECT_TRUE(compositor.SetMaxLiveTiles(1));
+  EXPECT_FALSE(compositor.SetMaxLiveTiles(1));
+  EXPECT_FALSE(compositor.Push(2, SolidFrame(32, 32, 235)));
+  compositor.Render(&rgba, &width, &height);
+  EXPECT_EQ(compositor.blit_count(), 3u);
+  EXPECT_EQ(Pixel(rgba, width, 10, 10)[0], 255);
+  EXPECT_EQ(Pixel(rgba, width, 40, 10)[3], 0);
+
+  // Lifting the limit shows the tile again from its next frame.
+  compositor.SetMaxLiveTiles(0);
+  compositor.Push(2, SolidFrame(32, 32, 235));
+  compositor.Render(&rgba, &width, &height);
+  EXPECT_EQ(Pixel(rgba, width, 40, 10)[0], 255);
+}
+
+TEST(GalleryCompositor, CountsDroppedFramesAndAge) {
+  fake_now_us = 1000000;
+  GalleryCompositor compositor(FakeNow);
+  compositor.SetLayout(64, 32,
+                       {Tile(1, 0, 0, 32, 32), Tile(2, 32, 0, 32, 32)});
+  compositor.Push(1, SolidFrame(32, 32, 16));
+  compositor.Push(1, SolidFrame(32, 32, 235));
+  fake_now_us += 10000;
+  compositor.Push(2, SolidFrame(32, 32, 235));
+  fake_now_us += 10000;
+  const uint8_t* rgba;
+  uint32_t width, height;
+  compositor.Render(&rgba, &width, &height);
+
+  VideoFrameStats stats = compositor.GetStats();
+  EXPECT_EQ(stats.produced, 3u);
+  EXPECT_EQ(stats.displayed, 2u);
+  EXPECT_EQ(stats.dropped, 1u);
+  EXPECT_EQ(stats.max_age_us, 20000);
+  EXPECT_EQ(stats.mean_age_us(), 15000);
+
+  // Redrawing after a relayout displays no new frames, and a frame pending
+  // for a tile that leaves the layout is dropped.
+  compositor.Push(2, SolidFrame(32, 32, 16));
+  compositor.SetLayout(64, 32, {Tile(1, 32, 0, 32, 32)});
+  compositor.Render(&rgba, &width, &height);
+  stats = compositor.GetStats();
+  EXPECT_EQ(stats.produced, 4u);
+  EXPECT_EQ(stats.displayed, 2u);
+  EXPECT_EQ(stats.dropped, 2u);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,119 @@
+#include "local_meeting_backend.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+LocalMeetingBackend::Config FastConfig() {
+  LocalMeetingBackend::Config config;
+  config.init_delay = std::chrono::milliseconds(0);
+  config.join_delay = std::chrono::milliseconds(0);
+  return config;
+}
+
+class RecordingObserver : public MeetingBackend::Observer {
+ public:
+  void OnMeetingStatusChanged(const std::string& meeting_id,
+                              MeetingStatus status,
+                              int32_t error_code,
+                              int32_t internal_error_code) override {
+    meeting_ids.push_back(meeting_id);
+    statuses.push_back(status);
+  }
+
+  std::vector<std::string> meeting_ids;
+  std::vector<MeetingStatus> statuses;
+};
+
+}  // namespace
+
+TEST(LocalMeetingBackend, RejectsEmptyDomain) {
+  LocalMeetingBackend backend(FastConfig());
+  InitResult result = backend.Initialize(InitParams());
+  EXPECT_EQ(result.error_code, kZoomErrorInvalidArguments);
+  EXPECT_FALSE(backend.IsInitialized());
+}
+
+TEST(LocalMeetingBackend, JoinRequiresInitialize) {
+  LocalMeetingBackend backend(FastConfig());
+  MeetingOptions options;
+  options.meeting_id = "123";
+  EXPECT_FALSE(backend.JoinMeeting(options));
+
+  InitParams params;
+  params.domain = "zoom.us";
+  EXPECT_EQ(backend.Initialize(params).error_code, kZoomErrorSuccess);
+  EXPECT_TRUE(backend.JoinMeeting(options));
+  EXPECT_EQ(backend.GetMeetingStatus(), MeetingStatus::kInMeeting);
+}
+
+TEST(LocalMeetingBackend, ReportsJoinTransitions) {
+  LocalMeetingBackend backend(FastConfig());
+  RecordingObserver observer;
+  backend.SetObserver(&observer);
+
+  InitParams params;
+  params.domain = "zoom.us";
+  backend.Initialize(params);
+  MeetingOptions options;
+  options.meeting_id = "123";
+  backend.JoinMeeting(options);
+  backend.SetObserver(nullptr);
+
+  EXPECT_EQ(observer.statuses,
+            (std::vector<MeetingStatus>{MeetingStatus::kConnecting,
+                                        MeetingStatus::kInMeeting}));
+  EXPECT_EQ(observer.meeting_ids, (std::vector<std::string>{"123", "123"}));
+}
+
+TEST(LocalMeetingBackend, AttendsConcurrentMeetings) {
+  LocalMeetingBackend backend(FastConfig());
+  RecordingObserver observer;
+  backend.SetObserver(&observer);
+
+  InitParams params;
+  params.domain = "zoom.us";
+  backend.Initialize(params);
+  MeetingOptions first;
+  first.meeting_id = "123";
+  MeetingOptions second;
+  second.meeting_id = "456";
+  EXPECT_TRUE(backend.JoinMeeting(first));
+  EXPECT_TRUE(backend.JoinMeeting(second));
+  // Already attending.
+  EXPECT_FALSE(backend.JoinMeeting(first));
+
+  EXPECT_TRUE(backend.LeaveMeeting("123"));
+  EXPECT_FALSE(backend.LeaveMeeting("123"));
+  backend.SetObserver(nullptr);
+
+  ASSERT_EQ(observer.statuses.size(), 6u);
+  EXPECT_EQ(observer.meeting_ids[4], "123");
+  EXPECT_EQ(observer.statuses[4], MeetingStatus::kDisconnecting);
+  EXPECT_EQ(observer.meeting_ids[5], "123");
+  EXPECT_EQ(observer.statuses[5], MeetingStatus::kIdle);
+
+  // A meeting that was left can be joined again.
+  EXPECT_TRUE(backend.JoinMeeting(first));
+}
+
+TEST(LocalMeetingBackend, StartRequiresAccessToken) {
+  LocalMeetingBackend backend(FastConfig());
+  InitParams params;
+  params.domain = "zoom.us";
+  backend.Initialize(params);
+  MeetingOptions options;
+  options.meeting_id = "123";
+  EXPECT_FALSE(backend.StartMeeting(options));
+  options.zoom_access_token = "zak";
+  EXPECT_TRUE(backend.StartMeeting(options));
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,86 @@
+#include "meeting_options_codec.h"
+
+#include <gtest/gtest.h>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+TEST(MeetingOptionsCodec, RoundTrips) {
+  MeetingOptions options;
+  options.user_id = "bot";
+  options.display_name = "Bot \xc3\xa9";
+  options.meeting_id = "84512345678";
+  options.meeting_password = "s3cr3t";
+  options.disable_invite = true;
+  options.no_audio = true;
+  options.meeting_view_options = 130;
+
+  std::vector<uint8_t> packed = EncodeMeetingOptions(options);
+  EXPECT_EQ(packed.size(), kMeetingOptionsMinSize + 3 + 6 + 11 + 6);
+
+  MeetingOptions decoded;
+  ASSERT_TRUE(DecodeMeetingOptions(packed.data(), packed.size(), &decoded));
+  EXPECT_EQ(decoded.user_id, "bot");
+  EXPECT_EQ(decoded.display_name, "Bot \xc3\xa9");
+  EXPECT_EQ(decoded.meeting_id, "84512345678");
+  EXPECT_EQ(decoded.meeting_password, "s3cr3t");
+  EXPECT_EQ(decoded.zoom_access_token, "");
+  EXPECT_FALSE(decoded.disable_dial_in);
+  EXPECT_FALSE(decoded.disable_drive);
+  EXPECT_TRUE(decoded.disable_invite);
+  EXPECT_FALSE(decoded.disable_share);
+  EXPECT_FALSE(decoded.no_disconnect_audio);
+  EXPECT_TRUE(decoded.no_audio);
+  EXPECT_EQ(decoded.meeting_view_options, 130);
+}
+
+TEST(MeetingOptionsCodec, MatchesDocumentedLayout) {
+  MeetingOptions options;
+  options.meeting_id = "42";
+  options.disable_dial_in = true;
+  options.no_audio = true;
+  options.meeting_view_options = -1;
+
+  std::vector<uint8_t> expected = {
+      1, 0, 0, 0,                    // version
+      0x21, 0, 0, 0,                 // flags
+      0xff, 0xff, 0xff, 0xff,        // meeting view options
+      0, 0, 0, 0,                    // user ID
+      0, 0, 0, 0,                    // display name
+      2, 0, 0, 0, '4', '2',          // meeting ID
+      0, 0, 0, 0,                    // meeting password
+      0, 0, 0, 0,                    // Zoom access token
+  };
+  EXPECT_EQ(EncodeMeetingOptions(options), expected);
+}
+
+TEST(MeetingOptionsCodec, RejectsMalformedRecords) {
+  MeetingOptions options;
+  options.meeting_id = "42";
+  std::vector<uint8_t> packed = EncodeMeetingOptions(options);
+  MeetingOptions decoded;
+
+  // Truncated inside a string, and with a trailing byte.
+  EXPECT_FALSE(
+      DecodeMeetingOptions(packed.data(), packed.size() - 5, &decoded));
+  std::vector<uint8_t> longer = packed;
+  longer.push_back(0);
+  EXPECT_FALSE(DecodeMeetingOptions(longer.data(), longer.size(), &decoded));
+
+  // A string length past the end of the record.
+  std::vector<uint8_t> overlong = packed;
+  overlong[12] = 0xff;
+  EXPECT_FALSE(
+      DecodeMeetingOptions(overlong.data(), overlong.size(), &decoded));
+
+  std::vector<uint8_t> future = packed;
+  future[0] = 2;
+  EXPECT_FALSE(DecodeMeetingOptions(future.data(), future.size(), &decoded));
+
+  EXPECT_FALSE(DecodeMeetingOptions(packed.data(), 4, &decoded));
+  EXPECT_TRUE(DecodeMeetingOptions(packed.data(), packed.size(), &decoded));
+  EXPECT_EQ(decoded.meeting_id, "42");
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
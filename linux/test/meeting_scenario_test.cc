@@ -0,0 +1,251 @@
+#include "meeting_scenario.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+constexpr uint32_t kFirstId = 1000;
+
+std::vector<ScenarioEvent> Play(const MeetingScenario& scenario,
+                                const std::string& meeting_id,
+                                size_t max_events) {
+  ScenarioTimeline timeline(scenario, meeting_id, kFirstId);
+  std::vector<ScenarioEvent> events;
+  ScenarioEvent event;
+  while (events.size() < max_events && timeline.Next(&event)) {
+    events.push_back(event);
+  }
+  return events;
+}
+
+std::vector<MeetingStatus> Statuses(const std::vector<ScenarioEvent>& events) {
+  std::vector<MeetingStatus> statuses;
+  for (const ScenarioEvent& event : events) {
+    if (event.type == ScenarioEvent::Type::kStatus) {
+      statuses.push_back(event.status);
+    }
+  }
+  return statuses;
+}
+
+}  // namespace
+
+TEST(MeetingScenario, ParsesSettings) {
+  MeetingScenario scenario;
+  std::string error;
+  ASSERT_TRUE(ParseMeetingScenario(
+      "# webinar\n"
+      "seed 42\n"
+      "speed 2.5\n"
+      "step CONNECTING 300 100\n"
+      "step MEETING_STATUS_WAITINGFORHOST 2000\n"
+      "step INMEETING   # joined\n"
+      "\n"
+      "participants 500\n"
+      "video_share 0.05\n"
+      "reconnect_count 1000\n"
+      "speaker_turn_ms 3000\n",
+      &scenario, &error))
+      << error;
+  EXPECT_EQ(scenario.seed, 42u);
+  EXPECT_DOUBLE_EQ(scenario.speed, 2.5);
+  ASSERT_EQ(scenario.join_steps.size(), 3u);
+  EXPECT_EQ(scenario.join_steps[0].jitter_ms, 100);
+  EXPECT_EQ(scenario.join_steps[1].status, MeetingStatus::kWaitingForHost);
+  EXPECT_EQ(scenario.join_steps[1].duration_ms, 2000);
+  EXPECT_EQ(scenario.participants, 500);
+  EXPECT_DOUBLE_EQ(scenario.video_share, 0.05);
+  EXPECT_EQ(scenario.reconnect_count, 1000);
+  EXPECT_EQ(scenario.speaker_turn_ms, 3000);
+  // Unset keys keep their defaults.
+  EXPECT_EQ(scenario.max_participants, 1000);
+}
+
+TEST(MeetingScenario, RejectsBadSettings) {
+  MeetingScenario scenario;
+  std::string error;
+  EXPECT_FALSE(ParseMeetingScenario("participants -1\n", &scenario, &error));
+  EXPECT_EQ(error, "line 1: invalid \"participants\" setting");
+  EXPECT_FALSE(ParseMeetingScenario("\nbogus 1\n", &scenario, &error));
+  EXPECT_EQ(error, "line 2: invalid \"bogus\" setting");
+  EXPECT_FALSE(ParseMeetingScenario("speed 0\n", &scenario, &error));
+  EXPECT_FALSE(ParseMeetingScenario("video_share 1.5\n", &scenario, &error));
+  EXPECT_FALSE(ParseMeetingScenario("step LOBBY 10\n", &scenario, &error));
+  EXPECT_FALSE(
+      ParseMeetingScenario("step CONNECTING 10\n", &scenario, &error));
+  EXPECT_EQ(error, "the last step must be INMEETING");
+}
+
+TEST(ScenarioTimeline, PlaysJoinSteps) {
+  MeetingScenario scenario;
+  scenario.join_steps = {{MeetingStatus::kConnecting, 300, 0},
+                         {MeetingStatus::kWaitingForHost, 2000, 0},
+                         {MeetingStatus::kInMeeting, 0, 0}};
+  scenario.participants = 0;
+  std::vector<ScenarioEvent> events = Play(scenario, "123", 100);
+  ASSERT_EQ(events.size(), 3u);
+  EXPECT_EQ(Statuses(events),
+            (std::vector<MeetingStatus>{MeetingStatus::kConnecting,
+                                        MeetingStatus::kWaitingForHost,
+                                        MeetingStatus::kInMeeting}));
+  EXPECT_EQ(events[1].at_ms, 300);
+  EXPECT_EQ(events[2].at_ms, 2300);
+}
+
+TEST(ScenarioTimeline, IsDeterministic) {
+  MeetingScenario scenario;
+  scenario.seed = 7;
+  scenario.join_steps[0].jitter_ms = 150;
+  scenario.participants = 20;
+  scenario.joins_per_minute = 120;
+  scenario.leaves_per_minute = 120;
+  scenario.reconnect_count = 5;
+  scenario.reconnect_interval_ms = 1000;
+  scenario.reconnect_jitter_ms = 500;
+  scenario.video_share = 0.5;
+  scenario.updates_per_minute = 240;
+
+  std::vector<ScenarioEvent> first = Play(scenario, "123", 500);
+  std::vector<ScenarioEvent> second = Play(scenario, "123", 500);
+  ASSERT_EQ(first.size(), 500u);
+  ASSERT_EQ(second.size(), first.size());
+  for (size_t i = 0; i < first.size(); ++i) {
+    EXPECT_EQ(first[i].type, second[i].type);
+    EXPECT_EQ(first[i].at_ms, second[i].at_ms);
+    EXPECT_EQ(first[i].status, second[i].status);
+    EXPECT_EQ(first[i].participant_id, second[i].participant_id);
+    EXPECT_EQ(first[i].has_video, second[i].has_video);
+    EXPECT_EQ(first[i].participant.display_name,
+              second[i].participant.display_name);
+  }
+
+  // Another meeting, or another seed, plays differently.
+  std::vector<ScenarioEvent> other = Play(scenario, "456", 500);
+  bool differs = false;
+  for (size_t i = 0; i < other.size() && !differs; ++i) {
+    differs = other[i].at_ms != first[i].at_ms;
+  }
+  EXPECT_TRUE(differs);
+}
+
+TEST(ScenarioTimeline, KeepsEventsInTimeOrder) {
+  MeetingScenario scenario;
+  scenario.participants = 50;
+  scenario.max_participants = 60;
+  scenario.joins_per_minute = 600;
+  scenario.leaves_per_minute = 600;
+  scenario.reconnect_count = 20;
+  scenario.reconnect_interval_ms = 700;
+  scenario.reconnect_jitter_ms = 300;
+  scenario.duration_ms = 60000;
+
+  std::vector<ScenarioEvent> events = Play(scenario, "123", 100000);
+  std::set<uint32_t> present;
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (i > 0) {
+      ASSERT_GE(events[i].at_ms, events[i - 1].at_ms);
+    }
+    if (events[i].type == ScenarioEvent::Type::kParticipantJoined) {
+      EXPECT_TRUE(present.insert(events[i].participant_id).second);
+      EXPECT_LE(present.size(), 60u);
+    } else if (events[i].type == ScenarioEvent::Type::kParticipantLeft) {
+      EXPECT_EQ(present.erase(events[i].participant_id), 1u);
+    }
+  }
+  EXPECT_EQ(events.back().status, MeetingStatus::kIdle);
+  EXPECT_EQ(events.back().at_ms, events.front().at_ms + 200 + 60000);
+}
+
+TEST(ScenarioTimeline, ReconnectsTheConfiguredNumberOfTimes) {
+  MeetingScenario scenario;
+  scenario.participants = 0;
+  scenario.reconnect_count = 1000;
+  scenario.reconnect_interval_ms = 500;
+  scenario.reconnect_duration_ms = 100;
+
+  std::vector<ScenarioEvent> events = Play(scenario, "123", 1000000);
+  std::vector<MeetingStatus> statuses = Statuses(events);
+  // Connecting, in meeting, then 1000 reconnect pairs.
+  ASSERT_EQ(statuses.size(), 2u + 2000u);
+  EXPECT_EQ(statuses[2], MeetingStatus::kReconnecting);
+  EXPECT_EQ(statuses.back(), MeetingStatus::kInMeeting);
+  EXPECT_EQ(events.back().at_ms, 200 + 1000 * 600);
+}
+
+TEST(ScenarioTimeline, AnnouncesInitialParticipants) {
+  MeetingScenario scenario;
+  scenario.participants = 500;
+  scenario.video_share = 0.1;
+  std::vector<ScenarioEvent> events = Play(scenario, "123", 100000);
+  ASSERT_EQ(events.size(), 502u);
+  size_t with_video = 0;
+  for (size_t i = 2; i < events.size(); ++i) {
+    EXPECT_EQ(events[i].type, ScenarioEvent::Type::kParticipantJoined);
+    EXPECT_EQ(events[i].participant_id, kFirstId + i - 2);
+    with_video += events[i].has_video;
+  }
+  EXPECT_GT(with_video, 20u);
+  EXPECT_LT(with_video, 80u);
+}
+
+TEST(ScenarioTimeline, ChangesPresentParticipants) {
+  MeetingScenario scenario;
+  scenario.participants = 20;
+  scenario.joins_per_minute = 60;
+  scenario.leaves_per_minute = 60;
+  scenario.updates_per_minute = 600;
+  std::vector<ScenarioEvent> events = Play(scenario, "123", 10000);
+  std::map<uint32_t, ParticipantInfo> present;
+  size_t changes = 0;
+  for (const ScenarioEvent& event : events) {
+    switch (event.type) {
+      case ScenarioEvent::Type::kParticipantJoined:
+        EXPECT_EQ(event.participant.video_on, event.has_video);
+        EXPECT_FALSE(event.participant.display_name.empty());
+        present[event.participant_id] = event.participant;
+        break;
+      case ScenarioEvent::Type::kParticipantLeft:
+        EXPECT_EQ(present.erase(event.participant_id), 1u);
+        break;
+      case ScenarioEvent::Type::kParticipantChanged: {
+        ++changes;
+        auto it = present.find(event.participant_id);
+        ASSERT_NE(it, present.end());
+        // One thing changes at a time; a rename may pick the same name.
+        const ParticipantInfo& before = it->second;
+        const ParticipantInfo& after = event.participant;
+        EXPECT_LE((before.display_name != after.display_name) +
+                      (before.audio_muted != after.audio_muted) +
+                      (before.video_on != after.video_on) +
+                      (before.hand_raised != after.hand_raised),
+                  1);
+        it->second = after;
+        break;
+      }
+      case ScenarioEvent::Type::kStatus:
+        break;
+    }
+  }
+  // Ten times as many changes as leaves.
+  EXPECT_GT(changes, 5000u);
+}
+
+TEST(ScenarioTimeline, FailsJoins) {
+  MeetingScenario scenario;
+  scenario.join_failure_rate = 1;
+  std::vector<ScenarioEvent> events = Play(scenario, "123", 100);
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[1].status, MeetingStatus::kFailed);
+  EXPECT_EQ(events[1].error_code, kMeetingErrorNetworkError);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
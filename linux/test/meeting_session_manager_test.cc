@@ -0,0 +1,129 @@
+#include "meeting_session_manager.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+TEST(MeetingSessionManager, OpensOneSessionPerMeeting) {
+  MeetingSessionManager sessions;
+  uint32_t first = sessions.Open("123");
+  uint32_t second = sessions.Open("456");
+  EXPECT_NE(first, kNoMeetingSession);
+  EXPECT_NE(second, kNoMeetingSession);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(sessions.Open("123"), first);
+  EXPECT_EQ(sessions.size(), 2u);
+  EXPECT_EQ(sessions.Open(""), kNoMeetingSession);
+}
+
+TEST(MeetingSessionManager, TracksStatusPerMeeting) {
+  MeetingSessionManager sessions;
+  MeetingSession session;
+  ASSERT_TRUE(sessions.Update("123", MeetingStatus::kConnecting, 0, 0,
+                              &session));
+  ASSERT_TRUE(sessions.Update("456", MeetingStatus::kFailed, 4, 7, &session));
+  ASSERT_TRUE(sessions.Update("123", MeetingStatus::kInMeeting, 0, 0,
+                              &session));
+  EXPECT_EQ(session.meeting_id, "123");
+  EXPECT_EQ(session.event_count, 2u);
+
+  ASSERT_TRUE(sessions.Get("456", &session));
+  EXPECT_EQ(session.status, MeetingStatus::kFailed);
+  EXPECT_EQ(session.error_code, 4);
+  EXPECT_EQ(session.internal_error_code, 7);
+
+  MeetingSession by_id;
+  ASSERT_TRUE(sessions.GetById(session.session_id, &by_id));
+  EXPECT_EQ(by_id.meeting_id, "456");
+  EXPECT_FALSE(sessions.Get("789", &session));
+  EXPECT_FALSE(sessions.Update("", MeetingStatus::kIdle, 0, 0, &session));
+}
+
+TEST(MeetingSessionManager, NeverReusesSessionIds) {
+  MeetingSessionManager sessions;
+  uint32_t first = sessions.Open("123");
+  EXPECT_TRUE(sessions.Close("123"));
+  EXPECT_FALSE(sessions.Close("123"));
+  uint32_t second = sessions.Open("123");
+  EXPECT_NE(second, first);
+
+  MeetingSession session;
+  EXPECT_FALSE(sessions.GetById(first, &session));
+}
+
+TEST(MeetingSessionManager, ClosesOnlyEndedSessions) {
+  MeetingSessionManager sessions;
+  MeetingSession session;
+  sessions.Update("123", MeetingStatus::kInMeeting, 0, 0, &session);
+  EXPECT_FALSE(sessions.CloseIfEnded(session.session_id));
+
+  sessions.Update("123", MeetingStatus::kIdle, 0, 0, &session);
+  EXPECT_TRUE(sessions.CloseIfEnded(session.session_id));
+  EXPECT_EQ(sessions.size(), 0u);
+  EXPECT_FALSE(sessions.CloseIfEnded(kNoMeetingSession));
+}
+
+TEST(MeetingSessionManager, EnforcesMaxSessions) {
+  MeetingSessionManager sessions(2);
+  EXPECT_NE(sessions.Open("1"), kNoMeetingSession);
+  EXPECT_NE(sessions.Open("2"), kNoMeetingSession);
+  EXPECT_EQ(sessions.Open("3"), kNoMeetingSession);
+  sessions.Close("1");
+  EXPECT_NE(sessions.Open("3"), kNoMeetingSession);
+}
+
+TEST(MeetingSessionManager, SurvivesGrowthAndChurn) {
+  MeetingSessionManager sessions(100);
+  std::vector<uint32_t> ids;
+  for (int i = 0; i < 100; ++i) {
+    ids.push_back(sessions.Open(std::to_string(i)));
+  }
+  // Enough open/close cycles to fill the table with tombstones several
+  // times over.
+  for (int round = 0; round < 20; ++round) {
+    for (int i = 0; i < 50; ++i) {
+      ASSERT_TRUE(sessions.Close(std::to_string(i)));
+    }
+    for (int i = 0; i < 50; ++i) {
+      ids[i] = sessions.Open(std::to_string(i));
+      ASSERT_NE(ids[i], kNoMeetingSession);
+    }
+  }
+  EXPECT_EQ(sessions.size(), 100u);
+  for (int i = 0; i < 100; ++i) {
+    MeetingSession session;
+    ASSERT_TRUE(sessions.Get(std::to_string(i), &session));
+    EXPECT_EQ(session.session_id, ids[i]);
+  }
+  EXPECT_EQ(sessions.GetAll().size(), 100u);
+}
+
+TEST(MeetingSessionManager, UpdatesFromManyThreads) {
+  MeetingSessionManager sessions;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&sessions, t]() {
+      MeetingSession session;
+      for (int i = 0; i < 1000; ++i) {
+        sessions.Update(std::to_string(t), MeetingStatus::kInMeeting, 0, 0,
+                        &session);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (int t = 0; t < 4; ++t) {
+    MeetingSession session;
+    ASSERT_TRUE(sessions.Get(std::to_string(t), &session));
+    EXPECT_EQ(session.event_count, 1000u);
+  }
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,91 @@
+#include "meeting_state_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+// An event whose every field is derived from |sequence|, so a torn read
+// shows up as fields that disagree.
+MeetingStatusEvent EventAt(uint64_t sequence) {
+  MeetingStatusEvent event;
+  event.status = static_cast<MeetingStatus>(sequence % 10);
+  event.error_code = static_cast<int32_t>(sequence * 3);
+  event.internal_error_code = -static_cast<int32_t>(sequence);
+  event.session_id = static_cast<uint32_t>(sequence + 7);
+  event.timestamp_us = static_cast<int64_t>(sequence) * 1000;
+  event.sequence = sequence;
+  return event;
+}
+
+bool Consistent(const MeetingStatusEvent& event) {
+  MeetingStatusEvent expected = EventAt(event.sequence);
+  return event.status == expected.status &&
+         event.error_code == expected.error_code &&
+         event.internal_error_code == expected.internal_error_code &&
+         event.session_id == expected.session_id &&
+         event.timestamp_us == expected.timestamp_us;
+}
+
+}  // namespace
+
+TEST(MeetingStateCache, StartsIdle) {
+  MeetingStateCache cache;
+  MeetingStatusEvent event = cache.Read();
+  EXPECT_EQ(event.status, MeetingStatus::kIdle);
+  EXPECT_EQ(event.sequence, 0u);
+}
+
+TEST(MeetingStateCache, KeepsTheNewestEvent) {
+  MeetingStateCache cache;
+  EXPECT_TRUE(cache.Publish(EventAt(2)));
+  EXPECT_EQ(cache.Read().sequence, 2u);
+  EXPECT_TRUE(Consistent(cache.Read()));
+
+  // A callback that lost the race to publish does not roll the state back.
+  EXPECT_FALSE(cache.Publish(EventAt(1)));
+  EXPECT_FALSE(cache.Publish(EventAt(2)));
+  EXPECT_EQ(cache.Read().sequence, 2u);
+}
+
+TEST(MeetingStateCache, ReadersNeverSeeTornEvents) {
+  MeetingStateCache cache;
+  constexpr uint64_t kEvents = 200000;
+  std::atomic<bool> done{false};
+  std::atomic<int> torn{0};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 2; ++i) {
+    readers.emplace_back([&] {
+      uint64_t last = 0;
+      while (!done) {
+        MeetingStatusEvent event = cache.Read();
+        if (!Consistent(event) && event.sequence != 0) {
+          torn++;
+        }
+        // Readers never go back in time.
+        if (event.sequence < last) {
+          torn++;
+        }
+        last = event.sequence;
+      }
+    });
+  }
+  for (uint64_t sequence = 1; sequence <= kEvents; ++sequence) {
+    cache.Publish(EventAt(sequence));
+  }
+  done = true;
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(torn, 0);
+  EXPECT_EQ(cache.Read().sequence, kEvents);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,101 @@
+#include "memory_accounting.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+// Other tests charge the same counters, so these only look at differences.
+int64_t CurrentBytes(MemoryCategory category) {
+  return static_cast<int64_t>(
+      MemoryAccounting::GetStats()
+          .categories[static_cast<size_t>(category)]
+          .current_bytes);
+}
+
+}  // namespace
+
+TEST(MemoryAccounting, CountsChargesPerCategory) {
+  int64_t recording = CurrentBytes(MemoryCategory::kRecording);
+  int64_t roster = CurrentBytes(MemoryCategory::kRoster);
+
+  MemoryAccounting::Charge(MemoryCategory::kRecording, 1000);
+  MemoryAccounting::Charge(MemoryCategory::kRecording, 24);
+  EXPECT_EQ(CurrentBytes(MemoryCategory::kRecording), recording + 1024);
+  EXPECT_EQ(CurrentBytes(MemoryCategory::kRoster), roster);
+
+  MemoryAccounting::Charge(MemoryCategory::kRecording, -1024);
+  EXPECT_EQ(CurrentBytes(MemoryCategory::kRecording), recording);
+  EXPECT_GE(MemoryAccounting::GetStats()
+                .categories[static_cast<size_t>(MemoryCategory::kRecording)]
+                .peak_bytes,
+            static_cast<uint64_t>(recording + 1024));
+}
+
+TEST(MemoryAccounting, FlushesWhenThreadsExit) {
+  int64_t before = CurrentBytes(MemoryCategory::kEventQueues);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] {
+      // Small enough to stay batched until the thread exits.
+      for (int j = 0; j < 10; ++j) {
+        MemoryAccounting::Charge(MemoryCategory::kEventQueues, 100);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(CurrentBytes(MemoryCategory::kEventQueues), before + 4000);
+  MemoryAccounting::Charge(MemoryCategory::kEventQueues, -4000);
+}
+
+TEST(MemoryAccounting, BatchesSmallChargesOfOtherThreads) {
+  int64_t before = CurrentBytes(MemoryCategory::kAudioRings);
+  std::thread thread([] {
+    MemoryAccounting::Charge(MemoryCategory::kAudioRings, 1);
+  });
+  thread.join();
+  std::thread batching([&] {
+    MemoryAccounting::Charge(MemoryCategory::kAudioRings, 100);
+    // Not landed yet, and not visible to other threads.
+    std::thread reader([&] {
+      EXPECT_EQ(CurrentBytes(MemoryCategory::kAudioRings), before + 1);
+    });
+    reader.join();
+    MemoryAccounting::Charge(MemoryCategory::kAudioRings,
+                             MemoryAccounting::kFlushBytes);
+    std::thread late_reader([&] {
+      EXPECT_EQ(CurrentBytes(MemoryCategory::kAudioRings),
+                before + 1 + MemoryAccounting::kFlushBytes);
+    });
+    late_reader.join();
+    MemoryAccounting::Charge(MemoryCategory::kAudioRings,
+                             -101 - MemoryAccounting::kFlushBytes);
+  });
+  batching.join();
+  EXPECT_EQ(CurrentBytes(MemoryCategory::kAudioRings), before);
+}
+
+TEST(TrackingAllocator, ChargesContainerStorage) {
+  int64_t before = CurrentBytes(MemoryCategory::kVideoTextures);
+  {
+    TrackedVector<uint32_t, MemoryCategory::kVideoTextures> pixels;
+    pixels.resize(1000);
+    EXPECT_EQ(CurrentBytes(MemoryCategory::kVideoTextures),
+              before + static_cast<int64_t>(pixels.capacity() * 4));
+  }
+  EXPECT_EQ(CurrentBytes(MemoryCategory::kVideoTextures), before);
+}
+
+TEST(MemoryAccounting, ReadsTheResidentSetSize) {
+  EXPECT_GT(ReadProcessRssBytes(), 0u);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
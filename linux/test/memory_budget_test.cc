@@ -0,0 +1,47 @@
+#include "memory_budget.h"
+
+#include <gtest/gtest.h>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+TEST(MemoryBudget, StaysNormalWithoutBudgets) {
+  MemoryBudget budget;
+  EXPECT_EQ(budget.Update(uint64_t{1} << 40, uint64_t{1} << 40),
+            MemoryPressure::kNormal);
+}
+
+TEST(MemoryBudget, RaisesAndReleasesPressureWithMargin) {
+  MemoryBudget::Config config;
+  config.plugin_bytes = 1000;
+  MemoryBudget budget(config);
+
+  EXPECT_EQ(budget.Update(1000, 0), MemoryPressure::kNormal);
+  EXPECT_EQ(budget.Update(1001, 0), MemoryPressure::kReduced);
+  // Shedding brought it back under budget, but not by enough.
+  EXPECT_EQ(budget.Update(950, 0), MemoryPressure::kReduced);
+  EXPECT_EQ(budget.Update(899, 0), MemoryPressure::kNormal);
+
+  // Straight to minimal, then down a step at a time.
+  EXPECT_EQ(budget.Update(1600, 0), MemoryPressure::kMinimal);
+  EXPECT_EQ(budget.Update(1400, 0), MemoryPressure::kMinimal);
+  EXPECT_EQ(budget.Update(1300, 0), MemoryPressure::kReduced);
+  EXPECT_EQ(budget.Update(100, 0), MemoryPressure::kNormal);
+}
+
+TEST(MemoryBudget, EitherBudgetRaisesPressure) {
+  MemoryBudget::Config config;
+  config.plugin_bytes = 1000;
+  config.rss_bytes = 1 << 20;
+  MemoryBudget budget(config);
+  EXPECT_EQ(budget.Update(10, 2 << 20), MemoryPressure::kMinimal);
+  EXPECT_STREQ(MemoryPressureName(budget.level()), "minimal");
+
+  config.rss_bytes = 0;
+  budget.SetConfig(config);
+  EXPECT_EQ(budget.level(), MemoryPressure::kMinimal);
+  EXPECT_EQ(budget.Update(10, 2 << 20), MemoryPressure::kNormal);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,68 @@
+#include "mpsc_ring_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+TEST(MpscRingBuffer, RoundsCapacityUpToPowerOfTwo) {
+  MpscRingBuffer<int> ring(5);
+  EXPECT_EQ(ring.capacity(), 8u);
+}
+
+TEST(MpscRingBuffer, FailsWhenFullAndEmpty) {
+  MpscRingBuffer<int> ring(4);
+  int value = 0;
+  EXPECT_FALSE(ring.TryPop(&value));
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(ring.TryPush(i));
+  }
+  EXPECT_FALSE(ring.TryPush(4));
+  EXPECT_EQ(ring.SizeApprox(), 4u);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(ring.TryPop(&value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(ring.TryPop(&value));
+}
+
+TEST(MpscRingBuffer, DeliversEveryItemFromManyProducers) {
+  constexpr int kProducers = 4;
+  constexpr int kItemsPerProducer = 20000;
+  MpscRingBuffer<int> ring(64);
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&ring, p] {
+      for (int i = 0; i < kItemsPerProducer; ++i) {
+        while (!ring.TryPush(p * kItemsPerProducer + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // Items from one producer must arrive in the order it pushed them.
+  std::vector<int> next(kProducers, 0);
+  int received = 0;
+  while (received < kProducers * kItemsPerProducer) {
+    int value;
+    if (!ring.TryPop(&value)) {
+      std::this_thread::yield();
+      continue;
+    }
+    int producer = value / kItemsPerProducer;
+    EXPECT_EQ(value % kItemsPerProducer, next[producer]);
+    next[producer]++;
+    received++;
+  }
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
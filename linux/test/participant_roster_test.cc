@@ -0,0 +1,210 @@
+#include "participant_roster.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+ParticipantInfo Participant(uint32_t participant_id,
+                            const std::string& display_name) {
+  ParticipantInfo participant;
+  participant.participant_id = participant_id;
+  participant.display_name = display_name;
+  return participant;
+}
+
+std::vector<RosterDelta> TakePending(ParticipantRoster* roster) {
+  std::vector<RosterDelta> deltas;
+  roster->TakePending(&deltas);
+  return deltas;
+}
+
+}  // namespace
+
+TEST(ParticipantRoster, RecordsJoinsChangesAndLeaves) {
+  ParticipantRoster roster{ParticipantRoster::Config()};
+  EXPECT_TRUE(roster.Join(1, Participant(100, "Ada")));
+  EXPECT_FALSE(roster.Join(1, Participant(101, "Grace")));
+
+  ParticipantInfo changed = Participant(100, "Ada L.");
+  changed.hand_raised = true;
+  EXPECT_FALSE(roster.Change(1, changed));
+  EXPECT_FALSE(roster.Leave(1, 101));
+  EXPECT_EQ(roster.size(), 1u);
+
+  std::vector<RosterDelta> deltas = TakePending(&roster);
+  ASSERT_EQ(deltas.size(), 4u);
+  EXPECT_EQ(deltas[0].type, RosterDeltaType::kJoined);
+  EXPECT_EQ(deltas[0].display_name, "Ada");
+  EXPECT_EQ(deltas[1].slot, 1u);
+  EXPECT_EQ(deltas[2].type, RosterDeltaType::kChanged);
+  EXPECT_EQ(deltas[2].slot, 0u);
+  EXPECT_EQ(deltas[2].changes, kRosterNameChanged | kRosterHandChanged);
+  EXPECT_EQ(deltas[2].state, kRosterHandRaised);
+  EXPECT_EQ(deltas[2].display_name, "Ada L.");
+  EXPECT_EQ(deltas[3].type, RosterDeltaType::kLeft);
+  EXPECT_EQ(deltas[3].participant_id, 101u);
+  for (size_t i = 0; i < deltas.size(); ++i) {
+    EXPECT_EQ(deltas[i].sequence, i + 1);
+  }
+  EXPECT_EQ(roster.sequence(), 4u);
+}
+
+TEST(ParticipantRoster, SkipsChangesThatChangeNothing) {
+  ParticipantRoster roster{ParticipantRoster::Config()};
+  roster.Join(1, Participant(100, "Ada"));
+  EXPECT_FALSE(roster.Change(1, Participant(100, "Ada")));
+  EXPECT_FALSE(roster.Leave(1, 555));
+  EXPECT_EQ(roster.sequence(), 1u);
+
+  // Only the name is sent with a change that does not rename.
+  ParticipantInfo muted = Participant(100, "Ada");
+  muted.audio_muted = true;
+  roster.Change(1, muted);
+  std::vector<RosterDelta> deltas = TakePending(&roster);
+  ASSERT_EQ(deltas.size(), 2u);
+  EXPECT_EQ(deltas[1].changes, kRosterAudioChanged);
+  EXPECT_TRUE(deltas[1].display_name.empty());
+}
+
+TEST(ParticipantRoster, ReusesSlotsAndKeepsSessionsApart) {
+  ParticipantRoster roster{ParticipantRoster::Config()};
+  roster.Join(1, Participant(100, "Ada"));
+  roster.Join(2, Participant(100, "Ada elsewhere"));
+  roster.Leave(1, 100);
+  roster.Join(1, Participant(102, "Edsger"));
+  std::vector<RosterDelta> deltas = TakePending(&roster);
+  ASSERT_EQ(deltas.size(), 4u);
+  EXPECT_EQ(deltas[1].slot, 1u);
+  EXPECT_EQ(deltas[2].session_id, 1u);
+  EXPECT_EQ(deltas[3].slot, 0u);
+  EXPECT_EQ(roster.size(), 2u);
+}
+
+TEST(ParticipantRoster, EndsSessionsWithOneDelta) {
+  ParticipantRoster roster{ParticipantRoster::Config()};
+  for (uint32_t id = 0; id < 1000; ++id) {
+    roster.Join(1, Participant(id, "Attendee"));
+  }
+  roster.Join(2, Participant(5, "Host"));
+  TakePending(&roster);
+
+  EXPECT_TRUE(roster.EndSession(1));
+  EXPECT_FALSE(roster.EndSession(1));
+  std::vector<RosterDelta> deltas = TakePending(&roster);
+  ASSERT_EQ(deltas.size(), 1u);
+  EXPECT_EQ(deltas[0].type, RosterDeltaType::kSessionEnded);
+  EXPECT_EQ(deltas[0].session_id, 1u);
+  EXPECT_EQ(roster.size(), 1u);
+}
+
+TEST(ParticipantRoster, SnapshotsOnlyWhatChanged) {
+  ParticipantRoster roster{ParticipantRoster::Config()};
+  for (uint32_t id = 0; id < 1000; ++id) {
+    roster.Join(1, Participant(id, "Attendee"));
+  }
+  ParticipantInfo raised = Participant(7, "Attendee");
+  raised.hand_raised = true;
+  roster.Change(1, raised);
+  roster.Leave(1, 8);
+
+  ParticipantRoster::Snapshot snapshot = roster.GetSnapshot(1000);
+  EXPECT_FALSE(snapshot.full);
+  EXPECT_EQ(snapshot.sequence, 1002u);
+  ASSERT_EQ(snapshot.deltas.size(), 2u);
+  EXPECT_EQ(snapshot.deltas[0].sequence, 1001u);
+  EXPECT_EQ(snapshot.deltas[1].type, RosterDeltaType::kLeft);
+
+  EXPECT_TRUE(roster.GetSnapshot(1002).deltas.empty());
+}
+
+TEST(ParticipantRoster, SnapshotsEverythingOnceHistoryIsGone) {
+  ParticipantRoster::Config config;
+  config.history = 16;
+  ParticipantRoster roster(config);
+  for (uint32_t id = 0; id < 100; ++id) {
+    roster.Join(1, Participant(id, "Attendee " + std::to_string(id)));
+  }
+  roster.Leave(1, 50);
+
+  EXPECT_FALSE(roster.GetSnapshot(90).full);
+  ParticipantRoster::Snapshot snapshot = roster.GetSnapshot(10);
+  EXPECT_TRUE(snapshot.full);
+  EXPECT_EQ(snapshot.sequence, 101u);
+  ASSERT_EQ(snapshot.deltas.size(), 99u);
+  EXPECT_EQ(snapshot.deltas[50].participant_id, 51u);
+  EXPECT_EQ(snapshot.deltas[50].display_name, "Attendee 51");
+  EXPECT_EQ(snapshot.deltas[50].slot, 51u);
+}
+
+TEST(ParticipantRoster, ShrinksHistoryOnRequest) {
+  ParticipantRoster roster{ParticipantRoster::Config()};
+  for (uint32_t id = 0; id < 100; ++id) {
+    roster.Join(1, Participant(id, "Attendee"));
+  }
+  EXPECT_FALSE(roster.GetSnapshot(10).full);
+
+  roster.SetHistoryLimit(16);
+  EXPECT_TRUE(roster.GetSnapshot(10).full);
+  EXPECT_EQ(roster.GetSnapshot(84).deltas.size(), 16u);
+  EXPECT_FALSE(roster.GetSnapshot(84).full);
+  roster.Leave(1, 0);
+  EXPECT_TRUE(roster.GetSnapshot(84).full);
+  EXPECT_FALSE(roster.GetSnapshot(85).full);
+}
+
+TEST(ParticipantRoster, CapsPendingDeltas) {
+  ParticipantRoster::Config config;
+  config.max_pending = 10;
+  ParticipantRoster roster(config);
+  for (uint32_t id = 0; id < 20; ++id) {
+    roster.Join(1, Participant(id, "Attendee"));
+  }
+  // The rest leave a gap that a snapshot fills.
+  EXPECT_EQ(TakePending(&roster).size(), 10u);
+  EXPECT_EQ(roster.GetSnapshot(10).deltas.size(), 10u);
+  EXPECT_TRUE(roster.Join(1, Participant(20, "Attendee")));
+}
+
+TEST(ParticipantRoster, SurvivesConcurrentUpdates) {
+  ParticipantRoster roster{ParticipantRoster::Config()};
+  std::vector<std::thread> threads;
+  for (uint32_t session = 1; session <= 4; ++session) {
+    threads.emplace_back([&roster, session] {
+      for (uint32_t i = 0; i < 1000; ++i) {
+        ParticipantInfo participant = Participant(i % 50, "Attendee");
+        participant.audio_muted = i % 3 == 0;
+        if (i % 7 == 0) {
+          roster.Leave(session, i % 50);
+        } else {
+          roster.Change(session, participant);
+        }
+      }
+    });
+  }
+  std::vector<RosterDelta> deltas;
+  uint64_t last_sequence = 0;
+  for (int i = 0; i < 100; ++i) {
+    roster.TakePending(&deltas);
+    for (const RosterDelta& delta : deltas) {
+      EXPECT_EQ(delta.sequence, ++last_sequence);
+    }
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  roster.TakePending(&deltas);
+  for (const RosterDelta& delta : deltas) {
+    EXPECT_EQ(delta.sequence, ++last_sequence);
+  }
+  EXPECT_EQ(last_sequence, roster.sequence());
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,64 @@
+#include "pcm_ring_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+TEST(PcmRingBuffer, HeaderLayoutMatchesDart) {
+  // lib/flutter_zoom_meeting_sdk_audio.dart hard-codes these offsets.
+  EXPECT_EQ(offsetof(PcmRingHeader, sample_rate), 8u);
+  EXPECT_EQ(offsetof(PcmRingHeader, capacity), 16u);
+  EXPECT_EQ(offsetof(PcmRingHeader, participant_id), 20u);
+  EXPECT_EQ(offsetof(PcmRingHeader, data_offset), 24u);
+  EXPECT_EQ(offsetof(PcmRingHeader, write_position), 64u);
+  EXPECT_EQ(offsetof(PcmRingHeader, claim_position), 72u);
+  EXPECT_EQ(offsetof(PcmRingHeader, read_position), 128u);
+  EXPECT_EQ(offsetof(PcmRingHeader, dropped_samples), 192u);
+
+  std::unique_ptr<PcmRingBuffer> ring = PcmRingBuffer::Create(7, 16000, 1000);
+  ASSERT_NE(ring, nullptr);
+  EXPECT_EQ(ring->header().magic, kPcmRingMagic);
+  EXPECT_EQ(ring->header().sample_rate, 16000u);
+  EXPECT_EQ(ring->header().participant_id, 7u);
+  EXPECT_EQ(ring->capacity(), 1024u);
+  EXPECT_EQ(ring->address() % 4096, 0u);
+}
+
+TEST(PcmRingBuffer, WrapsAround) {
+  std::unique_ptr<PcmRingBuffer> ring = PcmRingBuffer::Create(0, 16000, 8);
+  std::vector<int16_t> samples(6);
+  std::iota(samples.begin(), samples.end(), 1);
+  ring->Write(samples.data(), samples.size());
+  std::iota(samples.begin(), samples.end(), 7);
+  ring->Write(samples.data(), samples.size());
+  EXPECT_EQ(ring->write_position(), 12u);
+  EXPECT_EQ(ring->header().claim_position.load(), 12u);
+
+  std::vector<int16_t> newest(8);
+  ring->CopyOut(4, newest.size(), newest.data());
+  EXPECT_EQ(newest, (std::vector<int16_t>{5, 6, 7, 8, 9, 10, 11, 12}));
+}
+
+TEST(PcmRingBuffer, CountsUnreadSamplesOverwritten) {
+  std::unique_ptr<PcmRingBuffer> ring = PcmRingBuffer::Create(0, 16000, 8);
+  std::vector<int16_t> samples(20);
+  ring->Write(samples.data(), 6);
+  ring->Write(samples.data(), 6);
+  // Samples 0-3 were overwritten before anyone read them.
+  EXPECT_EQ(ring->header().dropped_samples.load(), 4u);
+
+  // Dart caught up, so the next wrap only loses what it has not read.
+  const_cast<PcmRingHeader&>(ring->header()).read_position.store(12);
+  ring->Write(samples.data(), 6);
+  EXPECT_EQ(ring->header().dropped_samples.load(), 4u);
+  ring->Write(samples.data(), samples.size());
+  EXPECT_EQ(ring->header().dropped_samples.load(), 4u + 18u);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
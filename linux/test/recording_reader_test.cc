@@ -0,0 +1,273 @@
+#include "recording_reader.h"
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "recording_format.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+std::string MakeRecordingDirectory() {
+  std::string pattern = ::testing::TempDir() + "recording_XXXXXX";
+  std::vector<char> path(pattern.begin(), pattern.end());
+  path.push_back('\0');
+  EXPECT_NE(mkdtemp(path.data()), nullptr);
+  return path.data();
+}
+
+// Builds a segment the way RecordingWriter lays one out.
+class SegmentBuilder {
+ public:
+  explicit SegmentBuilder(uint32_t segment_number)
+      : data_(kSegmentHeaderSize) {
+    header_.segment_number = segment_number;
+  }
+
+  void AddAudio(uint32_t participant_id,
+                int64_t timestamp_us,
+                uint32_t sample_rate,
+                const std::vector<int16_t>& samples) {
+    std::vector<uint8_t> payload(kAudioPayloadHeaderSize +
+                                 samples.size() * sizeof(int16_t));
+    payload[0] = static_cast<uint8_t>(sample_rate);
+    payload[1] = static_cast<uint8_t>(sample_rate >> 8);
+    payload[4] = 1;
+    memcpy(payload.data() + kAudioPayloadHeaderSize, samples.data(),
+           samples.size() * sizeof(int16_t));
+    Add(RecordType::kAudio, participant_id, timestamp_us, payload);
+  }
+
+  void AddVideo(uint32_t participant_id,
+                int64_t timestamp_us,
+                uint8_t width,
+                uint8_t height,
+                uint8_t value) {
+    size_t chroma = static_cast<size_t>((width + 1) / 2) * ((height + 1) / 2);
+    std::vector<uint8_t> payload(
+        kVideoPayloadHeaderSize + static_cast<size_t>(width) * height +
+            2 * chroma,
+        value);
+    memset(payload.data(), 0, kVideoPayloadHeaderSize);
+    payload[0] = width;
+    payload[4] = height;
+    Add(RecordType::kVideo, participant_id, timestamp_us, payload);
+  }
+
+  // Writes the segment with its index, or as a crash would leave it: no
+  // index, and the last record cut off.
+  std::string Write(const std::string& directory, bool finished) {
+    std::vector<uint8_t> data = data_;
+    if (finished) {
+      header_.index_offset = data.size();
+      header_.index_count = static_cast<uint32_t>(index_.size());
+      for (const RecordIndexEntry& entry : index_) {
+        data.resize(data.size() + kIndexEntrySize);
+        EncodeIndexEntry(entry, data.data() + data.size() - kIndexEntrySize);
+      }
+    } else {
+      data.resize(data.size() - 10);
+      // The unused, pre-allocated rest of the segment.
+      data.resize(data.size() + 4096, 0);
+    }
+    EncodeSegmentHeader(header_, data.data());
+
+    char name[32];
+    SegmentFileName(header_.segment_number, !finished, name);
+    std::string path = directory + "/" + name;
+    FILE* file = fopen(path.c_str(), "wb");
+    EXPECT_NE(file, nullptr);
+    fwrite(data.data(), 1, data.size(), file);
+    fclose(file);
+    return path;
+  }
+
+ private:
+  void Add(RecordType type,
+           uint32_t participant_id,
+           int64_t timestamp_us,
+           const std::vector<uint8_t>& payload) {
+    RecordHeader header;
+    header.type = type;
+    header.participant_id = participant_id;
+    header.payload_size = static_cast<uint32_t>(payload.size());
+    header.timestamp_us = timestamp_us;
+    size_t offset = data_.size();
+    data_.resize(offset + RecordSize(payload.size()), 0);
+    memcpy(data_.data() + offset + kRecordHeaderSize, payload.data(),
+           payload.size());
+    EncodeRecordHeader(header, payload.data(), data_.data() + offset);
+    index_.push_back({type, participant_id, timestamp_us, offset});
+  }
+
+  SegmentHeader header_;
+  std::vector<uint8_t> data_;
+  std::vector<RecordIndexEntry> index_;
+};
+
+// Runs ExtractRecording into memory.
+bool Extract(const std::string& directory,
+             const RecordingExtractOptions& options,
+             std::string* output,
+             RecordingExtractResult* result) {
+  char* buffer = nullptr;
+  size_t size = 0;
+  FILE* out = open_memstream(&buffer, &size);
+  std::string error;
+  bool ok = ExtractRecording(directory, options, out, result, &error);
+  fclose(out);
+  output->assign(buffer, size);
+  free(buffer);
+  return ok;
+}
+
+}  // namespace
+
+TEST(RecordingFormat, DetectsCorruptRecords) {
+  SegmentBuilder builder(0);
+  builder.AddAudio(1, 0, 16000, {1, 2, 3, 4});
+  std::string directory = MakeRecordingDirectory();
+  std::string path = builder.Write(directory, true);
+
+  std::string error;
+  std::unique_ptr<RecordingSegmentReader> reader =
+      RecordingSegmentReader::Open(path, &error);
+  ASSERT_NE(reader, nullptr) << error;
+  RecordHeader header;
+  const uint8_t* payload;
+  ASSERT_TRUE(reader->Read(reader->index()[0], &header, &payload));
+
+  // Flip one payload byte.
+  std::vector<uint8_t> record(payload - kRecordHeaderSize,
+                              payload + header.payload_size);
+  record.back() ^= 1;
+  EXPECT_FALSE(
+      DecodeRecord(record.data(), record.size(), &header, &payload));
+}
+
+TEST(RecordingSegmentReader, RecoversUnfinishedSegments) {
+  std::string directory = MakeRecordingDirectory();
+  SegmentBuilder builder(0);
+  builder.AddAudio(1, 0, 16000, {1, 2});
+  builder.AddAudio(1, 100, 16000, {3, 4});
+  builder.AddAudio(1, 200, 16000, {5, 6});
+  std::string path = builder.Write(directory, false);
+  EXPECT_NE(path.find(".zrec.part"), std::string::npos);
+
+  std::string error;
+  std::unique_ptr<RecordingSegmentReader> reader =
+      RecordingSegmentReader::Open(path, &error);
+  ASSERT_NE(reader, nullptr) << error;
+  EXPECT_FALSE(reader->finished());
+  // The cut-off last record is lost.
+  ASSERT_EQ(reader->index().size(), 2u);
+  EXPECT_EQ(reader->index()[1].timestamp_us, 100);
+}
+
+TEST(RecordingSegmentReader, RejectsOtherFiles) {
+  std::string directory = MakeRecordingDirectory();
+  std::string path = directory + "/segment-000000.zrec";
+  FILE* file = fopen(path.c_str(), "wb");
+  fputs("not a segment", file);
+  fclose(file);
+  std::string error;
+  EXPECT_EQ(RecordingSegmentReader::Open(path, &error), nullptr);
+  EXPECT_FALSE(error.empty());
+}
+
+TEST(ExtractRecording, WritesAudioAsWav) {
+  std::string directory = MakeRecordingDirectory();
+  SegmentBuilder first(0);
+  first.AddAudio(1, 0, 16000, {1, 2});
+  first.AddAudio(2, 0, 16000, {9, 9});
+  first.AddAudio(1, 1000, 16000, {3, 4});
+  first.Write(directory, true);
+  SegmentBuilder second(1);
+  second.AddAudio(1, 2000, 16000, {5, 6});
+  second.AddAudio(1, 3000, 16000, {7, 8});
+  second.Write(directory, false);
+
+  RecordingExtractOptions options;
+  options.participant_id = 1;
+  options.type = RecordType::kAudio;
+  std::string output;
+  RecordingExtractResult result;
+  ASSERT_TRUE(Extract(directory, options, &output, &result));
+  // The unfinished segment loses its cut-off last record.
+  EXPECT_EQ(result.records, 3u);
+  EXPECT_EQ(result.partial_segments, 1u);
+  ASSERT_EQ(output.size(), 44u + 12u);
+  EXPECT_EQ(output.compare(0, 4, "RIFF"), 0);
+  EXPECT_EQ(output.compare(8, 4, "WAVE"), 0);
+  const int16_t* samples =
+      reinterpret_cast<const int16_t*>(output.data() + 44);
+  EXPECT_EQ(samples[0], 1);
+  EXPECT_EQ(samples[5], 6);
+}
+
+TEST(ExtractRecording, SelectsTimeRange) {
+  std::string directory = MakeRecordingDirectory();
+  SegmentBuilder builder(0);
+  for (int i = 0; i < 10; ++i) {
+    builder.AddAudio(1, i * 1000, 16000, {static_cast<int16_t>(i)});
+  }
+  builder.Write(directory, true);
+
+  RecordingExtractOptions options;
+  options.participant_id = 1;
+  options.start_us = 3000;
+  options.end_us = 6000;
+  std::string output;
+  RecordingExtractResult result;
+  ASSERT_TRUE(Extract(directory, options, &output, &result));
+  EXPECT_EQ(result.records, 3u);
+  const int16_t* samples =
+      reinterpret_cast<const int16_t*>(output.data() + 44);
+  EXPECT_EQ(samples[0], 3);
+  EXPECT_EQ(samples[2], 5);
+}
+
+TEST(ExtractRecording, WritesVideoAsY4m) {
+  std::string directory = MakeRecordingDirectory();
+  SegmentBuilder builder(0);
+  builder.AddVideo(5, 0, 4, 2, 10);
+  builder.AddVideo(5, 100000, 4, 2, 20);
+  builder.AddVideo(5, 150000, 8, 8, 30);
+  builder.AddVideo(5, 200000, 4, 2, 40);
+  builder.Write(directory, true);
+
+  RecordingExtractOptions options;
+  options.participant_id = 5;
+  options.type = RecordType::kVideo;
+  std::string output;
+  RecordingExtractResult result;
+  ASSERT_TRUE(Extract(directory, options, &output, &result));
+  EXPECT_EQ(result.records, 3u);
+  // The frame of another size is skipped.
+  EXPECT_EQ(result.skipped, 1u);
+  std::string header = "YUV4MPEG2 W4 H2 F10000:1000 Ip A1:1 C420jpeg\n";
+  ASSERT_EQ(output.compare(0, header.size(), header), 0);
+  // Each frame is "FRAME\n" and 8 luma and 4 chroma bytes.
+  ASSERT_EQ(output.size(), header.size() + 3 * (6 + 12));
+  EXPECT_EQ(output[header.size() + 6], 10);
+  EXPECT_EQ(output[header.size() + 2 * 18 + 6], 40);
+}
+
+TEST(ExtractRecording, ReportsMissingStreams) {
+  std::string directory = MakeRecordingDirectory();
+  RecordingExtractOptions options;
+  std::string output;
+  RecordingExtractResult result;
+  EXPECT_FALSE(Extract(directory, options, &output, &result));
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,214 @@
+#include "recording_writer.h"
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "monotonic_clock.h"
+#include "recording_reader.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+// A fresh directory for one test's recording.
+std::string MakeRecordingDirectory() {
+  std::string pattern = ::testing::TempDir() + "recording_XXXXXX";
+  std::vector<char> path(pattern.begin(), pattern.end());
+  path.push_back('\0');
+  EXPECT_NE(mkdtemp(path.data()), nullptr);
+  return path.data();
+}
+
+std::shared_ptr<VideoFrame> MakeFrame(int width, int height, uint8_t value) {
+  std::shared_ptr<VideoFrame> frame = VideoFrame::Allocate(width, height);
+  for (int row = 0; row < height; ++row) {
+    std::fill_n(frame->mutable_data_y() + row * frame->stride_y(), width,
+                value);
+  }
+  for (int row = 0; row < frame->chroma_height(); ++row) {
+    std::fill_n(frame->mutable_data_u() + row * frame->stride_u(),
+                frame->chroma_width(), 128);
+    std::fill_n(frame->mutable_data_v() + row * frame->stride_v(),
+                frame->chroma_width(), 128);
+  }
+  frame->set_timestamp_us(MonotonicNowUs());
+  return frame;
+}
+
+// Every record in the recording in |directory|, in order.
+std::vector<RecordIndexEntry> ReadAll(const std::string& directory,
+                                      size_t* partial_segments = nullptr) {
+  std::vector<RecordIndexEntry> entries;
+  for (const std::string& path : ListRecordingSegments(directory)) {
+    std::string error;
+    std::unique_ptr<RecordingSegmentReader> reader =
+        RecordingSegmentReader::Open(path, &error);
+    EXPECT_NE(reader, nullptr) << error;
+    if (reader == nullptr) {
+      continue;
+    }
+    if (partial_segments != nullptr && !reader->finished()) {
+      ++*partial_segments;
+    }
+    for (const RecordIndexEntry& entry : reader->index()) {
+      RecordHeader header;
+      const uint8_t* payload;
+      EXPECT_TRUE(reader->Read(entry, &header, &payload));
+      entries.push_back(entry);
+    }
+  }
+  return entries;
+}
+
+}  // namespace
+
+TEST(RecordingWriter, WritesVideoAndAudioRecords) {
+  std::string directory = MakeRecordingDirectory();
+  std::string error;
+  std::unique_ptr<RecordingWriter> writer =
+      RecordingWriter::Create(directory, RecordingWriter::Config(), &error);
+  ASSERT_NE(writer, nullptr) << error;
+
+  std::vector<int16_t> samples(320, 1000);
+  for (int i = 0; i < 10; ++i) {
+    writer->OnVideoFrame(7, MakeFrame(32, 18, static_cast<uint8_t>(i)));
+    writer->OnAudioData(7, samples.data(), 160, 16000, 2);
+  }
+  writer.reset();
+
+  std::vector<std::string> segments = ListRecordingSegments(directory);
+  ASSERT_EQ(segments.size(), 1u);
+  EXPECT_NE(segments[0].find("segment-000000.zrec"), std::string::npos);
+  std::unique_ptr<RecordingSegmentReader> reader =
+      RecordingSegmentReader::Open(segments[0], &error);
+  ASSERT_NE(reader, nullptr) << error;
+  EXPECT_TRUE(reader->finished());
+  ASSERT_EQ(reader->index().size(), 20u);
+
+  RecordHeader header;
+  const uint8_t* payload;
+  ASSERT_TRUE(reader->Read(reader->index()[2], &header, &payload));
+  EXPECT_EQ(header.type, RecordType::kVideo);
+  EXPECT_EQ(header.participant_id, 7u);
+  EXPECT_EQ(header.payload_size,
+            kVideoPayloadHeaderSize + 32 * 18 + 2 * 16 * 9);
+  EXPECT_EQ(payload[0], 32);
+  EXPECT_EQ(payload[4], 18);
+  EXPECT_EQ(payload[kVideoPayloadHeaderSize], 1);
+
+  ASSERT_TRUE(reader->Read(reader->index()[3], &header, &payload));
+  EXPECT_EQ(header.type, RecordType::kAudio);
+  EXPECT_EQ(header.payload_size, kAudioPayloadHeaderSize + 320 * 2);
+  for (size_t i = 1; i < reader->index().size(); ++i) {
+    EXPECT_GE(reader->index()[i].timestamp_us,
+              reader->index()[i - 1].timestamp_us);
+  }
+}
+
+TEST(RecordingWriter, RotatesSegmentsBySize) {
+  std::string directory = MakeRecordingDirectory();
+  RecordingWriter::Config config;
+  config.segment_bytes = 8192;
+  std::string error;
+  std::unique_ptr<RecordingWriter> writer =
+      RecordingWriter::Create(directory, config, &error);
+  ASSERT_NE(writer, nullptr) << error;
+
+  // 1000-byte audio records, so seven fit in a segment with their index.
+  std::vector<int16_t> samples(480, 0);
+  for (int i = 0; i < 30; ++i) {
+    writer->OnAudioData(1, samples.data(), 480, 48000, 1);
+  }
+  writer.reset();
+
+  size_t partial_segments = 0;
+  EXPECT_EQ(ReadAll(directory, &partial_segments).size(), 30u);
+  EXPECT_EQ(partial_segments, 0u);
+  EXPECT_EQ(ListRecordingSegments(directory).size(), 5u);
+}
+
+TEST(RecordingWriter, RotatesSegmentsByTime) {
+  std::string directory = MakeRecordingDirectory();
+  RecordingWriter::Config config;
+  config.segment_duration_us = 20000;
+  config.batch_size = 1;
+  std::string error;
+  std::unique_ptr<RecordingWriter> writer =
+      RecordingWriter::Create(directory, config, &error);
+  ASSERT_NE(writer, nullptr) << error;
+
+  std::vector<int16_t> samples(160, 0);
+  for (int i = 0; i < 3; ++i) {
+    writer->OnAudioData(1, samples.data(), 160, 16000, 1);
+    usleep(30000);
+  }
+  RecordingWriter::Stats stats = writer->GetStats();
+  EXPECT_EQ(stats.segments_finished, 2u);
+  writer.reset();
+  EXPECT_EQ(ListRecordingSegments(directory).size(), 3u);
+}
+
+TEST(RecordingWriter, DropsRecordsLargerThanASegment) {
+  std::string directory = MakeRecordingDirectory();
+  RecordingWriter::Config config;
+  config.segment_bytes = 4096;
+  std::string error;
+  std::unique_ptr<RecordingWriter> writer =
+      RecordingWriter::Create(directory, config, &error);
+  ASSERT_NE(writer, nullptr) << error;
+
+  writer->OnVideoFrame(1, MakeFrame(64, 64, 0));
+  std::vector<int16_t> samples(16, 0);
+  writer->OnAudioData(1, samples.data(), 16, 16000, 1);
+  writer.reset();
+
+  EXPECT_EQ(ReadAll(directory).size(), 1u);
+}
+
+TEST(RecordingWriter, DropsRecordsWhenTheQueueIsFull) {
+  std::string directory = MakeRecordingDirectory();
+  RecordingWriter::Config config;
+  config.queue_capacity = 4;
+  std::string error;
+  std::unique_ptr<RecordingWriter> writer =
+      RecordingWriter::Create(directory, config, &error);
+  ASSERT_NE(writer, nullptr) << error;
+
+  std::shared_ptr<VideoFrame> frame = MakeFrame(640, 360, 0);
+  for (int i = 0; i < 200; ++i) {
+    writer->OnVideoFrame(1, frame);
+  }
+  RecordingWriter::Stats stats = writer->GetStats();
+  writer.reset();
+  EXPECT_GT(stats.records_dropped, 0u);
+  EXPECT_EQ(ReadAll(directory).size(), 200 - stats.records_dropped);
+}
+
+TEST(RecordingWriter, LeavesNoEmptySegment) {
+  std::string directory = MakeRecordingDirectory();
+  std::string error;
+  std::unique_ptr<RecordingWriter> writer =
+      RecordingWriter::Create(directory, RecordingWriter::Config(), &error);
+  ASSERT_NE(writer, nullptr) << error;
+  writer.reset();
+  EXPECT_TRUE(ListRecordingSegments(directory).empty());
+}
+
+TEST(RecordingWriter, ReportsUnwritableDirectories) {
+  std::string error;
+  EXPECT_EQ(RecordingWriter::Create("/nonexistent/recording",
+                                    RecordingWriter::Config(), &error),
+            nullptr);
+  EXPECT_NE(error.find("/nonexistent/recording"), std::string::npos);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
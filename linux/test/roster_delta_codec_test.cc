@@ -0,0 +1,72 @@
+#include "roster_delta_codec.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+TEST(RosterDeltaCodec, RoundTrips) {
+  std::vector<RosterDelta> deltas(3);
+  deltas[0].sequence = 0x0102030405060708;
+  deltas[0].session_id = 7;
+  deltas[0].slot = 12;
+  deltas[0].participant_id = 16778240;
+  deltas[0].state = kRosterVideoOn;
+  deltas[0].display_name = "Zoë";
+  deltas[1].type = RosterDeltaType::kChanged;
+  deltas[1].changes = kRosterAudioChanged;
+  deltas[1].state = kRosterAudioMuted | kRosterVideoOn;
+  deltas[2].type = RosterDeltaType::kSessionEnded;
+  deltas[2].session_id = 7;
+
+  std::vector<uint8_t> data;
+  EncodeRosterDeltas(deltas, &data);
+  // "Zoë" is 4 UTF-8 bytes, so no padding.
+  ASSERT_EQ(data.size(), 3 * kRosterDeltaHeaderSize + 4);
+
+  std::vector<RosterDelta> decoded;
+  ASSERT_TRUE(DecodeRosterDeltas(data.data(), data.size(), &decoded));
+  ASSERT_EQ(decoded.size(), 3u);
+  EXPECT_EQ(decoded[0].sequence, deltas[0].sequence);
+  EXPECT_EQ(decoded[0].session_id, 7u);
+  EXPECT_EQ(decoded[0].slot, 12u);
+  EXPECT_EQ(decoded[0].participant_id, 16778240u);
+  EXPECT_EQ(decoded[0].type, RosterDeltaType::kJoined);
+  EXPECT_EQ(decoded[0].state, kRosterVideoOn);
+  EXPECT_EQ(decoded[0].display_name, "Zoë");
+  EXPECT_EQ(decoded[1].type, RosterDeltaType::kChanged);
+  EXPECT_EQ(decoded[1].changes, kRosterAudioChanged);
+  EXPECT_EQ(decoded[2].type, RosterDeltaType::kSessionEnded);
+}
+
+TEST(RosterDeltaCodec, PadsNamesAndUsesLittleEndianLayout) {
+  std::vector<RosterDelta> deltas(2);
+  deltas[0].sequence = 0x0102;
+  deltas[0].display_name = "Ada";
+  deltas[1].sequence = 0x0103;
+
+  std::vector<uint8_t> data;
+  EncodeRosterDeltas(deltas, &data);
+  ASSERT_EQ(data.size(), 2 * kRosterDeltaHeaderSize + 4);
+  EXPECT_EQ(data[0], 0x02);
+  EXPECT_EQ(data[1], 0x01);
+  EXPECT_EQ(data[24], 3);
+  EXPECT_EQ(data[28], 'A');
+  EXPECT_EQ(data[31], 0);
+  EXPECT_EQ(data[32], 0x03);
+}
+
+TEST(RosterDeltaCodec, RejectsCutOffRecords) {
+  std::vector<RosterDelta> deltas(1);
+  deltas[0].display_name = "Grace";
+  std::vector<uint8_t> data;
+  EncodeRosterDeltas(deltas, &data);
+  std::vector<RosterDelta> decoded;
+  EXPECT_FALSE(DecodeRosterDeltas(data.data(), data.size() - 1, &decoded));
+  EXPECT_FALSE(DecodeRosterDeltas(data.data(), 20, &decoded));
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,198 @@
+#include "simulated_meeting_backend.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+MeetingScenario FastScenario() {
+  MeetingScenario scenario;
+  scenario.speed = 1000;
+  scenario.init_delay_ms = 0;
+  scenario.video_width = 16;
+  scenario.video_height = 16;
+  return scenario;
+}
+
+class RecordingObserver : public MeetingBackend::Observer {
+ public:
+  void OnMeetingStatusChanged(const std::string& meeting_id,
+                              MeetingStatus status,
+                              int32_t error_code,
+                              int32_t internal_error_code) override {
+    std::lock_guard<std::mutex> lock(mutex);
+    statuses.push_back(status);
+  }
+
+  void OnParticipantJoined(const std::string& meeting_id,
+                           const ParticipantInfo& participant) override {
+    ++joined;
+  }
+
+  void OnParticipantLeft(const std::string& meeting_id,
+                         uint32_t participant_id) override {
+    ++left;
+  }
+
+  void OnParticipantChanged(const std::string& meeting_id,
+                            const ParticipantInfo& participant) override {
+    ++changed;
+  }
+
+  std::vector<MeetingStatus> GetStatuses() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return statuses;
+  }
+
+  std::mutex mutex;
+  std::vector<MeetingStatus> statuses;
+  std::atomic<int> joined{0};
+  std::atomic<int> left{0};
+  std::atomic<int> changed{0};
+};
+
+class CountingSink : public MeetingBackend::VideoSink {
+ public:
+  void OnVideoFrame(uint32_t participant_id,
+                    std::shared_ptr<const VideoFrame> frame) override {
+    ++frames;
+  }
+
+  std::atomic<int> frames{0};
+};
+
+// Polls |condition| for up to two seconds.
+template <typename Condition>
+bool WaitUntil(Condition condition) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+void Initialize(MeetingBackend* backend) {
+  InitParams params;
+  params.domain = "zoom.us";
+  ASSERT_EQ(backend->Initialize(params).error_code, kZoomErrorSuccess);
+}
+
+MeetingOptions Meeting(const std::string& meeting_id) {
+  MeetingOptions options;
+  options.meeting_id = meeting_id;
+  return options;
+}
+
+}  // namespace
+
+TEST(SimulatedMeetingBackend, JoinsAndLeaves) {
+  MeetingScenario scenario = FastScenario();
+  scenario.participants = 3;
+  SimulatedMeetingBackend backend(scenario);
+  RecordingObserver observer;
+  backend.SetObserver(&observer);
+  Initialize(&backend);
+
+  ASSERT_TRUE(backend.JoinMeeting(Meeting("123")));
+  EXPECT_EQ(backend.GetMeetingStatus(), MeetingStatus::kInMeeting);
+  EXPECT_FALSE(backend.JoinMeeting(Meeting("123")));
+  ASSERT_TRUE(WaitUntil([&] { return backend.GetParticipants().size() == 3; }));
+
+  EXPECT_TRUE(backend.LeaveMeeting("123"));
+  EXPECT_TRUE(backend.GetParticipants().empty());
+  backend.SetObserver(nullptr);
+  EXPECT_EQ(observer.GetStatuses(),
+            (std::vector<MeetingStatus>{
+                MeetingStatus::kConnecting, MeetingStatus::kInMeeting,
+                MeetingStatus::kDisconnecting, MeetingStatus::kIdle}));
+  EXPECT_EQ(observer.joined, 3);
+}
+
+TEST(SimulatedMeetingBackend, ServesVideoOfPresentParticipants) {
+  MeetingScenario scenario = FastScenario();
+  scenario.participants = 2;
+  SimulatedMeetingBackend backend(scenario);
+  Initialize(&backend);
+  CountingSink sink;
+  EXPECT_FALSE(backend.SubscribeVideo(
+      SimulatedMeetingBackend::kFirstParticipantId, &sink));
+
+  ASSERT_TRUE(backend.JoinMeeting(Meeting("123")));
+  ASSERT_TRUE(WaitUntil([&] { return backend.GetParticipants().size() == 2; }));
+  uint32_t participant_id = backend.GetParticipants()[0];
+  ASSERT_TRUE(backend.SubscribeVideo(participant_id, &sink));
+  EXPECT_TRUE(WaitUntil([&] { return sink.frames > 0; }));
+
+  // Leaving stops the participant's video.
+  backend.LeaveMeeting("123");
+  int frames = sink.frames;
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(sink.frames, frames);
+}
+
+TEST(SimulatedMeetingBackend, EndsMeetingsAfterTheirDuration) {
+  MeetingScenario scenario = FastScenario();
+  scenario.participants = 5;
+  scenario.duration_ms = 1000;
+  SimulatedMeetingBackend backend(scenario);
+  RecordingObserver observer;
+  backend.SetObserver(&observer);
+  Initialize(&backend);
+
+  ASSERT_TRUE(backend.JoinMeeting(Meeting("123")));
+  ASSERT_TRUE(WaitUntil(
+      [&] { return backend.GetMeetingStatus() == MeetingStatus::kIdle; }));
+  EXPECT_TRUE(backend.GetParticipants().empty());
+  // Already over, so it cannot be left, but it can be joined again.
+  EXPECT_FALSE(backend.LeaveMeeting("123"));
+  EXPECT_TRUE(backend.JoinMeeting(Meeting("123")));
+  backend.SetObserver(nullptr);
+}
+
+TEST(SimulatedMeetingBackend, AttendsConcurrentMeetingsWithChurn) {
+  MeetingScenario scenario = FastScenario();
+  scenario.participants = 10;
+  scenario.joins_per_minute = 600;
+  scenario.leaves_per_minute = 600;
+  scenario.updates_per_minute = 600;
+  scenario.reconnect_count = 10;
+  scenario.reconnect_interval_ms = 100;
+  SimulatedMeetingBackend backend(scenario);
+  RecordingObserver observer;
+  backend.SetObserver(&observer);
+  Initialize(&backend);
+
+  ASSERT_TRUE(backend.JoinMeeting(Meeting("1")));
+  ASSERT_TRUE(backend.JoinMeeting(Meeting("2")));
+  EXPECT_TRUE(
+      WaitUntil([&] { return observer.left > 20 && observer.changed > 20; }));
+  backend.LeaveMeeting("1");
+  backend.LeaveMeeting("2");
+  EXPECT_TRUE(backend.GetParticipants().empty());
+  backend.SetObserver(nullptr);
+}
+
+TEST(SimulatedMeetingBackend, ReportsFailedJoins) {
+  MeetingScenario scenario = FastScenario();
+  scenario.join_failure_rate = 1;
+  SimulatedMeetingBackend backend(scenario);
+  Initialize(&backend);
+  EXPECT_TRUE(backend.JoinMeeting(Meeting("123")));
+  EXPECT_EQ(backend.GetMeetingStatus(), MeetingStatus::kFailed);
+  EXPECT_FALSE(backend.LeaveMeeting("123"));
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
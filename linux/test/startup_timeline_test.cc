@@ -0,0 +1,47 @@
+#include "startup_timeline.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "monotonic_clock.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+TEST(StartupTimeline, KeepsFirstMarkOfEachName) {
+  StartupTimeline timeline;
+  EXPECT_TRUE(timeline.Mark(kStartupMain));
+  EXPECT_TRUE(timeline.Mark(kStartupActivate));
+  EXPECT_FALSE(timeline.Mark(kStartupMain));
+
+  std::vector<StartupTimeline::Milestone> marks = timeline.GetMarks();
+  ASSERT_EQ(marks.size(), 2u);
+  EXPECT_EQ(marks[0].name, kStartupMain);
+  EXPECT_EQ(marks[1].name, kStartupActivate);
+  EXPECT_LE(marks[0].time_us, marks[1].time_us);
+  EXPECT_TRUE(timeline.HasMark(kStartupActivate));
+  EXPECT_FALSE(timeline.HasMark(kStartupFirstFrame));
+}
+
+TEST(StartupTimeline, MeasuresFromProcessStart) {
+  StartupTimeline timeline;
+  timeline.Mark(kStartupMain);
+  int64_t origin = timeline.origin_us();
+  EXPECT_LE(origin, timeline.GetMarks()[0].time_us);
+  // The test binary has not been running for an hour.
+  EXPECT_GT(origin, MonotonicNowUs() - INT64_C(3600000000));
+}
+
+TEST(StartupTimeline, FormatsOneLinePerMark) {
+  StartupTimeline timeline;
+  timeline.Mark(kStartupMain);
+  timeline.Mark(kStartupSdkInitComplete);
+  std::string text = timeline.Format();
+  EXPECT_NE(text.find("main"), std::string::npos);
+  EXPECT_NE(text.find("sdk_init_complete"), std::string::npos);
+  EXPECT_EQ(std::count(text.begin(), text.end(), '\n'), 2);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
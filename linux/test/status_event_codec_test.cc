@@ -0,0 +1,53 @@
+#include "status_event_codec.h"
+
+#include <gtest/gtest.h>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+TEST(StatusEventCodec, RoundTrips) {
+  MeetingStatusEvent event;
+  event.status = MeetingStatus::kReconnecting;
+  event.error_code = -3;
+  event.internal_error_code = 70000;
+  event.session_id = 7;
+  event.timestamp_us = 1234567890123;
+  event.sequence = 0x0102030405060708;
+
+  uint8_t record[kStatusEventRecordSize];
+  EncodeStatusEvent(event, record);
+
+  MeetingStatusEvent decoded;
+  ASSERT_TRUE(DecodeStatusEvent(record, sizeof(record), &decoded));
+  EXPECT_EQ(decoded.status, event.status);
+  EXPECT_EQ(decoded.error_code, event.error_code);
+  EXPECT_EQ(decoded.internal_error_code, event.internal_error_code);
+  EXPECT_EQ(decoded.session_id, event.session_id);
+  EXPECT_EQ(decoded.timestamp_us, event.timestamp_us);
+  EXPECT_EQ(decoded.sequence, event.sequence);
+}
+
+TEST(StatusEventCodec, UsesLittleEndianLayout) {
+  MeetingStatusEvent event;
+  event.status = MeetingStatus::kInMeeting;
+  event.session_id = 0x0304;
+  event.sequence = 0x0102;
+
+  uint8_t record[kStatusEventRecordSize];
+  EncodeStatusEvent(event, record);
+  EXPECT_EQ(record[0], 3);
+  EXPECT_EQ(record[1], 0);
+  EXPECT_EQ(record[12], 0x04);
+  EXPECT_EQ(record[13], 0x03);
+  EXPECT_EQ(record[24], 0x02);
+  EXPECT_EQ(record[25], 0x01);
+}
+
+TEST(StatusEventCodec, RejectsShortRecord) {
+  uint8_t record[kStatusEventRecordSize - 1] = {};
+  MeetingStatusEvent decoded;
+  EXPECT_FALSE(DecodeStatusEvent(record, sizeof(record), &decoded));
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
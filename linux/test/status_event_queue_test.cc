@@ -0,0 +1,53 @@
+#include "status_event_queue.h"
+
+#include <gtest/gtest.h>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+MeetingStatusEvent MakeEvent(uint64_t sequence) {
+  MeetingStatusEvent event;
+  event.status = MeetingStatus::kConnecting;
+  event.sequence = sequence;
+  event.timestamp_us = MonotonicNowUs();
+  return event;
+}
+
+}  // namespace
+
+TEST(StatusEventQueue, BurstNeedsOneWakeup) {
+  StatusEventQueue queue(16);
+  EXPECT_TRUE(queue.Push(MakeEvent(1)));
+  EXPECT_FALSE(queue.Push(MakeEvent(2)));
+  EXPECT_FALSE(queue.Push(MakeEvent(3)));
+
+  std::vector<MeetingStatusEvent> batch;
+  EXPECT_EQ(queue.Drain(&batch), 3u);
+  EXPECT_EQ(batch[0].sequence, 1u);
+  EXPECT_EQ(batch[2].sequence, 3u);
+
+  StatusEventQueueStats stats = queue.GetStats();
+  EXPECT_EQ(stats.pushed, 3u);
+  EXPECT_EQ(stats.wakeups, 1u);
+  EXPECT_EQ(stats.coalesced, 2u);
+  EXPECT_EQ(stats.drains, 1u);
+  EXPECT_EQ(stats.depth, 0u);
+  EXPECT_EQ(stats.peak_depth, 3u);
+  EXPECT_GE(stats.max_drain_latency_us, 0);
+
+  // The next event after a drain needs a new wakeup.
+  EXPECT_TRUE(queue.Push(MakeEvent(4)));
+}
+
+TEST(StatusEventQueue, CountsDroppedEvents) {
+  StatusEventQueue queue(2);
+  queue.Push(MakeEvent(1));
+  queue.Push(MakeEvent(2));
+  EXPECT_FALSE(queue.Push(MakeEvent(3)));
+  EXPECT_EQ(queue.GetStats().dropped, 1u);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,118 @@
+#include "trace.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+size_t CountSpans(const std::vector<TraceEvent>& events) {
+  size_t spans = 0;
+  for (const TraceEvent& event : events) {
+    spans += event.phase == 'X' ? 1 : 0;
+  }
+  return spans;
+}
+
+}  // namespace
+
+TEST(Tracer, RecordsScopesOnlyWhileEnabled) {
+  Tracer* tracer = Tracer::Get();
+  tracer->Stop();
+  { ZOOM_TRACE_SCOPE("test", "disabled"); }
+
+  tracer->Start();
+  { ZOOM_TRACE_SCOPE("test", "enabled"); }
+  std::thread([] { ZOOM_TRACE_SCOPE("test", "other_thread"); }).join();
+  tracer->Stop();
+
+  std::vector<TraceEvent> events = tracer->GetEvents();
+  EXPECT_EQ(CountSpans(events), 2u);
+  for (const TraceEvent& event : events) {
+    EXPECT_STRNE(event.name, "disabled");
+    if (event.phase == 'X') {
+      EXPECT_STREQ(event.category, "test");
+      EXPECT_GE(event.duration_us, 0);
+    }
+  }
+}
+
+TEST(Tracer, StartDiscardsPreviousSession) {
+  Tracer* tracer = Tracer::Get();
+  tracer->Start();
+  { ZOOM_TRACE_SCOPE("test", "first"); }
+  tracer->Start();
+  { ZOOM_TRACE_SCOPE("test", "second"); }
+  tracer->Stop();
+
+  std::vector<TraceEvent> events = tracer->GetEvents();
+  ASSERT_EQ(CountSpans(events), 1u);
+  EXPECT_STREQ(events.back().name, "second");
+}
+
+TEST(Tracer, DropsEventsWhenThreadBufferIsFull) {
+  Tracer* tracer = Tracer::Get();
+  tracer->Start();
+  for (size_t i = 0; i < Tracer::kEventsPerThread + 10; ++i) {
+    tracer->Record("test", "fill", 0, 0);
+  }
+  tracer->Stop();
+  // The thread name takes the first slot.
+  EXPECT_EQ(CountSpans(tracer->GetEvents()), Tracer::kEventsPerThread - 1);
+  EXPECT_EQ(tracer->dropped(), 11u);
+}
+
+TEST(Tracer, TruncatesLongNames) {
+  Tracer* tracer = Tracer::Get();
+  tracer->Start();
+  std::string name(100, 'n');
+  tracer->Record("a_very_long_category_name", name.c_str(), 1, 2);
+  tracer->Stop();
+  TraceEvent event = tracer->GetEvents().back();
+  EXPECT_EQ(std::string(event.name), name.substr(0, sizeof(event.name) - 1));
+  EXPECT_STREQ(event.category, "a_very_long_ca");
+}
+
+TEST(FormatTraceEvents, WritesChromeTraceJson) {
+  TraceEvent span = {};
+  span.start_us = 10;
+  span.duration_us = 5;
+  span.thread_id = 7;
+  span.phase = 'X';
+  snprintf(span.category, sizeof(span.category), "backend");
+  snprintf(span.name, sizeof(span.name), "say \"hi\"");
+  TraceEvent thread_name = {};
+  thread_name.phase = 'M';
+  thread_name.thread_id = 7;
+  snprintf(thread_name.name, sizeof(thread_name.name), "worker");
+
+  EXPECT_EQ(FormatTraceEvents({thread_name, span}, 42),
+            "{\"ph\":\"M\",\"pid\":42,\"tid\":7,\"name\":\"thread_name\","
+            "\"args\":{\"name\":\"worker\"}},\n"
+            "{\"ph\":\"X\",\"cat\":\"backend\",\"name\":\"say \\\"hi\\\"\","
+            "\"pid\":42,\"tid\":7,\"ts\":10,\"dur\":5}");
+}
+
+TEST(WriteChromeTrace, JoinsNativeAndExtraEvents) {
+  std::string path = ::testing::TempDir() + "trace_test.json";
+  ASSERT_TRUE(WriteChromeTrace(path, "{\"a\":1}", "{\"b\":2}"));
+  std::ifstream file(path);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  EXPECT_EQ(contents.str(),
+            "{\"traceEvents\":[\n{\"a\":1},\n{\"b\":2}\n],"
+            "\"displayTimeUnit\":\"ms\"}\n");
+  std::remove(path.c_str());
+
+  EXPECT_FALSE(WriteChromeTrace("/nonexistent/trace.json", "", ""));
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,227 @@
+#include "video_renderer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "local_meeting_backend.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+std::shared_ptr<VideoFrame> SolidFrame(int width, int height, uint8_t luma) {
+  std::shared_ptr<VideoFrame> frame = VideoFrame::Allocate(width, height);
+  memset(frame->mutable_data_y(), luma,
+         static_cast<size_t>(frame->stride_y()) * height);
+  memset(frame->mutable_data_u(), 128,
+         static_cast<size_t>(frame->stride_u()) * frame->chroma_height());
+  memset(frame->mutable_data_v(), 128,
+         static_cast<size_t>(frame->stride_v()) * frame->chroma_height());
+  return frame;
+}
+
+int64_t fake_now_us = 0;
+
+int64_t FakeNow() {
+  return fake_now_us;
+}
+
+class CountingSink : public MeetingBackend::VideoSink {
+ public:
+  void OnVideoFrame(uint32_t participant_id,
+                    std::shared_ptr<const VideoFrame> frame) override {
+    frames++;
+    last_participant = participant_id;
+  }
+
+  std::atomic<int> frames{0};
+  std::atomic<uint32_t> last_participant{0};
+};
+
+}  // namespace
+
+TEST(VideoRenderer, NothingToRenderBeforeFirstFrame) {
+  VideoRenderer renderer;
+  const uint8_t* rgba;
+  uint32_t width, height;
+  EXPECT_FALSE(renderer.Render(&rgba, &width, &height));
+}
+
+TEST(VideoRenderer, RendersLatestFrame) {
+  VideoRenderer renderer;
+  renderer.Push(SolidFrame(4, 2, 16));
+  renderer.Push(SolidFrame(6, 4, 235));
+
+  const uint8_t* rgba;
+  uint32_t width, height;
+  ASSERT_TRUE(renderer.Render(&rgba, &width, &height));
+  EXPECT_EQ(width, 6u);
+  EXPECT_EQ(height, 4u);
+  EXPECT_EQ(rgba[0], 255);
+  EXPECT_EQ(rgba[1], 255);
+  EXPECT_EQ(rgba[2], 255);
+  EXPECT_EQ(rgba[3], 255);
+
+  // Without a new frame the last conversion is shown again.
+  ASSERT_TRUE(renderer.Render(&rgba, &width, &height));
+  EXPECT_EQ(width, 6u);
+}
+
+TEST(VideoRenderer, ReleasesWrappedPlanesAfterRendering) {
+  uint8_t planes[4 + 1 + 1] = {16, 16, 16, 16, 128, 128};
+  bool released = false;
+  VideoRenderer renderer;
+  renderer.Push(VideoFrame::Wrap(2, 2, planes, 2, planes + 4, 1, planes + 5, 1,
+                                 [&released] { released = true; }));
+  EXPECT_FALSE(released);
+
+  const uint8_t* rgba;
+  uint32_t width, height;
+  ASSERT_TRUE(renderer.Render(&rgba, &width, &height));
+  EXPECT_TRUE(released);
+  EXPECT_EQ(rgba[0], 0);
+}
+
+TEST(VideoRenderer, CountsDroppedFramesAndAge) {
+  fake_now_us = 1000000;
+  VideoRenderer renderer(FakeNow);
+  const uint8_t* rgba;
+  uint32_t width, height;
+
+  // Two frames overwrite the first before the raster thread gets to it.
+  std::shared_ptr<VideoFrame> captured = SolidFrame(4, 2, 16);
+  captured->set_timestamp_us(fake_now_us - 30000);
+  renderer.Push(captured);
+  renderer.Push(SolidFrame(4, 2, 16));
+  fake_now_us += 5000;
+  renderer.Push(SolidFrame(4, 2, 235));
+  fake_now_us += 10000;
+  ASSERT_TRUE(renderer.Render(&rgba, &width, &height));
+
+  // A frame with a capture time is aged from it.
+  captured = SolidFrame(4, 2, 16);
+  captured->set_timestamp_us(fake_now_us - 40000);
+  renderer.Push(captured);
+  ASSERT_TRUE(renderer.Render(&rgba, &width, &height));
+  // Showing the last conversion again displays nothing new.
+  ASSERT_TRUE(renderer.Render(&rgba, &width, &height));
+
+  VideoFrameStats stats = renderer.GetStats();
+  EXPECT_EQ(stats.produced, 4u);
+  EXPECT_EQ(stats.displayed, 2u);
+  EXPECT_EQ(stats.dropped, 2u);
+  EXPECT_EQ(stats.last_age_us, 40000);
+  EXPECT_EQ(stats.max_age_us, 40000);
+  EXPECT_EQ(stats.mean_age_us(), 25000);
+}
+
+TEST(ScaleToDisplay, CoversTheDisplayInWholeSteps) {
+  int width, height;
+  ScaleToDisplay(1920, 1080, 240, 135, &width, &height);
+  EXPECT_EQ(width, 240);
+  EXPECT_EQ(height, 135);
+
+  ScaleToDisplay(1920, 1080, 250, 100, &width, &height);
+  EXPECT_EQ(width, 256);
+  EXPECT_EQ(height, 144);
+
+  // A tall tile crops the sides, so the height decides.
+  ScaleToDisplay(1920, 1080, 100, 300, &width, &height);
+  EXPECT_EQ(width, 544);
+  EXPECT_EQ(height, 306);
+}
+
+TEST(ScaleToDisplay, NeverUpscales) {
+  int width, height;
+  ScaleToDisplay(640, 360, 1000, 1000, &width, &height);
+  EXPECT_EQ(width, 640);
+  EXPECT_EQ(height, 360);
+
+  ScaleToDisplay(640, 360, 0, 0, &width, &height);
+  EXPECT_EQ(width, 640);
+  EXPECT_EQ(height, 360);
+}
+
+TEST(VideoRenderer, ScalesToTheDisplaySize) {
+  VideoRenderer renderer;
+  const uint8_t* rgba;
+  uint32_t width, height;
+  auto render = [&](int display_width, int display_height) {
+    renderer.SetDisplaySize(display_width, display_height);
+    renderer.Push(SolidFrame(1280, 720, 235));
+    ASSERT_TRUE(renderer.Render(&rgba, &width, &height));
+  };
+
+  render(320, 180);
+  EXPECT_EQ(width, 320u);
+  EXPECT_EQ(height, 180u);
+  EXPECT_EQ(rgba[0], 255);
+  EXPECT_EQ(rgba[(320 * 180 - 1) * 4 + 2], 255);
+
+  // Shrinking a little keeps the resolution; shrinking a lot does not.
+  render(300, 170);
+  EXPECT_EQ(width, 320u);
+  render(200, 112);
+  EXPECT_EQ(width, 208u);
+  EXPECT_EQ(height, 117u);
+
+  render(640, 360);
+  EXPECT_EQ(width, 640u);
+  render(0, 0);
+  EXPECT_EQ(width, 1280u);
+  EXPECT_EQ(height, 720u);
+}
+
+TEST(VideoRenderer, DividesTheResolutionUnderPressure) {
+  VideoRenderer renderer;
+  const uint8_t* rgba;
+  uint32_t width, height;
+  renderer.SetResolutionDivisor(2);
+  renderer.Push(SolidFrame(1280, 720, 235));
+  ASSERT_TRUE(renderer.Render(&rgba, &width, &height));
+  EXPECT_EQ(width, 640u);
+  EXPECT_EQ(height, 360u);
+
+  renderer.SetDisplaySize(320, 180);
+  renderer.SetResolutionDivisor(4);
+  renderer.Push(SolidFrame(1280, 720, 235));
+  ASSERT_TRUE(renderer.Render(&rgba, &width, &height));
+  EXPECT_EQ(width, 80u);
+  EXPECT_EQ(height, 45u);
+  EXPECT_EQ(rgba[0], 255);
+
+  renderer.SetResolutionDivisor(1);
+  renderer.Push(SolidFrame(1280, 720, 235));
+  ASSERT_TRUE(renderer.Render(&rgba, &width, &height));
+  EXPECT_EQ(width, 320u);
+}
+
+TEST(LocalMeetingBackend, DeliversSyntheticVideo) {
+  LocalMeetingBackend::Config config;
+  config.init_delay = std::chrono::milliseconds(0);
+  config.video.width = 64;
+  config.video.height = 36;
+  config.video.frames_per_second = 200;
+  LocalMeetingBackend backend(config);
+
+  CountingSink sink;
+  EXPECT_FALSE(backend.SubscribeVideo(7, &sink));
+
+  InitParams params;
+  params.domain = "zoom.us";
+  backend.Initialize(params);
+  ASSERT_TRUE(backend.SubscribeVideo(7, &sink));
+  while (sink.frames < 3) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  backend.UnsubscribeVideo(7);
+  int frames = sink.frames;
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(sink.frames, frames);
+  EXPECT_EQ(sink.last_participant, 7u);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
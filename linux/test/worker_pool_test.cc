@@ -0,0 +1,37 @@
+#include "worker_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+TEST(WorkerPool, RunsPostedTasks) {
+  std::atomic<int> count{0};
+  {
+    WorkerPool pool(2);
+    for (int i = 0; i < 100; ++i) {
+      pool.Post([&count] { ++count; });
+    }
+  }
+  EXPECT_EQ(count, 100);
+}
+
+TEST(WorkerPool, BlockedTaskDoesNotStallOthers) {
+  WorkerPool pool(2);
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  pool.Post([released] { released.wait(); });
+
+  std::promise<void> ran;
+  pool.Post([&ran] { ran.set_value(); });
+  EXPECT_EQ(ran.get_future().wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  release.set_value();
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
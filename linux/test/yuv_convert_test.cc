@@ -0,0 +1,247 @@
+#include "yuv_convert.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+constexpr YuvKernel kKernels[] = {YuvKernel::kScalar, YuvKernel::kSse2,
+                                  YuvKernel::kAvx2};
+constexpr YuvMatrix kMatrices[] = {YuvMatrix::kBt601, YuvMatrix::kBt709};
+constexpr YuvRange kRanges[] = {YuvRange::kLimited, YuvRange::kFull};
+
+// Random planes with padding after each row, to catch kernels that read or
+// write past |width|.
+struct TestImage {
+  TestImage(int width, int height, uint32_t seed)
+      : width(width),
+        height(height),
+        chroma_width((width + 1) / 2),
+        chroma_height((height + 1) / 2),
+        stride_y(width + 7),
+        stride_u(chroma_width + 5),
+        stride_v(chroma_width + 3),
+        stride_uv(chroma_width * 2 + 6),
+        y(static_cast<size_t>(stride_y) * height),
+        u(static_cast<size_t>(stride_u) * chroma_height),
+        v(static_cast<size_t>(stride_v) * chroma_height),
+        uv(static_cast<size_t>(stride_uv) * chroma_height) {
+    std::mt19937 random(seed);
+    for (auto* plane : {&y, &u, &v}) {
+      for (uint8_t& value : *plane) {
+        value = static_cast<uint8_t>(random());
+      }
+    }
+    for (int row = 0; row < chroma_height; ++row) {
+      for (int col = 0; col < chroma_width; ++col) {
+        uv[row * stride_uv + col * 2] = u[row * stride_u + col];
+        uv[row * stride_uv + col * 2 + 1] = v[row * stride_v + col];
+      }
+    }
+  }
+
+  int width;
+  int height;
+  int chroma_width;
+  int chroma_height;
+  int stride_y;
+  int stride_u;
+  int stride_v;
+  int stride_uv;
+  std::vector<uint8_t> y;
+  std::vector<uint8_t> u;
+  std::vector<uint8_t> v;
+  std::vector<uint8_t> uv;
+};
+
+std::vector<uint8_t> ConvertI420(YuvKernel kernel,
+                                 const TestImage& image,
+                                 YuvMatrix matrix,
+                                 YuvRange range) {
+  int stride_rgba = image.width * 4 + 12;
+  std::vector<uint8_t> rgba(static_cast<size_t>(stride_rgba) * image.height,
+                            0xcd);
+  I420ToRgbaWithKernel(kernel, image.y.data(), image.stride_y, image.u.data(),
+                       image.stride_u, image.v.data(), image.stride_v,
+                       rgba.data(), stride_rgba, image.width, image.height,
+                       matrix, range);
+  return rgba;
+}
+
+std::vector<uint8_t> ConvertNv12(YuvKernel kernel,
+                                 const TestImage& image,
+                                 YuvMatrix matrix,
+                                 YuvRange range) {
+  int stride_rgba = image.width * 4 + 12;
+  std::vector<uint8_t> rgba(static_cast<size_t>(stride_rgba) * image.height,
+                            0xcd);
+  Nv12ToRgbaWithKernel(kernel, image.y.data(), image.stride_y,
+                       image.uv.data(), image.stride_uv, rgba.data(),
+                       stride_rgba, image.width, image.height, matrix, range);
+  return rgba;
+}
+
+std::vector<uint8_t> ScaleI420(YuvKernel kernel,
+                               const TestImage& image,
+                               int width,
+                               int height) {
+  int stride_rgba = width * 4 + 12;
+  std::vector<uint8_t> rgba(static_cast<size_t>(stride_rgba) * height, 0xcd);
+  I420ScaleToRgbaWithKernel(kernel, image.y.data(), image.stride_y,
+                            image.u.data(), image.stride_u, image.v.data(),
+                            image.stride_v, image.width, image.height,
+                            rgba.data(), stride_rgba, width, height,
+                            YuvMatrix::kBt601, YuvRange::kLimited);
+  return rgba;
+}
+
+// Reference box filter: output sample i averages source samples
+// [i * src / dst, (i + 1) * src / dst), at least one, rounding to nearest.
+std::vector<uint8_t> BoxFilter(const std::vector<uint8_t>& plane,
+                               int stride,
+                               int src_width,
+                               int src_height,
+                               int dst_width,
+                               int dst_height) {
+  std::vector<uint8_t> out(static_cast<size_t>(dst_width) * dst_height);
+  for (int row = 0; row < dst_height; ++row) {
+    int top = row * src_height / dst_height;
+    int bottom = std::max((row + 1) * src_height / dst_height, top + 1);
+    for (int col = 0; col < dst_width; ++col) {
+      int left = col * src_width / dst_width;
+      int right = std::max((col + 1) * src_width / dst_width, left + 1);
+      int sum = 0;
+      for (int y = top; y < bottom; ++y) {
+        for (int x = left; x < right; ++x) {
+          sum += plane[y * stride + x];
+        }
+      }
+      int count = (bottom - top) * (right - left);
+      out[row * dst_width + col] = static_cast<uint8_t>((sum + count / 2) /
+                                                        count);
+    }
+  }
+  return out;
+}
+
+std::vector<uint8_t> ConvertPixel(uint8_t y,
+                                  uint8_t u,
+                                  uint8_t v,
+                                  YuvMatrix matrix,
+                                  YuvRange range) {
+  std::vector<uint8_t> rgba(4);
+  I420ToRgba(&y, 1, &u, 1, &v, 1, rgba.data(), 4, 1, 1, matrix, range);
+  return rgba;
+}
+
+}  // namespace
+
+TEST(YuvConvert, ScalarIsAlwaysSupported) {
+  EXPECT_TRUE(IsYuvKernelSupported(YuvKernel::kScalar));
+  EXPECT_TRUE(IsYuvKernelSupported(DetectYuvKernel()));
+}
+
+TEST(YuvConvert, LimitedRangeBlackAndWhite) {
+  EXPECT_EQ(ConvertPixel(16, 128, 128, YuvMatrix::kBt601, YuvRange::kLimited),
+            (std::vector<uint8_t>{0, 0, 0, 255}));
+  EXPECT_EQ(ConvertPixel(235, 128, 128, YuvMatrix::kBt709, YuvRange::kLimited),
+            (std::vector<uint8_t>{255, 255, 255, 255}));
+  EXPECT_EQ(ConvertPixel(255, 128, 128, YuvMatrix::kBt601, YuvRange::kFull),
+            (std::vector<uint8_t>{255, 255, 255, 255}));
+}
+
+TEST(YuvConvert, MatrixSelectsColor) {
+  // Limited-range pure red in each matrix.
+  std::vector<uint8_t> bt601 =
+      ConvertPixel(81, 90, 240, YuvMatrix::kBt601, YuvRange::kLimited);
+  std::vector<uint8_t> bt709 =
+      ConvertPixel(63, 102, 240, YuvMatrix::kBt709, YuvRange::kLimited);
+  for (const std::vector<uint8_t>& rgba : {bt601, bt709}) {
+    EXPECT_GE(rgba[0], 253);
+    EXPECT_LE(rgba[1], 2);
+    EXPECT_LE(rgba[2], 2);
+  }
+}
+
+// Every kernel must match the scalar reference exactly, across SIMD block
+// boundaries, odd sizes and padded strides.
+TEST(YuvConvert, KernelsMatchScalar) {
+  const int kSizes[][2] = {{1, 1},  {15, 3},  {16, 2},  {17, 5},
+                           {33, 4}, {63, 7},  {64, 2},  {97, 9},
+                           {640, 3}};
+  for (YuvKernel kernel : kKernels) {
+    if (!IsYuvKernelSupported(kernel)) {
+      continue;
+    }
+    for (const auto& size : kSizes) {
+      TestImage image(size[0], size[1], size[0] * 31 + size[1]);
+      for (YuvMatrix matrix : kMatrices) {
+        for (YuvRange range : kRanges) {
+          SCOPED_TRACE(testing::Message()
+                       << YuvKernelName(kernel) << " " << size[0] << "x"
+                       << size[1] << " matrix " << static_cast<int>(matrix)
+                       << " range " << static_cast<int>(range));
+          std::vector<uint8_t> expected =
+              ConvertI420(YuvKernel::kScalar, image, matrix, range);
+          EXPECT_EQ(ConvertI420(kernel, image, matrix, range), expected);
+          EXPECT_EQ(ConvertNv12(kernel, image, matrix, range), expected);
+        }
+      }
+    }
+  }
+}
+
+// Scaling must equal box-filtering each plane and then converting, for
+// every kernel, whether the scale factor is whole, fractional or upwards.
+TEST(YuvConvert, ScaleAveragesBoxes) {
+  const int kSizes[][4] = {
+      {64, 36, 16, 9},   {97, 9, 13, 4}, {33, 17, 32, 16},
+      {17, 5, 40, 11},   {5, 5, 1, 1},   {640, 360, 256, 144},
+  };
+  for (YuvKernel kernel : kKernels) {
+    if (!IsYuvKernelSupported(kernel)) {
+      continue;
+    }
+    for (const auto& size : kSizes) {
+      SCOPED_TRACE(testing::Message()
+                   << YuvKernelName(kernel) << " " << size[0] << "x"
+                   << size[1] << " to " << size[2] << "x" << size[3]);
+      TestImage image(size[0], size[1], size[0] * 7 + size[3]);
+      const int width = size[2];
+      const int height = size[3];
+      const int chroma_width = (width + 1) / 2;
+      std::vector<uint8_t> y = BoxFilter(image.y, image.stride_y, image.width,
+                                         image.height, width, height);
+      std::vector<uint8_t> u = BoxFilter(
+          image.u, image.stride_u, image.chroma_width, image.chroma_height,
+          chroma_width, (height + 1) / 2);
+      std::vector<uint8_t> v = BoxFilter(
+          image.v, image.stride_v, image.chroma_width, image.chroma_height,
+          chroma_width, (height + 1) / 2);
+      int stride_rgba = width * 4 + 12;
+      std::vector<uint8_t> expected(static_cast<size_t>(stride_rgba) * height,
+                                    0xcd);
+      I420ToRgbaWithKernel(YuvKernel::kScalar, y.data(), width, u.data(),
+                           chroma_width, v.data(), chroma_width,
+                           expected.data(), stride_rgba, width, height,
+                           YuvMatrix::kBt601, YuvRange::kLimited);
+      EXPECT_EQ(ScaleI420(kernel, image, width, height), expected);
+    }
+  }
+}
+
+TEST(YuvConvert, ScaleToSameSizeConverts) {
+  TestImage image(97, 9, 5);
+  EXPECT_EQ(ScaleI420(DetectYuvKernel(), image, 97, 9),
+            ConvertI420(YuvKernel::kScalar, image, YuvMatrix::kBt601,
+                        YuvRange::kLimited));
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
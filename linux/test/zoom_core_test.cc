@@ -0,0 +1,134 @@
+#include "include/flutter_zoom_meeting_sdk/zoom_core.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include "local_meeting_backend.h"
+#include "zoom_core_handle.h"
+
+namespace flutter_zoom_meeting_sdk {
+namespace test {
+
+namespace {
+
+constexpr int64_t kAudioPort = 42;
+constexpr int64_t kClosedPort = 43;
+constexpr uint32_t kParticipant = 16778240;
+
+// The leading fields of Dart_CObject that an int message uses.
+struct IntMessage {
+  int32_t type;
+  int64_t value;
+};
+
+std::atomic<int> posts{0};
+std::atomic<int64_t> last_port{0};
+std::atomic<int64_t> last_value{0};
+
+// Stands in for Dart_PostCObject. kClosedPort behaves like a port Dart has
+// closed.
+bool FakePostCObject(int64_t port, void* message) {
+  if (port == kClosedPort) {
+    return false;
+  }
+  const auto* int_message = static_cast<const IntMessage*>(message);
+  EXPECT_EQ(int_message->type, 3);
+  last_port = port;
+  last_value = int_message->value;
+  posts++;
+  return true;
+}
+
+bool WaitFor(const std::function<bool()>& condition) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(ZoomCore, ReportsItsAbiVersion) {
+  EXPECT_EQ(zoom_core_abi_version(), ZOOM_CORE_ABI_VERSION);
+}
+
+TEST(ZoomCore, PostsAudioNotificationsToADartPort) {
+  posts = 0;
+  last_port = 0;
+  last_value = 0;
+  LocalMeetingBackend::Config config;
+  config.init_delay = std::chrono::milliseconds(0);
+  LocalMeetingBackend backend(config);
+  InitParams params;
+  params.domain = "zoom.us";
+  backend.Initialize(params);
+
+  std::atomic<int> channel_notifications{0};
+  AudioStreamRouter router(&backend, AudioStreamRouter::Config(),
+                           [&](uint32_t) { channel_notifications++; });
+  ZoomCore core{&router};
+  ZoomCoreHandle handle = RegisterZoomCore(&core);
+
+  zoom_core_init_dart_api(nullptr);
+  EXPECT_FALSE(zoom_core_set_audio_port(handle, kAudioPort));
+  zoom_core_init_dart_api(FakePostCObject);
+  ASSERT_TRUE(zoom_core_set_audio_port(handle, kAudioPort));
+
+  const PcmRingBuffer* ring = router.Subscribe(kParticipant);
+  ASSERT_NE(ring, nullptr);
+  ASSERT_TRUE(WaitFor([] { return posts == 1; }));
+  EXPECT_EQ(last_port, kAudioPort);
+  EXPECT_EQ(last_value, kParticipant);
+
+  // Coalesced as on the channel until Dart acknowledges.
+  uint64_t position = ring->write_position();
+  ASSERT_TRUE(
+      WaitFor([&] { return ring->write_position() >= position + 1600; }));
+  EXPECT_EQ(posts, 1);
+  zoom_core_acknowledge_audio(handle, kParticipant);
+  ASSERT_TRUE(WaitFor([] { return posts == 2; }));
+
+  // A closed port falls back to the channel.
+  ASSERT_TRUE(zoom_core_set_audio_port(handle, kClosedPort));
+  zoom_core_acknowledge_audio(handle, kParticipant);
+  ASSERT_TRUE(WaitFor([&] { return channel_notifications == 1; }));
+  EXPECT_EQ(posts, 2);
+
+  router.Unsubscribe(kParticipant);
+  UnregisterZoomCore(handle);
+  zoom_core_init_dart_api(nullptr);
+}
+
+TEST(ZoomCore, RejectsStaleHandles) {
+  LocalMeetingBackend backend;
+  AudioStreamRouter router(&backend, AudioStreamRouter::Config(),
+                           [](uint32_t) {});
+  ZoomCore core{&router};
+  zoom_core_init_dart_api(FakePostCObject);
+
+  ZoomCoreHandle handle = RegisterZoomCore(&core);
+  EXPECT_NE(handle, 0u);
+  EXPECT_TRUE(zoom_core_set_audio_port(handle, kAudioPort));
+  UnregisterZoomCore(handle);
+  EXPECT_FALSE(zoom_core_set_audio_port(handle, kAudioPort));
+  zoom_core_acknowledge_audio(handle, kParticipant);
+
+  // A core registered later never gets the old handle back.
+  ZoomCoreHandle next = RegisterZoomCore(&core);
+  EXPECT_NE(next, handle);
+  EXPECT_FALSE(zoom_core_set_audio_port(handle, kAudioPort));
+  EXPECT_TRUE(zoom_core_set_audio_port(next, 0));
+  UnregisterZoomCore(next);
+  zoom_core_init_dart_api(nullptr);
+}
+
+}  // namespace test
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,102 @@
+// Extracts one participant's video or audio from a meeting recording.
+//
+//   flutter_zoom_meeting_sdk_recording_extract DIRECTORY PARTICIPANT_ID
+//       video|audio OUTPUT [START_MS [END_MS]]
+//
+// Video is written as YUV4MPEG2 (.y4m) and audio as WAV, both of which
+// ffmpeg and most players read. Times are milliseconds since the recording
+// started. Segments left unfinished by a crash are read up to their last
+// intact record.
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "recording_reader.h"
+
+namespace {
+
+using flutter_zoom_meeting_sdk::ExtractRecording;
+using flutter_zoom_meeting_sdk::RecordingExtractOptions;
+using flutter_zoom_meeting_sdk::RecordingExtractResult;
+using flutter_zoom_meeting_sdk::RecordType;
+
+bool ParseUnsigned(const char* text, unsigned long long* value) {
+  char* end;
+  errno = 0;
+  *value = strtoull(text, &end, 10);
+  return errno == 0 && end != text && *end == '\0' && text[0] != '-';
+}
+
+int Usage(const char* program) {
+  fprintf(stderr,
+          "usage: %s DIRECTORY PARTICIPANT_ID video|audio OUTPUT "
+          "[START_MS [END_MS]]\n",
+          program);
+  return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 5 || argc > 7) {
+    return Usage(argv[0]);
+  }
+
+  RecordingExtractOptions options;
+  unsigned long long value;
+  if (!ParseUnsigned(argv[2], &value) || value > UINT32_MAX) {
+    return Usage(argv[0]);
+  }
+  options.participant_id = static_cast<uint32_t>(value);
+  if (strcmp(argv[3], "video") == 0) {
+    options.type = RecordType::kVideo;
+  } else if (strcmp(argv[3], "audio") == 0) {
+    options.type = RecordType::kAudio;
+  } else {
+    return Usage(argv[0]);
+  }
+  if (argc > 5) {
+    if (!ParseUnsigned(argv[5], &value)) {
+      return Usage(argv[0]);
+    }
+    options.start_us = static_cast<int64_t>(value) * 1000;
+  }
+  if (argc > 6) {
+    if (!ParseUnsigned(argv[6], &value)) {
+      return Usage(argv[0]);
+    }
+    options.end_us = static_cast<int64_t>(value) * 1000;
+  }
+
+  FILE* out = fopen(argv[4], "wb");
+  if (out == nullptr) {
+    fprintf(stderr, "cannot open %s: %s\n", argv[4], strerror(errno));
+    return 1;
+  }
+  RecordingExtractResult result;
+  std::string error;
+  bool ok = ExtractRecording(argv[1], options, out, &result, &error);
+  fclose(out);
+  if (!ok) {
+    fprintf(stderr, "%s\n", error.c_str());
+    remove(argv[4]);
+    return 1;
+  }
+  fprintf(stderr, "%zu records extracted", result.records);
+  if (result.skipped != 0) {
+    fprintf(stderr, ", %zu skipped", result.skipped);
+  }
+  if (result.partial_segments != 0) {
+    fprintf(stderr, ", %zu unfinished segments recovered",
+            result.partial_segments);
+  }
+  if (result.unreadable_segments != 0) {
+    fprintf(stderr, ", %zu unreadable segments", result.unreadable_segments);
+  }
+  fprintf(stderr, "\n");
+  return 0;
+}
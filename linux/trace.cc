@@ -0,0 +1,212 @@
+#include "trace.h"
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace flutter_zoom_meeting_sdk {
+
+struct Tracer::ThreadBuffer {
+  // Session the events belong to. Only the owning thread resets it.
+  std::atomic<uint32_t> session{0};
+  // Events [0, count) are complete; published with release.
+  std::atomic<size_t> count{0};
+  std::atomic<uint64_t> dropped{0};
+  std::atomic<bool> owned{true};
+  TraceEvent events[kEventsPerThread];
+};
+
+namespace {
+
+void CopyTruncated(char* destination, size_t size, const char* source) {
+  size_t length = strnlen(source, size - 1);
+  memcpy(destination, source, length);
+  destination[length] = '\0';
+}
+
+// Per-thread state. Returns the buffer to the tracer when the thread exits.
+struct ThreadState {
+  ~ThreadState() {
+    if (buffer != nullptr) {
+      owned->store(false, std::memory_order_release);
+    }
+  }
+
+  void* buffer = nullptr;
+  std::atomic<bool>* owned = nullptr;
+  int32_t thread_id = static_cast<int32_t>(syscall(SYS_gettid));
+};
+
+thread_local ThreadState thread_state;
+
+void AppendEscaped(std::string* out, const char* text) {
+  for (const char* c = text; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      out->push_back('\\');
+      out->push_back(*c);
+    } else if (static_cast<unsigned char>(*c) < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+      out->append(escaped);
+    } else {
+      out->push_back(*c);
+    }
+  }
+}
+
+}  // namespace
+
+Tracer::Tracer() = default;
+
+Tracer* Tracer::Get() {
+  static Tracer* tracer = new Tracer();
+  return tracer;
+}
+
+void Tracer::Start() {
+  session_.fetch_add(1, std::memory_order_acq_rel);
+  internal::trace_enabled.store(true, std::memory_order_release);
+}
+
+void Tracer::Stop() {
+  internal::trace_enabled.store(false, std::memory_order_release);
+}
+
+Tracer::ThreadBuffer* Tracer::GetThreadBuffer() {
+  ThreadBuffer* buffer = static_cast<ThreadBuffer*>(thread_state.buffer);
+  if (buffer == nullptr) {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    for (const std::unique_ptr<ThreadBuffer>& candidate : buffers_) {
+      bool expected = false;
+      if (candidate->owned.compare_exchange_strong(expected, true)) {
+        buffer = candidate.get();
+        break;
+      }
+    }
+    if (buffer == nullptr) {
+      buffers_.push_back(std::make_unique<ThreadBuffer>());
+      buffer = buffers_.back().get();
+    }
+    thread_state.buffer = buffer;
+    thread_state.owned = &buffer->owned;
+    // A reused buffer is reset below only if its session is stale; force
+    // it so the new thread's name is recorded.
+    buffer->session.store(0, std::memory_order_relaxed);
+  }
+
+  uint32_t session = session_.load(std::memory_order_acquire);
+  if (buffer->session.load(std::memory_order_relaxed) != session) {
+    TraceEvent& name = buffer->events[0];
+    name = TraceEvent();
+    name.phase = 'M';
+    name.thread_id = thread_state.thread_id;
+    if (pthread_getname_np(pthread_self(), name.name, sizeof(name.name)) !=
+        0) {
+      name.name[0] = '\0';
+    }
+    buffer->count.store(1, std::memory_order_release);
+    buffer->dropped.store(0, std::memory_order_relaxed);
+    buffer->session.store(session, std::memory_order_release);
+  }
+  return buffer;
+}
+
+void Tracer::Record(const char* category,
+                    const char* name,
+                    int64_t start_us,
+                    int64_t duration_us) {
+  ThreadBuffer* buffer = GetThreadBuffer();
+  size_t index = buffer->count.load(std::memory_order_relaxed);
+  if (index == kEventsPerThread) {
+    buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  TraceEvent& event = buffer->events[index];
+  event.start_us = start_us;
+  event.duration_us = duration_us;
+  event.thread_id = thread_state.thread_id;
+  event.phase = 'X';
+  CopyTruncated(event.category, sizeof(event.category), category);
+  CopyTruncated(event.name, sizeof(event.name), name);
+  buffer->count.store(index + 1, std::memory_order_release);
+}
+
+std::vector<TraceEvent> Tracer::GetEvents() const {
+  uint32_t session = session_.load(std::memory_order_acquire);
+  std::vector<TraceEvent> events;
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  for (const std::unique_ptr<ThreadBuffer>& buffer : buffers_) {
+    if (buffer->session.load(std::memory_order_acquire) != session) {
+      continue;
+    }
+    size_t count = buffer->count.load(std::memory_order_acquire);
+    events.insert(events.end(), buffer->events, buffer->events + count);
+  }
+  return events;
+}
+
+uint64_t Tracer::dropped() const {
+  uint32_t session = session_.load(std::memory_order_acquire);
+  uint64_t dropped = 0;
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  for (const std::unique_ptr<ThreadBuffer>& buffer : buffers_) {
+    if (buffer->session.load(std::memory_order_acquire) == session) {
+      dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+  }
+  return dropped;
+}
+
+std::string FormatTraceEvents(const std::vector<TraceEvent>& events,
+                              int32_t pid) {
+  std::string out;
+  char numbers[96];
+  for (const TraceEvent& event : events) {
+    if (!out.empty()) {
+      out.append(",\n");
+    }
+    if (event.phase == 'M') {
+      snprintf(numbers, sizeof(numbers),
+               "{\"ph\":\"M\",\"pid\":%" PRId32 ",\"tid\":%" PRId32, pid,
+               event.thread_id);
+      out.append(numbers);
+      out.append(",\"name\":\"thread_name\",\"args\":{\"name\":\"");
+      AppendEscaped(&out, event.name);
+      out.append("\"}}");
+      continue;
+    }
+    out.append("{\"ph\":\"X\",\"cat\":\"");
+    AppendEscaped(&out, event.category);
+    out.append("\",\"name\":\"");
+    AppendEscaped(&out, event.name);
+    snprintf(numbers, sizeof(numbers),
+             "\",\"pid\":%" PRId32 ",\"tid\":%" PRId32 ",\"ts\":%" PRId64
+             ",\"dur\":%" PRId64 "}",
+             pid, event.thread_id, event.start_us, event.duration_us);
+    out.append(numbers);
+  }
+  return out;
+}
+
+bool WriteChromeTrace(const std::string& path,
+                      const std::string& native_events,
+                      const std::string& extra_events) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+  file << "{\"traceEvents\":[\n" << native_events;
+  if (!native_events.empty() && !extra_events.empty()) {
+    file << ",\n";
+  }
+  file << extra_events << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  file.close();
+  return !file.fail();
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,138 @@
+#ifndef FLUTTER_PLUGIN_TRACE_H_
+#define FLUTTER_PLUGIN_TRACE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "monotonic_clock.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace internal {
+
+// Read on every trace scope, so it is a plain constant-initialized global
+// rather than a member behind a function-local static.
+inline std::atomic<bool> trace_enabled{false};
+
+}  // namespace internal
+
+// Returns whether trace events are being recorded.
+inline bool TraceEnabled() {
+  return internal::trace_enabled.load(std::memory_order_relaxed);
+}
+
+struct TraceEvent {
+  // Monotonic clock, microseconds.
+  int64_t start_us;
+  int64_t duration_us;
+  int32_t thread_id;
+  // Chrome trace phase: 'X' for a complete span, 'M' for the thread name.
+  char phase;
+  // Truncated copies, so callers may pass temporary strings.
+  char category[15];
+  char name[48];
+};
+
+// Process-wide recorder for Chrome trace events.
+//
+// Each thread appends to its own fixed-size buffer, so recording takes no
+// lock and never blocks. A full buffer drops further events of its thread
+// until the next Start(). Buffers of exited threads are handed to new
+// threads and are never freed.
+class Tracer {
+ public:
+  static constexpr size_t kEventsPerThread = 4096;
+
+  static Tracer* Get();
+
+  Tracer(const Tracer&) = delete;
+  Tracer& operator=(const Tracer&) = delete;
+
+  // Discards the previous session's events and starts recording.
+  void Start();
+
+  // Stops recording. Scopes that are still open are recorded when they
+  // close.
+  void Stop();
+
+  // Records a span on the calling thread. |category| and |name| are copied.
+  void Record(const char* category,
+              const char* name,
+              int64_t start_us,
+              int64_t duration_us);
+
+  // Events of the current session, grouped by thread. Call after Stop();
+  // spans still open are not included.
+  std::vector<TraceEvent> GetEvents() const;
+
+  // Events dropped this session because a thread's buffer was full.
+  uint64_t dropped() const;
+
+ private:
+  struct ThreadBuffer;
+
+  Tracer();
+
+  // Returns the calling thread's buffer, reset for the current session.
+  ThreadBuffer* GetThreadBuffer();
+
+  std::atomic<uint32_t> session_{0};
+
+  mutable std::mutex buffers_mutex_;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+};
+
+// Records the lifetime of the enclosing scope when tracing is enabled.
+// |category| and |name| must outlive the scope. When tracing is disabled the
+// cost is one relaxed load and a branch on each end.
+class TraceScope {
+ public:
+  TraceScope(const char* category, const char* name)
+      : category_(category),
+        name_(name),
+        start_us_(TraceEnabled() ? MonotonicNowUs() : -1) {}
+
+  ~TraceScope() {
+    if (start_us_ >= 0) {
+      Tracer::Get()->Record(category_, name_, start_us_,
+                            MonotonicNowUs() - start_us_);
+    }
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+ private:
+  const char* category_;
+  const char* name_;
+  int64_t start_us_;
+};
+
+// Serializes |events| as Chrome trace JSON objects separated by commas,
+// without the surrounding array, for process |pid|.
+std::string FormatTraceEvents(const std::vector<TraceEvent>& events,
+                              int32_t pid);
+
+// Writes a Chrome trace file to |path| containing |native_events| and
+// |extra_events|, a comma-separated list of already serialized events (may
+// be empty). Returns false if the file could not be written.
+bool WriteChromeTrace(const std::string& path,
+                      const std::string& native_events,
+                      const std::string& extra_events);
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#define ZOOM_TRACE_CONCAT_INNER(a, b) a##b
+#define ZOOM_TRACE_CONCAT(a, b) ZOOM_TRACE_CONCAT_INNER(a, b)
+
+// Traces the rest of the enclosing scope as |name| in |category|.
+#define ZOOM_TRACE_SCOPE(category, name)                    \
+  ::flutter_zoom_meeting_sdk::TraceScope ZOOM_TRACE_CONCAT( \
+      zoom_trace_scope_, __LINE__)(category, name)
+
+#endif  // FLUTTER_PLUGIN_TRACE_H_
@@ -0,0 +1,73 @@
+#include "video_frame.h"
+
+#include <utility>
+
+#include "frame_pool.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+size_t AlignUp(size_t size) {
+  return (size + kFrameBufferAlignment - 1) & ~(kFrameBufferAlignment - 1);
+}
+
+}  // namespace
+
+std::shared_ptr<VideoFrame> VideoFrame::Allocate(int width, int height) {
+  int chroma_width = (width + 1) / 2;
+  size_t y_size = AlignUp(static_cast<size_t>(width) * height);
+  size_t chroma_size =
+      AlignUp(static_cast<size_t>(chroma_width) * ((height + 1) / 2));
+  size_t size = y_size + 2 * chroma_size;
+  void* buffer = FramePool::Get()->Allocate(size);
+  if (buffer == nullptr) {
+    return nullptr;
+  }
+
+  std::shared_ptr<VideoFrame> frame(new VideoFrame());
+  frame->width_ = width;
+  frame->height_ = height;
+  frame->stride_y_ = width;
+  frame->stride_u_ = chroma_width;
+  frame->stride_v_ = chroma_width;
+  frame->pooled_ = buffer;
+  frame->pooled_size_ = size;
+  frame->y_ = static_cast<uint8_t*>(buffer);
+  frame->u_ = frame->y_ + y_size;
+  frame->v_ = frame->u_ + chroma_size;
+  return frame;
+}
+
+std::shared_ptr<VideoFrame> VideoFrame::Wrap(int width,
+                                             int height,
+                                             uint8_t* y,
+                                             int stride_y,
+                                             uint8_t* u,
+                                             int stride_u,
+                                             uint8_t* v,
+                                             int stride_v,
+                                             std::function<void()> release) {
+  std::shared_ptr<VideoFrame> frame(new VideoFrame());
+  frame->width_ = width;
+  frame->height_ = height;
+  frame->y_ = y;
+  frame->u_ = u;
+  frame->v_ = v;
+  frame->stride_y_ = stride_y;
+  frame->stride_u_ = stride_u;
+  frame->stride_v_ = stride_v;
+  frame->release_ = std::move(release);
+  return frame;
+}
+
+VideoFrame::~VideoFrame() {
+  if (release_) {
+    release_();
+  }
+  if (pooled_ != nullptr) {
+    FramePool::Get()->Release(pooled_, pooled_size_);
+  }
+}
+
+}  // namespace flutter_zoom_meeting_sdk
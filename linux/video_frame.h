@@ -0,0 +1,81 @@
+#ifndef FLUTTER_PLUGIN_VIDEO_FRAME_H_
+#define FLUTTER_PLUGIN_VIDEO_FRAME_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace flutter_zoom_meeting_sdk {
+
+// An I420 frame shared by reference between the receive thread and the
+// texture that displays it.
+//
+// Planes are either owned by the frame or borrowed from the producer, which
+// gets them back through its release callback once the last reference is
+// dropped. Either way, handing a frame on never copies pixel data.
+class VideoFrame {
+ public:
+  // Allocates a frame with tightly packed rows from FramePool::Get(), each
+  // plane starting on a kFrameBufferAlignment boundary. Returns nullptr if
+  // the pool is at its cap.
+  static std::shared_ptr<VideoFrame> Allocate(int width, int height);
+
+  // Wraps planes owned by the producer. |release| runs on whichever thread
+  // drops the last reference.
+  static std::shared_ptr<VideoFrame> Wrap(int width,
+                                          int height,
+                                          uint8_t* y,
+                                          int stride_y,
+                                          uint8_t* u,
+                                          int stride_u,
+                                          uint8_t* v,
+                                          int stride_v,
+                                          std::function<void()> release);
+
+  ~VideoFrame();
+
+  VideoFrame(const VideoFrame&) = delete;
+  VideoFrame& operator=(const VideoFrame&) = delete;
+
+  int width() const { return width_; }
+  int height() const { return height_; }
+  int chroma_width() const { return (width_ + 1) / 2; }
+  int chroma_height() const { return (height_ + 1) / 2; }
+
+  const uint8_t* data_y() const { return y_; }
+  const uint8_t* data_u() const { return u_; }
+  const uint8_t* data_v() const { return v_; }
+  uint8_t* mutable_data_y() { return y_; }
+  uint8_t* mutable_data_u() { return u_; }
+  uint8_t* mutable_data_v() { return v_; }
+  int stride_y() const { return stride_y_; }
+  int stride_u() const { return stride_u_; }
+  int stride_v() const { return stride_v_; }
+
+  // Capture time on the monotonic clock, in microseconds.
+  int64_t timestamp_us() const { return timestamp_us_; }
+  void set_timestamp_us(int64_t timestamp_us) { timestamp_us_ = timestamp_us; }
+
+ private:
+  VideoFrame() = default;
+
+  int width_ = 0;
+  int height_ = 0;
+  uint8_t* y_ = nullptr;
+  uint8_t* u_ = nullptr;
+  uint8_t* v_ = nullptr;
+  int stride_y_ = 0;
+  int stride_u_ = 0;
+  int stride_v_ = 0;
+  int64_t timestamp_us_ = 0;
+
+  // The FramePool buffer holding the planes of an allocated frame.
+  void* pooled_ = nullptr;
+  size_t pooled_size_ = 0;
+  std::function<void()> release_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_VIDEO_FRAME_H_
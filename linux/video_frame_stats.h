@@ -0,0 +1,40 @@
+#ifndef FLUTTER_PLUGIN_VIDEO_FRAME_STATS_H_
+#define FLUTTER_PLUGIN_VIDEO_FRAME_STATS_H_
+
+#include <algorithm>
+#include <cstdint>
+
+namespace flutter_zoom_meeting_sdk {
+
+// Frame counts for one video texture's mailbox.
+//
+// A texture holds at most one frame waiting to be drawn: a newer frame
+// replaces it, and the replaced frame counts as dropped. The producer never
+// waits and a slow raster thread only ever sees the latest frame, so frame
+// age stays bounded however far rendering falls behind.
+struct VideoFrameStats {
+  uint64_t produced = 0;
+  uint64_t displayed = 0;
+  uint64_t dropped = 0;
+  // Age of displayed frames when they were converted for upload, from
+  // their capture time, or from their arrival when it is unknown.
+  int64_t last_age_us = 0;
+  int64_t max_age_us = 0;
+  int64_t total_age_us = 0;
+
+  void RecordDisplayed(int64_t age_us) {
+    age_us = std::max<int64_t>(age_us, 0);
+    displayed++;
+    last_age_us = age_us;
+    max_age_us = std::max(max_age_us, age_us);
+    total_age_us += age_us;
+  }
+
+  int64_t mean_age_us() const {
+    return displayed == 0 ? 0 : total_age_us / static_cast<int64_t>(displayed);
+  }
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_VIDEO_FRAME_STATS_H_
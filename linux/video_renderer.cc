@@ -0,0 +1,163 @@
+#include "video_renderer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "trace.h"
+#include "yuv_convert.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+// A smaller display size only takes effect once it asks for less than this
+// share of the current width.
+constexpr int kShrinkPercent = 75;
+
+}  // namespace
+
+void ScaleToDisplay(int frame_width,
+                    int frame_height,
+                    int display_width,
+                    int display_height,
+                    int* width,
+                    int* height) {
+  *width = frame_width;
+  *height = frame_height;
+  if (display_width <= 0 || display_height <= 0 || frame_width <= 0 ||
+      frame_height <= 0) {
+    return;
+  }
+  // Covering the display needs whichever side is relatively larger.
+  int64_t cover_width = display_width;
+  if (int64_t{display_height} * frame_width >
+      int64_t{display_width} * frame_height) {
+    cover_width = (int64_t{display_height} * frame_width + frame_height - 1) /
+                  frame_height;
+  }
+  cover_width = (cover_width + kDisplaySizeStep - 1) / kDisplaySizeStep *
+                kDisplaySizeStep;
+  if (cover_width >= frame_width) {
+    return;
+  }
+  *width = static_cast<int>(cover_width);
+  *height = std::max<int>(
+      1, (cover_width * frame_height + frame_width / 2) / frame_width);
+}
+
+VideoRenderer::VideoRenderer(Clock clock) : clock_(clock) {}
+
+VideoRenderer::~VideoRenderer() = default;
+
+void VideoRenderer::Push(std::shared_ptr<const VideoFrame> frame) {
+  if (frame == nullptr) {
+    return;
+  }
+  const int64_t since_us =
+      frame->timestamp_us() != 0 ? frame->timestamp_us() : clock_();
+  std::shared_ptr<const VideoFrame> replaced;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    replaced = std::move(pending_);
+    pending_ = std::move(frame);
+    pending_since_us_ = since_us;
+    stats_.produced++;
+    if (replaced != nullptr) {
+      stats_.dropped++;
+    }
+  }
+  // |replaced| is released outside the lock, since that may hand its planes
+  // back to the producer.
+}
+
+void VideoRenderer::SetDisplaySize(int width, int height) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  display_width_ = std::max(width, 0);
+  display_height_ = std::max(height, 0);
+}
+
+void VideoRenderer::SetResolutionDivisor(int divisor) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  resolution_divisor_ = std::max(divisor, 1);
+}
+
+bool VideoRenderer::Render(const uint8_t** rgba,
+                           uint32_t* width,
+                           uint32_t* height) {
+  ZOOM_TRACE_SCOPE("video", "render_frame");
+  std::shared_ptr<const VideoFrame> frame;
+  int64_t since_us;
+  int display_width;
+  int display_height;
+  int divisor;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    frame = std::move(pending_);
+    since_us = pending_since_us_;
+    display_width = display_width_;
+    display_height = display_height_;
+    divisor = resolution_divisor_;
+  }
+
+  if (frame != nullptr) {
+    if (divisor > 1) {
+      if (display_width == 0 || display_height == 0) {
+        display_width = frame->width();
+        display_height = frame->height();
+      }
+      display_width = std::max(display_width / divisor, 1);
+      display_height = std::max(display_height / divisor, 1);
+    }
+    int width;
+    int height;
+    ScaleToDisplay(frame->width(), frame->height(), display_width,
+                   display_height, &width, &height);
+    // Keep the current size while shrinking a little, unless the source
+    // changed resolution.
+    const bool same_source = frame->width() == frame_width_ &&
+                             frame->height() == frame_height_;
+    const int current_width = static_cast<int>(width_);
+    if (same_source && width < current_width &&
+        width * 100 >= current_width * kShrinkPercent) {
+      width = current_width;
+      height = static_cast<int>(height_);
+    }
+    frame_width_ = frame->width();
+    frame_height_ = frame->height();
+    width_ = static_cast<uint32_t>(width);
+    height_ = static_cast<uint32_t>(height);
+    rgba_.resize(static_cast<size_t>(width_) * height_ * 4);
+    // Give memory back once frames got much smaller, e.g. under pressure.
+    if (rgba_.size() * 2 < rgba_.capacity()) {
+      rgba_.shrink_to_fit();
+    }
+    if (width == frame->width() && height == frame->height()) {
+      I420ToRgba(frame->data_y(), frame->stride_y(), frame->data_u(),
+                 frame->stride_u(), frame->data_v(), frame->stride_v(),
+                 rgba_.data(), width * 4, width, height);
+    } else {
+      I420ScaleToRgba(frame->data_y(), frame->stride_y(), frame->data_u(),
+                      frame->stride_u(), frame->data_v(), frame->stride_v(),
+                      frame->width(), frame->height(), rgba_.data(),
+                      width * 4, width, height);
+    }
+    const int64_t age_us = clock_() - since_us;
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.RecordDisplayed(age_us);
+  }
+
+  if (rgba_.empty()) {
+    return false;
+  }
+  *rgba = rgba_.data();
+  *width = width_;
+  *height = height_;
+  return true;
+}
+
+VideoFrameStats VideoRenderer::GetStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+}  // namespace flutter_zoom_meeting_sdk
@@ -0,0 +1,97 @@
+#ifndef FLUTTER_PLUGIN_VIDEO_RENDERER_H_
+#define FLUTTER_PLUGIN_VIDEO_RENDERER_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "memory_accounting.h"
+#include "monotonic_clock.h"
+#include "video_frame.h"
+#include "video_frame_stats.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+// Display-sized frames have widths in steps of this many pixels.
+constexpr int kDisplaySizeStep = 16;
+
+// Returns the size to convert a |frame_width| x |frame_height| frame to for
+// a texture drawn at |display_width| x |display_height| physical pixels: the
+// smallest size that covers the display at the frame's aspect ratio, with
+// the width rounded up to a multiple of kDisplaySizeStep, and never larger
+// than the frame. A display size of 0 x 0 keeps the frame size.
+void ScaleToDisplay(int frame_width,
+                    int frame_height,
+                    int display_width,
+                    int display_height,
+                    int* width,
+                    int* height);
+
+// Hands frames from a receive thread to a texture's copy_pixels callback.
+//
+// Push() only swaps a reference into a single-slot mailbox, so the receive
+// thread never touches pixel data or waits for the raster thread; a frame
+// replaced before it was drawn counts as dropped, see VideoFrameStats.
+// Render() converts the newest frame straight from its I420 planes into the
+// RGBA buffer the engine uploads, which is the only pass over the pixels.
+// Once the display size is known, that pass also box-filters the frame down
+// to it, so a small tile costs a fraction of a full-size frame.
+class VideoRenderer {
+ public:
+  // Returns the time in microseconds.
+  using Clock = int64_t (*)();
+
+  explicit VideoRenderer(Clock clock = MonotonicNowUs);
+  ~VideoRenderer();
+
+  VideoRenderer(const VideoRenderer&) = delete;
+  VideoRenderer& operator=(const VideoRenderer&) = delete;
+
+  // Safe to call from any thread. Replaces any frame not rendered yet,
+  // which counts as dropped.
+  void Push(std::shared_ptr<const VideoFrame> frame);
+
+  // Safe to call from any thread. Sets the texture's on-screen size in
+  // physical pixels; 0 x 0 renders frames at full size. Growing takes
+  // effect with the next frame, while shrinking waits until the new size is
+  // well below the current one, so a tile being resized does not change
+  // resolution every frame.
+  void SetDisplaySize(int width, int height);
+
+  // Safe to call from any thread. Renders frames at 1 / |divisor| of the
+  // size they would otherwise have, to save memory and conversion work;
+  // 1 restores full quality. Takes effect with the next frame.
+  void SetResolutionDivisor(int divisor);
+
+  // Called from the raster thread. Points |rgba| at the latest converted
+  // frame, which stays valid until the next call. Returns false if no frame
+  // has arrived yet.
+  bool Render(const uint8_t** rgba, uint32_t* width, uint32_t* height);
+
+  // Safe to call from any thread.
+  VideoFrameStats GetStats();
+
+ private:
+  const Clock clock_;
+
+  std::mutex mutex_;
+  std::shared_ptr<const VideoFrame> pending_;
+  // When |pending_| was captured, or arrived if that is unknown.
+  int64_t pending_since_us_ = 0;
+  VideoFrameStats stats_;
+  int display_width_ = 0;
+  int display_height_ = 0;
+  int resolution_divisor_ = 1;
+
+  // Raster thread only.
+  TrackedVector<uint8_t, MemoryCategory::kVideoTextures> rgba_;
+  uint32_t width_ = 0;
+  uint32_t height_ = 0;
+  int frame_width_ = 0;
+  int frame_height_ = 0;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_VIDEO_RENDERER_H_
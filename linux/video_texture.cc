@@ -0,0 +1,110 @@
+#include "video_texture.h"
+
+#include <utility>
+
+#include "video_renderer.h"
+
+using flutter_zoom_meeting_sdk::MeetingBackend;
+using flutter_zoom_meeting_sdk::VideoFrame;
+using flutter_zoom_meeting_sdk::VideoFrameStats;
+using flutter_zoom_meeting_sdk::VideoRenderer;
+
+namespace {
+
+// Passes frames from the receive thread to the renderer and tells the engine
+// a new frame is ready. The texture registrar may be called from any thread.
+class TextureVideoSink : public MeetingBackend::VideoSink {
+ public:
+  TextureVideoSink(FlTextureRegistrar* registrar, FlTexture* texture)
+      : registrar_(registrar), texture_(texture) {}
+
+  void OnVideoFrame(uint32_t participant_id,
+                    std::shared_ptr<const VideoFrame> frame) override {
+    renderer_.Push(std::move(frame));
+    fl_texture_registrar_mark_texture_frame_available(registrar_, texture_);
+  }
+
+  VideoRenderer* renderer() { return &renderer_; }
+
+ private:
+  FlTextureRegistrar* registrar_;
+  FlTexture* texture_;
+  VideoRenderer renderer_;
+};
+
+}  // namespace
+
+struct _ZoomVideoTexture {
+  FlPixelBufferTexture parent_instance;
+
+  FlTextureRegistrar* registrar;
+  TextureVideoSink* sink;
+};
+
+G_DEFINE_TYPE(ZoomVideoTexture,
+              zoom_video_texture,
+              fl_pixel_buffer_texture_get_type())
+
+// Implements FlPixelBufferTexture::copy_pixels. Called on the raster thread.
+static gboolean zoom_video_texture_copy_pixels(FlPixelBufferTexture* texture,
+                                               const uint8_t** out_buffer,
+                                               uint32_t* width,
+                                               uint32_t* height,
+                                               GError** error) {
+  ZoomVideoTexture* self = ZOOM_VIDEO_TEXTURE(texture);
+  // Before the first frame there is nothing to draw; report an empty
+  // texture rather than an error.
+  if (!self->sink->renderer()->Render(out_buffer, width, height)) {
+    static const uint8_t kTransparentPixel[4] = {0, 0, 0, 0};
+    *out_buffer = kTransparentPixel;
+    *width = 1;
+    *height = 1;
+  }
+  return TRUE;
+}
+
+static void zoom_video_texture_dispose(GObject* object) {
+  ZoomVideoTexture* self = ZOOM_VIDEO_TEXTURE(object);
+
+  delete self->sink;
+  self->sink = nullptr;
+  g_clear_object(&self->registrar);
+
+  G_OBJECT_CLASS(zoom_video_texture_parent_class)->dispose(object);
+}
+
+static void zoom_video_texture_class_init(ZoomVideoTextureClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = zoom_video_texture_dispose;
+  FL_PIXEL_BUFFER_TEXTURE_CLASS(klass)->copy_pixels =
+      zoom_video_texture_copy_pixels;
+}
+
+static void zoom_video_texture_init(ZoomVideoTexture* self) {}
+
+ZoomVideoTexture* zoom_video_texture_new(FlTextureRegistrar* registrar) {
+  ZoomVideoTexture* self = ZOOM_VIDEO_TEXTURE(
+      g_object_new(zoom_video_texture_get_type(), nullptr));
+  self->registrar = FL_TEXTURE_REGISTRAR(g_object_ref(registrar));
+  self->sink = new TextureVideoSink(self->registrar, FL_TEXTURE(self));
+  return self;
+}
+
+MeetingBackend::VideoSink* zoom_video_texture_get_sink(
+    ZoomVideoTexture* texture) {
+  return texture->sink;
+}
+
+void zoom_video_texture_set_display_size(ZoomVideoTexture* texture,
+                                         int width,
+                                         int height) {
+  texture->sink->renderer()->SetDisplaySize(width, height);
+}
+
+void zoom_video_texture_set_resolution_divisor(ZoomVideoTexture* texture,
+                                               int divisor) {
+  texture->sink->renderer()->SetResolutionDivisor(divisor);
+}
+
+VideoFrameStats zoom_video_texture_get_stats(ZoomVideoTexture* texture) {
+  return texture->sink->renderer()->GetStats();
+}
@@ -0,0 +1,42 @@
+#ifndef FLUTTER_PLUGIN_VIDEO_TEXTURE_H_
+#define FLUTTER_PLUGIN_VIDEO_TEXTURE_H_
+
+#include <flutter_linux/flutter_linux.h>
+
+#include "meeting_backend.h"
+#include "video_frame_stats.h"
+
+G_DECLARE_FINAL_TYPE(ZoomVideoTexture,
+                     zoom_video_texture,
+                     ZOOM,
+                     VIDEO_TEXTURE,
+                     FlPixelBufferTexture)
+
+// Creates a texture that shows the frames delivered to its sink. New frames
+// are announced through |registrar|, which the texture must be registered
+// with.
+ZoomVideoTexture* zoom_video_texture_new(FlTextureRegistrar* registrar);
+
+// Returns the sink to subscribe with MeetingBackend::SubscribeVideo. It is
+// owned by the texture; unsubscribe before the texture is released.
+flutter_zoom_meeting_sdk::MeetingBackend::VideoSink* zoom_video_texture_get_sink(
+    ZoomVideoTexture* texture);
+
+// Sets the size the texture is drawn at in physical pixels, so frames are
+// scaled down to it before upload. 0 x 0 uploads frames at full size. May be
+// called from any thread.
+void zoom_video_texture_set_display_size(ZoomVideoTexture* texture,
+                                         int width,
+                                         int height);
+
+// Renders frames at 1 / |divisor| of their display size to save memory, see
+// VideoRenderer::SetResolutionDivisor. May be called from any thread.
+void zoom_video_texture_set_resolution_divisor(ZoomVideoTexture* texture,
+                                               int divisor);
+
+// Returns the frame counts of the texture's mailbox. May be called from any
+// thread.
+flutter_zoom_meeting_sdk::VideoFrameStats zoom_video_texture_get_stats(
+    ZoomVideoTexture* texture);
+
+#endif  // FLUTTER_PLUGIN_VIDEO_TEXTURE_H_
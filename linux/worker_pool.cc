@@ -0,0 +1,57 @@
+#include "worker_pool.h"
+
+#include <pthread.h>
+
+#include <utility>
+
+namespace flutter_zoom_meeting_sdk {
+
+WorkerPool::WorkerPool(size_t thread_count) {
+  if (thread_count == 0) {
+    thread_count = 1;
+  }
+  threads_.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i) {
+    threads_.emplace_back(&WorkerPool::Run, this);
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  task_available_.notify_all();
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkerPool::Post(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  task_available_.notify_one();
+}
+
+void WorkerPool::Run() {
+  // Names the thread in debuggers and traces.
+  pthread_setname_np(pthread_self(), "zoom-worker");
+  for (;;) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_available_.wait(lock,
+                           [this] { return stopping_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+}  // namespace flutter_zoom_meeting_sdk
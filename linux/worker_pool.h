@@ -0,0 +1,40 @@
+#ifndef FLUTTER_PLUGIN_WORKER_POOL_H_
+#define FLUTTER_PLUGIN_WORKER_POOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace flutter_zoom_meeting_sdk {
+
+// Fixed set of threads that runs blocking backend calls away from the GTK
+// main loop. Tasks run in FIFO order.
+class WorkerPool {
+ public:
+  explicit WorkerPool(size_t thread_count);
+
+  // Runs every task already posted, then joins the threads.
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  void Post(std::function<void()> task);
+
+ private:
+  void Run();
+
+  std::mutex mutex_;
+  std::condition_variable task_available_;
+  std::deque<std::function<void()>> tasks_;
+  bool stopping_ = false;
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_WORKER_POOL_H_
@@ -0,0 +1,391 @@
+#include "yuv_convert.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "yuv_convert_internal.h"
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+// Coefficients scaled by 64 and rounded, indexed by [matrix][range].
+constexpr YuvCoefficients kCoefficients[2][2] = {
+    {
+        // BT.601 limited: 1.164, 1.596, 0.391, 0.813, 2.018.
+        {16, 75, 102, 25, 52, 129},
+        // BT.601 full: 1.0, 1.402, 0.344, 0.714, 1.772.
+        {0, 64, 90, 22, 46, 113},
+    },
+    {
+        // BT.709 limited: 1.164, 1.793, 0.213, 0.533, 2.112.
+        {16, 75, 115, 14, 34, 135},
+        // BT.709 full: 1.0, 1.575, 0.187, 0.468, 1.856.
+        {0, 64, 101, 12, 30, 119},
+    },
+};
+
+// Tallest box the 16-bit vertical sums can hold: 257 * 255 = 65535.
+constexpr int kMaxBoxRows = 257;
+
+// Fixed-point shift of the reciprocals dividing box sums. Large enough that
+// the quotient is exact for every box under 2^20 pixels.
+constexpr int kReciprocalShift = 48;
+
+struct RowFunctions {
+  I420RowFunction i420;
+  Nv12RowFunction nv12;
+  SumRowsFunction sum_rows;
+};
+
+RowFunctions GetRowFunctions(YuvKernel kernel) {
+  switch (kernel) {
+#ifdef FLUTTER_ZOOM_YUV_X86
+    case YuvKernel::kAvx2:
+      return {I420ToRgbaRowAvx2, Nv12ToRgbaRowAvx2, SumRowsAvx2};
+    case YuvKernel::kSse2:
+      return {I420ToRgbaRowSse2, Nv12ToRgbaRowSse2, SumRowsSse2};
+#endif
+    default:
+      return {I420ToRgbaRowScalar, Nv12ToRgbaRowScalar, SumRowsScalar};
+  }
+}
+
+const RowFunctions& DetectedRowFunctions() {
+  static const RowFunctions functions = GetRowFunctions(DetectYuvKernel());
+  return functions;
+}
+
+void ConvertI420(I420RowFunction row_function,
+                 const uint8_t* y,
+                 int stride_y,
+                 const uint8_t* u,
+                 int stride_u,
+                 const uint8_t* v,
+                 int stride_v,
+                 uint8_t* rgba,
+                 int stride_rgba,
+                 int width,
+                 int height,
+                 const YuvCoefficients& c) {
+  for (int row = 0; row < height; ++row) {
+    row_function(y + row * stride_y, u + (row / 2) * stride_u,
+                 v + (row / 2) * stride_v, rgba + row * stride_rgba, width, c);
+  }
+}
+
+void ConvertNv12(Nv12RowFunction row_function,
+                 const uint8_t* y,
+                 int stride_y,
+                 const uint8_t* uv,
+                 int stride_uv,
+                 uint8_t* rgba,
+                 int stride_rgba,
+                 int width,
+                 int height,
+                 const YuvCoefficients& c) {
+  for (int row = 0; row < height; ++row) {
+    row_function(y + row * stride_y, uv + (row / 2) * stride_uv,
+                 rgba + row * stride_rgba, width, c);
+  }
+}
+
+// Splits |src_size| samples into |dst_size| boxes: box i starts at
+// starts[i] and ends at BoxEnd(starts, i).
+std::vector<int> BoxStarts(int src_size, int dst_size) {
+  std::vector<int> starts(dst_size + 1);
+  for (int i = 0; i <= dst_size; ++i) {
+    starts[i] = static_cast<int>(static_cast<int64_t>(i) * src_size / dst_size);
+  }
+  return starts;
+}
+
+// Boxes hold at least one sample, which repeats samples when upscaling.
+int BoxEnd(const std::vector<int>& starts, int i) {
+  return std::max(starts[i + 1], starts[i] + 1);
+}
+
+uint64_t BoxReciprocal(int pixels) {
+  return ((uint64_t{1} << kReciprocalShift) + pixels - 1) / pixels;
+}
+
+// Box-filters one output row of a plane: sums the source rows of box |row|
+// in |rows| column by column, then averages each box in |columns|, rounding
+// to nearest. |sums| and |prefix| are scratch for the source width, plus one
+// entry in |prefix|.
+void BoxFilterRow(SumRowsFunction sum_rows,
+                  const uint8_t* plane,
+                  int stride,
+                  const std::vector<int>& rows,
+                  int row,
+                  const std::vector<int>& columns,
+                  uint16_t* sums,
+                  uint32_t* prefix,
+                  uint8_t* out) {
+  const int width = columns.back();
+  const int first_row = rows[row];
+  const int box_rows = std::min(BoxEnd(rows, row) - first_row, kMaxBoxRows);
+  sum_rows(plane + static_cast<size_t>(first_row) * stride, stride, box_rows,
+           sums, width);
+
+  // Running totals make each box one subtraction, whatever its width.
+  uint32_t total = 0;
+  prefix[0] = 0;
+  for (int x = 0; x < width; ++x) {
+    total += sums[x];
+    prefix[x + 1] = total;
+  }
+
+  // Box widths are the floor or ceiling of the scale factor, so two
+  // reciprocals replace a division per pixel.
+  const int count = static_cast<int>(columns.size()) - 1;
+  const int narrow = std::max(1, width / count);
+  const uint64_t reciprocals[2] = {BoxReciprocal(narrow * box_rows),
+                                   BoxReciprocal((narrow + 1) * box_rows)};
+  for (int col = 0; col < count; ++col) {
+    const int first = columns[col];
+    const int end = BoxEnd(columns, col);
+    const int box_width = end - first;
+    const uint64_t rounded =
+        prefix[end] - prefix[first] + (box_width * box_rows) / 2;
+    out[col] = static_cast<uint8_t>(
+        (rounded * reciprocals[box_width - narrow]) >> kReciprocalShift);
+  }
+}
+
+void ScaleI420(const RowFunctions& functions,
+               const uint8_t* y,
+               int stride_y,
+               const uint8_t* u,
+               int stride_u,
+               const uint8_t* v,
+               int stride_v,
+               int src_width,
+               int src_height,
+               uint8_t* rgba,
+               int stride_rgba,
+               int dst_width,
+               int dst_height,
+               const YuvCoefficients& c) {
+  if (src_width <= 0 || src_height <= 0 || dst_width <= 0 ||
+      dst_height <= 0) {
+    return;
+  }
+  const int src_chroma_width = (src_width + 1) / 2;
+  const int src_chroma_height = (src_height + 1) / 2;
+  const int dst_chroma_width = (dst_width + 1) / 2;
+  const int dst_chroma_height = (dst_height + 1) / 2;
+  const std::vector<int> luma_columns = BoxStarts(src_width, dst_width);
+  const std::vector<int> luma_rows = BoxStarts(src_height, dst_height);
+  const std::vector<int> chroma_columns =
+      BoxStarts(src_chroma_width, dst_chroma_width);
+  const std::vector<int> chroma_rows =
+      BoxStarts(src_chroma_height, dst_chroma_height);
+
+  std::vector<uint16_t> sums(src_width);
+  std::vector<uint32_t> prefix(src_width + 1);
+  std::vector<uint8_t> y_row(dst_width);
+  std::vector<uint8_t> u_row(dst_chroma_width);
+  std::vector<uint8_t> v_row(dst_chroma_width);
+  for (int row = 0; row < dst_height; ++row) {
+    if (row % 2 == 0) {
+      BoxFilterRow(functions.sum_rows, u, stride_u, chroma_rows, row / 2,
+                   chroma_columns, sums.data(), prefix.data(), u_row.data());
+      BoxFilterRow(functions.sum_rows, v, stride_v, chroma_rows, row / 2,
+                   chroma_columns, sums.data(), prefix.data(), v_row.data());
+    }
+    BoxFilterRow(functions.sum_rows, y, stride_y, luma_rows, row,
+                 luma_columns, sums.data(), prefix.data(), y_row.data());
+    functions.i420(y_row.data(), u_row.data(), v_row.data(),
+                   rgba + static_cast<size_t>(row) * stride_rgba, dst_width,
+                   c);
+  }
+}
+
+}  // namespace
+
+const YuvCoefficients& GetYuvCoefficients(YuvMatrix matrix, YuvRange range) {
+  return kCoefficients[matrix == YuvMatrix::kBt709 ? 1 : 0]
+                      [range == YuvRange::kFull ? 1 : 0];
+}
+
+void I420ToRgbaRowScalar(const uint8_t* y,
+                         const uint8_t* u,
+                         const uint8_t* v,
+                         uint8_t* rgba,
+                         int width,
+                         const YuvCoefficients& c) {
+  for (int col = 0; col < width; ++col) {
+    YuvToRgbaPixel(y[col], u[col / 2], v[col / 2], c, rgba + col * 4);
+  }
+}
+
+void Nv12ToRgbaRowScalar(const uint8_t* y,
+                         const uint8_t* uv,
+                         uint8_t* rgba,
+                         int width,
+                         const YuvCoefficients& c) {
+  for (int col = 0; col < width; ++col) {
+    const uint8_t* chroma = uv + (col / 2) * 2;
+    YuvToRgbaPixel(y[col], chroma[0], chroma[1], c, rgba + col * 4);
+  }
+}
+
+void SumRowsScalar(const uint8_t* src,
+                   int stride,
+                   int rows,
+                   uint16_t* sums,
+                   int width) {
+  std::fill(sums, sums + width, 0);
+  for (int row = 0; row < rows; ++row) {
+    const uint8_t* line = src + static_cast<size_t>(row) * stride;
+    for (int col = 0; col < width; ++col) {
+      sums[col] = static_cast<uint16_t>(sums[col] + line[col]);
+    }
+  }
+}
+
+YuvKernel DetectYuvKernel() {
+  static const YuvKernel kernel = [] {
+    if (IsYuvKernelSupported(YuvKernel::kAvx2)) {
+      return YuvKernel::kAvx2;
+    }
+    if (IsYuvKernelSupported(YuvKernel::kSse2)) {
+      return YuvKernel::kSse2;
+    }
+    return YuvKernel::kScalar;
+  }();
+  return kernel;
+}
+
+bool IsYuvKernelSupported(YuvKernel kernel) {
+  switch (kernel) {
+    case YuvKernel::kScalar:
+      return true;
+#ifdef FLUTTER_ZOOM_YUV_X86
+    case YuvKernel::kSse2:
+      return __builtin_cpu_supports("sse2");
+    case YuvKernel::kAvx2:
+      return __builtin_cpu_supports("avx2");
+#endif
+    default:
+      return false;
+  }
+}
+
+const char* YuvKernelName(YuvKernel kernel) {
+  switch (kernel) {
+    case YuvKernel::kScalar:
+      return "scalar";
+    case YuvKernel::kSse2:
+      return "sse2";
+    case YuvKernel::kAvx2:
+      return "avx2";
+  }
+  return "unknown";
+}
+
+void I420ToRgba(const uint8_t* y,
+                int stride_y,
+                const uint8_t* u,
+                int stride_u,
+                const uint8_t* v,
+                int stride_v,
+                uint8_t* rgba,
+                int stride_rgba,
+                int width,
+                int height,
+                YuvMatrix matrix,
+                YuvRange range) {
+  ConvertI420(DetectedRowFunctions().i420, y, stride_y, u, stride_u, v,
+              stride_v, rgba, stride_rgba, width, height,
+              GetYuvCoefficients(matrix, range));
+}
+
+void Nv12ToRgba(const uint8_t* y,
+                int stride_y,
+                const uint8_t* uv,
+                int stride_uv,
+                uint8_t* rgba,
+                int stride_rgba,
+                int width,
+                int height,
+                YuvMatrix matrix,
+                YuvRange range) {
+  ConvertNv12(DetectedRowFunctions().nv12, y, stride_y, uv, stride_uv, rgba,
+              stride_rgba, width, height, GetYuvCoefficients(matrix, range));
+}
+
+void I420ScaleToRgba(const uint8_t* y,
+                     int stride_y,
+                     const uint8_t* u,
+                     int stride_u,
+                     const uint8_t* v,
+                     int stride_v,
+                     int src_width,
+                     int src_height,
+                     uint8_t* rgba,
+                     int stride_rgba,
+                     int dst_width,
+                     int dst_height,
+                     YuvMatrix matrix,
+                     YuvRange range) {
+  ScaleI420(DetectedRowFunctions(), y, stride_y, u, stride_u, v, stride_v,
+            src_width, src_height, rgba, stride_rgba, dst_width, dst_height,
+            GetYuvCoefficients(matrix, range));
+}
+
+void I420ToRgbaWithKernel(YuvKernel kernel,
+                          const uint8_t* y,
+                          int stride_y,
+                          const uint8_t* u,
+                          int stride_u,
+                          const uint8_t* v,
+                          int stride_v,
+                          uint8_t* rgba,
+                          int stride_rgba,
+                          int width,
+                          int height,
+                          YuvMatrix matrix,
+                          YuvRange range) {
+  ConvertI420(GetRowFunctions(kernel).i420, y, stride_y, u, stride_u, v,
+              stride_v, rgba, stride_rgba, width, height,
+              GetYuvCoefficients(matrix, range));
+}
+
+void Nv12ToRgbaWithKernel(YuvKernel kernel,
+                          const uint8_t* y,
+                          int stride_y,
+                          const uint8_t* uv,
+                          int stride_uv,
+                          uint8_t* rgba,
+                          int stride_rgba,
+                          int width,
+                          int height,
+                          YuvMatrix matrix,
+                          YuvRange range) {
+  ConvertNv12(GetRowFunctions(kernel).nv12, y, stride_y, uv, stride_uv, rgba,
+              stride_rgba, width, height, GetYuvCoefficients(matrix, range));
+}
+
+void I420ScaleToRgbaWithKernel(YuvKernel kernel,
+                               const uint8_t* y,
+                               int stride_y,
+                               const uint8_t* u,
+                               int stride_u,
+                               const uint8_t* v,
+                               int stride_v,
+                               int src_width,
+                               int src_height,
+                               uint8_t* rgba,
+                               int stride_rgba,
+                               int dst_width,
+                               int dst_height,
+                               YuvMatrix matrix,
+                               YuvRange range) {
+  ScaleI420(GetRowFunctions(kernel), y, stride_y, u, stride_u, v, stride_v,
+            src_width, src_height, rgba, stride_rgba, dst_width, dst_height,
+            GetYuvCoefficients(matrix, range));
+}
+
+}  // namespace flutter_zoom_meeting_sdk
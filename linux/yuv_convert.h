@@ -0,0 +1,127 @@
+#ifndef FLUTTER_PLUGIN_YUV_CONVERT_H_
+#define FLUTTER_PLUGIN_YUV_CONVERT_H_
+
+#include <cstdint>
+
+namespace flutter_zoom_meeting_sdk {
+
+enum class YuvMatrix {
+  kBt601,
+  kBt709,
+};
+
+enum class YuvRange {
+  // Y in [16, 235], chroma in [16, 240].
+  kLimited,
+  kFull,
+};
+
+// Conversion kernels. Every kernel produces output bit-exact with kScalar.
+enum class YuvKernel {
+  kScalar,
+  kSse2,
+  kAvx2,
+};
+
+// Returns the fastest kernel this CPU supports. Checked once with CPUID.
+YuvKernel DetectYuvKernel();
+
+bool IsYuvKernelSupported(YuvKernel kernel);
+
+const char* YuvKernelName(YuvKernel kernel);
+
+// Converts an I420 image to RGBA8888 with opaque alpha. Planes may have any
+// stride, and odd widths and heights are allowed.
+void I420ToRgba(const uint8_t* y,
+                int stride_y,
+                const uint8_t* u,
+                int stride_u,
+                const uint8_t* v,
+                int stride_v,
+                uint8_t* rgba,
+                int stride_rgba,
+                int width,
+                int height,
+                YuvMatrix matrix = YuvMatrix::kBt601,
+                YuvRange range = YuvRange::kLimited);
+
+// Converts an NV12 image (interleaved UV plane) to RGBA8888.
+void Nv12ToRgba(const uint8_t* y,
+                int stride_y,
+                const uint8_t* uv,
+                int stride_uv,
+                uint8_t* rgba,
+                int stride_rgba,
+                int width,
+                int height,
+                YuvMatrix matrix = YuvMatrix::kBt601,
+                YuvRange range = YuvRange::kLimited);
+
+// Scales a |src_width| x |src_height| I420 image to |dst_width| x
+// |dst_height| while converting it to RGBA8888, in a single pass over the
+// source. Each output pixel averages the box of source pixels it covers, so
+// downscaling does not alias; when upscaling, boxes are one pixel wide and
+// pixels are repeated. Boxes taller than 257 rows only average their first
+// 257, which keeps the vertical sums in 16 bits.
+void I420ScaleToRgba(const uint8_t* y,
+                     int stride_y,
+                     const uint8_t* u,
+                     int stride_u,
+                     const uint8_t* v,
+                     int stride_v,
+                     int src_width,
+                     int src_height,
+                     uint8_t* rgba,
+                     int stride_rgba,
+                     int dst_width,
+                     int dst_height,
+                     YuvMatrix matrix = YuvMatrix::kBt601,
+                     YuvRange range = YuvRange::kLimited);
+
+// Same as above with an explicit kernel, for tests and benchmarks. |kernel|
+// must be supported.
+void I420ToRgbaWithKernel(YuvKernel kernel,
+                          const uint8_t* y,
+                          int stride_y,
+                          const uint8_t* u,
+                          int stride_u,
+                          const uint8_t* v,
+                          int stride_v,
+                          uint8_t* rgba,
+                          int stride_rgba,
+                          int width,
+                          int height,
+                          YuvMatrix matrix,
+                          YuvRange range);
+
+void Nv12ToRgbaWithKernel(YuvKernel kernel,
+                          const uint8_t* y,
+                          int stride_y,
+                          const uint8_t* uv,
+                          int stride_uv,
+                          uint8_t* rgba,
+                          int stride_rgba,
+                          int width,
+                          int height,
+                          YuvMatrix matrix,
+                          YuvRange range);
+
+void I420ScaleToRgbaWithKernel(YuvKernel kernel,
+                               const uint8_t* y,
+                               int stride_y,
+                               const uint8_t* u,
+                               int stride_u,
+                               const uint8_t* v,
+                               int stride_v,
+                               int src_width,
+                               int src_height,
+                               uint8_t* rgba,
+                               int stride_rgba,
+                               int dst_width,
+                               int dst_height,
+                               YuvMatrix matrix,
+                               YuvRange range);
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_YUV_CONVERT_H_
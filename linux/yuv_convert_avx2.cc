@@ -0,0 +1,153 @@
+#include "yuv_convert_internal.h"
+
+#ifdef FLUTTER_ZOOM_YUV_X86
+
+#include <immintrin.h>
+
+// Only called after DetectYuvKernel() has seen AVX2 in CPUID.
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+struct Avx2Coefficients {
+  __m256i y_offset;
+  __m256i y_scale;
+  __m256i rounding;
+  __m256i chroma_bias;
+  __m256i v_to_r;
+  __m256i u_to_g;
+  __m256i v_to_g;
+  __m256i u_to_b;
+};
+
+AVX2_TARGET Avx2Coefficients LoadCoefficients(const YuvCoefficients& c) {
+  return {_mm256_set1_epi16(c.y_offset), _mm256_set1_epi16(c.y_scale),
+          _mm256_set1_epi16(32),         _mm256_set1_epi16(128),
+          _mm256_set1_epi16(c.v_to_r),   _mm256_set1_epi16(c.u_to_g),
+          _mm256_set1_epi16(c.v_to_g),   _mm256_set1_epi16(c.u_to_b)};
+}
+
+AVX2_TARGET inline void ConvertLanes(__m256i y,
+                                     __m256i u,
+                                     __m256i v,
+                                     const Avx2Coefficients& k,
+                                     __m256i* r,
+                                     __m256i* g,
+                                     __m256i* b) {
+  __m256i luma = _mm256_add_epi16(
+      _mm256_mullo_epi16(_mm256_sub_epi16(y, k.y_offset), k.y_scale),
+      k.rounding);
+  u = _mm256_sub_epi16(u, k.chroma_bias);
+  v = _mm256_sub_epi16(v, k.chroma_bias);
+  *r = _mm256_srai_epi16(
+      _mm256_adds_epi16(luma, _mm256_mullo_epi16(v, k.v_to_r)), 6);
+  *g = _mm256_srai_epi16(
+      _mm256_subs_epi16(
+          _mm256_subs_epi16(luma, _mm256_mullo_epi16(u, k.u_to_g)),
+          _mm256_mullo_epi16(v, k.v_to_g)),
+      6);
+  *b = _mm256_srai_epi16(
+      _mm256_adds_epi16(luma, _mm256_mullo_epi16(u, k.u_to_b)), 6);
+}
+
+// Converts 32 pixels. |y| holds 32 luma bytes; |u| and |v| hold their 16
+// chroma samples in order as 16-bit lanes.
+//
+// AVX2 unpacks work within 128-bit halves, so the intermediate vectors hold
+// pixels 0-7 and 16-23 ("a") or 8-15 and 24-31 ("b"). Packing a with b puts
+// every pixel back in order, and the final permutes undo the split again
+// when interleaving into RGBA.
+AVX2_TARGET inline void Convert32(__m256i y,
+                                  __m256i u,
+                                  __m256i v,
+                                  const Avx2Coefficients& k,
+                                  uint8_t* rgba) {
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i r_a, g_a, b_a, r_b, g_b, b_b;
+  ConvertLanes(_mm256_unpacklo_epi8(y, zero), _mm256_unpacklo_epi16(u, u),
+               _mm256_unpacklo_epi16(v, v), k, &r_a, &g_a, &b_a);
+  ConvertLanes(_mm256_unpackhi_epi8(y, zero), _mm256_unpackhi_epi16(u, u),
+               _mm256_unpackhi_epi16(v, v), k, &r_b, &g_b, &b_b);
+
+  __m256i r = _mm256_packus_epi16(r_a, r_b);
+  __m256i g = _mm256_packus_epi16(g_a, g_b);
+  __m256i b = _mm256_packus_epi16(b_a, b_b);
+  __m256i a = _mm256_set1_epi8(static_cast<char>(0xff));
+  __m256i rg_lo = _mm256_unpacklo_epi8(r, g);
+  __m256i rg_hi = _mm256_unpackhi_epi8(r, g);
+  __m256i ba_lo = _mm256_unpacklo_epi8(b, a);
+  __m256i ba_hi = _mm256_unpackhi_epi8(b, a);
+  __m256i p0 = _mm256_unpacklo_epi16(rg_lo, ba_lo);  // 0-3, 16-19
+  __m256i p1 = _mm256_unpackhi_epi16(rg_lo, ba_lo);  // 4-7, 20-23
+  __m256i p2 = _mm256_unpacklo_epi16(rg_hi, ba_hi);  // 8-11, 24-27
+  __m256i p3 = _mm256_unpackhi_epi16(rg_hi, ba_hi);  // 12-15, 28-31
+  __m256i* out = reinterpret_cast<__m256i*>(rgba);
+  _mm256_storeu_si256(out, _mm256_permute2x128_si256(p0, p1, 0x20));
+  _mm256_storeu_si256(out + 1, _mm256_permute2x128_si256(p2, p3, 0x20));
+  _mm256_storeu_si256(out + 2, _mm256_permute2x128_si256(p0, p1, 0x31));
+  _mm256_storeu_si256(out + 3, _mm256_permute2x128_si256(p2, p3, 0x31));
+}
+
+}  // namespace
+
+AVX2_TARGET void I420ToRgbaRowAvx2(const uint8_t* y,
+                                   const uint8_t* u,
+                                   const uint8_t* v,
+                                   uint8_t* rgba,
+                                   int width,
+                                   const YuvCoefficients& c) {
+  const Avx2Coefficients k = LoadCoefficients(c);
+  int col = 0;
+  for (; col + 32 <= width; col += 32) {
+    __m256i y32 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + col));
+    __m128i u16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u + col / 2));
+    __m128i v16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + col / 2));
+    Convert32(y32, _mm256_cvtepu8_epi16(u16), _mm256_cvtepu8_epi16(v16), k,
+              rgba + col * 4);
+  }
+  I420ToRgbaRowSse2(y + col, u + col / 2, v + col / 2, rgba + col * 4,
+                    width - col, c);
+}
+
+AVX2_TARGET void Nv12ToRgbaRowAvx2(const uint8_t* y,
+                                   const uint8_t* uv,
+                                   uint8_t* rgba,
+                                   int width,
+                                   const YuvCoefficients& c) {
+  const Avx2Coefficients k = LoadCoefficients(c);
+  const __m256i low_bytes = _mm256_set1_epi16(0x00ff);
+  int col = 0;
+  for (; col + 32 <= width; col += 32) {
+    __m256i y32 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + col));
+    __m256i uv32 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(uv + col));
+    Convert32(y32, _mm256_and_si256(uv32, low_bytes),
+              _mm256_srli_epi16(uv32, 8), k, rgba + col * 4);
+  }
+  Nv12ToRgbaRowSse2(y + col, uv + col, rgba + col * 4, width - col, c);
+}
+
+AVX2_TARGET void SumRowsAvx2(const uint8_t* src,
+                             int stride,
+                             int rows,
+                             uint16_t* sums,
+                             int width) {
+  int col = 0;
+  for (; col + 16 <= width; col += 16) {
+    __m256i total = _mm256_setzero_si256();
+    const uint8_t* block = src + col;
+    for (int row = 0; row < rows; ++row, block += stride) {
+      total = _mm256_add_epi16(
+          total, _mm256_cvtepu8_epi16(_mm_loadu_si128(
+                     reinterpret_cast<const __m128i*>(block))));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(sums + col), total);
+  }
+  SumRowsScalar(src + col, stride, rows, sums + col, width - col);
+}
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_ZOOM_YUV_X86
@@ -0,0 +1,136 @@
+#ifndef FLUTTER_PLUGIN_YUV_CONVERT_INTERNAL_H_
+#define FLUTTER_PLUGIN_YUV_CONVERT_INTERNAL_H_
+
+#include <cstdint>
+
+#include "yuv_convert.h"
+
+// Shared by the conversion kernels in yuv_convert*.cc.
+//
+// All kernels use the same 16-bit fixed-point arithmetic, with coefficients
+// scaled by 64, so the SIMD kernels can match the scalar one exactly:
+//
+//   luma  = (Y - y_offset) * y_scale + 32
+//   R     = sat16(luma + v_to_r * (V - 128)) >> 6
+//   G     = sat16(sat16(luma - u_to_g * (U - 128)) - v_to_g * (V - 128)) >> 6
+//   B     = sat16(luma + u_to_b * (U - 128)) >> 6
+//
+// where sat16 saturates to int16 and the results are clamped to [0, 255].
+// Every product fits in int16, so only the additions need saturation.
+
+namespace flutter_zoom_meeting_sdk {
+
+struct YuvCoefficients {
+  int16_t y_offset;
+  int16_t y_scale;
+  int16_t v_to_r;
+  int16_t u_to_g;
+  int16_t v_to_g;
+  int16_t u_to_b;
+};
+
+const YuvCoefficients& GetYuvCoefficients(YuvMatrix matrix, YuvRange range);
+
+inline int SaturateInt16(int value) {
+  return value < -32768 ? -32768 : (value > 32767 ? 32767 : value);
+}
+
+inline uint8_t ClampUint8(int value) {
+  return static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+inline void YuvToRgbaPixel(int y,
+                           int u,
+                           int v,
+                           const YuvCoefficients& c,
+                           uint8_t* out) {
+  int luma = (y - c.y_offset) * c.y_scale + 32;
+  u -= 128;
+  v -= 128;
+  out[0] = ClampUint8(SaturateInt16(luma + c.v_to_r * v) >> 6);
+  out[1] = ClampUint8(
+      SaturateInt16(SaturateInt16(luma - c.u_to_g * u) - c.v_to_g * v) >> 6);
+  out[2] = ClampUint8(SaturateInt16(luma + c.u_to_b * u) >> 6);
+  out[3] = 255;
+}
+
+// Row converters. |width| pixels are written to |rgba|; the chroma rows hold
+// (width + 1) / 2 samples.
+using I420RowFunction = void (*)(const uint8_t* y,
+                                 const uint8_t* u,
+                                 const uint8_t* v,
+                                 uint8_t* rgba,
+                                 int width,
+                                 const YuvCoefficients& c);
+using Nv12RowFunction = void (*)(const uint8_t* y,
+                                 const uint8_t* uv,
+                                 uint8_t* rgba,
+                                 int width,
+                                 const YuvCoefficients& c);
+
+void I420ToRgbaRowScalar(const uint8_t* y,
+                         const uint8_t* u,
+                         const uint8_t* v,
+                         uint8_t* rgba,
+                         int width,
+                         const YuvCoefficients& c);
+void Nv12ToRgbaRowScalar(const uint8_t* y,
+                         const uint8_t* uv,
+                         uint8_t* rgba,
+                         int width,
+                         const YuvCoefficients& c);
+
+// Sums |rows| rows of |src|, |width| bytes each, column by column into
+// |sums|, for the box filter's vertical pass. |rows| is at most 257.
+using SumRowsFunction = void (*)(const uint8_t* src,
+                                 int stride,
+                                 int rows,
+                                 uint16_t* sums,
+                                 int width);
+
+void SumRowsScalar(const uint8_t* src,
+                   int stride,
+                   int rows,
+                   uint16_t* sums,
+                   int width);
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FLUTTER_ZOOM_YUV_X86 1
+
+void I420ToRgbaRowSse2(const uint8_t* y,
+                       const uint8_t* u,
+                       const uint8_t* v,
+                       uint8_t* rgba,
+                       int width,
+                       const YuvCoefficients& c);
+void Nv12ToRgbaRowSse2(const uint8_t* y,
+                       const uint8_t* uv,
+                       uint8_t* rgba,
+                       int width,
+                       const YuvCoefficients& c);
+void I420ToRgbaRowAvx2(const uint8_t* y,
+                       const uint8_t* u,
+                       const uint8_t* v,
+                       uint8_t* rgba,
+                       int width,
+                       const YuvCoefficients& c);
+void Nv12ToRgbaRowAvx2(const uint8_t* y,
+                       const uint8_t* uv,
+                       uint8_t* rgba,
+                       int width,
+                       const YuvCoefficients& c);
+void SumRowsSse2(const uint8_t* src,
+                 int stride,
+                 int rows,
+                 uint16_t* sums,
+                 int width);
+void SumRowsAvx2(const uint8_t* src,
+                 int stride,
+                 int rows,
+                 uint16_t* sums,
+                 int width);
+#endif
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_YUV_CONVERT_INTERNAL_H_
@@ -0,0 +1,149 @@
+#include "yuv_convert_internal.h"
+
+#ifdef FLUTTER_ZOOM_YUV_X86
+
+#include <emmintrin.h>
+
+// Compiled with the sse2 target attribute rather than per-file flags so the
+// rest of the plugin keeps the toolchain's baseline ISA.
+#define SSE2_TARGET __attribute__((target("sse2")))
+
+namespace flutter_zoom_meeting_sdk {
+
+namespace {
+
+struct Sse2Coefficients {
+  __m128i y_offset;
+  __m128i y_scale;
+  __m128i rounding;
+  __m128i chroma_bias;
+  __m128i v_to_r;
+  __m128i u_to_g;
+  __m128i v_to_g;
+  __m128i u_to_b;
+};
+
+SSE2_TARGET Sse2Coefficients LoadCoefficients(const YuvCoefficients& c) {
+  return {_mm_set1_epi16(c.y_offset), _mm_set1_epi16(c.y_scale),
+          _mm_set1_epi16(32),         _mm_set1_epi16(128),
+          _mm_set1_epi16(c.v_to_r),   _mm_set1_epi16(c.u_to_g),
+          _mm_set1_epi16(c.v_to_g),   _mm_set1_epi16(c.u_to_b)};
+}
+
+// Converts eight pixels held as 16-bit lanes to packed 16-bit R, G and B.
+SSE2_TARGET inline void ConvertLanes(__m128i y,
+                                     __m128i u,
+                                     __m128i v,
+                                     const Sse2Coefficients& k,
+                                     __m128i* r,
+                                     __m128i* g,
+                                     __m128i* b) {
+  __m128i luma = _mm_add_epi16(
+      _mm_mullo_epi16(_mm_sub_epi16(y, k.y_offset), k.y_scale), k.rounding);
+  u = _mm_sub_epi16(u, k.chroma_bias);
+  v = _mm_sub_epi16(v, k.chroma_bias);
+  *r = _mm_srai_epi16(_mm_adds_epi16(luma, _mm_mullo_epi16(v, k.v_to_r)), 6);
+  *g = _mm_srai_epi16(
+      _mm_subs_epi16(_mm_subs_epi16(luma, _mm_mullo_epi16(u, k.u_to_g)),
+                     _mm_mullo_epi16(v, k.v_to_g)),
+      6);
+  *b = _mm_srai_epi16(_mm_adds_epi16(luma, _mm_mullo_epi16(u, k.u_to_b)), 6);
+}
+
+// Converts 16 pixels. |y| holds 16 luma bytes; |u| and |v| hold the eight
+// chroma samples for them as 16-bit lanes.
+SSE2_TARGET inline void Convert16(__m128i y,
+                                  __m128i u,
+                                  __m128i v,
+                                  const Sse2Coefficients& k,
+                                  uint8_t* rgba) {
+  const __m128i zero = _mm_setzero_si128();
+  __m128i y_lo = _mm_unpacklo_epi8(y, zero);
+  __m128i y_hi = _mm_unpackhi_epi8(y, zero);
+  __m128i r_lo, g_lo, b_lo, r_hi, g_hi, b_hi;
+  ConvertLanes(y_lo, _mm_unpacklo_epi16(u, u), _mm_unpacklo_epi16(v, v), k,
+               &r_lo, &g_lo, &b_lo);
+  ConvertLanes(y_hi, _mm_unpackhi_epi16(u, u), _mm_unpackhi_epi16(v, v), k,
+               &r_hi, &g_hi, &b_hi);
+
+  __m128i r = _mm_packus_epi16(r_lo, r_hi);
+  __m128i g = _mm_packus_epi16(g_lo, g_hi);
+  __m128i b = _mm_packus_epi16(b_lo, b_hi);
+  __m128i a = _mm_set1_epi8(static_cast<char>(0xff));
+  __m128i rg_lo = _mm_unpacklo_epi8(r, g);
+  __m128i rg_hi = _mm_unpackhi_epi8(r, g);
+  __m128i ba_lo = _mm_unpacklo_epi8(b, a);
+  __m128i ba_hi = _mm_unpackhi_epi8(b, a);
+  __m128i* out = reinterpret_cast<__m128i*>(rgba);
+  _mm_storeu_si128(out, _mm_unpacklo_epi16(rg_lo, ba_lo));
+  _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(rg_lo, ba_lo));
+  _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(rg_hi, ba_hi));
+  _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(rg_hi, ba_hi));
+}
+
+}  // namespace
+
+SSE2_TARGET void I420ToRgbaRowSse2(const uint8_t* y,
+                                   const uint8_t* u,
+                                   const uint8_t* v,
+                                   uint8_t* rgba,
+                                   int width,
+                                   const YuvCoefficients& c) {
+  const Sse2Coefficients k = LoadCoefficients(c);
+  const __m128i zero = _mm_setzero_si128();
+  int col = 0;
+  for (; col + 16 <= width; col += 16) {
+    __m128i y16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + col));
+    __m128i u8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + col / 2));
+    __m128i v8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + col / 2));
+    Convert16(y16, _mm_unpacklo_epi8(u8, zero), _mm_unpacklo_epi8(v8, zero),
+              k, rgba + col * 4);
+  }
+  I420ToRgbaRowScalar(y + col, u + col / 2, v + col / 2, rgba + col * 4,
+                      width - col, c);
+}
+
+SSE2_TARGET void Nv12ToRgbaRowSse2(const uint8_t* y,
+                                   const uint8_t* uv,
+                                   uint8_t* rgba,
+                                   int width,
+                                   const YuvCoefficients& c) {
+  const Sse2Coefficients k = LoadCoefficients(c);
+  const __m128i low_bytes = _mm_set1_epi16(0x00ff);
+  int col = 0;
+  for (; col + 16 <= width; col += 16) {
+    __m128i y16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + col));
+    __m128i uv16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(uv + col));
+    Convert16(y16, _mm_and_si128(uv16, low_bytes), _mm_srli_epi16(uv16, 8), k,
+              rgba + col * 4);
+  }
+  Nv12ToRgbaRowScalar(y + col, uv + col, rgba + col * 4, width - col, c);
+}
+
+// Each column block is summed down all rows in registers, so |sums| is
+// written once.
+SSE2_TARGET void SumRowsSse2(const uint8_t* src,
+                             int stride,
+                             int rows,
+                             uint16_t* sums,
+                             int width) {
+  const __m128i zero = _mm_setzero_si128();
+  int col = 0;
+  for (; col + 16 <= width; col += 16) {
+    __m128i low = zero;
+    __m128i high = zero;
+    const uint8_t* block = src + col;
+    for (int row = 0; row < rows; ++row, block += stride) {
+      __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+      low = _mm_add_epi16(low, _mm_unpacklo_epi8(bytes, zero));
+      high = _mm_add_epi16(high, _mm_unpackhi_epi8(bytes, zero));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sums + col), low);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(sums + col + 8), high);
+  }
+  SumRowsScalar(src + col, stride, rows, sums + col, width - col);
+}
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_ZOOM_YUV_X86
@@ -0,0 +1,85 @@
+#include "include/flutter_zoom_meeting_sdk/zoom_core.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#include "dart_port.h"
+#include "zoom_core_handle.h"
+
+using flutter_zoom_meeting_sdk::HasDartPostCObject;
+using flutter_zoom_meeting_sdk::SetDartPostCObject;
+
+namespace {
+
+// Live cores by handle. Calls hold |mutex| while they use a core, so
+// unregistering waits for them.
+struct CoreRegistry {
+  std::mutex mutex;
+  std::unordered_map<ZoomCoreHandle, ZoomCore*> cores;
+  ZoomCoreHandle next_handle = 1;
+};
+
+// Never destroyed, so Dart calls during shutdown still find it.
+CoreRegistry& Registry() {
+  static CoreRegistry* registry = new CoreRegistry();
+  return *registry;
+}
+
+// Returns the core of |handle|, or nullptr if it is stale. Requires the
+// registry mutex.
+ZoomCore* FindLocked(CoreRegistry& registry, ZoomCoreHandle handle) {
+  auto it = registry.cores.find(handle);
+  return it != registry.cores.end() ? it->second : nullptr;
+}
+
+}  // namespace
+
+namespace flutter_zoom_meeting_sdk {
+
+ZoomCoreHandle RegisterZoomCore(ZoomCore* core) {
+  CoreRegistry& registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  ZoomCoreHandle handle = registry.next_handle++;
+  registry.cores[handle] = core;
+  return handle;
+}
+
+void UnregisterZoomCore(ZoomCoreHandle handle) {
+  CoreRegistry& registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.cores.erase(handle);
+}
+
+}  // namespace flutter_zoom_meeting_sdk
+
+int32_t zoom_core_abi_version(void) {
+  return ZOOM_CORE_ABI_VERSION;
+}
+
+void zoom_core_init_dart_api(ZoomCorePostCObject post_cobject) {
+  SetDartPostCObject(post_cobject);
+}
+
+bool zoom_core_set_audio_port(ZoomCoreHandle handle, int64_t port) {
+  if (!HasDartPostCObject()) {
+    return false;
+  }
+  CoreRegistry& registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  ZoomCore* core = FindLocked(registry, handle);
+  if (core == nullptr) {
+    return false;
+  }
+  core->audio_router->SetNotifyPort(port);
+  return true;
+}
+
+void zoom_core_acknowledge_audio(ZoomCoreHandle handle,
+                                 uint32_t participant_id) {
+  CoreRegistry& registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  ZoomCore* core = FindLocked(registry, handle);
+  if (core != nullptr) {
+    core->audio_router->AcknowledgeNotification(participant_id);
+  }
+}
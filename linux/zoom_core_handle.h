@@ -0,0 +1,24 @@
+#ifndef FLUTTER_PLUGIN_ZOOM_CORE_HANDLE_H_
+#define FLUTTER_PLUGIN_ZOOM_CORE_HANDLE_H_
+
+#include "audio_stream_router.h"
+#include "include/flutter_zoom_meeting_sdk/zoom_core.h"
+
+// What the C ABI in include/flutter_zoom_meeting_sdk/zoom_core.h reaches of
+// one plugin instance. The plugin owns it and everything it points to.
+struct ZoomCore {
+  flutter_zoom_meeting_sdk::AudioStreamRouter* audio_router;
+};
+
+namespace flutter_zoom_meeting_sdk {
+
+// Makes |core| reachable through the C ABI and returns its handle.
+ZoomCoreHandle RegisterZoomCore(ZoomCore* core);
+
+// Makes |handle| stale. Returns once no C ABI call is using its core, so the
+// core can be deleted afterwards.
+void UnregisterZoomCore(ZoomCoreHandle handle);
+
+}  // namespace flutter_zoom_meeting_sdk
+
+#endif  // FLUTTER_PLUGIN_ZOOM_CORE_HANDLE_H_
@@ -0,0 +1,130 @@
+import 'dart:ffi';
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_audio.dart';
+
+typedef _CallocNative = Pointer<Uint8> Function(IntPtr, IntPtr);
+typedef _Calloc = Pointer<Uint8> Function(int, int);
+typedef _FreeNative = Void Function(Pointer<Uint8>);
+typedef _Free = void Function(Pointer<Uint8>);
+
+final _calloc =
+    DynamicLibrary.process().lookupFunction<_CallocNative, _Calloc>('calloc');
+final _free =
+    DynamicLibrary.process().lookupFunction<_FreeNative, _Free>('free');
+
+/// Builds a ring the way linux/pcm_ring_buffer.cc does and plays the
+/// producer's part.
+class _FakeRing {
+  static const int dataOffset = 256;
+
+  final int capacity;
+  final Pointer<Uint8> memory;
+
+  _FakeRing(this.capacity) : memory = _calloc(dataOffset + capacity * 2, 1) {
+    final header = memory.address;
+    Pointer<Uint32>.fromAddress(header).value = PcmRingReader.magic;
+    Pointer<Uint32>.fromAddress(header + 4).value = PcmRingReader.version;
+    Pointer<Uint32>.fromAddress(header + 8).value = 16000;
+    Pointer<Uint32>.fromAddress(header + 16).value = capacity;
+    Pointer<Uint32>.fromAddress(header + 24).value = dataOffset;
+  }
+
+  int writePosition = 0;
+
+  void write(List<int> samples) {
+    final end = beginWrite(samples, samples.length);
+    Pointer<Uint64>.fromAddress(memory.address + 64).value = end;
+  }
+
+  /// Claims room for [samples] and copies only the first [copied] of them,
+  /// leaving the write in progress. Returns where it ends.
+  int beginWrite(List<int> samples, int copied) {
+    final end = writePosition + samples.length;
+    Pointer<Uint64>.fromAddress(memory.address + 72).value = end;
+    final data = Pointer<Int16>.fromAddress(memory.address + dataOffset)
+        .asTypedList(capacity);
+    for (var i = 0; i < copied; i++) {
+      data[(writePosition + i) % capacity] = samples[i];
+    }
+    writePosition = end;
+    return end;
+  }
+
+  void finishWrite(List<int> samples, int copied) {
+    final start = writePosition - samples.length;
+    final data = Pointer<Int16>.fromAddress(memory.address + dataOffset)
+        .asTypedList(capacity);
+    for (var i = copied; i < samples.length; i++) {
+      data[(start + i) % capacity] = samples[i];
+    }
+    Pointer<Uint64>.fromAddress(memory.address + 64).value = writePosition;
+  }
+
+  int get readPosition =>
+      Pointer<Uint64>.fromAddress(memory.address + 128).value;
+
+  void dispose() => _free(memory);
+}
+
+void main() {
+  test('rejects memory that is not a ring', () {
+    final memory = _calloc(256, 1);
+    expect(() => PcmRingReader(memory.address), throwsArgumentError);
+    _free(memory);
+  });
+
+  test('reads new samples across the wrap', () {
+    final ring = _FakeRing(8);
+    final reader = PcmRingReader(ring.memory.address);
+    expect(reader.sampleRate, 16000);
+    expect(reader.read(), isEmpty);
+
+    ring.write([1, 2, 3, 4, 5, 6]);
+    expect(reader.read(), Int16List.fromList([1, 2, 3, 4, 5, 6]));
+    ring.write([7, 8, 9, 10, 11]);
+    expect(reader.read(), Int16List.fromList([7, 8, 9, 10, 11]));
+    expect(ring.readPosition, 11);
+    ring.dispose();
+  });
+
+  test('skips samples that were overwritten before reading', () {
+    final ring = _FakeRing(8);
+    final reader = PcmRingReader(ring.memory.address);
+    ring.write(List<int>.generate(12, (i) => i));
+    expect(reader.read(), Int16List.fromList([4, 5, 6, 7, 8, 9, 10, 11]));
+    ring.dispose();
+  });
+
+  test('drops samples a write in progress is overwriting', () {
+    final ring = _FakeRing(8);
+    final reader = PcmRingReader(ring.memory.address);
+    ring.write(List<int>.generate(8, (i) => i));
+
+    // A read that starts while the next write has replaced half of what it
+    // claimed must not return any of the claimed slots.
+    final next = [8, 9, 10, 11];
+    ring.beginWrite(next, 2);
+    expect(reader.read(), Int16List.fromList([4, 5, 6, 7]));
+
+    ring.finishWrite(next, 2);
+    expect(reader.read(), Int16List.fromList([8, 9, 10, 11]));
+    ring.dispose();
+  });
+
+  test('decodes active speaker events', () {
+    final change = ActiveSpeakerChange.fromEvent([
+      'ACTIVE_SPEAKER_CHANGED',
+      '16778240',
+      ['16778240', '16779264'],
+    ]);
+    expect(change.activeSpeaker, '16778240');
+    expect(change.speaking, ['16778240', '16779264']);
+
+    final silence =
+        ActiveSpeakerChange.fromEvent(['ACTIVE_SPEAKER_CHANGED', null, []]);
+    expect(silence.activeSpeaker, isNull);
+    expect(silence.speaking, isEmpty);
+  });
+}
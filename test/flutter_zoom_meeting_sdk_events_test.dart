@@ -0,0 +1,45 @@
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_events.dart';
+
+void main() {
+  test('decodes a binary status record', () {
+    final data = ByteData(MeetingStatusEvent.recordSize)
+      ..setInt32(0, 5, Endian.little)
+      ..setInt32(4, -3, Endian.little)
+      ..setInt32(8, 70000, Endian.little)
+      ..setUint32(12, 7, Endian.little)
+      ..setInt64(16, 1234567890123, Endian.little)
+      ..setUint64(24, 42, Endian.little);
+
+    final event = MeetingStatusEvent.decode(data);
+    expect(event.status, MeetingStatus.reconnecting);
+    expect(event.errorCode, -3);
+    expect(event.internalErrorCode, 70000);
+    expect(event.sessionId, 7);
+    expect(event.timestampUs, 1234567890123);
+    expect(event.sequence, 42);
+  });
+
+  test('maps unknown status codes to unknown', () {
+    final data = ByteData(MeetingStatusEvent.recordSize)
+      ..setInt32(0, 99, Endian.little);
+    expect(MeetingStatusEvent.decode(data).status, MeetingStatus.unknown);
+  });
+
+  test('decodes a batch of records', () {
+    final data = ByteData(MeetingStatusEvent.recordSize * 2)
+      ..setUint64(24, 1, Endian.little)
+      ..setInt32(MeetingStatusEvent.recordSize, 3, Endian.little)
+      ..setUint64(MeetingStatusEvent.recordSize + 24, 2, Endian.little);
+
+    final events = MeetingStatusEvent.decodeAll(data);
+    expect(events.map((e) => e.sequence), [1, 2]);
+    expect(events[1].status, MeetingStatus.inMeeting);
+  });
+
+  test('rejects short records', () {
+    expect(() => MeetingStatusEvent.decode(ByteData(8)), throwsArgumentError);
+  });
+}
@@ -0,0 +1,26 @@
+import 'package:flutter_test/flutter_test.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_gallery.dart';
+
+void main() {
+  test('grid fills rows in reading order', () {
+    final layout = GalleryLayout.grid(['1', '2', '3', '4', '5'],
+        width: 960, height: 480, spacing: 6);
+    expect(layout.tiles, hasLength(5));
+    // Five tiles make a 3x2 grid.
+    expect(layout.tiles[0].width, 316);
+    expect(layout.tiles[0].height, 237);
+    expect(layout.tiles[2].x, 644);
+    expect(layout.tiles[3].x, 0);
+    expect(layout.tiles[3].y, 243);
+  });
+
+  test('encodes five integers per tile', () {
+    const layout = GalleryLayout(width: 640, height: 360, tiles: [
+      GalleryTile(
+          participantId: '16778240', x: 0, y: 0, width: 320, height: 180),
+      GalleryTile(participantId: '7', x: 320, y: 0, width: 320, height: 180),
+    ]);
+    expect(layout.encodeTiles(),
+        [16778240, 0, 0, 320, 180, 7, 320, 0, 320, 180]);
+  });
+}
@@ -1,11 +1,54 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
 import 'package:flutter/services.dart';
 import 'package:flutter_test/flutter_test.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_auth.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_events.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_memory.dart';
 import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_method_channel.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_options.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_options_codec.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_roster.dart';
 
 void main() {
-  MethodChannelZoom platform = MethodChannelZoom();
+  MethodChannelZoom platform = MethodChannelZoom(packMeetingOptions: false);
   const MethodChannel channel = MethodChannel('plugins.flutter_zoom_meeting_sdk/zoom_channel');
 
+  final joinOptions = ZoomMeetingOptions(
+    userId: 'bot',
+    meetingId: '42',
+    meetingPassword: '',
+    disableDialIn: 'true',
+    disableDrive: 'false',
+    disableInvite: 'false',
+    disableShare: 'false',
+    noDisconnectAudio: 'false',
+    noAudio: 'false',
+  );
+
+  // An in-meeting status record as the Linux plugin encodes it.
+  Uint8List statusRecord(int sequence) {
+    final data = ByteData(32)
+      ..setInt32(0, 3, Endian.little)
+      ..setUint32(12, 1, Endian.little)
+      ..setInt64(16, 1000, Endian.little)
+      ..setUint64(24, sequence, Endian.little);
+    return data.buffer.asUint8List();
+  }
+
+  // Answers zoom_channel calls with [reply] in place of the plugin and
+  // returns the calls it receives.
+  List<MethodCall> mockPlugin(Object? Function(MethodCall call) reply) {
+    final calls = <MethodCall>[];
+    TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+        .setMockMethodCallHandler(channel, (MethodCall methodCall) async {
+      calls.add(methodCall);
+      return reply(methodCall);
+    });
+    return calls;
+  }
+
   TestWidgetsFlutterBinding.ensureInitialized();
 
   setUp(() {
@@ -26,5 +69,415 @@ void main() {
   test('getPlatformVersion', () async {
     expect(await platform.getPlatformVersion(), 'Android 15');
   });
+
+  test('decodes token expiry events', () {
+    final expiring =
+        TokenExpiring.fromEvent(['TOKEN_EXPIRING', 'key', 1700003600]);
+    expect(expiring.appKey, 'key');
+    expect(expiring.expiresAt,
+        DateTime.fromMillisecondsSinceEpoch(1700003600000, isUtc: true));
+  });
+
+  test('decodes memory pressure events', () {
+    final change = MemoryPressureChange.fromEvent(
+        ['MEMORY_PRESSURE', 'minimal', 96 << 20, 700 << 20]);
+    expect(change.pressure, MemoryPressure.minimal);
+    expect(change.trackedBytes, 96 << 20);
+    expect(change.rssBytes, 700 << 20);
+    expect(MemoryPressure.fromName('unknown'), MemoryPressure.normal);
+  });
+
+  group('onMeetingStatusEvent', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => null);
+    });
+
+    test('decodes record batches from the binary channel', () async {
+      final platform = MethodChannelZoom(packMeetingOptions: false);
+      final events = <MeetingStatusEvent>[];
+      final subscription = platform.onMeetingStatusEvent().listen(events.add);
+      await Future<void>.delayed(Duration.zero);
+      expect(calls.single.method, 'binary_status_events');
+      expect(calls.single.arguments, {'enabled': 'true'});
+
+      final batch = Uint8List(64)
+        ..setAll(0, statusRecord(5))
+        ..setAll(32, statusRecord(6));
+      await TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+          .handlePlatformMessage(platform.statusEventChannel.name,
+              ByteData.sublistView(batch), (ByteData? reply) {});
+      await Future<void>.delayed(Duration.zero);
+      expect(events.map((event) => event.sequence), [5, 6]);
+      expect(events.first.status, MeetingStatus.inMeeting);
+      expect(events.first.sessionId, 1);
+      expect(events.first.timestampUs, 1000);
+
+      await subscription.cancel();
+      await Future<void>.delayed(Duration.zero);
+      expect(calls.last.method, 'binary_status_events');
+      expect(calls.last.arguments, {'enabled': 'false'});
+    });
+  });
+
+  group('subscribeVideo', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin(
+          (call) => call.arguments['participantId'] == '7' ? 3 : null);
+    });
+
+    test('sends the participant ID and returns the texture ID', () async {
+      expect(await platform.subscribeVideo('7'), 3);
+      expect(calls.single.method, 'subscribe_video');
+      expect(calls.single.arguments, {'participantId': '7'});
+    });
+
+    test('returns -1 when the plugin has no texture', () async {
+      expect(await platform.subscribeVideo('8'), -1);
+    });
+  });
+
+  group('joinMeeting', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => true);
+    });
+
+    test('sends a string map when packing is off', () async {
+      expect(await platform.joinMeeting(joinOptions), isTrue);
+      expect(calls.single.method, 'join');
+      expect(calls.single.arguments, {
+        'userId': 'bot',
+        'meetingId': '42',
+        'meetingPassword': '',
+        'disableDialIn': 'true',
+        'disableDrive': 'false',
+        'disableInvite': 'false',
+        'disableShare': 'false',
+        'noDisconnectAudio': 'false',
+        'noAudio': 'false',
+      });
+    });
+
+    test('sends packed options when enabled', () async {
+      final packed = MethodChannelZoom(packMeetingOptions: true);
+      expect(await packed.joinMeeting(joinOptions), isTrue);
+      expect(calls.single.method, 'join');
+
+      final bytes = calls.single.arguments as Uint8List;
+      final data = ByteData.sublistView(bytes);
+      expect(data.getUint32(0, Endian.little),
+          PackedMeetingOptions.formatVersion);
+      expect(data.getUint32(4, Endian.little),
+          PackedMeetingOptions.disableDialIn);
+      expect(data.getInt32(8, Endian.little), 0);
+      // User ID, display name, meeting ID, password and access token; join
+      // leaves the host fields empty.
+      final strings = <String>[];
+      var offset = PackedMeetingOptions.headerSize;
+      while (offset < bytes.length) {
+        final length = data.getUint32(offset, Endian.little);
+        offset += 4;
+        strings.add(utf8.decode(bytes.sublist(offset, offset + length)));
+        offset += length;
+      }
+      expect(strings, ['bot', '', '42', '', '']);
+    });
+  });
+
+  group('concurrent meetings', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => call.method == 'meeting_status'
+          ? ['MEETING_STATUS_INMEETING', '']
+          : null);
+    });
+
+    test('leaveMeeting names the meeting to leave', () async {
+      expect(await platform.leaveMeeting('42'), isFalse);
+      expect(calls.single.method, 'leave_meeting');
+      expect(calls.single.arguments, {'meetingId': '42'});
+    });
+
+    test('meetingStatus names the meeting', () async {
+      expect(await platform.meetingStatus('42'),
+          ['MEETING_STATUS_INMEETING', '']);
+      expect(calls.single.method, 'meeting_status');
+      expect(calls.single.arguments, {'meetingId': '42'});
+    });
+
+    test('meetingSessions is empty without an answer', () async {
+      expect(await platform.meetingSessions(), isEmpty);
+      expect(calls.single.method, 'meeting_sessions');
+    });
+  });
+
+  group('recording', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => call.method == 'start_recording');
+    });
+
+    test('startRecording sends the directory', () async {
+      expect(await platform.startRecording('/tmp/bot'), isTrue);
+      expect(calls.single.method, 'start_recording');
+      expect(calls.single.arguments, {'directory': '/tmp/bot'});
+    });
+
+    test('stopRecording sends no arguments', () async {
+      expect(await platform.stopRecording(), isFalse);
+      expect(calls.single.method, 'stop_recording');
+      expect(calls.single.arguments, isNull);
+    });
+  });
+
+  group('framePoolStats', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => <String, Object>{
+            'maxBytes': 1 << 29,
+            'inUseBytes': 393216,
+            'failedAllocations': 2,
+            'classes': [
+              <String, int>{'bufferSize': 393216, 'inUseBytes': 393216},
+            ],
+          });
+    });
+
+    test('decodes the stats map, defaulting missing counters', () async {
+      final stats = await platform.framePoolStats();
+      expect(calls.single.method, 'frame_pool_stats');
+      expect(stats.maxBytes, 1 << 29);
+      expect(stats.inUseBytes, 393216);
+      expect(stats.freeBytes, 0);
+      expect(stats.failedAllocations, 2);
+      expect(stats.classes.single.bufferSize, 393216);
+      expect(stats.classes.single.inUseBytes, 393216);
+      expect(stats.classes.single.freeBytes, 0);
+    });
+  });
+
+  group('participantSnapshot', () {
+    late List<MethodCall> calls;
+
+    // A join of participant 16778240, muted, named "Ann", as the plugin
+    // encodes it.
+    Uint8List joinDelta(int sequence) {
+      final data = ByteData(RosterDelta.headerSize + 4)
+        ..setUint64(0, sequence, Endian.little)
+        ..setUint32(8, 1, Endian.little)
+        ..setUint32(12, 0, Endian.little)
+        ..setUint32(16, 16778240, Endian.little)
+        ..setUint8(20, 0)
+        ..setUint8(22, 1)
+        ..setUint32(24, 3, Endian.little);
+      final bytes = data.buffer.asUint8List();
+      bytes.setAll(RosterDelta.headerSize, utf8.encode('Ann'));
+      return bytes;
+    }
+
+    setUp(() {
+      calls = mockPlugin((call) => <String, Object>{
+            'sequence': 10,
+            'full': false,
+            'deltas': joinDelta(10),
+          });
+    });
+
+    test('sends the sequence and decodes the deltas', () async {
+      final snapshot = await platform.participantSnapshot(9);
+      expect(calls.single.method, 'participant_snapshot');
+      expect(calls.single.arguments, {'sinceSequence': '9'});
+      expect(snapshot.sequence, 10);
+      expect(snapshot.full, isFalse);
+      final delta = snapshot.deltas.single;
+      expect(delta.type, RosterDeltaType.joined);
+      expect(delta.sessionId, 1);
+      expect(delta.participantId, 16778240);
+      expect(delta.audioMuted, isTrue);
+      expect(delta.displayName, 'Ann');
+    });
+  });
+
+  group('setSpeakerDetection', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => true);
+    });
+
+    test('sends the flag as a string', () async {
+      expect(await platform.setSpeakerDetection(true), isTrue);
+      expect(await platform.setSpeakerDetection(false), isTrue);
+      expect(calls.map((call) => call.method),
+          ['set_speaker_detection', 'set_speaker_detection']);
+      expect(calls.map((call) => call.arguments), [
+        {'enabled': 'true'},
+        {'enabled': 'false'},
+      ]);
+    });
+  });
+
+  group('setVideoDisplaySize', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => null);
+    });
+
+    test('sends the participant and size as strings', () async {
+      expect(await platform.setVideoDisplaySize('7', 240, 135), isFalse);
+      expect(calls.single.method, 'set_video_display_size');
+      expect(calls.single.arguments,
+          {'participantId': '7', 'width': '240', 'height': '135'});
+    });
+  });
+
+  group('videoStats', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => <String, Object>{
+            'participants': {
+              7: <String, int>{'produced': 40, 'displayed': 30, 'dropped': 10},
+            },
+            'gallery': <String, int>{'produced': 8, 'meanAgeUs': 12000},
+          });
+    });
+
+    test('decodes participants keyed by ID and the gallery', () async {
+      final stats = await platform.videoStats();
+      expect(calls.single.method, 'video_stats');
+      final texture = stats.participants['7']!;
+      expect(texture.displayed, 30);
+      expect(texture.dropRatio, 0.25);
+      expect(stats.gallery!.produced, 8);
+      expect(stats.gallery!.meanAgeUs, 12000);
+    });
+  });
+
+  group('meetingState', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => statusRecord(5));
+    });
+
+    test('decodes the status record', () async {
+      final state = await platform.meetingState();
+      expect(calls.single.method, 'meeting_state');
+      expect(calls.single.arguments, isNull);
+      expect(state!.status, MeetingStatus.inMeeting);
+      expect(state.sessionId, 1);
+      expect(state.timestampUs, 1000);
+      expect(state.sequence, 5);
+    });
+
+    test('is null when the plugin has no status', () async {
+      mockPlugin((call) => null);
+      expect(await platform.meetingState(), isNull);
+    });
+  });
+
+  group('waitForStatusChange', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) =>
+          statusRecord(int.parse(call.arguments['sinceSequence']) + 1));
+    });
+
+    test('sends the sequence and timeout and decodes the change', () async {
+      final state = await platform.waitForStatusChange(5,
+          timeout: const Duration(milliseconds: 1500));
+      expect(calls.single.method, 'wait_for_status_change');
+      expect(calls.single.arguments,
+          {'sinceSequence': '5', 'timeoutMs': '1500'});
+      expect(state!.status, MeetingStatus.inMeeting);
+      expect(state.sequence, 6);
+    });
+  });
+
+  group('setAuthToken', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => null);
+    });
+
+    test('sends the token', () async {
+      expect(await platform.setAuthToken('header.payload.signature'), isFalse);
+      expect(calls.single.method, 'set_auth_token');
+      expect(calls.single.arguments, {'jwtToken': 'header.payload.signature'});
+    });
+  });
+
+  group('bindView', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => true);
+    });
+
+    test('sends the view and the meeting it shows', () async {
+      expect(await platform.bindView(2, '44'), isTrue);
+      expect(await platform.bindView(2, null), isTrue);
+      expect(calls.map((call) => call.method), ['bind_view', 'bind_view']);
+      expect(calls.map((call) => call.arguments), [
+        {'viewId': '2', 'meetingId': '44'},
+        {'viewId': '2'},
+      ]);
+    });
+  });
+
+  group('memory', () {
+    late List<MethodCall> calls;
+
+    setUp(() {
+      calls = mockPlugin((call) => call.method == 'memory_stats'
+          ? <String, Object>{
+              'categories': {
+                'videoFrames': <String, int>{
+                  'currentBytes': 1 << 20,
+                  'peakBytes': 3 << 20,
+                },
+              },
+              'trackedBytes': 1 << 20,
+              'peakBytes': 3 << 20,
+              'rssBytes': 200 << 20,
+              'pressure': 'reduced',
+            }
+          : true);
+    });
+
+    test('getMemoryStats decodes the stats map', () async {
+      final stats = await platform.getMemoryStats();
+      expect(calls.single.method, 'memory_stats');
+      expect(stats.categories['videoFrames']!.currentBytes, 1 << 20);
+      expect(stats.categories['videoFrames']!.peakBytes, 3 << 20);
+      expect(stats.trackedBytes, 1 << 20);
+      expect(stats.peakBytes, 3 << 20);
+      expect(stats.rssBytes, 200 << 20);
+      expect(stats.pressure, MemoryPressure.reduced);
+    });
+
+    test('setMemoryBudget sends only the budgets given', () async {
+      expect(await platform.setMemoryBudget(pluginBytes: 64 << 20), isTrue);
+      expect(await platform.setMemoryBudget(rssBytes: 1 << 30), isTrue);
+      expect(calls.map((call) => call.method),
+          ['set_memory_budget', 'set_memory_budget']);
+      expect(calls.map((call) => call.arguments), [
+        {'pluginBytes': '${64 << 20}'},
+        {'rssBytes': '${1 << 30}'},
+      ]);
+    });
+  });
 }
 
@@ -0,0 +1,57 @@
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_options.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_options_codec.dart';
+
+void main() {
+  test('matches the native layout', () {
+    final options = ZoomMeetingOptions(
+      userId: '',
+      meetingId: '42',
+      meetingPassword: '',
+      disableDialIn: 'TRUE',
+      disableDrive: 'false',
+      disableInvite: 'false',
+      disableShare: 'no',
+      noDisconnectAudio: 'false',
+      noAudio: 'true',
+      meetingViewOptions: -1,
+    );
+    // Same bytes as MeetingOptionsCodec.MatchesDocumentedLayout in
+    // linux/test/meeting_options_codec_test.cc.
+    expect(
+        PackedMeetingOptions.encode(options),
+        Uint8List.fromList([
+          1, 0, 0, 0, // version
+          0x21, 0, 0, 0, // flags
+          0xff, 0xff, 0xff, 0xff, // meeting view options
+          0, 0, 0, 0, // user ID
+          0, 0, 0, 0, // display name
+          2, 0, 0, 0, 0x34, 0x32, // meeting ID
+          0, 0, 0, 0, // meeting password
+          0, 0, 0, 0, // Zoom access token
+        ]));
+  });
+
+  test('length-prefixes UTF-8 strings', () {
+    final options = ZoomMeetingOptions(
+      userId: 'bot',
+      displayName: 'Bot é',
+      meetingId: '1',
+      meetingPassword: '',
+      disableDialIn: 'false',
+      disableDrive: 'false',
+      disableInvite: 'false',
+      disableShare: 'false',
+      noDisconnectAudio: 'false',
+      noAudio: 'false',
+    );
+    final packed = PackedMeetingOptions.encode(options);
+    final data = ByteData.sublistView(packed);
+    expect(data.getUint32(12, Endian.little), 3);
+    // 'é' is two bytes.
+    expect(data.getUint32(19, Endian.little), 6);
+    expect(packed.length, PackedMeetingOptions.headerSize + 5 * 4 + 3 + 6 + 1);
+  });
+}
@@ -0,0 +1,145 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_roster.dart';
+
+// Encodes deltas as linux/roster_delta_codec.cc does.
+ByteData encode(List<RosterDelta> deltas) {
+  final bytes = BytesBuilder();
+  for (final delta in deltas) {
+    final name = utf8.encode(delta.displayName ?? '');
+    final padded = (name.length + 3) & ~3;
+    final header = ByteData(RosterDelta.headerSize)
+      ..setUint64(0, delta.sequence, Endian.little)
+      ..setUint32(8, delta.sessionId, Endian.little)
+      ..setUint32(12, delta.slot, Endian.little)
+      ..setUint32(16, delta.participantId, Endian.little)
+      ..setUint8(20, delta.type.index)
+      ..setUint8(21, delta.changes)
+      ..setUint8(
+          22,
+          (delta.audioMuted ? 1 : 0) |
+              (delta.videoOn ? 2 : 0) |
+              (delta.handRaised ? 4 : 0))
+      ..setUint32(24, name.length, Endian.little);
+    bytes
+      ..add(header.buffer.asUint8List())
+      ..add(name)
+      ..add(Uint8List(padded - name.length));
+  }
+  return ByteData.sublistView(bytes.toBytes());
+}
+
+RosterDelta joined(int sequence, int slot, int participantId,
+        {int sessionId = 1}) =>
+    RosterDelta(
+      sequence: sequence,
+      type: RosterDeltaType.joined,
+      sessionId: sessionId,
+      slot: slot,
+      participantId: participantId,
+      displayName: 'Participant $participantId',
+    );
+
+void main() {
+  test('decodes a batch of deltas', () {
+    final deltas = RosterDelta.decodeAll(encode([
+      joined(1, 0, 16778240),
+      const RosterDelta(
+        sequence: 2,
+        type: RosterDeltaType.changed,
+        sessionId: 1,
+        slot: 0,
+        participantId: 16778240,
+        changes: RosterDelta.nameChanged | RosterDelta.handChanged,
+        handRaised: true,
+        displayName: 'Ünïcode',
+      ),
+      const RosterDelta(
+        sequence: 3,
+        type: RosterDeltaType.left,
+        sessionId: 1,
+        slot: 0,
+        participantId: 16778240,
+      ),
+    ]));
+
+    expect(deltas.map((d) => d.sequence), [1, 2, 3]);
+    expect(deltas[0].displayName, 'Participant 16778240');
+    expect(deltas[1].displayName, 'Ünïcode');
+    expect(deltas[1].handRaised, isTrue);
+    expect(deltas[1].audioMuted, isFalse);
+    expect(deltas[2].type, RosterDeltaType.left);
+    expect(deltas[2].displayName, isNull);
+  });
+
+  test('rejects truncated deltas', () {
+    final data = encode([joined(1, 0, 7)]);
+    expect(() => RosterDelta.decodeAll(ByteData.sublistView(data, 0, 30)),
+        throwsArgumentError);
+  });
+
+  test('applies deltas in order and reports gaps', () {
+    final roster = ParticipantRoster();
+    expect(roster.apply([joined(1, 0, 7), joined(2, 1, 8)]), isTrue);
+    expect(roster.participants.keys, unorderedEquals([0, 1]));
+
+    expect(
+        roster.apply([
+          const RosterDelta(
+            sequence: 3,
+            type: RosterDeltaType.changed,
+            sessionId: 1,
+            slot: 1,
+            participantId: 8,
+            changes: RosterDelta.audioChanged,
+            audioMuted: true,
+          ),
+        ]),
+        isTrue);
+    expect(roster.participants[1]!.audioMuted, isTrue);
+    expect(roster.participants[1]!.displayName, 'Participant 8');
+
+    // Already applied deltas are skipped; a missing one stops the batch.
+    expect(roster.apply([joined(3, 2, 9), joined(5, 2, 9)]), isFalse);
+    expect(roster.sequence, 3);
+    expect(roster.participants, hasLength(2));
+  });
+
+  test('drops every participant of an ended session', () {
+    final roster = ParticipantRoster()
+      ..apply([
+        joined(1, 0, 7),
+        joined(2, 1, 8, sessionId: 2),
+        joined(3, 2, 9),
+        const RosterDelta(
+          sequence: 4,
+          type: RosterDeltaType.sessionEnded,
+          sessionId: 1,
+          slot: 0,
+          participantId: 0,
+        ),
+      ]);
+    expect(roster.participants.keys, [1]);
+    expect(roster.participantsOf(2).single.participantId, 8);
+  });
+
+  test('replaces everything with a full snapshot', () {
+    final roster = ParticipantRoster()..apply([joined(1, 0, 7)]);
+    roster.applySnapshot(RosterSnapshot(
+      sequence: 40,
+      full: true,
+      deltas: [joined(0, 3, 9)],
+    ));
+    expect(roster.sequence, 40);
+    expect(roster.participants.keys, [3]);
+
+    roster.applySnapshot(RosterSnapshot(
+      sequence: 41,
+      full: false,
+      deltas: [joined(41, 4, 10)],
+    ));
+    expect(roster.participants.keys, unorderedEquals([3, 4]));
+  });
+}
@@ -0,0 +1,42 @@
+import 'dart:convert';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:flutter_zoom_meeting_sdk/flutter_zoom_meeting_sdk_trace.dart';
+
+void main() {
+  test('records nothing until started', () async {
+    final recorder = ZoomTraceRecorder();
+    expect(await recorder.span('dart', 'join', () async => true), isTrue);
+    expect(recorder.encodeEvents(1), isEmpty);
+  });
+
+  test('encodes spans as Chrome trace events', () async {
+    final recorder = ZoomTraceRecorder()..start();
+    await recorder.span('dart', 'join', () async => true);
+    await expectLater(
+        recorder.span('dart', 'init', () async => throw StateError('x')),
+        throwsStateError);
+    recorder.stop();
+
+    final events = jsonDecode('[${recorder.encodeEvents(42)}]') as List;
+    expect(events, hasLength(3));
+    expect(events[0]['ph'], 'M');
+    expect(events[0]['args']['name'], 'dart');
+    expect(events[1]['ph'], 'X');
+    expect(events[1]['name'], 'join');
+    expect(events[1]['pid'], 42);
+    expect(events[1]['dur'], greaterThanOrEqualTo(0));
+    // Failed calls are recorded too.
+    expect(events[2]['name'], 'init');
+  });
+
+  test('start discards the previous session', () async {
+    final recorder = ZoomTraceRecorder()..start();
+    await recorder.span('dart', 'first', () async => null);
+    recorder.start();
+    await recorder.span('dart', 'second', () async => null);
+
+    final events = jsonDecode('[${recorder.encodeEvents(1)}]') as List;
+    expect(events.map((event) => event['name']), ['thread_name', 'second']);
+  });
+}